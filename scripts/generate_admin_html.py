@@ -4,8 +4,9 @@ Generate admin_html.h from data/admin.html
 
 This script:
 1. Reads data/admin.html
-2. Compresses it with gzip (level 9)
-3. Generates src/admin_html.h with the compressed data as PROGMEM array
+2. Compresses it with gzip (level 9, no timestamp so output is reproducible)
+3. Generates src/admin_html.h with the compressed data as PROGMEM array,
+   plus a CRC of the source for the page's ETag
 
 Used as a PlatformIO pre-build script.
 """
@@ -13,6 +14,7 @@ Used as a PlatformIO pre-build script.
 import gzip
 import os
 import sys
+import zlib
 
 # When run as PlatformIO script
 try:
@@ -63,9 +65,12 @@ def generate_admin_html(*args, **kwargs):
     original_size = len(content)
 
     # Compress with maximum compression
-    compressed = gzip.compress(content, compresslevel=9)
+    compressed = gzip.compress(content, compresslevel=9, mtime=0)
     compressed_size = len(compressed)
 
+    # Changes with the page even when the firmware version doesn't
+    content_hash = f'{zlib.crc32(content):08x}'
+
     print(f"[admin_html] Original: {original_size} bytes")
     print(f"[admin_html] Compressed: {compressed_size} bytes ({100*compressed_size//original_size}%)")
 
@@ -82,8 +87,10 @@ def generate_admin_html(*args, **kwargs):
         f.write('#define ADMIN_HTML_H\n\n')
         f.write('#include <Arduino.h>\n\n')
         f.write(f'const size_t admin_html_gz_len = {compressed_size};\n')
-        f.write(f'const char* admin_html_version = "{version}";\n\n')
-        f.write('const uint8_t admin_html_gz[] PROGMEM = {\n')
+        f.write(f'const char* admin_html_version = "{version}";\n')
+        f.write(f'const char* admin_html_hash = "{content_hash}";\n\n')
+        f.write('// Word aligned so it can be copied out of flash a word at a time\n')
+        f.write('const uint8_t admin_html_gz[] PROGMEM __attribute__((aligned(4))) = {\n')
 
         # Write bytes in rows of 16
         for i, b in enumerate(compressed):
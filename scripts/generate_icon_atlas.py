@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+"""
+Generate icon_atlas.h - the weather icons, pre-rendered
+
+This script:
+1. Draws every weather icon on a 16x16 pixel-art grid, scaled to each size
+   the screens use (ICON_SIZES)
+2. Crops each to the pixels it covers and run-length encodes it with palette
+   indices instead of colours, so the firmware fills in theme colours
+3. Generates src/icon_atlas.h with the runs and an index as PROGMEM arrays
+
+Used as a PlatformIO pre-build script.
+"""
+
+import os
+
+# When run as PlatformIO script
+try:
+    Import("env")
+    is_platformio = True
+except:
+    is_platformio = False
+
+# Icon sizes drawWeatherIcon() is called with
+ICON_SIZES = [32, 64]
+
+# Palette indices - drawWeatherIcon() maps them to colours at draw time
+PAL_TRANSPARENT = 0
+PAL_SUN = 1          # ICON_SUN
+PAL_CLOUD = 2        # getIconCloud()
+PAL_CLOUD_DARK = 3   # getIconCloudDark()
+PAL_RAIN = 4         # getIconRain()
+PAL_SNOW = 5         # getIconSnow()
+PAL_LIGHTNING = 6    # ICON_LIGHTNING
+PAL_GRAY = 7         # getThemeGray()
+
+PALETTE_NAMES = ['TRANSPARENT', 'SUN', 'CLOUD', 'CLOUD_DARK', 'RAIN', 'SNOW', 'LIGHTNING', 'GRAY']
+
+# Each run is one byte: palette index in the top 3 bits, length - 1 below
+MAX_RUN = 32
+
+
+def get_project_dir():
+    """Get project root directory"""
+    if is_platformio:
+        return env.get("PROJECT_DIR", os.getcwd())
+    # When run standalone, go up from scripts/ to project root
+    return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+# =============================================================================
+# PIXEL-ART ICONS
+# Based on reference: weather-line-icons-pixel-art-set
+# Each icon is drawn at x,y on a 16x16 grid scaled to size. Later drawing
+# covers earlier drawing, as it did on screen.
+# =============================================================================
+
+class Canvas:
+    def __init__(self):
+        self.pixels = {}
+
+    def block(self, x, y, px, py, s, pal):
+        """One grid cell - a scale x scale block"""
+        for yy in range(y + py * s, y + py * s + s):
+            for xx in range(x + px * s, x + px * s + s):
+                self.pixels[(xx, yy)] = pal
+
+
+def draw_sun(c, x, y, size):
+    """Golden circle with rays"""
+    s = size // 16
+    for py in range(6, 10):
+        for px in range(6, 10):
+            c.block(x, y, px, py, s, PAL_SUN)
+    for px, py in [(7, 2), (8, 2), (7, 3), (8, 3),        # Top ray
+                   (7, 12), (8, 12), (7, 13), (8, 13),    # Bottom ray
+                   (2, 7), (2, 8), (3, 7), (3, 8),        # Left ray
+                   (12, 7), (12, 8), (13, 7), (13, 8),    # Right ray
+                   (4, 4), (11, 4), (4, 11), (11, 11)]:   # Diagonal rays
+        c.block(x, y, px, py, s, PAL_SUN)
+
+
+def draw_cloud(c, x, y, size, pal):
+    """Fluffy cloud"""
+    s = size // 16
+    for px in range(5, 9):
+        c.block(x, y, px, 4, s, pal)
+    for px in range(9, 13):
+        c.block(x, y, px, 5, s, pal)
+    for py in range(5, 10):
+        for px in range(3, 14):
+            c.block(x, y, px, py, s, pal)
+    for px in range(2, 14):
+        c.block(x, y, px, 10, s, pal)
+        c.block(x, y, px, 11, s, pal)
+
+
+def draw_rain_drops(c, x, y, size):
+    """Three drops in a row"""
+    s = size // 16
+    for px, py in [(4, 12), (4, 13), (8, 13), (8, 14), (12, 12), (12, 13)]:
+        c.block(x, y, px, py, s, PAL_RAIN)
+
+
+def draw_snow_flakes(c, x, y, size):
+    """Small dots"""
+    s = size // 16
+    for px, py in [(4, 12), (7, 14), (11, 12), (9, 13), (5, 14)]:
+        c.block(x, y, px, py, s, PAL_SNOW)
+
+
+def draw_lightning(c, x, y, size):
+    """Zigzag bolt"""
+    s = size // 16
+    for px, py in [(8, 8), (7, 9), (8, 9), (6, 10), (7, 10), (8, 10), (9, 10),
+                   (7, 11), (8, 11), (6, 12), (7, 12), (5, 13), (6, 13)]:
+        c.block(x, y, px, py, s, PAL_LIGHTNING)
+
+
+def draw_moon(c, x, y, size):
+    """Crescent - full circle minus an offset circle"""
+    s = size // 16
+    for py in range(4, 12):
+        for px in range(5, 11):
+            dx = px - 8
+            dy = py - 8
+            dx2 = px - 6
+            if dx * dx + dy * dy <= 16 and dx2 * dx2 + dy * dy > 9:
+                c.block(x, y, px, py, s, PAL_SUN)
+
+
+def draw_fog(c, x, y, size):
+    """Horizontal lines"""
+    s = size // 16
+    for px in range(3, 13):
+        c.block(x, y, px, 6, s, PAL_GRAY)
+        c.block(x, y, px, 9, s, PAL_GRAY)
+        c.block(x, y, px, 12, s, PAL_GRAY)
+
+
+# Icons in IconId order, each drawn at (0, 0). Drizzle shares the rain icon.
+def icon_clear_day(c, size):
+    draw_sun(c, 0, 0, size)
+
+def icon_clear_night(c, size):
+    draw_moon(c, 0, 0, size)
+
+def icon_partly_day(c, size):
+    draw_sun(c, -(size // 8), -(size // 8), size * 3 // 4)
+    draw_cloud(c, size // 8, size // 4, size * 3 // 4, PAL_CLOUD)
+
+def icon_partly_night(c, size):
+    draw_moon(c, -(size // 8), -(size // 8), size * 3 // 4)
+    draw_cloud(c, size // 8, size // 4, size * 3 // 4, PAL_CLOUD)
+
+def icon_cloudy(c, size):
+    draw_cloud(c, 0, 0, size, PAL_CLOUD)
+
+def icon_fog(c, size):
+    draw_fog(c, 0, 0, size)
+
+def icon_rain(c, size):
+    draw_cloud(c, 0, -(size // 8), size, PAL_CLOUD)
+    draw_rain_drops(c, 0, 0, size)
+
+def icon_freezing_rain(c, size):
+    draw_cloud(c, 0, -(size // 8), size, PAL_CLOUD_DARK)
+    draw_rain_drops(c, 0, 0, size)
+    draw_snow_flakes(c, size // 4, 0, size)
+
+def icon_snow(c, size):
+    draw_cloud(c, 0, -(size // 8), size, PAL_CLOUD)
+    draw_snow_flakes(c, 0, 0, size)
+
+def icon_thunderstorm(c, size):
+    draw_cloud(c, 0, -(size // 8), size, PAL_CLOUD_DARK)
+    draw_lightning(c, 0, 0, size)
+    draw_rain_drops(c, size // 4, 0, size)
+
+def icon_unknown(c, size):
+    draw_cloud(c, 0, 0, size, PAL_GRAY)
+
+ICONS = [
+    ('CLEAR_DAY', icon_clear_day),
+    ('CLEAR_NIGHT', icon_clear_night),
+    ('PARTLY_CLOUDY_DAY', icon_partly_day),
+    ('PARTLY_CLOUDY_NIGHT', icon_partly_night),
+    ('CLOUDY', icon_cloudy),
+    ('FOG', icon_fog),
+    ('RAIN', icon_rain),
+    ('FREEZING_RAIN', icon_freezing_rain),
+    ('SNOW', icon_snow),
+    ('THUNDERSTORM', icon_thunderstorm),
+    ('UNKNOWN', icon_unknown),
+]
+
+
+def encode_icon(canvas):
+    """Crop to the drawn pixels and run-length encode them row by row"""
+    xs = [p[0] for p in canvas.pixels]
+    ys = [p[1] for p in canvas.pixels]
+    x0, y0 = min(xs), min(ys)
+    w, h = max(xs) - x0 + 1, max(ys) - y0 + 1
+
+    # Runs continue across row ends, so the panel can take the icon as one stream
+    runs = []
+    pal, length = None, 0
+    for y in range(y0, y0 + h):
+        for x in range(x0, x0 + w):
+            p = canvas.pixels.get((x, y), PAL_TRANSPARENT)
+            if p == pal and length < MAX_RUN:
+                length += 1
+            else:
+                if pal is not None:
+                    runs.append((pal << 5) | (length - 1))
+                pal, length = p, 1
+    runs.append((pal << 5) | (length - 1))
+    return x0, y0, w, h, runs
+
+
+def generate_icon_atlas(*args, **kwargs):
+    """Generate icon_atlas.h"""
+    project_dir = get_project_dir()
+    output_file = os.path.join(project_dir, 'src', 'icon_atlas.h')
+
+    print(f"[icon_atlas] Generating {output_file}")
+
+    entries = []
+    data = []
+    for icon_id, (name, draw) in enumerate(ICONS):
+        for size in ICON_SIZES:
+            canvas = Canvas()
+            draw(canvas, size)
+            x0, y0, w, h, runs = encode_icon(canvas)
+            entries.append((name, icon_id, size, x0, y0, w, h, len(data), len(runs)))
+            data.extend(runs)
+
+    print(f"[icon_atlas] {len(entries)} icons, {len(data)} bytes of runs")
+
+    with open(output_file, 'w') as f:
+        f.write('/**\n')
+        f.write(' * Auto-generated weather icon atlas\n')
+        f.write(' * DO NOT EDIT - this file is generated by scripts/generate_icon_atlas.py\n')
+        f.write(' *\n')
+        f.write(f' * Sizes: {", ".join(str(s) for s in ICON_SIZES)}\n')
+        f.write(f' * Run data: {len(data)} bytes\n')
+        f.write(' */\n\n')
+        f.write('#ifndef ICON_ATLAS_H\n')
+        f.write('#define ICON_ATLAS_H\n\n')
+        f.write('#include <Arduino.h>\n\n')
+
+        f.write('// Palette indices, mapped to theme colours when drawn\n')
+        for i, name in enumerate(PALETTE_NAMES):
+            f.write(f'#define ICON_PAL_{name} {i}\n')
+        f.write('#define ICON_PAL_COUNT 8\n\n')
+
+        f.write('// Each run byte: palette index << 5 | (length - 1)\n')
+        f.write('#define ICON_RUN_PAL(b) ((b) >> 5)\n')
+        f.write('#define ICON_RUN_LEN(b) (((b) & 0x1F) + 1)\n\n')
+
+        f.write('enum IconId : uint8_t {\n')
+        for name, _ in ICONS:
+            f.write(f'    ICON_ID_{name},\n')
+        f.write('    ICON_ID_COUNT\n')
+        f.write('};\n\n')
+
+        f.write('// Pre-rendered icon: runs cover a w x h box at (x + dx, y + dy)\n')
+        f.write('struct IconAtlasEntry {\n')
+        f.write('    uint8_t id;\n')
+        f.write('    uint8_t size;       // Size drawWeatherIcon() was asked for\n')
+        f.write('    int8_t dx, dy;\n')
+        f.write('    uint8_t w, h;\n')
+        f.write('    uint16_t offset;    // First run in icon_atlas_runs\n')
+        f.write('    uint16_t length;    // Run bytes\n')
+        f.write('};\n\n')
+
+        f.write(f'const uint8_t icon_atlas_count = {len(entries)};\n\n')
+        f.write('const IconAtlasEntry icon_atlas[] PROGMEM = {\n')
+        for name, icon_id, size, x0, y0, w, h, offset, length in entries:
+            f.write(f'    {{ICON_ID_{name}, {size}, {x0}, {y0}, {w}, {h}, {offset}, {length}}},\n')
+        f.write('};\n\n')
+
+        f.write('const uint8_t icon_atlas_runs[] PROGMEM = {\n')
+        # Write bytes in rows of 16
+        for i, b in enumerate(data):
+            if i % 16 == 0:
+                f.write('    ')
+            f.write(f'0x{b:02x}')
+            if i < len(data) - 1:
+                f.write(', ')
+            if i % 16 == 15:
+                f.write('\n')
+        if len(data) % 16 != 0:
+            f.write('\n')
+        f.write('};\n\n')
+        f.write('#endif // ICON_ATLAS_H\n')
+
+    print(f"[icon_atlas] Generated {output_file}")
+
+# Run immediately when loaded as pre: script (before compilation)
+if is_platformio:
+    generate_icon_atlas()
+
+# Allow running standalone for testing
+if __name__ == "__main__":
+    generate_icon_atlas()
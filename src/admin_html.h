@@ -2,8 +2,8 @@
  * Auto-generated from data/admin.html
  * DO NOT EDIT - this file is generated by scripts/generate_admin_html.py
  *
- * Original size: 91726 bytes
- * Compressed size: 21538 bytes
+ * Original size: 95107 bytes
+ * Compressed size: 22546 bytes
  */
 
 #ifndef ADMIN_HTML_H
@@ -11,1356 +11,1421 @@
 
 #include <Arduino.h>
 
-const size_t admin_html_gz_len = 21538;
+const size_t admin_html_gz_len = 22546;
 const char* admin_html_version = "1.10.12";
+const char* admin_html_hash = "2f9ed353";
 
-const uint8_t admin_html_gz[] PROGMEM = {
-    0x1f, 0x8b, 0x08, 0x00, 0xb5, 0xb8, 0x51, 0x69, 0x02, 0xff, 0xed, 0xbd, 0xdb, 0x76, 0x1b, 0xc9, 
-    0x92, 0x18, 0xfa, 0xce, 0xaf, 0x48, 0xa1, 0xbb, 0x37, 0x80, 0x4d, 0xdc, 0x41, 0x90, 0x14, 0x29, 
-    0xb2, 0x87, 0x57, 0x91, 0x92, 0x48, 0x51, 0x22, 0x75, 0x6b, 0x6d, 0x79, 0x77, 0x01, 0x28, 0x00, 
-    0x25, 0x16, 0x50, 0xe8, 0xaa, 0x02, 0x49, 0x88, 0xc3, 0x17, 0x9f, 0xe3, 0x47, 0x5f, 0xd6, 0xf2, 
-    0x5a, 0x63, 0x3f, 0x1c, 0x2f, 0xbf, 0x9c, 0x0f, 0x98, 0x27, 0x2f, 0x3f, 0xf8, 0xc9, 0xe7, 0x4f, 
-    0xe6, 0x07, 0xec, 0x4f, 0x38, 0x11, 0x91, 0x97, 0xca, 0xac, 0x2a, 0x5c, 0xc5, 0x9e, 0x69, 0xdb, 
-    0xd3, 0x7b, 0x8b, 0x00, 0xaa, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x9e, 
-    0x3d, 0x39, 0x7c, 0x7d, 0x70, 0xf5, 0xe9, 0xe2, 0x88, 0xf5, 0xc2, 0xbe, 0xbb, 0xbb, 0xf2, 0x0c, 
-    0x3f, 0x98, 0x6b, 0x0d, 0xba, 0x3b, 0x19, 0x7b, 0x90, 0xc1, 0x07, 0xb6, 0xd5, 0x86, 0x8f, 0xbe, 
-    0x1d, 0x5a, 0xac, 0xd5, 0xb3, 0xfc, 0xc0, 0x0e, 0x77, 0x32, 0xef, 0xae, 0x8e, 0x8b, 0x9b, 0x19, 
-    0xf9, 0x78, 0x60, 0xf5, 0xed, 0x9d, 0xcc, 0x8d, 0x63, 0xdf, 0x0e, 0x3d, 0x3f, 0xcc, 0xb0, 0x96, 
-    0x37, 0x08, 0xed, 0x01, 0x14, 0xbb, 0x75, 0xda, 0x61, 0x6f, 0xa7, 0x6d, 0xdf, 0x38, 0x2d, 0xbb, 
-    0x48, 0x3f, 0x0a, 0xce, 0xc0, 0x09, 0x1d, 0xcb, 0x2d, 0x06, 0x2d, 0xcb, 0xb5, 0x77, 0xaa, 0x08, 
-    0x23, 0x74, 0x42, 0xd7, 0xde, 0x3d, 0x1a, 0x3a, 0xad, 0x0f, 0xb6, 0x15, 0xf6, 0x6c, 0x7f, 0xdf, 
-    0xbb, 0x63, 0x7b, 0xed, 0xbe, 0x33, 0x78, 0x56, 0xe6, 0xef, 0x56, 0x9e, 0x3d, 0x29, 0x16, 0xd9, 
-    0xe5, 0x68, 0xc0, 0x3a, 0x16, 0xc0, 0xf2, 0x06, 0xac, 0xc8, 0x3a, 0xf0, 0xab, 0x67, 0x0d, 0x87, 
-    0x63, 0x16, 0xc0, 0x37, 0x7c, 0xf8, 0x84, 0x15, 0x8b, 0x50, 0xd4, 0x75, 0x06, 0xd7, 0xcc, 0xb7, 
-    0xdd, 0x9d, 0x0c, 0x3e, 0xcc, 0xb0, 0x70, 0x3c, 0x04, 0xec, 0x9c, 0xbe, 0xd5, 0xb5, 0xcb, 0xc1, 
-    0x4d, 0x77, 0xf5, 0xae, 0xef, 0x66, 0x58, 0xcf, 0xb7, 0x3b, 0x3b, 0x99, 0xb6, 0x15, 0x5a, 0x5b, 
-    0xc6, 0x9b, 0xc2, 0x4f, 0xf5, 0x03, 0xf8, 0xca, 0xe0, 0xeb, 0x20, 0xd8, 0xc9, 0xf6, 0xc2, 0x70, 
-    0xb8, 0x55, 0x2e, 0xdf, 0xde, 0xde, 0x96, 0x6e, 0xeb, 0x25, 0xcf, 0xef, 0x96, 0x6b, 0x95, 0x4a, 
-    0x05, 0x0b, 0x67, 0x19, 0xf6, 0x17, 0x30, 0xdd, 0xc9, 0x56, 0x58, 0x85, 0xad, 0xaf, 0xc1, 0xff, 
-    0xb3, 0x3f, 0xd5, 0x8f, 0xa0, 0x7e, 0xcb, 0xf1, 0x5b, 0xae, 0xcd, 0x5a, 0xf0, 0xaa, 0x5e, 0xcb, 
-    0xb2, 0xd6, 0x98, 0x7f, 0xfa, 0xf0, 0x51, 0xc9, 0xb2, 0x8e, 0xe3, 0xba, 0x3b, 0xd9, 0x9f, 0x6a, 
-    0xf5, 0xaa, 0x55, 0xb5, 0x6a, 0x76, 0xb6, 0xcc, 0x2b, 0x75, 0xa3, 0x17, 0xc7, 0xc7, 0x87, 0x4f, 
-    0xeb, 0x87, 0x59, 0x16, 0x84, 0xbe, 0x77, 0x6d, 0xa7, 0x3c, 0xe2, 0xa4, 0xdc, 0xc9, 0xd6, 0xd4, 
-    0x03, 0xe8, 0xb3, 0xdd, 0xb2, 0x86, 0x3b, 0x59, 0xdf, 0x1b, 0x0d, 0xda, 0x02, 0x0f, 0x7c, 0xc8, 
-    0xee, 0xaa, 0xbc, 0xf5, 0x31, 0x7c, 0x6e, 0x66, 0xd9, 0x5d, 0x4d, 0xfc, 0x84, 0xcf, 0x6a, 0x43, 
-    0x36, 0xae, 0x4a, 0xae, 0x3d, 0xe5, 0x25, 0xe1, 0x15, 0x15, 0x5d, 0x5b, 0xe3, 0x45, 0x6b, 0x95, 
-    0x44, 0xd1, 0xc6, 0x3a, 0x2f, 0x8a, 0xd0, 0xa8, 0xe8, 0x53, 0x5e, 0x14, 0x7e, 0x4f, 0x82, 0x8a, 
-    0x9f, 0x3a, 0x54, 0xf8, 0x2c, 0x4f, 0x40, 0x15, 0xa1, 0xeb, 0xb8, 0x42, 0xd5, 0x78, 0x51, 0xc4, 
-    0x51, 0x87, 0x0a, 0x38, 0x4e, 0x82, 0xba, 0x69, 0xa2, 0x4a, 0x35, 0xd3, 0x51, 0x95, 0x40, 0x25, 
-    0x01, 0x24, 0xd0, 0x88, 0x00, 0xe5, 0x2e, 0xff, 0x6c, 0xdb, 0x9d, 0x80, 0x7f, 0xf3, 0xad, 0x36, 
-    0x70, 0xf4, 0x73, 0xfc, 0x00, 0xae, 0x67, 0x4e, 0x7b, 0x27, 0x1b, 0x00, 0x7f, 0xe0, 0xf8, 0xaf, 
-    0x55, 0x7e, 0xaa, 0x35, 0x38, 0x0b, 0xf0, 0xaf, 0xbc, 0x46, 0x10, 0x7a, 0x43, 0xe6, 0x75, 0x3a, 
-    0x38, 0x97, 0xb2, 0xbc, 0x08, 0x3e, 0x2a, 0xb6, 0x3c, 0xd7, 0xf3, 0xc5, 0x80, 0x1f, 0xad, 0xaf, 
-    0x1f, 0xca, 0x36, 0x8d, 0xf2, 0xd5, 0xca, 0x84, 0x1a, 0xc4, 0x22, 0x12, 0x4b, 0x13, 0x29, 0xf1, 
-    0x30, 0xc2, 0x79, 0x32, 0x8f, 0x56, 0xd7, 0x24, 0x8f, 0x8e, 0x7c, 0x37, 0x07, 0x80, 0x83, 0x6e, 
-    0x5e, 0x42, 0xd5, 0x6a, 0xd5, 0x36, 0x78, 0xad, 0xda, 0x53, 0xaa, 0x55, 0xcb, 0xea, 0xfc, 0xfb, 
-    0xb4, 0x51, 0xa9, 0xa4, 0xd4, 0xa9, 0xcf, 0x5b, 0x67, 0x08, 0x62, 0x80, 0x01, 0x19, 0xcf, 0x6a, 
-    0xeb, 0xac, 0xbe, 0xfe, 0xa6, 0x5e, 0x63, 0x6b, 0x35, 0x56, 0xdf, 0x84, 0xef, 0xb1, 0x59, 0x41, 
-    0x95, 0x92, 0xb3, 0x82, 0x83, 0x1d, 0x78, 0x03, 0x7b, 0xd2, 0x0c, 0x91, 0x64, 0x82, 0x99, 0x0c, 
-    0xdf, 0x32, 0x42, 0xc2, 0x38, 0xaf, 0x2f, 0x59, 0xcf, 0xeb, 0xdb, 0x2c, 0x68, 0xf9, 0xb6, 0xcd, 
-    0xa5, 0x0a, 0xcb, 0xf5, 0x47, 0x41, 0xc8, 0x9a, 0x36, 0xbb, 0x38, 0x7f, 0x5e, 0x60, 0x03, 0x2f, 
-    0x64, 0x97, 0xef, 0x9f, 0xe7, 0xe3, 0xb2, 0x06, 0x24, 0x91, 0x6b, 0x17, 0x43, 0x6f, 0xd4, 0xea, 
-    0x15, 0xb9, 0xdc, 0x49, 0x88, 0x98, 0xe1, 0xa0, 0xbb, 0xdd, 0xb4, 0x02, 0x7b, 0x7d, 0xad, 0xe0, 
-    0xbc, 0xdf, 0x7f, 0xfd, 0xf6, 0xb6, 0xf2, 0xf2, 0x79, 0xd7, 0xdb, 0x83, 0xff, 0xce, 0x2f, 0xdf, 
-    0xf5, 0x8e, 0xde, 0x75, 0xe1, 0xdb, 0xab, 0x37, 0xf0, 0xe7, 0xa0, 0x72, 0xb0, 0x77, 0x8a, 0x9f, 
-    0x63, 0xbf, 0x71, 0xec, 0xc2, 0x97, 0xc3, 0xcd, 0x23, 0xf7, 0xe8, 0xcd, 0xfb, 0xb7, 0x6b, 0xb5, 
-    0x51, 0xbd, 0x5d, 0xaf, 0x9f, 0xbc, 0x3b, 0xdb, 0x3f, 0xd8, 0x6b, 0xfd, 0x52, 0x7b, 0xfe, 0x7e, 
-    0xad, 0x59, 0xaf, 0xec, 0x9d, 0x1f, 0x1e, 0x34, 0x2e, 0xdf, 0xbc, 0x71, 0x5f, 0x9c, 0x1f, 0x5c, 
-    0x5f, 0xbf, 0x08, 0x8f, 0xf6, 0xae, 0x8e, 0xcf, 0x0e, 0x01, 0xd0, 0xe6, 0xd1, 0xd9, 0xab, 0x93, 
-    0x8b, 0x72, 0xbd, 0xfe, 0x61, 0xe3, 0xa6, 0xb6, 0x3a, 0x5c, 0x7d, 0xd3, 0xbf, 0x70, 0xeb, 0xb5, 
-    0x8b, 0xdf, 0x9e, 0x5e, 0x7f, 0x78, 0xdf, 0x68, 0x9f, 0xf4, 0xd6, 0x56, 0x8f, 0x3f, 0x1c, 0x9c, 
-    0xbe, 0xec, 0xbe, 0xe9, 0xee, 0x6f, 0x76, 0xf7, 0x5b, 0xde, 0x5e, 0xeb, 0x74, 0xaf, 0x73, 0xba, 
-    0xf7, 0xf1, 0xe5, 0xde, 0xc9, 0xc1, 0xde, 0xc9, 0x78, 0xef, 0xf9, 0x9b, 0xbd, 0xd5, 0x37, 0x7b, 
-    0xaf, 0xdf, 0xed, 0xbd, 0xbe, 0xde, 0xbb, 0xb8, 0xde, 0x3b, 0x74, 0xf7, 0x0e, 0x87, 0x7b, 0x87, 
-    0x8d, 0xbd, 0x43, 0xad, 0xcc, 0xf1, 0xb8, 0xbb, 0x7f, 0xcb, 0xeb, 0x77, 0x0f, 0x79, 0x99, 0xd1, 
-    0xb7, 0xd3, 0xd7, 0xe3, 0x23, 0x6f, 0xf8, 0xf1, 0x5b, 0x79, 0x75, 0x74, 0x72, 0xfe, 0xf2, 0x6e, 
-    0xb5, 0x5c, 0xde, 0xdf, 0xfb, 0xd0, 0x7f, 0xa3, 0xc3, 0xd8, 0x6b, 0xbc, 0xd9, 0x5b, 0xe7, 0xf0, 
-    0xdf, 0xec, 0x73, 0x18, 0xab, 0x8d, 0x5f, 0xbe, 0xde, 0x6c, 0x9c, 0xb7, 0x5f, 0x1c, 0x7e, 0x1d, 
-    0xdc, 0xb9, 0xbf, 0x94, 0x3f, 0x7c, 0x2d, 0x97, 0xd7, 0xbd, 0xde, 0xa7, 0x61, 0xe7, 0xe2, 0xeb, 
-    0xdd, 0xa1, 0x5d, 0x1d, 0xf7, 0x06, 0xef, 0x2f, 0x3f, 0x95, 0xbd, 0xc1, 0xd7, 0xce, 0x6f, 0xfb, 
-    0xe3, 0xc3, 0xdf, 0xca, 0x6f, 0xc7, 0xab, 0xfb, 0x27, 0xa7, 0xab, 0x75, 0x6b, 0xc3, 0xfd, 0xe5, 
-    0xed, 0xea, 0xe1, 0xc9, 0xc6, 0xea, 0x2f, 0xa1, 0xed, 0x7f, 0xec, 0xf9, 0x9d, 0xf7, 0xdf, 0x7e, 
-    0xf9, 0x70, 0xfe, 0xe2, 0xe2, 0xe9, 0xab, 0xf5, 0x6a, 0x67, 0xfc, 0x5b, 0xf3, 0xc5, 0xc9, 0xdd, 
-    0x51, 0x78, 0xf8, 0x6d, 0xef, 0x85, 0x1b, 0x1c, 0x5c, 0x78, 0x17, 0xd7, 0x37, 0x77, 0xdd, 0xbb, 
-    0xa1, 0x75, 0x58, 0x76, 0x9e, 0x7a, 0xe3, 0x8f, 0x6f, 0x4e, 0x6e, 0x7e, 0x39, 0xb9, 0x3b, 0x71, 
-    0x2f, 0x5b, 0xaf, 0x5f, 0xdb, 0x17, 0x9b, 0xde, 0xa7, 0xf5, 0x5f, 0x4e, 0x5b, 0xa3, 0xdb, 0xf7, 
-    0xeb, 0x4f, 0xdf, 0x0d, 0x7f, 0x69, 0xd8, 0xcf, 0xf7, 0xbc, 0x5a, 0xbf, 0xbb, 0xd9, 0xbf, 0x3b, 
-    0xb3, 0x4f, 0x0f, 0xef, 0x36, 0x36, 0xca, 0x17, 0x27, 0x27, 0x67, 0xdf, 0x6a, 0xab, 0x1b, 0xe1, 
-    0xdb, 0x8f, 0xe1, 0x6b, 0x67, 0x64, 0x9f, 0x1c, 0xdc, 0x38, 0xe5, 0x9b, 0xe6, 0xcd, 0x8b, 0xb5, 
-    0x0f, 0x9f, 0x5e, 0x6c, 0xfe, 0x76, 0x70, 0xdc, 0x3f, 0xb7, 0xbb, 0x9f, 0xec, 0x77, 0x9f, 0xaa, 
-    0x27, 0x95, 0x72, 0xf9, 0xe6, 0x55, 0xf5, 0xfd, 0xb0, 0xf5, 0xee, 0xc3, 0xd5, 0xea, 0xe5, 0xe1, 
-    0xc0, 0xa9, 0x1f, 0xdd, 0xbd, 0x7b, 0xdd, 0xf1, 0x3b, 0x6f, 0xae, 0xca, 0xeb, 0xab, 0xb5, 0xe0, 
-    0xee, 0x4d, 0xe3, 0xf8, 0x2c, 0xa8, 0x5b, 0xfb, 0x0d, 0xbb, 0xb7, 0x7a, 0x54, 0x3b, 0xef, 0x6f, 
-    0xbc, 0xdc, 0x38, 0xbe, 0x3e, 0x38, 0xfd, 0xda, 0x09, 0x2e, 0xc3, 0x46, 0x6f, 0x7f, 0xe3, 0x45, 
-    0xfb, 0xeb, 0xcd, 0xe8, 0xc5, 0xd3, 0xfe, 0xdb, 0x51, 0xe7, 0xe9, 0xa8, 0xf2, 0xa2, 0x72, 0x51, 
-    0x29, 0x7b, 0xaf, 0x7b, 0xab, 0x77, 0x67, 0x9b, 0xed, 0x4f, 0xaf, 0xbf, 0xba, 0x96, 0xb3, 0x7e, 
-    0xf4, 0x6e, 0xd3, 0xf9, 0xa5, 0xfc, 0xf6, 0xe5, 0xe6, 0xde, 0x75, 0xa5, 0xf6, 0xba, 0xb5, 0x39, 
-    0x5e, 0x5b, 0xbb, 0xb6, 0xef, 0xae, 0x5e, 0xec, 0xfd, 0x52, 0xbf, 0x5c, 0xeb, 0x57, 0xd6, 0x5f, 
-    0x5e, 0x8f, 0xbb, 0x77, 0xab, 0x2f, 0x5e, 0xd8, 0x5f, 0x0f, 0xae, 0x2e, 0x2e, 0x57, 0xdf, 0x3f, 
-    0x7f, 0xf5, 0x4b, 0xfb, 0xdb, 0xf1, 0x9b, 0xbb, 0x8f, 0xc3, 0xbb, 0xbb, 0xdb, 0x70, 0x78, 0x5a, 
-    0xff, 0x70, 0x11, 0xf4, 0xdb, 0xe3, 0xa7, 0xc7, 0x6f, 0x7a, 0x8d, 0x97, 0xa3, 0xd6, 0xfa, 0xf5, 
-    0xfa, 0xf1, 0x8b, 0xea, 0xab, 0xf5, 0xfe, 0xba, 0xfb, 0xed, 0xea, 0x8d, 0x7d, 0x53, 0xbf, 0xb8, 
-    0x3b, 0x3d, 0x7c, 0x37, 0x1e, 0x87, 0x27, 0x9e, 0x75, 0x70, 0xf1, 0x76, 0x7c, 0x74, 0xd1, 0x7f, 
-    0x73, 0xd4, 0x5f, 0xaf, 0x3d, 0x6f, 0x0f, 0x6b, 0x83, 0x5e, 0xa3, 0x73, 0x53, 0xef, 0x6d, 0x7e, 
-    0x70, 0xef, 0xae, 0xd7, 0x47, 0x17, 0x87, 0x1f, 0x6f, 0x2e, 0x1a, 0x1f, 0xd6, 0x6b, 0xd5, 0x8b, 
-    0xaf, 0x1b, 0xd5, 0x8f, 0xbf, 0x94, 0x07, 0x9d, 0xeb, 0x6a, 0xf3, 0xdb, 0xe0, 0x43, 0x1f, 0x78, 
-    0x67, 0xfc, 0xe2, 0xb4, 0xf6, 0xc2, 0x2d, 0x77, 0xd6, 0xab, 0xbd, 0xf1, 0xe8, 0x68, 0xe3, 0x85, 
-    0x1d, 0xd4, 0x9c, 0x0f, 0x95, 0xa3, 0xc3, 0xbd, 0xa7, 0x2f, 0xcf, 0x87, 0x9b, 0xeb, 0xfd, 0x4a, 
-    0x67, 0xe3, 0x6b, 0xa5, 0xbe, 0x77, 0x73, 0xf6, 0xbc, 0xfd, 0x66, 0x64, 0xbf, 0xff, 0xd4, 0x72, 
-    0x0e, 0x3f, 0xfd, 0xf6, 0xee, 0xe5, 0xeb, 0xb5, 0xb7, 0xe7, 0x4f, 0xeb, 0xef, 0xbf, 0x1d, 0xbb, 
-    0xfd, 0x73, 0xf7, 0x6b, 0xff, 0xe0, 0x65, 0xfd, 0xa2, 0xf1, 0xe9, 0xfd, 0x38, 0xe8, 0xee, 0x57, 
-    0xc7, 0xa1, 0x7b, 0x1c, 0xbe, 0x6b, 0xdc, 0x1e, 0x35, 0x8e, 0x2e, 0x5e, 0xbc, 0xab, 0x58, 0x95, 
-    0xae, 0x7b, 0x37, 0xbe, 0x19, 0x56, 0x6b, 0x37, 0x8d, 0xeb, 0xf5, 0xaf, 0xbd, 0x57, 0x55, 0xf7, 
-    0x55, 0xfd, 0x35, 0xe7, 0xd1, 0xfd, 0xe3, 0x41, 0x6d, 0xff, 0x79, 0xe3, 0x95, 0x77, 0x71, 0xd6, 
-    0xfd, 0x74, 0x37, 0xbe, 0x3a, 0xb0, 0x2f, 0xdc, 0xd5, 0xce, 0x61, 0xb5, 0x36, 0x3a, 0x3f, 0xbf, 
-    0x7b, 0xbe, 0x39, 0x38, 0xba, 0x39, 0xbf, 0xf9, 0x76, 0x75, 0xfb, 0xfa, 0x10, 0x48, 0x7c, 0xf4, 
-    0xe6, 0xee, 0xcd, 0xc6, 0x6f, 0x4f, 0x3f, 0xde, 0x3d, 0xed, 0x9c, 0xf9, 0x5f, 0x37, 0xec, 0x9b, 
-    0xa3, 0xc6, 0xf9, 0xf5, 0xe5, 0x2f, 0x3d, 0xc7, 0x6d, 0x58, 0x6b, 0x2f, 0xcf, 0xfd, 0xcb, 0xd6, 
-    0xd3, 0x4f, 0xdd, 0x8f, 0x1f, 0xcb, 0x17, 0xf6, 0xd9, 0xc7, 0xf1, 0x69, 0xf0, 0x66, 0xf3, 0xf9, 
-    0xda, 0xdd, 0xc7, 0xb5, 0xe0, 0xf8, 0xc3, 0xc7, 0xe3, 0xfe, 0xfa, 0x1b, 0xef, 0x64, 0xd8, 0x3e, 
-    0xfd, 0x3a, 0x78, 0xbf, 0xea, 0xee, 0x9d, 0x7f, 0x38, 0xbc, 0xad, 0xbe, 0xf7, 0x9d, 0xf7, 0x27, 
-    0xb7, 0xb7, 0x9b, 0x3e, 0x8c, 0xeb, 0xe9, 0xe5, 0x79, 0xf3, 0xc5, 0xbb, 0xc1, 0xd9, 0xf8, 0xea, 
-    0xae, 0x7e, 0x39, 0x7a, 0xb3, 0xfa, 0xad, 0xf9, 0xea, 0xed, 0x75, 0xe0, 0xb4, 0x5f, 0xbe, 0x3f, 
-    0xad, 0x54, 0xde, 0xff, 0x72, 0x62, 0xdd, 0xbd, 0xd9, 0xdc, 0xf8, 0xf6, 0xf6, 0xad, 0x5b, 0xee, 
-    0x75, 0x6b, 0xef, 0x1b, 0x55, 0xeb, 0xf8, 0xd3, 0xb7, 0x73, 0xf7, 0x45, 0x7b, 0xe3, 0xe5, 0xd5, 
-    0xfb, 0x46, 0xed, 0x6b, 0xed, 0x63, 0xfb, 0x79, 0xf3, 0xfa, 0xb7, 0xcb, 0x4f, 0x6b, 0x1b, 0x67, 
-    0xed, 0xf0, 0xf8, 0x62, 0x70, 0x55, 0x39, 0xbb, 0x7c, 0xfe, 0x6a, 0xf5, 0xcd, 0xda, 0xd9, 0x87, 
-    0xd6, 0x59, 0xb3, 0x36, 0xbc, 0x0b, 0xf7, 0xcb, 0x1f, 0xfd, 0xaa, 0xbf, 0x51, 0xed, 0x0d, 0xbf, 
-    0x9d, 0xbf, 0xba, 0xbc, 0xaa, 0x8e, 0xaf, 0x37, 0xce, 0x3f, 0x7c, 0xb4, 0xbe, 0x6e, 0xb6, 0xec, 
-    0x66, 0xf9, 0x97, 0xb5, 0xe0, 0x5b, 0x78, 0x1d, 0x5c, 0x8d, 0xae, 0x3b, 0x1f, 0x3e, 0x86, 0x2f, 
-    0x6b, 0xe1, 0x89, 0xf5, 0x35, 0xbc, 0xbc, 0xde, 0x3c, 0xb7, 0x9f, 0x8e, 0xde, 0x9e, 0x9e, 0xd8, 
-    0x1f, 0xd6, 0x06, 0x1b, 0xb7, 0x63, 0xaf, 0xf1, 0xed, 0xee, 0xc3, 0xf3, 0xf1, 0xe9, 0xea, 0xa7, 
-    0xf2, 0xcb, 0xc3, 0x93, 0xc6, 0x91, 0x7b, 0x79, 0x71, 0x3e, 0x38, 0x3a, 0x3e, 0xba, 0x68, 0x78, 
-    0x76, 0xeb, 0xe9, 0xb7, 0xcb, 0xaf, 0x27, 0x8d, 0xe6, 0xdb, 0x6f, 0x6f, 0xde, 0x8d, 0xcb, 0x1f, 
-    0x5f, 0x1e, 0x5e, 0x5c, 0x7f, 0x1d, 0xf4, 0xbe, 0x3d, 0x7d, 0xfd, 0xda, 0x5a, 0x3b, 0x7d, 0xbb, 
-    0x71, 0xfa, 0xf5, 0xce, 0x73, 0xbf, 0x0e, 0xfb, 0x1f, 0x2e, 0xaf, 0xaf, 0xee, 0x6e, 0x3c, 0xeb, 
-    0xf4, 0xd3, 0x46, 0x63, 0xfd, 0x93, 0xf3, 0x7c, 0xd3, 0xdf, 0x1c, 0x0e, 0x36, 0xdb, 0x8d, 0xab, 
-    0xa7, 0xfe, 0xed, 0x20, 0x4d, 0xce, 0x28, 0x39, 0x00, 0x72, 0xe6, 0x78, 0x6f, 0x74, 0x76, 0xfa, 
-    0xf1, 0xf5, 0x0c, 0xf9, 0xb3, 0xd7, 0xe8, 0xed, 0x1d, 0x4e, 0x97, 0x25, 0x5a, 0x3b, 0x5d, 0xeb, 
-    0xdb, 0xe6, 0x5e, 0xe0, 0x1c, 0xad, 0x6d, 0xb6, 0x0e, 0x4f, 0x9e, 0x07, 0xaf, 0x50, 0xe0, 0xee, 
-    0x1d, 0xb9, 0xc7, 0x57, 0xd7, 0x30, 0x0c, 0xfd, 0x83, 0x03, 0x29, 0xfc, 0xf7, 0x06, 0x6d, 0xdf, 
-    0x73, 0xda, 0xe5, 0x8b, 0x0f, 0x7b, 0x0c, 0x16, 0xda, 0xd0, 0x19, 0x74, 0x03, 0x2e, 0xe5, 0x35, 
-    0x25, 0x17, 0xd4, 0xd3, 0xbe, 0xcd, 0x57, 0x5d, 0x4d, 0xcf, 0xfd, 0x81, 0xeb, 0x72, 0x31, 0x85, 
-    0xb8, 0xef, 0x35, 0x1d, 0x58, 0x13, 0x6e, 0xed, 0x66, 0x11, 0x56, 0x87, 0x22, 0xac, 0x3e, 0x56, 
-    0xd3, 0xb5, 0xb5, 0x6a, 0x63, 0x3b, 0x88, 0x55, 0xe1, 0xab, 0xc8, 0x63, 0x55, 0x0c, 0x42, 0x2b, 
-    0x1c, 0x05, 0xc5, 0xa6, 0xe5, 0xc3, 0xd7, 0xb1, 0x01, 0xa1, 0xe9, 0x5a, 0xad, 0xeb, 0x62, 0xe8, 
-    0x5b, 0x83, 0xc0, 0x1d, 0xb5, 0xe0, 0xd1, 0x3c, 0xf0, 0x48, 0x19, 0xd7, 0x80, 0x44, 0xea, 0x3a, 
-    0xd6, 0xa6, 0x26, 0x76, 0x57, 0xfe, 0x7c, 0xdf, 0xf4, 0xee, 0x8a, 0x81, 0xf3, 0x0d, 0xe8, 0xb7, 
-    0xd5, 0xf4, 0xfc, 0xb6, 0xed, 0x17, 0xe1, 0xc9, 0x76, 0xdf, 0xf2, 0xbb, 0xce, 0x60, 0xab, 0xb2, 
-    0x3d, 0xb4, 0xda, 0x6d, 0x7c, 0x57, 0x79, 0x58, 0x69, 0x7a, 0xed, 0xf1, 0x7d, 0x07, 0xc0, 0x15, 
-    0x3b, 0x56, 0xdf, 0x71, 0xc7, 0x5b, 0x45, 0xde, 0x6e, 0x30, 0x0e, 0x42, 0xbb, 0x5f, 0xe0, 0x1f, 
-    0xc5, 0x91, 0x53, 0x08, 0x00, 0xcf, 0x62, 0x60, 0xfb, 0x4e, 0x07, 0x56, 0xd0, 0xd6, 0x75, 0x97, 
-    0x16, 0xf1, 0x2d, 0x41, 0xf6, 0x6d, 0x1a, 0x8e, 0xad, 0x1f, 0x6c, 0xdb, 0xde, 0x86, 0x4d, 0x43, 
-    0xb1, 0x67, 0x3b, 0xdd, 0x5e, 0xb8, 0x05, 0x7a, 0xd2, 0x4d, 0xef, 0x61, 0xa5, 0x84, 0xe8, 0x5a, 
-    0xb0, 0xfa, 0xfb, 0xf7, 0x7d, 0xeb, 0x8e, 0x2b, 0x09, 0x5b, 0x9b, 0x95, 0xca, 0x30, 0x42, 0x89, 
-    0x59, 0xa3, 0xd0, 0x53, 0x78, 0x55, 0x1b, 0xc3, 0xbb, 0x87, 0x95, 0x5e, 0xf5, 0x5e, 0x80, 0xad, 
-    0x54, 0xda, 0x6b, 0x9d, 0xce, 0x76, 0x68, 0xdf, 0x85, 0x45, 0xcb, 0x75, 0xba, 0x83, 0x2d, 0xa4, 
-    0x97, 0xed, 0x1b, 0x15, 0x58, 0x65, 0x9b, 0xfa, 0x01, 0xfd, 0xb6, 0xb7, 0xaa, 0xa5, 0x86, 0xdd, 
-    0x87, 0x96, 0xbb, 0xbe, 0xd3, 0xbe, 0x6f, 0x3b, 0xc1, 0xd0, 0xb5, 0xc6, 0x5b, 0xf8, 0x63, 0x1b, 
-    0xff, 0x14, 0xa1, 0x4f, 0xf0, 0x24, 0x24, 0x36, 0x1a, 0xf5, 0x07, 0xc1, 0x56, 0xb5, 0xe3, 0x6f, 
-    0x77, 0xad, 0xa1, 0x68, 0xf9, 0x6f, 0xfa, 0x36, 0xa8, 0x6e, 0x39, 0xec, 0x09, 0x47, 0x76, 0x1d, 
-    0x91, 0xcd, 0xdf, 0x73, 0x70, 0xe9, 0x10, 0x6a, 0xeb, 0x50, 0x84, 0x01, 0x9c, 0x07, 0xec, 0xb0, 
-    0xe5, 0xb7, 0xef, 0x35, 0x32, 0xf9, 0xdd, 0xa6, 0x95, 0xab, 0x35, 0x1a, 0x05, 0xf9, 0xaf, 0x52, 
-    0xaa, 0x34, 0xf2, 0xdb, 0x62, 0x6c, 0x50, 0x43, 0x1c, 0x01, 0x0e, 0x48, 0x10, 0xbd, 0x47, 0xe2, 
-    0xfd, 0x56, 0x15, 0x00, 0x07, 0x9e, 0xeb, 0xb4, 0x59, 0x0a, 0x9c, 0x6a, 0x5e, 0xb4, 0xc7, 0x7a, 
-    0xf5, 0x18, 0xbd, 0x38, 0x71, 0x61, 0xe8, 0xc3, 0xd0, 0xeb, 0x6f, 0x55, 0x41, 0x40, 0xe9, 0x14, 
-    0x22, 0xfa, 0x0c, 0x7d, 0x1b, 0x37, 0x51, 0xc5, 0x5b, 0xdf, 0x1a, 0x2a, 0x3a, 0x75, 0x5c, 0x1b, 
-    0x4a, 0xc2, 0x9f, 0x62, 0xdb, 0xf1, 0xed, 0x56, 0xe8, 0x78, 0x40, 0x70, 0xea, 0xe6, 0x36, 0x51, 
-    0xbf, 0xe8, 0x40, 0xef, 0x03, 0x31, 0x06, 0x0f, 0x2b, 0x3f, 0x08, 0x20, 0xf7, 0x02, 0xdd, 0x9a, 
-    0x42, 0xf7, 0x87, 0x7a, 0xbd, 0x1e, 0xeb, 0xe4, 0x26, 0x76, 0x4b, 0xe3, 0x1f, 0xd8, 0xcb, 0x6d, 
-    0x93, 0x6e, 0x56, 0xf4, 0xed, 0x01, 0x94, 0xc3, 0xbe, 0x0f, 0x9d, 0x3b, 0x1b, 0x69, 0xdb, 0xd6, 
-    0x10, 0x74, 0x06, 0x1d, 0xef, 0x5e, 0x74, 0x08, 0xb4, 0x6e, 0x82, 0x13, 0x75, 0xa6, 0x52, 0xda, 
-    0xb4, 0xfb, 0x92, 0x09, 0x37, 0x37, 0x37, 0xa1, 0x62, 0x33, 0x1c, 0x14, 0x7d, 0xef, 0xd6, 0xec, 
-    0x14, 0x0e, 0xf1, 0xa6, 0x62, 0x3b, 0x02, 0x44, 0x54, 0xa7, 0xce, 0x22, 0x0d, 0xb6, 0xf0, 0x0f, 
-    0xaf, 0x7d, 0x2f, 0x87, 0x62, 0x13, 0xc7, 0x75, 0x3d, 0x1a, 0x0e, 0x54, 0x6a, 0x63, 0xbd, 0xc2, 
-    0xb7, 0xad, 0x91, 0x1f, 0x40, 0xf3, 0x43, 0xcf, 0x21, 0xd6, 0x34, 0x90, 0x03, 0x66, 0xdc, 0xa6, 
-    0x99, 0xee, 0x10, 0x31, 0x2d, 0xd7, 0x65, 0x95, 0x52, 0x2d, 0x10, 0x68, 0x0e, 0x7d, 0xa0, 0x80, 
-    0x3f, 0xbe, 0x37, 0xe9, 0x42, 0x43, 0x28, 0xba, 0xc4, 0x67, 0x99, 0x59, 0x7c, 0xab, 0xe7, 0xdd, 
-    0xc0, 0x8c, 0x32, 0x2b, 0x59, 0x9b, 0xad, 0x96, 0x28, 0x16, 0xd8, 0x30, 0xed, 0xda, 0x31, 0xb8, 
-    0xa9, 0x0c, 0xa4, 0xcd, 0xde, 0x78, 0xdd, 0x64, 0x23, 0x29, 0x10, 0x6a, 0x79, 0x51, 0x0d, 0x08, 
-    0x96, 0x28, 0x5a, 0x29, 0xd4, 0xaa, 0x35, 0xd9, 0x54, 0x43, 0xb5, 0x25, 0xfa, 0xa7, 0x71, 0x78, 
-    0xdb, 0x0a, 0x7a, 0x36, 0xf0, 0x0c, 0x7f, 0x13, 0x41, 0x9c, 0x80, 0x82, 0x0e, 0xb7, 0xd6, 0xd0, 
-    0x30, 0x28, 0xc1, 0x88, 0xa3, 0xb0, 0x6e, 0xdf, 0x7b, 0x43, 0xab, 0xe5, 0x84, 0x63, 0x18, 0x80, 
-    0x35, 0x39, 0x3a, 0xb0, 0x77, 0x00, 0x09, 0xe2, 0x7a, 0xb7, 0x76, 0x7b, 0x5b, 0x8c, 0x54, 0xd1, 
-    0xbe, 0x01, 0x46, 0x0e, 0x8c, 0x61, 0x25, 0x41, 0xba, 0x45, 0x4c, 0x0c, 0x80, 0x3b, 0x9e, 0xdf, 
-    0x2f, 0x62, 0xdb, 0xc3, 0xfb, 0xe4, 0x94, 0x32, 0xde, 0x33, 0xd7, 0x6a, 0xda, 0xae, 0xe2, 0xb9, 
-    0xa6, 0xeb, 0xb5, 0xae, 0x63, 0xd3, 0x70, 0x2d, 0xce, 0xb8, 0x8d, 0x88, 0x73, 0x2d, 0xcb, 0x32, 
-    0xc1, 0x39, 0x83, 0xe1, 0x28, 0x2c, 0xe8, 0x4f, 0x02, 0xdb, 0x85, 0x19, 0x69, 0x3c, 0x42, 0xb1, 
-    0x68, 0xf9, 0xb6, 0x75, 0xcf, 0x65, 0x15, 0x6e, 0x4e, 0xb7, 0x35, 0xde, 0x4d, 0x4a, 0x91, 0x94, 
-    0x69, 0xb9, 0x1e, 0x9b, 0x96, 0x35, 0xab, 0x66, 0xad, 0x19, 0x62, 0x5d, 0xc7, 0xf9, 0x29, 0xc9, 
-    0x8e, 0x38, 0x9e, 0x5b, 0x1d, 0xaf, 0x35, 0x0a, 0x52, 0xb0, 0x4d, 0x79, 0x21, 0x71, 0xe6, 0xaf, 
-    0xee, 0xbd, 0x51, 0x88, 0xbb, 0x43, 0x63, 0x0c, 0x0c, 0x46, 0x91, 0xcd, 0xe9, 0x33, 0x7a, 0xba, 
-    0x38, 0x67, 0x4a, 0xa4, 0x57, 0x68, 0x90, 0x6e, 0xf9, 0x4a, 0x59, 0x1c, 0x00, 0x84, 0x29, 0x0b, 
-    0x89, 0x59, 0x18, 0x01, 0xdf, 0x47, 0x3d, 0xaf, 0xe1, 0xaa, 0xc2, 0x29, 0x71, 0xcb, 0x57, 0xb8, 
-    0xa6, 0xe7, 0xb6, 0xb5, 0xf2, 0x38, 0x6b, 0xee, 0xf5, 0x55, 0xa8, 0x1a, 0x1f, 0x5c, 0x59, 0x12, 
-    0x37, 0xa8, 0x3a, 0x64, 0x49, 0x51, 0xd8, 0x21, 0x07, 0xa1, 0x29, 0xb4, 0xbe, 0xc2, 0xe6, 0xd7, 
-    0xe9, 0x8c, 0x8b, 0x62, 0xd1, 0xdf, 0x0a, 0x80, 0xad, 0xed, 0x62, 0xd3, 0x0e, 0x6f, 0x61, 0x83, 
-    0x9c, 0x10, 0x65, 0x38, 0x59, 0x3a, 0xc0, 0xe0, 0xc5, 0xbb, 0x2d, 0x5c, 0x53, 0x35, 0xa8, 0xc5, 
-    0xb6, 0x35, 0x9e, 0xd2, 0x75, 0x5c, 0x70, 0xa2, 0x15, 0x6f, 0xad, 0x21, 0x59, 0x5b, 0xd5, 0x65, 
-    0x25, 0x04, 0xa0, 0xf3, 0xc1, 0x46, 0x5c, 0xe8, 0x9a, 0xc5, 0x63, 0x7d, 0xac, 0x96, 0xcc, 0x5e, 
-    0xf2, 0x42, 0x31, 0x12, 0x93, 0x24, 0x87, 0x42, 0x5c, 0x71, 0xba, 0x4f, 0xf2, 0xb1, 0xce, 0xb1, 
-    0x09, 0x31, 0x1e, 0x9b, 0x57, 0x0a, 0x4e, 0x29, 0x18, 0xb5, 0x5a, 0x76, 0x10, 0xa4, 0x49, 0x91, 
-    0x4a, 0xa5, 0x00, 0x53, 0x86, 0xc4, 0x98, 0x12, 0x4e, 0xad, 0xf5, 0xa8, 0xaa, 0xed, 0xfb, 0x5e, 
-    0x8a, 0x04, 0x84, 0x2a, 0x0d, 0xfa, 0xbf, 0x5e, 0xb1, 0xb3, 0x8e, 0x15, 0x43, 0xab, 0x19, 0x98, 
-    0x43, 0xa8, 0x94, 0x30, 0x2e, 0x36, 0xcc, 0x99, 0x18, 0x93, 0x29, 0x9c, 0xf0, 0x00, 0xe3, 0x5e, 
-    0x67, 0x4a, 0x46, 0x0a, 0x41, 0x6c, 0x8d, 0x31, 0xc1, 0x46, 0xeb, 0x2e, 0x2d, 0x35, 0x43, 0x98, 
-    0x5f, 0x83, 0x50, 0x1b, 0x9f, 0x94, 0x29, 0x0c, 0xad, 0x94, 0x2c, 0x58, 0xe0, 0x6f, 0xec, 0xfb, 
-    0x34, 0xb9, 0x9c, 0x98, 0x83, 0x50, 0x5e, 0xb2, 0xa1, 0xea, 0x20, 0xce, 0x59, 0xf3, 0x95, 0x04, 
-    0x69, 0x88, 0x41, 0x28, 0x82, 0xa6, 0x9a, 0x40, 0x5f, 0xc4, 0xa9, 0x4f, 0x09, 0x8e, 0x94, 0x25, 
-    0x99, 0x95, 0xaa, 0xcf, 0x80, 0xb2, 0x38, 0x61, 0xb0, 0x57, 0xca, 0x7f, 0x66, 0x07, 0x16, 0x0c, 
-    0x12, 0x88, 0x1d, 0x46, 0x22, 0x3c, 0x60, 0x7f, 0x2e, 0x93, 0x76, 0x44, 0xcf, 0x8a, 0xae, 0x03, 
-    0x73, 0xcb, 0xd4, 0x4f, 0x89, 0xd8, 0xaa, 0x00, 0x2a, 0x36, 0xb3, 0xf4, 0xb6, 0x7a, 0x7e, 0x2e, 
-    0x89, 0xba, 0xa9, 0x2b, 0x73, 0x34, 0x80, 0xb5, 0x88, 0x63, 0xc5, 0x88, 0x61, 0x19, 0x83, 0x4f, 
-    0x92, 0xea, 0x95, 0x12, 0x61, 0x72, 0xec, 0xbb, 0xbe, 0xd5, 0x8c, 0xa3, 0xbc, 0x25, 0xc7, 0x30, 
-    0x2a, 0xd2, 0x84, 0x76, 0xe3, 0xc5, 0x4a, 0x6d, 0xdf, 0xea, 0x42, 0xf3, 0x5d, 0x6d, 0x65, 0x6c, 
-    0x4c, 0x1a, 0x6a, 0xa3, 0x26, 0xa3, 0xaa, 0xc5, 0x9e, 0x35, 0x68, 0xbb, 0x8a, 0x55, 0xd6, 0xd7, 
-    0xd7, 0xb7, 0x93, 0xb3, 0x3b, 0x56, 0x0f, 0xff, 0x16, 0x13, 0x82, 0xa0, 0x3e, 0xb9, 0x28, 0xea, 
-    0x79, 0x48, 0x8b, 0xad, 0xea, 0x84, 0x12, 0xb4, 0x05, 0xba, 0x8f, 0x0b, 0xe1, 0x14, 0xe6, 0x4e, 
-    0xab, 0xdc, 0xb6, 0x83, 0x96, 0x29, 0xc2, 0x1a, 0x86, 0x0c, 0xd3, 0x45, 0x4a, 0x2d, 0xc9, 0x1b, 
-    0x02, 0x0a, 0xec, 0x0e, 0x42, 0x9d, 0x4d, 0xb4, 0x65, 0x8b, 0x7f, 0x4f, 0xa7, 0x10, 0xb6, 0x64, 
-    0x4e, 0x60, 0xc9, 0x20, 0xa0, 0x14, 0xb0, 0xcd, 0xa9, 0xcd, 0x09, 0x2d, 0x68, 0xc6, 0x28, 0x51, 
-    0x71, 0xdf, 0xee, 0x43, 0xd9, 0x25, 0xf0, 0xc3, 0x11, 0x5c, 0x0e, 0x43, 0xde, 0xa4, 0x89, 0x23, 
-    0x97, 0x85, 0xaa, 0x74, 0x0b, 0x30, 0x01, 0x80, 0x41, 0x52, 0x21, 0x27, 0x29, 0x30, 0x55, 0x94, 
-    0xc7, 0x97, 0x19, 0xc0, 0xa9, 0xd8, 0x1c, 0xc1, 0x14, 0x1a, 0x04, 0xb3, 0xf5, 0xfb, 0x5a, 0x8a, 
-    0x7e, 0x8f, 0x92, 0xe2, 0xcc, 0x6b, 0x5b, 0x86, 0x98, 0xe8, 0xe3, 0x03, 0x43, 0xac, 0x81, 0x8a, 
-    0x28, 0x34, 0xf6, 0x0e, 0x6c, 0x49, 0xda, 0xdb, 0x08, 0xaf, 0xb2, 0xed, 0xda, 0x9d, 0x10, 0x3e, 
-    0x34, 0x6d, 0x2b, 0x12, 0x27, 0x3f, 0x6d, 0x27, 0x57, 0x18, 0xfa, 0x5f, 0x69, 0x23, 0xbf, 0xfd, 
-    0x0d, 0xb8, 0xbb, 0x8d, 0x9c, 0x0d, 0x7b, 0x9e, 0x94, 0x99, 0x1e, 0x5f, 0xe7, 0x95, 0x34, 0x24, 
-    0xc4, 0xe2, 0x42, 0x15, 0xbb, 0x24, 0xdf, 0x29, 0x99, 0x9c, 0xb2, 0x33, 0x9f, 0x47, 0x56, 0x11, 
-    0x8d, 0xe4, 0x48, 0xd7, 0x90, 0xfc, 0xbc, 0x73, 0x4f, 0xa1, 0x3f, 0xd1, 0x8e, 0x7d, 0x4d, 0xec, 
-    0xd8, 0xef, 0xa4, 0xf8, 0x7c, 0x0a, 0xbb, 0xfb, 0x48, 0xdf, 0x18, 0x4b, 0x7d, 0xc3, 0x40, 0x69, 
-    0xe6, 0xae, 0x94, 0x2f, 0x77, 0xbc, 0xce, 0xc4, 0x31, 0xad, 0x56, 0x62, 0x83, 0x8a, 0x2c, 0x13, 
-    0xa7, 0x17, 0x0d, 0x32, 0x6c, 0x22, 0xf9, 0xf0, 0x9e, 0x82, 0x20, 0x61, 0x4d, 0xef, 0x0e, 0x06, 
-    0x17, 0x14, 0x0e, 0xc6, 0x0d, 0x19, 0x0c, 0x56, 0x29, 0x1a, 0x6b, 0x14, 0x33, 0x68, 0x13, 0x59, 
-    0x78, 0x93, 0xbe, 0x94, 0x58, 0x9f, 0xae, 0xc1, 0xa5, 0xed, 0xa9, 0x39, 0x82, 0x7c, 0x37, 0x31, 
-    0x61, 0x05, 0x17, 0x0a, 0x0e, 0x15, 0xbc, 0xb1, 0xdc, 0x51, 0x7c, 0x09, 0xd7, 0x25, 0x64, 0xa3, 
-    0x52, 0x81, 0xa2, 0xa3, 0x61, 0x1b, 0x95, 0xe4, 0xa6, 0xd5, 0xee, 0x1a, 0xe2, 0x01, 0xb4, 0xfd, 
-    0x06, 0xe8, 0xfb, 0x4a, 0x2a, 0x74, 0xd6, 0xb7, 0x13, 0x22, 0x52, 0xf6, 0xb9, 0xce, 0xe5, 0x40, 
-    0x8c, 0x2a, 0x6b, 0x11, 0x0d, 0x68, 0x76, 0x6c, 0xca, 0x75, 0xbd, 0x0d, 0x1b, 0x49, 0xdf, 0xa2, 
-    0x29, 0x24, 0xf4, 0x04, 0x1d, 0x89, 0x94, 0x2d, 0x6c, 0xdd, 0xda, 0xb0, 0xea, 0x16, 0x1f, 0xc2, 
-    0x2b, 0xaf, 0xdb, 0x75, 0x6d, 0x16, 0xdc, 0x3a, 0x61, 0xab, 0x47, 0xc3, 0x16, 0xd2, 0x93, 0xe4, 
-    0xbe, 0x7e, 0x51, 0x02, 0x9b, 0x43, 0x58, 0x99, 0xaa, 0x9f, 0x3d, 0xe8, 0xcd, 0x6e, 0xb9, 0xa8, 
-    0xb8, 0xb6, 0x7a, 0x8e, 0xdb, 0xbe, 0x37, 0x2b, 0x49, 0x35, 0x88, 0x8a, 0xde, 0x2b, 0xc1, 0xe1, 
-    0xa3, 0x25, 0x03, 0xe6, 0xad, 0x98, 0x51, 0x6b, 0x48, 0x29, 0x31, 0x7d, 0x6a, 0x6b, 0x5c, 0xd3, 
-    0xe3, 0xbd, 0xa4, 0x2d, 0x54, 0xb4, 0x30, 0x8b, 0xf2, 0x15, 0x59, 0xb8, 0x12, 0xa1, 0x11, 0x00, 
-    0x66, 0x40, 0x35, 0xd5, 0x04, 0x68, 0x9b, 0xb0, 0xed, 0x09, 0xed, 0xb8, 0xe8, 0x36, 0xa4, 0x95, 
-    0xcf, 0xa1, 0x6c, 0x0b, 0x6c, 0x2b, 0xc6, 0x6e, 0x2f, 0x29, 0x11, 0x10, 0x37, 0xdd, 0x62, 0x51, 
-    0x29, 0xd5, 0x83, 0x38, 0x06, 0x5b, 0x4d, 0x1b, 0x55, 0xf9, 0x34, 0x44, 0xc4, 0x30, 0x64, 0x32, 
-    0x4a, 0x34, 0x6e, 0x2a, 0xa1, 0x42, 0x5f, 0x09, 0xab, 0x3a, 0xf1, 0x11, 0xe1, 0x53, 0x8f, 0xed, 
-    0x3f, 0x3b, 0x91, 0x0e, 0x2a, 0x30, 0x6a, 0x80, 0x2c, 0x9a, 0x84, 0x90, 0xd8, 0x7f, 0xb6, 0x7a, 
-    0x76, 0xeb, 0xda, 0x6e, 0xaf, 0xc6, 0x08, 0x95, 0x34, 0xab, 0xcc, 0x57, 0x51, 0xf6, 0x8f, 0x5a, 
-    0xc5, 0xdd, 0xe7, 0x16, 0x37, 0xd6, 0x02, 0xfb, 0x7e, 0xcc, 0xa1, 0x94, 0xcc, 0x0b, 0x95, 0x13, 
-    0xa7, 0x0d, 0x1b, 0x3a, 0x00, 0xc2, 0x37, 0xd4, 0x4e, 0x7c, 0x9e, 0xe4, 0xd5, 0x69, 0x3a, 0x9e, 
-    0x6e, 0x72, 0x9a, 0xc9, 0x95, 0x0a, 0xfe, 0x4c, 0xa6, 0xe4, 0x25, 0xb9, 0x34, 0xe1, 0xba, 0x55, 
-    0x9a, 0x24, 0xe1, 0xa5, 0xa4, 0x31, 0x8f, 0x0f, 0x56, 0xbd, 0x66, 0xf2, 0x6b, 0xca, 0xbc, 0x4f, 
-    0x2e, 0x30, 0x8d, 0x46, 0x43, 0x81, 0xe3, 0x6c, 0x2d, 0xad, 0xa8, 0x5a, 0x17, 0x51, 0xa1, 0x58, 
-    0x9f, 0xd3, 0x3a, 0xb1, 0x36, 0x9f, 0x75, 0x42, 0x58, 0xb0, 0xfb, 0xde, 0xc0, 0x23, 0x01, 0x30, 
-    0xb9, 0x93, 0xa9, 0xc6, 0x1c, 0xbe, 0x12, 0x69, 0x05, 0x74, 0x55, 0x33, 0xd2, 0x2c, 0xb7, 0xa7, 
-    0x2d, 0x67, 0xca, 0x2c, 0x69, 0xda, 0x07, 0x60, 0x79, 0x03, 0xae, 0x22, 0x63, 0x08, 0xec, 0x25, 
-    0xa7, 0xa9, 0x2c, 0x89, 0x65, 0x11, 0xc4, 0x58, 0x38, 0x90, 0xa3, 0xf6, 0xb8, 0x66, 0x1d, 0x5c, 
-    0x51, 0x66, 0x5a, 0x2d, 0x53, 0x76, 0x67, 0x12, 0x2b, 0xa9, 0x92, 0xa4, 0xed, 0x20, 0xe2, 0x76, 
-    0xbe, 0x69, 0x56, 0x41, 0x34, 0xde, 0xf1, 0x53, 0x9d, 0x25, 0x48, 0xc4, 0x2b, 0xa6, 0xd0, 0x88, 
-    0x44, 0xbb, 0x46, 0xa8, 0x85, 0xcc, 0xd2, 0x49, 0x0e, 0x5b, 0x86, 0x50, 0x0a, 0xb7, 0xf9, 0x29, 
-    0xa5, 0xd7, 0x62, 0xe2, 0x2b, 0x9e, 0x07, 0xdd, 0xa7, 0x70, 0x55, 0xa2, 0xe0, 0x22, 0xbb, 0x1b, 
-    0xbe, 0xf8, 0xb4, 0x60, 0xe1, 0xf4, 0xfa, 0x1c, 0xa1, 0xc0, 0x30, 0x38, 0x6c, 0xcf, 0xd0, 0x8c, 
-    0x6a, 0x69, 0x9a, 0x51, 0x4c, 0x45, 0x8b, 0x37, 0x50, 0xea, 0x39, 0xed, 0xb6, 0x3d, 0x88, 0x99, 
-    0x0e, 0x50, 0x86, 0xbe, 0xf2, 0x5a, 0xa4, 0x25, 0xb0, 0xc0, 0xb6, 0x7c, 0x58, 0xec, 0xdb, 0xbe, 
-    0x37, 0x6c, 0x7b, 0xb7, 0x03, 0x12, 0xa4, 0xfc, 0x19, 0x3f, 0xa3, 0x48, 0x2c, 0xac, 0x0f, 0xea, 
-    0xbd, 0xac, 0x93, 0xb2, 0x20, 0xf1, 0x6d, 0x05, 0xac, 0x20, 0xf1, 0xd5, 0x30, 0x39, 0xe4, 0x53, 
-    0xa7, 0x15, 0xc2, 0x49, 0x31, 0xff, 0x93, 0xfb, 0x99, 0x90, 0x67, 0x9a, 0x7e, 0x5c, 0x5b, 0x33, 
-    0x0c, 0x72, 0x5c, 0x41, 0xd6, 0x76, 0x01, 0xdb, 0x31, 0x13, 0x4a, 0xac, 0x1f, 0x93, 0xcc, 0x28, 
-    0xb1, 0x62, 0xdc, 0x68, 0x91, 0xd4, 0x49, 0xa7, 0xda, 0x8a, 0x12, 0x8b, 0x49, 0x1a, 0xd0, 0x99, 
-    0xeb, 0x4a, 0x6a, 0xa5, 0xd9, 0xe6, 0x7a, 0x9a, 0xf0, 0x69, 0x75, 0x59, 0x09, 0x95, 0x1f, 0xce, 
-    0xef, 0x72, 0x17, 0x99, 0xaa, 0xc9, 0x4e, 0xa9, 0xdc, 0xb6, 0x43, 0xcb, 0x99, 0xac, 0x34, 0xc3, 
-    0x7c, 0x48, 0x6c, 0xf1, 0x05, 0x34, 0xd7, 0xb3, 0x90, 0x84, 0x11, 0x29, 0x6b, 0x69, 0xd6, 0xa9, 
-    0xed, 0xe9, 0xea, 0xb8, 0xc4, 0xcc, 0xb9, 0xe1, 0xba, 0x47, 0xc4, 0x37, 0xa9, 0x56, 0x3f, 0x6a, 
-    0x84, 0xa9, 0x13, 0x59, 0xb5, 0x63, 0x4d, 0x40, 0x2a, 0x22, 0x22, 0x13, 0xe7, 0x36, 0x6e, 0xe4, 
-    0x13, 0x0b, 0xd1, 0xc3, 0xca, 0xb3, 0xb2, 0x38, 0x11, 0x7e, 0x56, 0x16, 0x3e, 0xa4, 0x78, 0xdc, 
-    0x0b, 0x1f, 0x00, 0x94, 0xb5, 0x60, 0x74, 0x83, 0x9d, 0x8c, 0x3a, 0x9b, 0x25, 0x4f, 0xd3, 0x2a, 
-    0x57, 0x60, 0x76, 0x32, 0xb3, 0x54, 0x96, 0xf4, 0xcd, 0x2a, 0xd7, 0x64, 0x00, 0xff, 0xcc, 0xee, 
-    0x33, 0xf4, 0xe1, 0xe4, 0xfe, 0x60, 0x99, 0xfa, 0x7a, 0x86, 0xf1, 0x39, 0xc1, 0xbf, 0x4b, 0xbf, 
-    0xcd, 0x8c, 0xf2, 0xdb, 0x84, 0xf2, 0x91, 0x97, 0x5a, 0xa6, 0x5e, 0xcb, 0xa0, 0x97, 0x1a, 0x7d, 
-    0xfa, 0xf0, 0x51, 0xc9, 0x70, 0x7f, 0x32, 0x75, 0xca, 0x5f, 0xde, 0x7d, 0xd6, 0x95, 0x8f, 0xb8, 
-    0xd7, 0x5d, 0x46, 0x7a, 0xa5, 0xc5, 0x1f, 0x08, 0x9f, 0xb4, 0x4c, 0x2d, 0x13, 0xf7, 0x43, 0xcb, 
-    0x10, 0x7b, 0x42, 0xcb, 0xd2, 0xf5, 0x90, 0xda, 0x1b, 0xc3, 0xe7, 0x66, 0x06, 0x3d, 0x0f, 0xf9, 
-    0x4f, 0xf8, 0xac, 0x36, 0xb0, 0x41, 0x55, 0x6a, 0xed, 0x29, 0x2f, 0x05, 0x8f, 0xa9, 0xd8, 0xda, 
-    0x1a, 0x2f, 0x56, 0xab, 0x18, 0xc5, 0x1a, 0xeb, 0xbc, 0x18, 0x42, 0xa1, 0x62, 0x4f, 0x79, 0x31, 
-    0xf8, 0x9d, 0x06, 0x0d, 0x3f, 0x75, 0x68, 0xf0, 0x59, 0x4e, 0x41, 0x0d, 0xa1, 0xea, 0xb8, 0x41, 
-    0x35, 0xbd, 0x18, 0xe2, 0xa4, 0x43, 0x03, 0x9c, 0xd2, 0xa0, 0x6d, 0x9a, 0xa8, 0x51, 0xad, 0x24, 
-    0x6a, 0x12, 0x98, 0xec, 0xa8, 0x04, 0xc6, 0x3b, 0x5a, 0xee, 0xee, 0x3e, 0x43, 0x6f, 0xc6, 0xdd, 
-    0x67, 0x49, 0xef, 0xcb, 0x4c, 0xd0, 0xcd, 0xd0, 0x48, 0xae, 0x55, 0x7e, 0xe2, 0x43, 0x89, 0x5f, 
-    0x80, 0x27, 0x34, 0x2f, 0xca, 0x0c, 0xbe, 0xd2, 0x3c, 0x28, 0x71, 0xe0, 0xd0, 0xe3, 0x12, 0x61, 
-    0x1b, 0xe5, 0x50, 0x70, 0x27, 0x4a, 0xd2, 0x10, 0x23, 0x16, 0x66, 0xe3, 0xf0, 0x80, 0xe3, 0x34, 
-    0x99, 0x9b, 0xaa, 0x6b, 0x92, 0x9b, 0xd0, 0xbb, 0xf2, 0x87, 0xa0, 0x9b, 0x47, 0x38, 0x5a, 0xf9, 
-    0xda, 0x06, 0x2f, 0x5f, 0x7b, 0x4a, 0xe5, 0x6b, 0x99, 0x88, 0xd3, 0xd0, 0xd9, 0x31, 0x56, 0xba, 
-    0x3e, 0xbb, 0xb4, 0xf0, 0xa5, 0xcc, 0x24, 0x7d, 0x29, 0x0d, 0xae, 0xa5, 0xe2, 0x49, 0xae, 0xe5, 
-    0xe0, 0x50, 0xe2, 0x4e, 0xe2, 0x60, 0x24, 0x03, 0xcc, 0x36, 0x20, 0xdb, 0xd0, 0x1a, 0xf0, 0xbf, 
-    0x72, 0x1a, 0x1b, 0xba, 0x45, 0x86, 0x3c, 0xbc, 0xa1, 0xec, 0xa4, 0x62, 0x1d, 0x2c, 0x13, 0xb9, 
-    0x94, 0xc8, 0x92, 0xf2, 0xa3, 0x57, 0x35, 0x45, 0x07, 0x9e, 0xbd, 0x65, 0xf8, 0xa3, 0x98, 0x4c, 
-    0x41, 0x77, 0x04, 0xdd, 0xb5, 0x00, 0x4b, 0xb5, 0xac, 0xc1, 0x8d, 0x15, 0x10, 0x77, 0x88, 0x57, 
-    0x19, 0x29, 0x1f, 0x60, 0xa1, 0x8c, 0x04, 0x04, 0xfe, 0x80, 0xc6, 0x78, 0x71, 0x13, 0xae, 0xee, 
-    0x0c, 0x90, 0xd9, 0x85, 0x82, 0x77, 0xf0, 0x8f, 0x1d, 0x72, 0x51, 0xc5, 0x2e, 0xf8, 0x5b, 0xe0, 
-    0x80, 0x38, 0x3e, 0xc2, 0x17, 0x00, 0xb1, 0xe0, 0x26, 0x26, 0xed, 0x05, 0x33, 0xce, 0xbb, 0x33, 
-    0xcc, 0x1b, 0xb4, 0x5c, 0xd8, 0xca, 0x41, 0x27, 0xc6, 0x30, 0xc4, 0x97, 0xe4, 0x85, 0x9a, 0xcb, 
-    0x67, 0x76, 0xcf, 0x41, 0xfe, 0x32, 0xfe, 0xf3, 0x59, 0x99, 0x43, 0x59, 0x08, 0x9c, 0x6f, 0x77, 
-    0x7c, 0x3b, 0xe8, 0x09, 0x24, 0x11, 0xe2, 0x5b, 0xfe, 0x44, 0x83, 0x26, 0x30, 0x2f, 0xa7, 0x12, 
-    0x34, 0x23, 0x07, 0x2b, 0xa6, 0x64, 0x89, 0x11, 0x48, 0x15, 0xdc, 0x0b, 0xdb, 0x45, 0x92, 0xe7, 
-    0xdb, 0xb4, 0x2c, 0xd4, 0xcd, 0xb6, 0xb7, 0x60, 0x84, 0x0e, 0x46, 0x3e, 0x9e, 0x2f, 0x31, 0xc1, 
-    0x2e, 0xc0, 0x1d, 0xf5, 0x79, 0xe8, 0x21, 0xe0, 0xe8, 0xbb, 0xc0, 0x34, 0x7b, 0x6f, 0x7c, 0x1c, 
-    0x44, 0x2b, 0x52, 0x4d, 0x54, 0x03, 0xf2, 0x0f, 0x7f, 0xf7, 0x5f, 0x92, 0xf4, 0x43, 0x6a, 0x20, 
-    0x9b, 0xc9, 0xb3, 0x56, 0x41, 0x92, 0xcc, 0xee, 0x2b, 0xbe, 0xc2, 0x97, 0x4a, 0xa5, 0x18, 0xa9, 
-    0xa3, 0x8a, 0x29, 0x74, 0x37, 0x1f, 0xe1, 0xe1, 0x5e, 0xf2, 0x11, 0xe3, 0xba, 0x5a, 0x86, 0xa1, 
-    0xb3, 0x71, 0x11, 0x1e, 0x50, 0x5d, 0xb2, 0x7c, 0x03, 0xa9, 0xc4, 0xb7, 0x94, 0x81, 0x85, 0x92, 
-    0x7a, 0x1d, 0x85, 0xa9, 0xe0, 0xe9, 0xd9, 0x35, 0x48, 0xf1, 0xcf, 0xec, 0x5e, 0xe1, 0xc7, 0xec, 
-    0xd2, 0xdc, 0x0a, 0x9a, 0xd9, 0xbd, 0xa4, 0x4f, 0xb3, 0xf7, 0xdc, 0x05, 0xef, 0x60, 0xef, 0xed, 
-    0xeb, 0x77, 0x97, 0x47, 0xaf, 0xd8, 0xd5, 0xde, 0x3e, 0x77, 0xbd, 0x93, 0xd4, 0x54, 0xfd, 0xd1, 
-    0x60, 0x2b, 0x2b, 0xaf, 0xe8, 0x3e, 0x14, 0x1f, 0x1a, 0x85, 0x69, 0x4b, 0xa2, 0x46, 0x7d, 0x92, 
-    0xdf, 0x83, 0xb6, 0x35, 0x31, 0x38, 0xef, 0xd0, 0xb7, 0xba, 0x2c, 0xf4, 0x98, 0x6f, 0x93, 0x1a, 
-    0x25, 0x7c, 0xc2, 0x03, 0x18, 0xbd, 0x61, 0x0a, 0x62, 0x74, 0xbc, 0x97, 0xd1, 0x86, 0x4e, 0x7b, 
-    0xba, 0x9b, 0x42, 0x1b, 0xed, 0x14, 0x61, 0xb2, 0x64, 0x80, 0x42, 0x92, 0x80, 0x74, 0x89, 0xc5, 
-    0x15, 0x1c, 0xa8, 0x31, 0xa8, 0x37, 0xb4, 0x07, 0x74, 0x98, 0x90, 0xcb, 0xca, 0xb7, 0x59, 0xe0, 
-    0xcf, 0x55, 0xb5, 0xa9, 0x99, 0x29, 0x2f, 0xe2, 0x8d, 0xd0, 0x59, 0x09, 0x2a, 0xb6, 0xe9, 0xad, 
-    0xa8, 0xd7, 0xbc, 0x99, 0x03, 0xf9, 0x73, 0xf1, 0x76, 0x68, 0x73, 0x36, 0xa1, 0x11, 0x7a, 0x27, 
-    0x5a, 0xa0, 0xef, 0xec, 0x0a, 0x66, 0xdc, 0xc2, 0x6d, 0x8c, 0xbd, 0x51, 0x38, 0x6a, 0xda, 0xe9, 
-    0x8d, 0x88, 0x97, 0xbc, 0x95, 0x4f, 0xde, 0xe8, 0x0a, 0x7e, 0x2c, 0xdc, 0x02, 0xb9, 0x8f, 0xa5, 
-    0xc3, 0xa7, 0x57, 0x1c, 0xfa, 0x29, 0x7e, 0x4d, 0x97, 0x15, 0x71, 0x8e, 0x91, 0x47, 0x55, 0xe4, 
-    0x52, 0x89, 0x4b, 0x9f, 0x1c, 0xc8, 0x60, 0x8b, 0xf1, 0x65, 0x13, 0xd9, 0x0e, 0xc6, 0x9a, 0x97, 
-    0xcc, 0xec, 0x56, 0xc4, 0x12, 0x59, 0xae, 0x8b, 0x2f, 0xa2, 0x9e, 0x1a, 0x19, 0xa3, 0x62, 0xab, 
-    0x3d, 0xb3, 0x1e, 0xd1, 0xdb, 0xa8, 0x33, 0xc2, 0x9d, 0xd8, 0xf4, 0x5a, 0x82, 0x7e, 0x7a, 0xb5, 
-    0x71, 0xb2, 0x52, 0xd5, 0xac, 0x44, 0x64, 0x31, 0xd0, 0x73, 0xfa, 0xdd, 0x29, 0x2d, 0x4d, 0x5e, 
-    0x5c, 0xa7, 0x2c, 0x4f, 0xe9, 0xe3, 0x28, 0xfc, 0xd8, 0xb4, 0x91, 0x0b, 0xac, 0x1b, 0x5b, 0x0a, 
-    0x4b, 0x14, 0xf1, 0x97, 0xf0, 0x9b, 0x45, 0xd2, 0x73, 0x92, 0x9c, 0x57, 0x03, 0xc7, 0x3d, 0x36, 
-    0xa2, 0xc9, 0xae, 0x0b, 0xb6, 0xc3, 0xd3, 0xcb, 0x8b, 0x57, 0x7b, 0x9f, 0x92, 0x72, 0x4d, 0xca, 
-    0xdc, 0x14, 0xb1, 0x16, 0x93, 0xf3, 0x91, 0xff, 0x12, 0xbe, 0x20, 0x73, 0xea, 0xee, 0x95, 0xdd, 
-    0x1f, 0xda, 0x3e, 0x34, 0xeb, 0xdb, 0xec, 0xdd, 0xc0, 0x81, 0xf9, 0xc1, 0x9f, 0x03, 0x79, 0xc9, 
-    0x96, 0x45, 0x4d, 0xa0, 0x8f, 0x4b, 0x71, 0x04, 0x6f, 0xb1, 0x9e, 0x37, 0x24, 0x43, 0x07, 0x1d, 
-    0xd9, 0x00, 0xcc, 0xcc, 0xee, 0xb1, 0xd5, 0x83, 0x95, 0x14, 0xd4, 0x1f, 0xa8, 0xcc, 0x5f, 0x26, 
-    0x4a, 0xb5, 0x60, 0x11, 0xb1, 0xdd, 0xc0, 0x19, 0x05, 0x5a, 0x91, 0x32, 0x6f, 0x21, 0x75, 0x50, 
-    0xd2, 0x50, 0xe5, 0xca, 0x0b, 0x3b, 0xc0, 0xf5, 0x94, 0xe5, 0xf8, 0x9a, 0x1c, 0xe4, 0x23, 0x84, 
-    0xc9, 0x54, 0x2b, 0xee, 0xea, 0x0d, 0x46, 0xfd, 0x26, 0x6c, 0x09, 0x39, 0x79, 0xb1, 0x42, 0x31, 
-    0x74, 0x60, 0x9d, 0x91, 0xf8, 0x54, 0x41, 0x5f, 0xeb, 0x3b, 0x03, 0xd0, 0x7e, 0xe1, 0xd3, 0x02, 
-    0x2d, 0x78, 0xbd, 0x92, 0x99, 0x1b, 0x8f, 0x7d, 0xb2, 0xbe, 0x0c, 0xec, 0x20, 0x48, 0x6f, 0xdb, 
-    0xb7, 0x06, 0x38, 0x9f, 0xb1, 0xe9, 0xa6, 0x2a, 0x2a, 0xda, 0xab, 0x8a, 0xf6, 0xaa, 0xa8, 0x2a, 
-    0x0b, 0x64, 0x36, 0x2b, 0x72, 0xa2, 0xc6, 0xea, 0xe0, 0xb1, 0x58, 0x66, 0x77, 0xb3, 0xf2, 0xd3, 
-    0x14, 0xee, 0xd5, 0x10, 0x9c, 0xc2, 0xc0, 0x84, 0x66, 0xec, 0x7d, 0xb4, 0xd1, 0xce, 0x48, 0xd2, 
-    0xbe, 0xa6, 0xa1, 0xd1, 0xba, 0xa5, 0xaf, 0xc4, 0xea, 0x0c, 0x49, 0x89, 0x95, 0xcb, 0x9e, 0x77, 
-    0xcb, 0x8e, 0x85, 0x37, 0x94, 0xd0, 0x2d, 0x03, 0x85, 0x2b, 0x6f, 0xd3, 0xa8, 0x0d, 0x9c, 0xad, 
-    0x13, 0x8a, 0x8e, 0x2d, 0x9a, 0xde, 0x1d, 0xa7, 0x55, 0x00, 0xd0, 0x8a, 0xd2, 0xb7, 0x0a, 0xb8, 
-    0x99, 0x9f, 0x69, 0x08, 0x3d, 0xdf, 0x44, 0x82, 0x9f, 0x6f, 0x64, 0x22, 0xcd, 0x5e, 0xe2, 0x2b, 
-    0xe8, 0x33, 0x4c, 0x5b, 0xb0, 0x27, 0xd8, 0x1b, 0x84, 0x33, 0x2e, 0xec, 0x1b, 0x7a, 0x40, 0x01, 
-    0x7b, 0x40, 0xae, 0x97, 0x05, 0x66, 0x5b, 0xad, 0x1e, 0x73, 0x95, 0x55, 0x0f, 0x70, 0x0b, 0x58, 
-    0x5d, 0x2e, 0xe0, 0x2c, 0xd7, 0x12, 0xda, 0xe3, 0x2a, 0xab, 0x31, 0x89, 0x73, 0xbe, 0xc4, 0x08, 
-    0x86, 0xf4, 0xdf, 0x2c, 0x80, 0x60, 0x70, 0xc7, 0x4c, 0x16, 0x15, 0xda, 0x1c, 0x73, 0x02, 0x02, 
-    0x37, 0x10, 0x5a, 0xc0, 0xef, 0x35, 0xa4, 0xe7, 0xc8, 0x45, 0xe8, 0x24, 0x60, 0xcf, 0x3b, 0x9c, 
-    0x47, 0xd4, 0x77, 0xa6, 0x57, 0x5c, 0x72, 0x28, 0x07, 0x08, 0xa2, 0x48, 0x66, 0x76, 0x41, 0xd0, 
-    0xcc, 0x52, 0xe3, 0x28, 0x45, 0x9c, 0x06, 0x4f, 0x5e, 0xab, 0x48, 0x25, 0x4d, 0x25, 0xda, 0x4d, 
-    0xe8, 0xb4, 0x14, 0x9d, 0x9c, 0x25, 0x5e, 0x42, 0xcb, 0x0f, 0x59, 0xae, 0xed, 0xf4, 0xf3, 0xa9, 
-    0x42, 0x90, 0x23, 0x11, 0x60, 0x29, 0xc2, 0x78, 0x31, 0xe1, 0x75, 0x34, 0x68, 0xb3, 0x1c, 0x9f, 
-    0xda, 0xf6, 0x60, 0x5a, 0x03, 0x36, 0x99, 0x74, 0x12, 0xe0, 0xe7, 0x6b, 0x85, 0x8f, 0xdd, 0x02, 
-    0x02, 0x8a, 0xb7, 0x39, 0x97, 0x98, 0xaa, 0x99, 0x62, 0x2a, 0x5e, 0x93, 0x0b, 0xab, 0x5a, 0x52, 
-    0x58, 0x7d, 0xcf, 0x9c, 0x3c, 0x74, 0xfa, 0x01, 0x13, 0x0b, 0x1c, 0x6b, 0x8f, 0xd0, 0xbb, 0x9e, 
-    0x51, 0xc3, 0xac, 0xe7, 0x8d, 0xfc, 0xa0, 0x84, 0x17, 0xba, 0x7d, 0x27, 0xb0, 0xcb, 0xf0, 0x09, 
-    0x9c, 0xc1, 0xf8, 0xda, 0x12, 0x30, 0x58, 0x4d, 0xd5, 0x7c, 0x43, 0x4d, 0x6b, 0xe2, 0x5c, 0x9b, 
-    0xb9, 0xb3, 0x4e, 0x5f, 0xe4, 0xc5, 0xf6, 0x46, 0xad, 0xf1, 0x97, 0x82, 0x2b, 0x27, 0xaf, 0xf1, 
-    0xa2, 0x13, 0x53, 0x97, 0xf8, 0xab, 0x93, 0xa3, 0xb3, 0xa3, 0xe4, 0x02, 0xcf, 0xb7, 0x48, 0xcb, 
-    0x2d, 0xef, 0x97, 0x9c, 0xbd, 0xc4, 0xf6, 0x2a, 0x4d, 0x0e, 0x18, 0xe7, 0x56, 0x99, 0xb4, 0x97, 
-    0x48, 0x0a, 0x73, 0x7b, 0x88, 0x8f, 0x77, 0x32, 0x68, 0xe6, 0x48, 0x14, 0x46, 0xdb, 0x37, 0x2c, 
-    0xf6, 0xf8, 0x08, 0x4d, 0x35, 0xd8, 0xbb, 0x64, 0x21, 0xda, 0x54, 0xed, 0xbe, 0x06, 0xde, 0x71, 
-    0x06, 0x16, 0x08, 0x16, 0x3a, 0x5c, 0x11, 0x85, 0x53, 0xf6, 0x80, 0x12, 0x0b, 0xb3, 0xf9, 0xea, 
-    0xe4, 0xe6, 0xcf, 0xd0, 0xbe, 0xe4, 0x5b, 0x9d, 0x70, 0x3a, 0x02, 0xfb, 0x78, 0x20, 0x31, 0x06, 
-    0x51, 0xef, 0x87, 0x3d, 0xd8, 0xa6, 0x01, 0x17, 0x2f, 0x8a, 0x43, 0x6d, 0x0a, 0x09, 0x48, 0x07, 
-    0x9e, 0x8e, 0x00, 0x68, 0xbc, 0x7e, 0x6a, 0xef, 0x17, 0x9a, 0xf4, 0x34, 0xb8, 0x93, 0x25, 0xbd, 
-    0x71, 0x76, 0x9b, 0x49, 0x79, 0x97, 0x18, 0x5f, 0x7c, 0x4a, 0xc3, 0xbb, 0x37, 0x0a, 0xbd, 0x14, 
-    0x24, 0x64, 0x2d, 0xa3, 0x38, 0x0c, 0xc7, 0xa1, 0xe5, 0x5f, 0xcf, 0x5b, 0x1c, 0x28, 0xf7, 0x0a, 
-    0x27, 0xf2, 0x77, 0x4a, 0x89, 0x35, 0x94, 0x12, 0x88, 0x26, 0x4e, 0x79, 0x10, 0x15, 0x80, 0x01, 
-    0xb3, 0x42, 0x2e, 0x23, 0x0a, 0xcc, 0x25, 0x51, 0x21, 0xe4, 0x46, 0xdb, 0x1a, 0x27, 0xc5, 0x80, 
-    0xdc, 0x9b, 0xa8, 0x23, 0xbe, 0x68, 0xff, 0xad, 0x3f, 0x65, 0xfc, 0xe0, 0x6f, 0xee, 0x55, 0xe4, 
-    0xd8, 0xc7, 0xa1, 0x4f, 0x19, 0x8c, 0xa5, 0x2c, 0x79, 0x78, 0xb0, 0x43, 0x83, 0x4c, 0x9e, 0x1a, 
-    0x41, 0xae, 0x92, 0xe7, 0xa6, 0x20, 0xa6, 0xa6, 0xd9, 0x12, 0xf6, 0xbc, 0x38, 0xd0, 0xaa, 0x04, 
-    0xaa, 0x4d, 0x9e, 0xf9, 0xc1, 0x8a, 0x51, 0xd3, 0xcf, 0x23, 0xd7, 0xeb, 0x75, 0xdd, 0x0a, 0xe6, 
-    0xc2, 0x34, 0xe3, 0x73, 0x82, 0x5a, 0x45, 0xd1, 0x79, 0x80, 0xcf, 0xd8, 0x9e, 0xeb, 0xce, 0x65, 
-    0x42, 0x8c, 0xfc, 0x1a, 0x32, 0x13, 0xdf, 0x88, 0xfb, 0x85, 0xc4, 0x89, 0x34, 0x23, 0x58, 0x91, 
-    0xed, 0x2b, 0x9c, 0xb8, 0xa7, 0x4b, 0x30, 0x9d, 0xd7, 0x66, 0x1c, 0x4a, 0x01, 0xd6, 0x9c, 0x23, 
-    0xd0, 0x29, 0x0f, 0x26, 0x55, 0x1f, 0xef, 0xde, 0x40, 0x37, 0x19, 0xcc, 0x6b, 0x58, 0x33, 0x9d, 
-    0x81, 0xbc, 0xf8, 0x1f, 0x91, 0x22, 0xb2, 0xf6, 0x18, 0x08, 0x13, 0x1b, 0x18, 0x5a, 0x91, 0xe6, 
-    0xe6, 0x02, 0xc2, 0x49, 0xab, 0xcf, 0xb5, 0x23, 0x43, 0xdf, 0x12, 0xd7, 0x47, 0xf5, 0x8a, 0xca, 
-    0x2a, 0x4d, 0xeb, 0x0d, 0x50, 0xa0, 0xd8, 0xec, 0xc6, 0xd4, 0x34, 0x3c, 0x84, 0x8b, 0xd5, 0xa2, 
-    0xd7, 0x46, 0x9d, 0x62, 0xcf, 0xbe, 0xa3, 0xf5, 0xdf, 0xb5, 0x07, 0x5d, 0x34, 0x6f, 0x6f, 0xa4, 
-    0x9a, 0x9f, 0xe6, 0xea, 0xc5, 0x05, 0x5f, 0x3e, 0x85, 0xe9, 0x65, 0xd9, 0x7e, 0x10, 0xda, 0x0b, 
-    0xf7, 0x84, 0x8e, 0x3e, 0x1f, 0xb1, 0x2f, 0x57, 0xb0, 0x83, 0x64, 0x7f, 0xb2, 0xfa, 0xc3, 0x6d, 
-    0x76, 0x62, 0x5b, 0xa0, 0xb8, 0x06, 0xcb, 0xf7, 0xa8, 0x35, 0xb6, 0x06, 0x8b, 0xf7, 0x08, 0x6b, 
-    0x3d, 0x66, 0x8f, 0x4e, 0x40, 0x3e, 0x32, 0xb4, 0x00, 0x2c, 0xdf, 0x11, 0x8f, 0x2b, 0x93, 0x0b, 
-    0x77, 0x85, 0xd7, 0x7b, 0xcc, 0xce, 0xbc, 0x82, 0xcd, 0xe8, 0xf7, 0xf5, 0xa5, 0x09, 0x7a, 0xee, 
-    0x12, 0x13, 0x06, 0x6a, 0x3d, 0x66, 0x3f, 0x2e, 0xa5, 0x54, 0xfd, 0xce, 0x49, 0xd3, 0xf5, 0xd1, 
-    0x10, 0xbf, 0x68, 0x6f, 0xb0, 0xd6, 0xb4, 0xde, 0x3c, 0xa2, 0x60, 0x3e, 0xc0, 0x53, 0xb6, 0xdf, 
-    0x4d, 0x24, 0x3b, 0x83, 0x00, 0x36, 0x97, 0x6a, 0x73, 0xce, 0xf0, 0x28, 0x24, 0x60, 0x16, 0xac, 
-    0x02, 0x1d, 0xcf, 0x0b, 0x61, 0x5f, 0xd0, 0xb4, 0xb0, 0xdd, 0x65, 0x44, 0x33, 0x21, 0xfe, 0x18, 
-    0xf2, 0x99, 0x1f, 0xcf, 0x2c, 0x2c, 0x05, 0xa0, 0xd6, 0x63, 0x32, 0x1c, 0x75, 0xe7, 0xfb, 0x05, 
-    0xf4, 0xeb, 0xc1, 0xc1, 0x52, 0xdd, 0x89, 0xea, 0x3e, 0x7a, 0xa7, 0xf6, 0x5a, 0x78, 0x2c, 0xf8, 
-    0x9d, 0x62, 0x7a, 0xd9, 0x7e, 0x45, 0x75, 0x1f, 0xbd, 0x5f, 0x8f, 0x26, 0xb7, 0x97, 0xed, 0x9b, 
-    0x5e, 0xfb, 0xd1, 0x7b, 0xf7, 0x38, 0x82, 0x7c, 0xd9, 0xae, 0x45, 0x75, 0x1f, 0xbd, 0x63, 0x4a, 
-    0xb2, 0x7f, 0x9f, 0x50, 0x5f, 0xb6, 0x67, 0x51, 0xdd, 0xdf, 0x51, 0xc0, 0xbf, 0x52, 0xd6, 0xc3, 
-    0xff, 0x63, 0x55, 0x6f, 0x97, 0x5b, 0xc6, 0x16, 0xd3, 0xbd, 0x65, 0xa5, 0x3f, 0x94, 0xf2, 0xcd, 
-    0x91, 0x5a, 0x58, 0xfb, 0x8e, 0xaa, 0xfd, 0x01, 0xd5, 0x6f, 0x8e, 0xdc, 0xc2, 0xfa, 0x77, 0x54, 
-    0xed, 0x8f, 0xa3, 0x80, 0x73, 0x9c, 0x96, 0xd0, 0xc0, 0xf5, 0x8a, 0x7f, 0x18, 0x15, 0x5c, 0xcc, 
-    0x80, 0x45, 0x75, 0xf0, 0xa8, 0xda, 0x1f, 0x4c, 0x09, 0xe7, 0x88, 0x2d, 0xac, 0x85, 0x47, 0xd5, 
-    0xfe, 0xb1, 0xa4, 0xf4, 0xff, 0xd1, 0x7a, 0xb8, 0x98, 0xd7, 0x8b, 0x2e, 0xa8, 0x51, 0xb5, 0x3f, 
-    0x8e, 0x26, 0x1e, 0x89, 0xdd, 0x25, 0x34, 0x84, 0x78, 0xe5, 0x3f, 0x94, 0x2e, 0x1e, 0x09, 0xdf, 
-    0xa5, 0x7b, 0xf6, 0x87, 0xd5, 0xc6, 0x75, 0x59, 0xbc, 0x74, 0xef, 0xfe, 0xb8, 0xfa, 0x78, 0x24, 
-    0x9e, 0x97, 0xee, 0xdc, 0x1f, 0x56, 0x23, 0x8f, 0x44, 0xf5, 0xd2, 0x7d, 0x5b, 0x48, 0x27, 0xff, 
-    0xdd, 0x7d, 0x97, 0x94, 0x65, 0x9e, 0x0e, 0x35, 0xc5, 0xa1, 0xe1, 0xa4, 0x13, 0x4d, 0x71, 0x72, 
-    0x38, 0xe5, 0x3c, 0xf3, 0xf2, 0xd3, 0xe5, 0xd5, 0xd1, 0x59, 0xf2, 0x40, 0x53, 0x78, 0x71, 0x2e, 
-    0x77, 0xa2, 0x79, 0x48, 0xa1, 0xc0, 0xe9, 0x7a, 0xbc, 0x79, 0xc2, 0x42, 0xfb, 0x1c, 0x1e, 0x27, 
-    0x9c, 0xfb, 0x57, 0x4f, 0xf4, 0x96, 0x5d, 0xce, 0xd7, 0x42, 0x38, 0x9d, 0x82, 0x20, 0x9b, 0xec, 
-    0x24, 0x13, 0x1f, 0x0f, 0x33, 0x6e, 0x43, 0x66, 0x19, 0x87, 0x6b, 0xe1, 0x39, 0xac, 0x39, 0x5c, 
-    0x47, 0x2e, 0xcb, 0x4b, 0x1d, 0xfb, 0x70, 0x97, 0x96, 0x12, 0xc5, 0x16, 0xce, 0x96, 0xf9, 0x75, 
-    0xf6, 0x6c, 0x66, 0xf7, 0xd8, 0xf1, 0xfb, 0xb7, 0x16, 0x7a, 0x81, 0xd1, 0x93, 0xef, 0x3c, 0xfc, 
-    0x69, 0x19, 0x87, 0x3f, 0x4e, 0x27, 0x07, 0x85, 0x3b, 0xd0, 0x42, 0x2e, 0xfb, 0xd6, 0x6e, 0xc2, 
-    0xba, 0xcf, 0xf8, 0x48, 0xfd, 0x9c, 0xcd, 0xe7, 0xe3, 0x18, 0xf9, 0x54, 0x20, 0x8b, 0xdd, 0xc5, 
-    0x2f, 0x53, 0x5d, 0x1e, 0xa7, 0xf0, 0xff, 0x66, 0x22, 0x6c, 0x46, 0x66, 0xc9, 0xbe, 0x3c, 0x5d, 
-    0x9f, 0xd4, 0x97, 0x4b, 0xab, 0xc3, 0x0f, 0x5e, 0x19, 0x62, 0x1a, 0xb0, 0x5b, 0x27, 0xec, 0xa1, 
-    0x03, 0x05, 0xcc, 0x2d, 0x97, 0x75, 0x6c, 0xf2, 0xaa, 0xe3, 0xea, 0x10, 0x28, 0x3f, 0x78, 0xad, 
-    0x6c, 0x5c, 0x02, 0x45, 0x6b, 0x10, 0x3a, 0x83, 0x51, 0x6a, 0xd7, 0xad, 0xa1, 0x53, 0x0e, 0x00, 
-    0x26, 0x1e, 0x91, 0x66, 0x71, 0x16, 0x76, 0xe4, 0xb9, 0xee, 0x77, 0x0d, 0x46, 0x7d, 0xfd, 0xe9, 
-    0xc4, 0xc1, 0xc0, 0x63, 0x40, 0x1e, 0x29, 0x9f, 0x09, 0x86, 0x03, 0x8c, 0x71, 0x43, 0xfd, 0xee, 
-    0x94, 0x75, 0x7c, 0xaf, 0xcf, 0x3a, 0x92, 0x2f, 0x50, 0x65, 0xe3, 0x63, 0x13, 0xcc, 0xee, 0x85, 
-    0x6f, 0x0f, 0x7d, 0xef, 0xc6, 0x09, 0xd0, 0x97, 0x18, 0x47, 0x32, 0x6a, 0xe6, 0x3b, 0xfb, 0xf2, 
-    0x74, 0x22, 0x63, 0x1d, 0x5b, 0x78, 0xc0, 0x3d, 0x66, 0x6f, 0x6d, 0xf4, 0x04, 0xa1, 0xf3, 0x46, 
-    0xd0, 0x33, 0x5d, 0x37, 0x8a, 0xc4, 0x8a, 0x3d, 0xf8, 0xe0, 0x1c, 0x3b, 0xac, 0xe5, 0xdb, 0x6d, 
-    0x90, 0x36, 0x8e, 0xe5, 0x42, 0x57, 0xae, 0x7a, 0x4e, 0x00, 0x5a, 0xe9, 0x00, 0xc3, 0x72, 0x37, 
-    0x6d, 0x06, 0xad, 0x78, 0x03, 0x7b, 0x7a, 0x0f, 0x7d, 0x6c, 0x02, 0xe7, 0x8c, 0xde, 0xe4, 0x3c, 
-    0x87, 0x98, 0xd3, 0xc5, 0x4d, 0xad, 0xa2, 0x8b, 0x9b, 0xbd, 0x8b, 0x53, 0x76, 0x34, 0x68, 0xd3, 
-    0xfd, 0xc7, 0x74, 0x69, 0x23, 0x83, 0x80, 0xc4, 0x96, 0xb9, 0x28, 0xf4, 0x46, 0x66, 0x97, 0x06, 
-    0xe3, 0x56, 0xca, 0x0b, 0xbe, 0xc6, 0x59, 0x22, 0xae, 0xb8, 0xfe, 0x2e, 0x63, 0x54, 0x26, 0x8f, 
-    0x1f, 0x85, 0x61, 0x5a, 0x20, 0x0c, 0x75, 0xcd, 0x86, 0xce, 0xf4, 0x9f, 0x95, 0xad, 0xb4, 0x75, 
-    0x78, 0x5e, 0xfc, 0x68, 0x08, 0xbb, 0xa9, 0xe8, 0xf1, 0x57, 0x8b, 0x63, 0xa7, 0xee, 0xe3, 0x4a, 
-    0xd8, 0xdf, 0x85, 0x20, 0x5f, 0xe4, 0x52, 0x11, 0x14, 0xeb, 0xdf, 0xc2, 0x08, 0x8a, 0x65, 0x4c, 
-    0x42, 0xb6, 0x76, 0x1f, 0x67, 0x8d, 0xba, 0xf0, 0xbd, 0xaf, 0xe8, 0xf0, 0xf3, 0x0a, 0x03, 0x90, 
-    0x2d, 0xcb, 0x34, 0xcf, 0x9d, 0xf0, 0x64, 0xd4, 0x8c, 0x77, 0x17, 0x13, 0x59, 0x04, 0x5b, 0xe5, 
-    0x72, 0x17, 0x84, 0xdc, 0xa8, 0x59, 0x6a, 0x79, 0xfd, 0xb2, 0x0f, 0x4a, 0x75, 0xdf, 0x1a, 0xb9, 
-    0x76, 0xd9, 0x1e, 0x3a, 0x2d, 0xc1, 0x4a, 0xe4, 0x05, 0x18, 0x02, 0x82, 0x78, 0xf7, 0xed, 0xaf, 
-    0x4d, 0xd7, 0x1a, 0x5c, 0x2f, 0x4e, 0x9e, 0x4b, 0x6f, 0xe4, 0xb7, 0xa4, 0xb9, 0xe7, 0xd0, 0x6b, 
-    0x05, 0xcb, 0x8f, 0x20, 0x08, 0x1f, 0xdb, 0x0a, 0xec, 0xe0, 0x3b, 0xfa, 0x03, 0x13, 0x9e, 0xc3, 
-    0xf8, 0xfe, 0x8e, 0x1d, 0x7a, 0xb7, 0x03, 0x12, 0x86, 0x52, 0xae, 0x2e, 0xdf, 0xb1, 0xd3, 0x20, 
-    0x18, 0x7d, 0x5f, 0xb7, 0x1c, 0x82, 0xf0, 0xfd, 0x9d, 0x7a, 0x6b, 0x63, 0xd6, 0x16, 0xd6, 0x1c, 
-    0x75, 0xd3, 0x58, 0x39, 0xc9, 0xd8, 0x3a, 0xb0, 0x69, 0xf1, 0x90, 0x53, 0xc3, 0x7c, 0xf1, 0xfb, 
-    0x55, 0xbb, 0x2b, 0x7f, 0x6a, 0x79, 0xc3, 0xf1, 0x36, 0xab, 0x55, 0x6a, 0x0d, 0x36, 0x57, 0xef, 
-    0x13, 0xfd, 0xdc, 0x55, 0xaf, 0x10, 0x6b, 0xf6, 0xb7, 0xec, 0x51, 0x78, 0x3d, 0x96, 0x86, 0x06, 
-    0x41, 0xaf, 0x4c, 0xa3, 0x08, 0xd7, 0x95, 0xcf, 0x5e, 0x1f, 0xee, 0xbd, 0xba, 0x34, 0xf5, 0x64, 
-    0x1e, 0x54, 0x2a, 0xba, 0xb1, 0x13, 0xf9, 0x53, 0xa1, 0xab, 0x65, 0xdc, 0xc7, 0x2a, 0x8a, 0x59, 
-    0x25, 0xae, 0xbc, 0x25, 0x41, 0x48, 0xf3, 0xcf, 0x5e, 0xbb, 0xad, 0x5d, 0xee, 0xa1, 0x8b, 0x6f, 
-    0x33, 0xfd, 0x08, 0x29, 0xac, 0x01, 0xaa, 0x32, 0x07, 0x4e, 0x38, 0x4e, 0x95, 0x2c, 0x5a, 0x98, 
-    0x83, 0x4c, 0xcc, 0xe3, 0x94, 0x6f, 0x85, 0xe4, 0xad, 0x13, 0x5e, 0x30, 0xc3, 0x86, 0xae, 0xd5, 
-    0xb2, 0x7b, 0x9e, 0xdb, 0xb6, 0xfd, 0x9d, 0xcc, 0x15, 0x14, 0x64, 0x78, 0x03, 0x9e, 0xc2, 0x87, 
-    0xb3, 0x9c, 0x5d, 0xea, 0x96, 0x0a, 0x6c, 0x6f, 0xe4, 0x03, 0xab, 0x15, 0xd8, 0xeb, 0x01, 0x50, 
-    0xd9, 0xf1, 0xf2, 0x19, 0x0a, 0xb4, 0x0d, 0xe3, 0x31, 0x74, 0xed, 0x10, 0x00, 0x7b, 0x78, 0xe3, 
-    0x33, 0xa2, 0x58, 0x04, 0xbd, 0x08, 0x6b, 0xf4, 0xc8, 0x0d, 0x23, 0xc9, 0x1c, 0xbb, 0x72, 0x3f, 
-    0xc7, 0xe6, 0xca, 0xbc, 0xc0, 0xce, 0xef, 0x86, 0xa5, 0xbe, 0x12, 0x16, 0xf2, 0xd7, 0x3e, 0x23, 
-    0x2e, 0x86, 0x35, 0xc7, 0xf3, 0x81, 0x8d, 0x41, 0x8b, 0x0e, 0x60, 0x43, 0x37, 0x18, 0x81, 0x12, 
-    0x32, 0xde, 0x9a, 0xc3, 0xdb, 0x5b, 0x51, 0x5b, 0xad, 0x5e, 0xe7, 0x96, 0xee, 0xb6, 0x99, 0x4e, 
-    0xd1, 0x81, 0x7d, 0x8b, 0x03, 0xcc, 0xdd, 0x0e, 0x4d, 0x9a, 0x72, 0x1a, 0xc2, 0xd8, 0x85, 0x34, 
-    0xec, 0x13, 0x9b, 0x9f, 0xcf, 0x41, 0xfa, 0x15, 0xe0, 0x14, 0x8e, 0xda, 0xf6, 0xec, 0x1b, 0x17, 
-    0x12, 0x25, 0xd7, 0x0a, 0x51, 0x72, 0xd8, 0xc3, 0x9d, 0x4c, 0xa5, 0x54, 0xa9, 0x54, 0xaa, 0x31, 
-    0xfc, 0xd6, 0x36, 0x4a, 0xeb, 0x95, 0xf5, 0x5a, 0x66, 0x01, 0xc2, 0x0c, 0xba, 0x8b, 0xe2, 0x80, 
-    0x33, 0x67, 0x0a, 0x0e, 0xc5, 0x6a, 0xad, 0x56, 0xaa, 0xd7, 0x6b, 0xd5, 0x4c, 0x82, 0x17, 0xe6, 
-    0xdf, 0x55, 0x8d, 0x02, 0xfb, 0x6c, 0x2c, 0x47, 0xed, 0xd8, 0xf3, 0xcf, 0xe9, 0x86, 0xac, 0x94, 
-    0x73, 0x51, 0xa4, 0xbd, 0xcc, 0xee, 0xbb, 0x00, 0x54, 0xfa, 0x71, 0xda, 0xd5, 0xba, 0xc4, 0x6c, 
-    0x9e, 0x79, 0xb7, 0x2f, 0xf5, 0xd6, 0xaf, 0xeb, 0x01, 0x2e, 0xc9, 0xdb, 0x7c, 0x07, 0xd6, 0xa0, 
-    0x65, 0xdc, 0x41, 0x9a, 0x61, 0x17, 0xa0, 0x9b, 0x28, 0xf0, 0x40, 0x89, 0x0e, 0xb4, 0x0f, 0xc4, 
-    0xcc, 0x05, 0xfa, 0x6d, 0x56, 0x10, 0x29, 0x13, 0x15, 0x60, 0x29, 0xe7, 0x4c, 0xb9, 0xa6, 0x5d, 
-    0x12, 0x5c, 0x5a, 0xb0, 0x29, 0x18, 0xba, 0x64, 0xd3, 0xee, 0x13, 0xce, 0x23, 0xda, 0x8e, 0x30, 
-    0x7c, 0x36, 0x43, 0xf1, 0x93, 0xee, 0x95, 0x0f, 0x7c, 0xd4, 0x6a, 0xd3, 0x55, 0x3d, 0xea, 0x7e, 
-    0x0f, 0x2d, 0x6d, 0x30, 0xe2, 0xb4, 0x4b, 0x56, 0x4d, 0x1d, 0x3b, 0xb6, 0xdb, 0x0e, 0x90, 0x10, 
-    0xf1, 0xab, 0x4f, 0x95, 0xcc, 0xee, 0xbe, 0xe3, 0x87, 0xbd, 0x36, 0xde, 0x86, 0x9d, 0x70, 0x3d, 
-    0x0a, 0x78, 0xef, 0xc8, 0x02, 0x1e, 0xf5, 0x27, 0x96, 0x80, 0x39, 0x72, 0xc2, 0xe3, 0x7e, 0xe3, 
-    0xf5, 0xed, 0x09, 0x85, 0xea, 0x99, 0xdd, 0xf7, 0x96, 0x8b, 0x1b, 0x9b, 0x81, 0x9d, 0x0d, 0xd8, 
-    0xe1, 0x94, 0x16, 0xd7, 0x80, 0x23, 0x7a, 0xbe, 0x13, 0x84, 0x7d, 0x2b, 0x98, 0x58, 0xa8, 0x21, 
-    0xbd, 0x98, 0x01, 0x14, 0x5a, 0x04, 0x16, 0xbd, 0xb9, 0x25, 0x6f, 0x0b, 0xd2, 0xd8, 0x24, 0xbc, 
-    0x96, 0xf1, 0xe1, 0x3c, 0xb2, 0x4d, 0x02, 0x30, 0x8c, 0x63, 0xf5, 0x6a, 0xaa, 0xa8, 0x3b, 0xf3, 
-    0xfa, 0xd0, 0x71, 0x49, 0xef, 0x19, 0x12, 0x4f, 0xa2, 0x47, 0xf1, 0xfc, 0xd2, 0x0e, 0x4e, 0xd2, 
-    0xb8, 0xe5, 0x0c, 0x38, 0xb1, 0x37, 0x8d, 0x51, 0xfa, 0x58, 0x20, 0x93, 0x36, 0xc4, 0x2f, 0x70, 
-    0x29, 0xf0, 0xa3, 0x31, 0x49, 0x0e, 0xf1, 0xb1, 0xdd, 0xf4, 0xa7, 0x15, 0x81, 0x01, 0x3e, 0xc3, 
-    0x85, 0x67, 0xda, 0xb0, 0xee, 0xc1, 0x14, 0x76, 0x27, 0x01, 0x68, 0x20, 0x80, 0x89, 0xe0, 0xd7, 
-    0x01, 0xc7, 0xd1, 0xc0, 0x9e, 0x08, 0x7d, 0x03, 0xdf, 0xbb, 0x13, 0xab, 0x6f, 0xa2, 0x27, 0x76, 
-    0x17, 0x18, 0x66, 0x52, 0x81, 0xa7, 0x78, 0xae, 0x36, 0x0c, 0x6d, 0x14, 0xd2, 0x93, 0xe7, 0x02, 
-    0x4c, 0x98, 0xd7, 0xb0, 0xad, 0xd6, 0xcb, 0xc4, 0x8b, 0x00, 0x31, 0xcf, 0xbd, 0x1b, 0x13, 0x4e, 
-    0xbc, 0x4c, 0x0d, 0xf7, 0x58, 0xad, 0x78, 0x5b, 0x8b, 0x5e, 0xdb, 0xa1, 0x39, 0x34, 0xcf, 0x52, 
-    0x43, 0x7c, 0x34, 0x8e, 0x5d, 0x9f, 0x41, 0x2e, 0x8d, 0xc6, 0x7f, 0x8a, 0xaa, 0xf1, 0x48, 0x02, 
-    0xdf, 0xb8, 0x58, 0xbd, 0xac, 0xc4, 0x8f, 0x64, 0x6a, 0x8a, 0xc8, 0x57, 0x02, 0x6f, 0x49, 0x99, 
-    0x2f, 0x2e, 0x6c, 0x2f, 0x2f, 0xf0, 0xb9, 0x57, 0xbe, 0x2e, 0xed, 0xa3, 0xbb, 0xdd, 0x2a, 0xbc, 
-    0xc5, 0x3c, 0x62, 0x9f, 0xfb, 0x10, 0xb0, 0x1c, 0x0c, 0x14, 0xab, 0xae, 0xf3, 0xbc, 0x94, 0xf9, 
-    0xb9, 0xe4, 0x11, 0x5e, 0x65, 0xee, 0x51, 0x6d, 0x43, 0x24, 0x55, 0xd7, 0x53, 0x45, 0xd2, 0x9b, 
-    0x91, 0x17, 0xda, 0x0b, 0x5c, 0x2e, 0xf5, 0xda, 0xfc, 0xcc, 0x99, 0x63, 0xb6, 0x59, 0x49, 0x60, 
-    0x26, 0x53, 0x0f, 0x98, 0x08, 0x61, 0x60, 0x24, 0x03, 0x9d, 0xcd, 0x4a, 0x86, 0x81, 0x94, 0x0b, 
-    0xe8, 0x8e, 0xab, 0x81, 0x17, 0xdd, 0x3a, 0xe9, 0xdb, 0x41, 0x60, 0x75, 0xed, 0x52, 0xa9, 0x84, 
-    0x9a, 0xb0, 0x84, 0x69, 0xee, 0xcf, 0x16, 0xb9, 0x83, 0xa1, 0x5d, 0x0c, 0x03, 0x94, 0x10, 0x9b, 
-    0xc4, 0x25, 0xec, 0xcd, 0xca, 0x62, 0xf7, 0x5a, 0x8e, 0xf9, 0xf9, 0x30, 0xd1, 0xa1, 0x5e, 0x59, 
-    0x74, 0x84, 0xf8, 0xe9, 0xb2, 0xb9, 0x68, 0x54, 0x52, 0x47, 0xe8, 0x04, 0x0f, 0x3b, 0x2c, 0xd6, 
-    0x85, 0xfe, 0x87, 0x78, 0x4b, 0xe4, 0x49, 0xe6, 0x77, 0x9d, 0xa3, 0x2a, 0x2e, 0xc1, 0xd2, 0x13, 
-    0x94, 0xcf, 0x81, 0xb4, 0xd9, 0x49, 0x6f, 0xa2, 0x98, 0x2f, 0x8b, 0x4f, 0x50, 0x15, 0xed, 0x60, 
-    0xe9, 0x19, 0x2a, 0x20, 0xc8, 0x29, 0x2a, 0x2e, 0xf5, 0xb3, 0x03, 0xd0, 0x9b, 0x06, 0xb6, 0xcb, 
-    0x2e, 0x43, 0x0b, 0xad, 0x99, 0xf3, 0xcc, 0x50, 0x59, 0x15, 0x0d, 0xa1, 0x2f, 0xed, 0x09, 0x72, 
-    0x78, 0x08, 0xd5, 0x6f, 0x3d, 0x8c, 0x2e, 0x23, 0xe2, 0x05, 0x58, 0x43, 0xa7, 0x78, 0x6d, 0x8f, 
-    0x63, 0x23, 0xbd, 0x77, 0xfa, 0xcd, 0xba, 0x1c, 0x13, 0xb7, 0x2f, 0x79, 0xc9, 0xe8, 0xb9, 0x1d, 
-    0x02, 0x93, 0x74, 0x80, 0xb4, 0x0c, 0xc0, 0x73, 0xdb, 0x78, 0xc2, 0x5e, 0x00, 0x44, 0x09, 0x3c, 
-    0xd7, 0x2e, 0xc1, 0x80, 0x8f, 0xda, 0xa5, 0xae, 0xe7, 0x75, 0xf1, 0x87, 0xd7, 0x47, 0x53, 0x61, 
-    0x50, 0xd6, 0xcc, 0xce, 0x49, 0x9b, 0x4b, 0x7a, 0xc0, 0xa3, 0xe7, 0x04, 0x82, 0x1d, 0x20, 0x3c, 
-    0x34, 0x49, 0x23, 0x74, 0xb4, 0x28, 0x94, 0x98, 0xb8, 0xad, 0x2b, 0x89, 0x04, 0x1a, 0x9a, 0x45, 
-    0x94, 0xba, 0xa9, 0x97, 0x16, 0xd9, 0x6a, 0xca, 0x71, 0x39, 0xa1, 0xd0, 0xf8, 0xb3, 0x66, 0x17, 
-    0xc6, 0x63, 0xe0, 0x15, 0x62, 0xf4, 0x45, 0xe5, 0xd5, 0x45, 0x23, 0x7b, 0xa9, 0x03, 0x93, 0x1e, 
-    0x39, 0x68, 0x59, 0x3a, 0x7f, 0x70, 0xc2, 0x9e, 0x87, 0x4d, 0xf7, 0x6c, 0xf6, 0x37, 0x2c, 0x18, 
-    0xf7, 0x9b, 0x9e, 0x0b, 0xbd, 0xbd, 0xb3, 0x70, 0xcb, 0xbf, 0xc5, 0x12, 0x0d, 0xa5, 0x5e, 0xe9, 
-    0x92, 0x4c, 0x18, 0x3f, 0x9d, 0x4c, 0x7b, 0x3f, 0xe5, 0x2a, 0xf1, 0xef, 0x27, 0x05, 0xb4, 0xc0, 
-    0x21, 0x73, 0x8a, 0x81, 0x34, 0x88, 0xa1, 0x1d, 0x84, 0x82, 0x01, 0x70, 0xba, 0x5f, 0xd9, 0x41, 
-    0xb8, 0xb8, 0x38, 0x51, 0xb4, 0x48, 0xca, 0x13, 0x0d, 0x36, 0x2e, 0xb5, 0xa1, 0x37, 0x25, 0x98, 
-    0xc5, 0x54, 0xb1, 0x22, 0x42, 0x9c, 0x2c, 0x2d, 0x54, 0x78, 0x86, 0x2d, 0x21, 0x52, 0xde, 0x0d, 
-    0xc9, 0x80, 0x2a, 0x02, 0xa2, 0x2c, 0xb0, 0xd6, 0xf3, 0x65, 0x95, 0x2e, 0xdf, 0x33, 0x8c, 0xc6, 
-    0x86, 0xc1, 0x34, 0x0b, 0x6c, 0x21, 0x05, 0x80, 0x23, 0x32, 0xef, 0xea, 0xcf, 0x8e, 0x29, 0xa2, 
-    0xef, 0xfc, 0xab, 0xbf, 0xb8, 0xae, 0xfb, 0xe2, 0xe2, 0x39, 0xef, 0x9e, 0x50, 0x4f, 0x2a, 0x95, 
-    0x97, 0xfb, 0x13, 0x50, 0xeb, 0x38, 0xae, 0xad, 0xa3, 0xc6, 0x7f, 0x5b, 0xad, 0x16, 0x28, 0xda, 
-    0x3b, 0x99, 0xd2, 0xd7, 0x61, 0xb7, 0x00, 0x7f, 0xec, 0xae, 0xbe, 0x77, 0x05, 0x95, 0xd4, 0xc1, 
-    0x4d, 0x0f, 0x35, 0xa1, 0x05, 0xf4, 0x5a, 0x72, 0xc6, 0xbe, 0x05, 0xce, 0xec, 0xf7, 0x31, 0xfb, 
-    0x59, 0x9b, 0x51, 0x15, 0x26, 0x23, 0x9b, 0x51, 0x22, 0xb4, 0xa0, 0xc4, 0xfb, 0x82, 0xc7, 0xa3, 
-    0xae, 0x8b, 0x47, 0x6c, 0xdc, 0xd8, 0x0b, 0xa5, 0xbd, 0x81, 0xbc, 0xdc, 0x9d, 0x7e, 0x33, 0x93, 
-    0x77, 0xc9, 0x08, 0xc4, 0x16, 0x0f, 0x13, 0x46, 0xd1, 0x4c, 0xe3, 0xc9, 0x17, 0x12, 0x86, 0x65, 
-    0xb2, 0x47, 0xf6, 0xbb, 0x49, 0xa0, 0xda, 0xdc, 0x97, 0x69, 0x02, 0x6a, 0xf1, 0x34, 0x01, 0xfc, 
-    0x41, 0x4a, 0x60, 0xe2, 0xb4, 0x48, 0xab, 0x99, 0x04, 0xfa, 0x48, 0x92, 0xf4, 0x08, 0x52, 0x13, 
-    0x63, 0xdb, 0x36, 0x74, 0xe1, 0x93, 0x4a, 0x93, 0x34, 0xc1, 0xf6, 0xb8, 0x12, 0x4a, 0x85, 0x1e, 
-    0x5a, 0x56, 0x4d, 0x11, 0x88, 0x9a, 0x52, 0x65, 0x44, 0x73, 0x97, 0xf8, 0x01, 0x0d, 0x64, 0x32, 
-    0x54, 0x86, 0x98, 0xd3, 0x33, 0xa5, 0x4a, 0xd0, 0xf2, 0x9d, 0x21, 0xec, 0xde, 0xca, 0x65, 0xbe, 
-    0xe0, 0x81, 0xba, 0xe3, 0x03, 0xa8, 0x15, 0xd7, 0x26, 0xc7, 0x42, 0x12, 0x4d, 0xa7, 0x18, 0x0f, 
-    0x8e, 0xed, 0xb0, 0xcf, 0x5f, 0xb6, 0xe9, 0xb9, 0xb4, 0x60, 0xe9, 0xcf, 0xd4, 0x1e, 0xc7, 0x78, 
-    0xa8, 0x69, 0x4f, 0xfa, 0x73, 0x21, 0x20, 0xa9, 0xc1, 0x1d, 0x36, 0x18, 0xb9, 0xee, 0x36, 0x63, 
-    0x80, 0x81, 0x5c, 0x7a, 0xf9, 0x11, 0xe3, 0x88, 0x9f, 0x88, 0xd0, 0x21, 0x33, 0x2d, 0x2b, 0x54, 
-    0x97, 0x88, 0x60, 0x80, 0x64, 0x54, 0x97, 0xcf, 0x6e, 0xe1, 0xaf, 0x8e, 0x47, 0xa8, 0x02, 0x03, 
-    0x0a, 0x15, 0x22, 0xa2, 0xb1, 0xec, 0xb0, 0xca, 0xb6, 0xfe, 0x38, 0x16, 0x43, 0xee, 0xb4, 0x7d, 
-    0x17, 0x15, 0x11, 0xe7, 0x11, 0x3a, 0x8e, 0xf4, 0x9c, 0x9c, 0x74, 0x12, 0x4f, 0x9d, 0x81, 0x13, 
-    0x1e, 0x08, 0x1b, 0x3a, 0xbc, 0xe8, 0x80, 0x42, 0x62, 0xf3, 0x3e, 0x1d, 0xbb, 0x3c, 0x62, 0x19, 
-    0x4e, 0x0f, 0x34, 0x8b, 0xd9, 0x96, 0xef, 0x8e, 0x99, 0x4a, 0x6d, 0x28, 0xef, 0x52, 0x23, 0x80, 
-    0x15, 0x1c, 0x85, 0xa3, 0xb6, 0x13, 0x32, 0x74, 0x57, 0xc0, 0x9c, 0x4d, 0xad, 0x6b, 0x78, 0x47, 
-    0x0d, 0x60, 0xc6, 0x17, 0xf8, 0x8e, 0x43, 0xa1, 0x48, 0x06, 0xa5, 0xef, 0xd5, 0x18, 0xb5, 0xef, 
-    0x0a, 0x24, 0xc0, 0x0a, 0xd4, 0xf9, 0x53, 0x0c, 0x28, 0xfc, 0xc0, 0x6e, 0x29, 0x02, 0x0b, 0xaf, 
-    0x5a, 0xa0, 0x5a, 0xfc, 0x11, 0x3f, 0x14, 0x22, 0xc0, 0xdc, 0xf0, 0x8e, 0xae, 0xe0, 0xa8, 0x23, 
-    0x68, 0xa0, 0x0f, 0xed, 0x26, 0x8c, 0x69, 0x0b, 0xf0, 0x80, 0x77, 0x3e, 0x1d, 0x54, 0xb8, 0x66, 
-    0x4c, 0xe6, 0x95, 0x15, 0xd4, 0xce, 0x90, 0x4f, 0x28, 0x8e, 0xe3, 0x0e, 0x6b, 0x7b, 0xad, 0x11, 
-    0xfa, 0xa8, 0x96, 0x40, 0x0f, 0x3b, 0xe2, 0xee, 0xaa, 0xfb, 0xe3, 0xd3, 0x76, 0x2e, 0x2b, 0x64, 
-    0x43, 0x36, 0xbf, 0x2d, 0xab, 0x84, 0x48, 0x6a, 0x5e, 0x11, 0x4b, 0xa3, 0x6f, 0x00, 0x88, 0x98, 
-    0x5c, 0xb6, 0xd6, 0xc6, 0x42, 0xa2, 0xd4, 0xe9, 0xc1, 0xeb, 0xf3, 0x4b, 0x28, 0x77, 0xbf, 0xc2, 
-    0x54, 0xdb, 0x5b, 0x2c, 0xfb, 0x3f, 0xff, 0xf3, 0xbf, 0xff, 0xd7, 0xd9, 0x02, 0x3c, 0x53, 0x4c, 
-    0xb7, 0x45, 0x45, 0x18, 0xab, 0xd0, 0xdb, 0x7f, 0xf3, 0x2f, 0xb3, 0x05, 0xec, 0x81, 0xb4, 0x5a, 
-    0xd1, 0xab, 0x2a, 0xbd, 0xfa, 0x77, 0x7f, 0xcf, 0x5f, 0x71, 0xe3, 0x20, 0xbd, 0xa8, 0xf1, 0x3a, 
-    0xff, 0x17, 0x7f, 0xa1, 0x6c, 0x82, 0xf4, 0xae, 0x0e, 0xef, 0xfe, 0xe1, 0x3f, 0xfd, 0xbf, 0xff, 
-    0xe3, 0xbf, 0xfe, 0x5b, 0xfe, 0x56, 0x19, 0x03, 0xe9, 0xed, 0x1a, 0xaf, 0xf9, 0x7f, 0xf3, 0x77, 
-    0xca, 0xfa, 0x47, 0xef, 0x1a, 0x1c, 0xcf, 0x7f, 0x95, 0x25, 0x26, 0xe0, 0xdb, 0x08, 0x78, 0xf1, 
-    0x40, 0x68, 0x8b, 0x60, 0x5e, 0x58, 0xe0, 0x3f, 0x51, 0x47, 0xc4, 0x84, 0xc0, 0xd6, 0xfe, 0xee, 
-    0xbf, 0x50, 0x6b, 0xf0, 0x90, 0x38, 0x9d, 0x4a, 0xfd, 0xdd, 0x7f, 0xc3, 0x67, 0x2b, 0x0f, 0x8a, 
-    0x30, 0x47, 0xef, 0x8f, 0xce, 0xaf, 0xfe, 0x7a, 0xbe, 0x77, 0x76, 0x84, 0xe4, 0xf9, 0x9c, 0x95, 
-    0x3d, 0x05, 0x4c, 0xb2, 0xbc, 0x6b, 0xf8, 0x4d, 0xf5, 0x05, 0x7f, 0x28, 0xd4, 0xff, 0x92, 0x0d, 
-    0xf0, 0xb7, 0x42, 0x97, 0x7e, 0xf0, 0x2d, 0xd4, 0x17, 0x39, 0x3c, 0x67, 0xaf, 0xcf, 0xaf, 0x4e, 
-    0x34, 0xf8, 0x2f, 0x2c, 0x80, 0x91, 0x3d, 0xb6, 0x9b, 0xf0, 0xf7, 0xcc, 0x02, 0xe0, 0xd9, 0xbd, 
-    0xa1, 0x4f, 0xdf, 0xa1, 0xc9, 0xec, 0x8b, 0xd1, 0x80, 0xfe, 0xba, 0xf8, 0x7c, 0xd4, 0x85, 0xbf, 
-    0x97, 0xf6, 0x10, 0xfe, 0xbe, 0x6e, 0x85, 0xf0, 0xf7, 0xdc, 0xbb, 0x81, 0xbf, 0x87, 0x76, 0x0b, 
-    0xc1, 0x23, 0x87, 0x5f, 0x59, 0x4d, 0x91, 0xc1, 0x03, 0x79, 0x50, 0xf1, 0xcc, 0x6f, 0x23, 0xdb, 
-    0x1f, 0x5f, 0x8a, 0xa8, 0x0a, 0x7b, 0x2e, 0x08, 0x4c, 0xcc, 0x20, 0x96, 0xcd, 0x63, 0x76, 0xb8, 
-    0x23, 0xab, 0xd5, 0xcb, 0x61, 0x50, 0xc5, 0x9d, 0x5d, 0x1a, 0x69, 0xcc, 0x52, 0x26, 0x24, 0x20, 
-    0xe0, 0x97, 0xcb, 0xcb, 0xe7, 0x8c, 0x2d, 0x00, 0x0e, 0x2b, 0x85, 0x25, 0x12, 0xba, 0xaf, 0x80, 
-    0x14, 0x25, 0x9e, 0xb2, 0x28, 0x97, 0xe5, 0x91, 0x1b, 0xb2, 0x79, 0xe0, 0xc3, 0x39, 0x20, 0x4a, 
-    0x0d, 0x4b, 0x83, 0xdc, 0x42, 0xc8, 0xad, 0xd9, 0x90, 0xb1, 0x17, 0x51, 0x21, 0x98, 0x93, 0x51, 
-    0x89, 0x58, 0xd3, 0xb1, 0xf9, 0x84, 0x15, 0x71, 0x96, 0x07, 0x76, 0x88, 0x28, 0xe4, 0xa7, 0x41, 
-    0x01, 0xa6, 0x79, 0xc8, 0x73, 0xc2, 0x47, 0x51, 0x6c, 0x18, 0x8f, 0x13, 0xb4, 0x32, 0x71, 0xc2, 
-    0x46, 0x51, 0x68, 0xa0, 0x5f, 0xde, 0x80, 0xeb, 0x47, 0x3b, 0xcc, 0x96, 0x84, 0x9e, 0xa3, 0x22, 
-    0x9e, 0x73, 0x43, 0x65, 0x9c, 0xd6, 0x07, 0x22, 0x26, 0x24, 0x00, 0x28, 0xf1, 0x5d, 0x5a, 0x89, 
-    0x8c, 0x78, 0x6c, 0x95, 0x65, 0x7f, 0xca, 0x6e, 0x13, 0x63, 0x03, 0x7e, 0x3c, 0xd6, 0x4e, 0x73, 
-    0x7e, 0x2c, 0xe3, 0x11, 0x73, 0x16, 0xc4, 0x35, 0x2d, 0xe0, 0xce, 0x32, 0x18, 0x73, 0x69, 0xcd, 
-    0xd3, 0x87, 0x14, 0x29, 0x14, 0x55, 0xb9, 0x87, 0x1e, 0xfa, 0xd2, 0x4d, 0x6a, 0x56, 0x07, 0xf4, 
-    0xb0, 0x4e, 0xd4, 0x05, 0xae, 0x56, 0xe2, 0x3a, 0x02, 0x02, 0x98, 0x9f, 0x07, 0xcd, 0xd3, 0x13, 
-    0x23, 0x9c, 0x13, 0x00, 0x22, 0x0d, 0xa9, 0x24, 0x83, 0xfd, 0xec, 0xc0, 0xd2, 0xe5, 0x04, 0x25, 
-    0x11, 0x05, 0x8c, 0xfd, 0xcc, 0xb2, 0x14, 0x3e, 0x3e, 0xcb, 0x40, 0xc4, 0xa0, 0xce, 0x17, 0xf5, 
-    0xea, 0x14, 0xd6, 0x22, 0xd8, 0x52, 0x83, 0x4e, 0x25, 0x42, 0x03, 0xf1, 0x0e, 0xe2, 0x6d, 0x21, 
-    0x79, 0xd8, 0x1b, 0xac, 0x48, 0xd4, 0x68, 0xe5, 0x22, 0x3a, 0xa0, 0x5f, 0x1d, 0x9f, 0x1e, 0x81, 
-    0xc0, 0x97, 0x0b, 0x13, 0x0a, 0xf0, 0x04, 0x2f, 0xa6, 0x2d, 0x10, 0x5a, 0x28, 0x28, 0xce, 0xb6, 
-    0xbc, 0x2a, 0xac, 0x92, 0x73, 0x55, 0x84, 0x72, 0xbc, 0x1a, 0x60, 0x8f, 0xfb, 0xaa, 0x40, 0x04, 
-    0x31, 0x0a, 0x8c, 0x20, 0x46, 0xb8, 0x8a, 0xf0, 0x5f, 0xb8, 0x58, 0x65, 0x63, 0xf6, 0xed, 0x62, 
-    0x35, 0xb3, 0xcb, 0x83, 0x1e, 0x4d, 0xb2, 0x80, 0x17, 0x6b, 0x54, 0x02, 0x21, 0xab, 0x22, 0x59, 
-    0xad, 0x55, 0x8c, 0xa0, 0xa4, 0xb5, 0x85, 0x2b, 0x66, 0x0e, 0x1b, 0xec, 0x91, 0x56, 0x01, 0x1f, 
-    0xcf, 0x40, 0x8f, 0x87, 0xcf, 0xd5, 0xd5, 0xbc, 0x90, 0x56, 0xbc, 0x97, 0xb0, 0x11, 0xc7, 0x45, 
-    0x1d, 0xdf, 0x57, 0x6b, 0x38, 0x30, 0x7b, 0x67, 0x34, 0x2a, 0x17, 0x67, 0xd9, 0x6d, 0xad, 0x18, 
-    0x82, 0x87, 0xf7, 0x58, 0x70, 0x67, 0x07, 0x20, 0x42, 0x49, 0xf8, 0xb9, 0xc5, 0x72, 0x3d, 0xb6, 
-    0xcb, 0x2b, 0xf6, 0x80, 0xfd, 0xe8, 0x51, 0x4f, 0x08, 0x10, 0xea, 0xea, 0x6a, 0xb2, 0xaf, 0x59, 
-    0xe0, 0xe3, 0x1e, 0xf2, 0x72, 0x66, 0x97, 0xbe, 0x72, 0xc8, 0xf0, 0x7b, 0xab, 0x52, 0x61, 0xf8, 
-    0x84, 0x50, 0x82, 0xdf, 0x66, 0x3f, 0x1f, 0xe0, 0x9f, 0x1c, 0xcd, 0x92, 0x33, 0x18, 0xd8, 0xfe, 
-    0xc9, 0xd5, 0xd9, 0x2b, 0xc0, 0x08, 0xdb, 0xc1, 0x02, 0x7c, 0xbc, 0x52, 0x5f, 0x01, 0x8d, 0x2e, 
-    0x6d, 0xf4, 0x52, 0xed, 0x58, 0xe8, 0x45, 0xa0, 0x43, 0xe2, 0x33, 0x0b, 0xb0, 0xac, 0xd5, 0xb2, 
-    0x5c, 0x69, 0xaa, 0x56, 0xd8, 0xc5, 0x59, 0x04, 0x4f, 0x15, 0xd8, 0xc0, 0xf7, 0x5c, 0xdf, 0xdb, 
-    0x60, 0x7b, 0x67, 0x2b, 0x0f, 0x2b, 0xe9, 0xdc, 0x27, 0xe4, 0x1d, 0x5a, 0x7e, 0x71, 0x17, 0x0a, 
-    0xf2, 0x90, 0x9c, 0x08, 0x28, 0x88, 0x27, 0x8d, 0xcb, 0xc0, 0xbe, 0x15, 0xcb, 0xb0, 0x50, 0x19, 
-    0xa7, 0xcc, 0x51, 0xdd, 0x20, 0xbc, 0xa8, 0x84, 0x31, 0x2c, 0xb7, 0x33, 0x64, 0x4b, 0x89, 0xef, 
-    0x7c, 0xd5, 0x34, 0xe4, 0xe9, 0xe8, 0x28, 0xc3, 0x22, 0x2e, 0x94, 0x6a, 0xc2, 0x45, 0xd1, 0x4c, 
-    0x51, 0xdf, 0xe3, 0xac, 0x34, 0x41, 0x3d, 0xe4, 0x9e, 0x9b, 0xa0, 0x7d, 0xc2, 0xb2, 0x40, 0xb3, 
-    0x18, 0x8a, 0xf2, 0x73, 0x56, 0x02, 0x80, 0x34, 0xcb, 0x71, 0xa5, 0x91, 0x34, 0x56, 0xe2, 0x9a, 
-    0x89, 0x9d, 0xe1, 0xdb, 0x20, 0xe4, 0x0e, 0x6a, 0x77, 0xda, 0xa2, 0xe3, 0x74, 0x18, 0xc1, 0x25, 
-    0x46, 0xd5, 0x0f, 0x51, 0xd8, 0x84, 0x53, 0x5e, 0xe8, 0xf4, 0x4a, 0xd4, 0x43, 0x6d, 0xd7, 0x14, 
-    0x75, 0x71, 0x09, 0xbc, 0xe2, 0xeb, 0xee, 0xf6, 0x2c, 0x4a, 0xd9, 0x52, 0xf9, 0xe6, 0x0c, 0xcb, 
-    0xc3, 0xe9, 0x74, 0x08, 0xc7, 0x44, 0xaf, 0x22, 0x5f, 0x80, 0xb8, 0xea, 0x11, 0x47, 0x30, 0xf2, 
-    0xa1, 0x01, 0x0e, 0x50, 0xbc, 0x9c, 0xdd, 0x9e, 0xb7, 0x96, 0xf4, 0xbc, 0xc9, 0xce, 0xea, 0xdb, 
-    0xa2, 0xd0, 0xf4, 0x79, 0x3a, 0x13, 0x1f, 0xdd, 0x2b, 0x66, 0x91, 0x7e, 0x68, 0xae, 0x2b, 0x4b, 
-    0x55, 0x43, 0x0a, 0xc7, 0xaa, 0x3d, 0x30, 0x1b, 0xb8, 0x75, 0x0a, 0x97, 0xdd, 0xcf, 0x86, 0x2d, 
-    0x3c, 0x10, 0x74, 0xd8, 0x95, 0x79, 0x70, 0x92, 0x87, 0xe7, 0x8b, 0xf6, 0x45, 0x1e, 0x64, 0xeb, 
-    0xf5, 0xaa, 0x73, 0x56, 0x44, 0xcd, 0x3e, 0x51, 0x2d, 0x9d, 0x08, 0xe2, 0x2c, 0x64, 0x2e, 0x0a, 
-    0x44, 0xc7, 0x6e, 0x0b, 0x77, 0x46, 0x93, 0x87, 0x8b, 0x57, 0xe4, 0x07, 0x49, 0x8b, 0x56, 0x9d, 
-    0x22, 0x47, 0xc5, 0xc8, 0xa5, 0x52, 0x44, 0x58, 0x5d, 0x66, 0x11, 0x24, 0xb2, 0xf5, 0x2d, 0x82, 
-    0x97, 0x6e, 0xbc, 0x5c, 0xbc, 0x9e, 0x6e, 0x86, 0x4b, 0x51, 0xd7, 0xa4, 0x56, 0x36, 0x07, 0x24, 
-    0x6e, 0xbc, 0x5a, 0x74, 0x46, 0x9b, 0x36, 0x25, 0xa8, 0x2d, 0x8d, 0x47, 0xa8, 0x2b, 0xfa, 0x23, 
-    0x9b, 0x2f, 0xf9, 0xba, 0x60, 0x9e, 0x20, 0xbd, 0x35, 0x65, 0x8f, 0x13, 0x9e, 0x0d, 0x2d, 0x3f, 
-    0xb0, 0x4f, 0x07, 0x61, 0x6e, 0x91, 0x39, 0xa8, 0x29, 0x7e, 0x34, 0xc5, 0x9e, 0x53, 0x62, 0xf8, 
-    0x29, 0xca, 0x9f, 0xe9, 0x09, 0xa3, 0x2b, 0x8e, 0x88, 0xe6, 0x3c, 0xd5, 0x23, 0x4f, 0x15, 0x32, 
-    0x3b, 0x70, 0x35, 0x45, 0x29, 0xf0, 0x04, 0x9c, 0x35, 0x61, 0x9f, 0x45, 0x96, 0x55, 0xc4, 0x35, 
-    0xbe, 0x0c, 0x54, 0xd8, 0xdf, 0xfe, 0x2d, 0x53, 0xbf, 0x1a, 0x40, 0x0a, 0xdd, 0xf2, 0xc0, 0xd0, 
-    0xbb, 0x53, 0xee, 0xfd, 0x99, 0xd6, 0xab, 0xe4, 0x60, 0x73, 0x65, 0x5c, 0x63, 0xe3, 0xfb, 0x99, 
-    0x55, 0x14, 0x7f, 0x3c, 0x24, 0x30, 0xc7, 0x7e, 0x99, 0x88, 0xb3, 0x1c, 0x37, 0x0c, 0x30, 0xba, 
-    0x9b, 0xe1, 0xb6, 0x46, 0x98, 0xb5, 0xb0, 0x9d, 0x8f, 0xf7, 0xa7, 0x2a, 0x7a, 0xa0, 0x19, 0x48, 
-    0x14, 0x2d, 0xa7, 0x61, 0x90, 0x32, 0xf5, 0x6a, 0x02, 0x94, 0x32, 0x43, 0x80, 0x76, 0xfa, 0xba, 
-    0x15, 0xb2, 0x7a, 0xf5, 0xbb, 0xc0, 0xd6, 0x05, 0x58, 0x65, 0xd0, 0x00, 0xb0, 0xc7, 0x76, 0x93, 
-    0x55, 0xd7, 0xbe, 0x0b, 0xec, 0x9a, 0x00, 0xab, 0xec, 0x22, 0x00, 0xf6, 0xd0, 0x6e, 0xb1, 0x5a, 
-    0x63, 0x51, 0xb0, 0xf7, 0xb3, 0x2a, 0x60, 0x96, 0x94, 0xac, 0x9a, 0x5c, 0xa4, 0x7c, 0xa0, 0x35, 
-    0x50, 0xd9, 0x5b, 0x19, 0x26, 0x28, 0x88, 0x26, 0x1d, 0xb7, 0x15, 0x46, 0x51, 0xd0, 0xb5, 0xd9, 
-    0x86, 0x05, 0xa7, 0x72, 0xb8, 0x9e, 0xf2, 0x80, 0xcf, 0x0f, 0xfc, 0x96, 0x10, 0x13, 0x62, 0x67, 
-    0x04, 0x2c, 0x48, 0x73, 0x1b, 0xf7, 0x2b, 0x05, 0xd6, 0x6a, 0xeb, 0x3f, 0x80, 0x8b, 0xb5, 0x9f, 
-    0x63, 0xfd, 0x87, 0xd3, 0xef, 0xaa, 0x5f, 0x04, 0xcb, 0x30, 0x1c, 0x2b, 0xb3, 0x48, 0x0e, 0xf3, 
-    0x8a, 0x40, 0xe9, 0xf6, 0x9d, 0x66, 0xaf, 0x11, 0xd3, 0xd5, 0xb9, 0xd1, 0xbb, 0xd1, 0x42, 0xc7, 
-    0x01, 0x5b, 0xf4, 0x24, 0x97, 0x85, 0xb7, 0x4a, 0xbf, 0x71, 0x6e, 0xb8, 0x0e, 0x84, 0x7e, 0xbc, 
-    0x88, 0xbc, 0x91, 0x7b, 0x3a, 0x1b, 0x15, 0xa2, 0xc4, 0xe6, 0x74, 0x9e, 0x1b, 0xc9, 0x32, 0xf1, 
-    0x46, 0x18, 0x4e, 0x28, 0xe7, 0x1a, 0xbc, 0x05, 0x7c, 0x08, 0x69, 0x4e, 0x02, 0x4c, 0x4c, 0x5e, 
-    0xe0, 0xb3, 0xae, 0xc0, 0x30, 0xa6, 0x28, 0xaf, 0x88, 0xac, 0x42, 0x09, 0xd3, 0xa3, 0x89, 0x2f, 
-    0xf8, 0x45, 0x1a, 0x8f, 0xa9, 0x98, 0x1a, 0x17, 0xaf, 0x05, 0x90, 0x95, 0x9d, 0xfc, 0x33, 0xcf, 
-    0xb5, 0x2e, 0xed, 0xb2, 0x5f, 0x50, 0x66, 0xdc, 0x3f, 0x6c, 0x8b, 0x2a, 0xd8, 0x24, 0x94, 0x26, 
-    0x63, 0x67, 0x49, 0xd6, 0x91, 0x2f, 0xb9, 0x08, 0x22, 0x58, 0x25, 0x72, 0xe3, 0x86, 0xaa, 0x59, 
-    0xe5, 0xcd, 0x8c, 0x4a, 0x6f, 0xce, 0x04, 0x0e, 0x4f, 0xaa, 0x79, 0x59, 0x1b, 0x3b, 0x00, 0x95, 
-    0x7f, 0x7d, 0x65, 0x85, 0x5b, 0xec, 0xc7, 0x7b, 0x04, 0x02, 0xd3, 0xfe, 0xe7, 0x52, 0xe8, 0x1d, 
-    0x63, 0xfa, 0xea, 0x1c, 0x30, 0x3d, 0xc2, 0xfb, 0x39, 0xfb, 0x50, 0x80, 0x8e, 0x0c, 0x54, 0x19, 
-    0x6f, 0x90, 0x56, 0xe6, 0x57, 0x09, 0x56, 0xf2, 0xc9, 0xea, 0x2a, 0x7f, 0xa2, 0xcd, 0x27, 0x93, 
-    0x48, 0x52, 0x9a, 0xa8, 0x15, 0xc3, 0xa0, 0x52, 0x0b, 0x17, 0x9a, 0xe8, 0xe0, 0x60, 0x01, 0x2a, 
-    0xa9, 0x4a, 0x9f, 0x5b, 0x6d, 0x6a, 0x8d, 0x0a, 0x73, 0x83, 0x6b, 0x9c, 0x72, 0x58, 0x82, 0xbe, 
-    0x42, 0x09, 0xcd, 0x6e, 0x6a, 0xd6, 0x54, 0x08, 0xaa, 0xea, 0xd8, 0x19, 0x51, 0x44, 0x75, 0x45, 
-    0xbc, 0x52, 0x74, 0x15, 0xb6, 0x56, 0x28, 0x18, 0x09, 0x54, 0x05, 0xc0, 0x90, 0x06, 0x5a, 0x25, 
-    0xcd, 0xb6, 0xfa, 0x19, 0x5b, 0x20, 0xad, 0x10, 0x91, 0x80, 0x16, 0x60, 0xfb, 0xfe, 0x05, 0xb7, 
-    0xdd, 0x7c, 0x60, 0xe1, 0x25, 0xae, 0x21, 0xf4, 0x4a, 0x41, 0x95, 0x14, 0x6c, 0xcf, 0x37, 0x02, 
-    0x52, 0x08, 0x6b, 0xab, 0x90, 0x22, 0xff, 0x88, 0x84, 0x87, 0x71, 0x48, 0xb3, 0xc8, 0x18, 0x50, 
-    0xbd, 0x04, 0xb5, 0xe1, 0x69, 0x89, 0x2b, 0x44, 0x9c, 0xb0, 0x7c, 0x93, 0xcd, 0xc1, 0x67, 0x63, 
-    0x7c, 0x99, 0xa3, 0xd2, 0xa8, 0xd8, 0x51, 0x59, 0xd4, 0x81, 0x46, 0xcd, 0x20, 0xc4, 0x03, 0x91, 
-    0x1c, 0xc8, 0x95, 0x35, 0x98, 0x63, 0xab, 0x5a, 0xa1, 0x9f, 0xc5, 0x0e, 0x99, 0xed, 0xc2, 0x2b, 
-    0xb4, 0x93, 0x94, 0x4a, 0x25, 0x32, 0x94, 0x64, 0x15, 0x79, 0x94, 0x98, 0x9a, 0x49, 0x18, 0xb9, 
-    0x8c, 0x88, 0x33, 0xa7, 0xb4, 0x1e, 0x0a, 0xab, 0x7c, 0xbc, 0x8b, 0xda, 0xe9, 0xd5, 0xcf, 0x25, 
-    0xe1, 0xbc, 0x71, 0x2e, 0xa6, 0x66, 0xda, 0x3b, 0xee, 0x08, 0x42, 0x3d, 0x14, 0x8d, 0xc5, 0xe9, 
-    0x60, 0xd4, 0xa2, 0xb3, 0x64, 0xe8, 0xdd, 0xaf, 0x3f, 0xde, 0xe3, 0x81, 0xb6, 0x15, 0x9e, 0x93, 
-    0x63, 0x64, 0x4e, 0x2b, 0x44, 0x64, 0x6a, 0xf9, 0x0e, 0x3c, 0x0e, 0xf2, 0x0f, 0x4c, 0xfb, 0xf5, 
-    0x2b, 0x92, 0x43, 0x7a, 0xa0, 0xd0, 0xa1, 0x99, 0x6a, 0x6b, 0x3c, 0x27, 0x61, 0xe4, 0x42, 0x48, 
-    0x07, 0x6a, 0x06, 0xc3, 0xe0, 0x79, 0xef, 0x8e, 0x71, 0x00, 0xb7, 0x00, 0xbb, 0x50, 0xb5, 0x38, 
-    0x29, 0x01, 0xa2, 0xc6, 0x2c, 0x39, 0xfc, 0x89, 0x2a, 0x38, 0x09, 0xba, 0x9f, 0x99, 0xfe, 0xb3, 
-    0x04, 0xab, 0xa7, 0x03, 0x6b, 0x41, 0x19, 0x98, 0x64, 0xe8, 0x0d, 0x61, 0x15, 0x84, 0x8e, 0xf2, 
-    0x33, 0xbf, 0x49, 0x42, 0x30, 0x2e, 0x05, 0x11, 0x1c, 0x1e, 0x14, 0x03, 0x64, 0x4e, 0xd8, 0xfd, 
-    0x71, 0x68, 0x07, 0x39, 0xf9, 0x18, 0x21, 0xd2, 0x0f, 0x39, 0x00, 0x59, 0x7e, 0x84, 0x6a, 0xb7, 
-    0x89, 0xc7, 0xce, 0xbd, 0x10, 0xaa, 0x8d, 0xa4, 0xa1, 0x91, 0xfa, 0x27, 0xd6, 0x3d, 0x45, 0xd2, 
-    0x15, 0xb5, 0xc8, 0xe8, 0x0b, 0xec, 0xaf, 0xa2, 0xb8, 0x71, 0xed, 0x0c, 0xd7, 0xa7, 0x22, 0xd9, 
-    0x76, 0xec, 0xcc, 0xee, 0x3f, 0xfc, 0xc7, 0xbf, 0x97, 0x31, 0xde, 0x53, 0x8a, 0x62, 0xd7, 0x8a, 
-    0x48, 0xcb, 0xcc, 0xee, 0x8f, 0xf7, 0xf8, 0xf9, 0x10, 0x2b, 0xac, 0x5f, 0x72, 0xa3, 0xb2, 0x74, 
-    0x59, 0x5f, 0xc9, 0x9d, 0xc4, 0x7b, 0xe1, 0xf5, 0xf1, 0xe3, 0x3d, 0xd0, 0xc5, 0x1a, 0xda, 0x27, 
-    0x61, 0xdf, 0xcd, 0xd1, 0xb3, 0xfc, 0x83, 0x38, 0x17, 0x9e, 0x58, 0x95, 0x47, 0xd9, 0x36, 0x6a, 
-    0xe2, 0xa3, 0x58, 0x45, 0xf3, 0x87, 0x79, 0xba, 0x4d, 0x60, 0xd0, 0xce, 0xa2, 0x9d, 0x61, 0xe3, 
-    0xcf, 0x03, 0x4d, 0x67, 0xc8, 0x41, 0x3f, 0xdb, 0x77, 0x0f, 0x79, 0xa0, 0xcc, 0xff, 0xf3, 0x6f, 
-    0xa2, 0x23, 0xec, 0xc9, 0xf0, 0xb8, 0x31, 0xc4, 0xb8, 0xea, 0x8f, 0x0f, 0xd2, 0x61, 0xfe, 0x7f, 
-    0xff, 0xc1, 0x04, 0xf9, 0xab, 0x58, 0xfe, 0xf1, 0xcc, 0x13, 0xd3, 0x4b, 0xd1, 0x39, 0x6d, 0xa0, 
-    0x86, 0xd2, 0x1b, 0xe0, 0x58, 0x91, 0xb1, 0x52, 0xb7, 0xf9, 0xe1, 0x7f, 0x36, 0x71, 0xdc, 0x15, 
-    0x65, 0x03, 0xb7, 0xfd, 0x12, 0x68, 0x15, 0x38, 0x3b, 0x73, 0x59, 0xdc, 0x9d, 0x96, 0x41, 0xdb, 
-    0x73, 0xf0, 0xe4, 0x0d, 0xf5, 0x1d, 0xc5, 0x89, 0x52, 0x7d, 0x89, 0xcc, 0x66, 0xa4, 0xa8, 0x80, 
-    0xc0, 0x93, 0x6c, 0xf5, 0xb0, 0x1d, 0x6b, 0x19, 0xb4, 0x3f, 0x75, 0xc6, 0x65, 0xd6, 0x97, 0x26, 
-    0xa0, 0x38, 0x88, 0xa8, 0x2e, 0xde, 0x90, 0x97, 0x48, 0xdb, 0x25, 0x71, 0x04, 0x7d, 0xc8, 0x4d, 
-    0xb0, 0xb9, 0x58, 0x69, 0x6f, 0x98, 0xec, 0x5e, 0x7a, 0x0d, 0x29, 0x0f, 0xd0, 0x63, 0x8f, 0x9f, 
-    0x99, 0xab, 0xed, 0x5e, 0x8c, 0x22, 0xdd, 0x14, 0x8a, 0xe4, 0x63, 0x50, 0x42, 0x8f, 0xc3, 0x20, 
-    0x3d, 0x2c, 0x5a, 0x7b, 0x25, 0xf0, 0x27, 0x20, 0x92, 0xa8, 0x88, 0xbe, 0xfe, 0x0a, 0x79, 0xc4, 
-    0x6d, 0x78, 0xa6, 0xb6, 0x89, 0x72, 0xa2, 0x65, 0xcb, 0xea, 0x05, 0x90, 0x03, 0x9f, 0x2b, 0x5f, 
-    0xb6, 0xa3, 0x9a, 0x69, 0x85, 0x09, 0x7e, 0x81, 0x54, 0x59, 0x78, 0x9c, 0x8f, 0x4a, 0xc7, 0x55, 
-    0x6f, 0x73, 0x15, 0x7e, 0x90, 0x7a, 0x23, 0x0d, 0xe6, 0x70, 0x08, 0x85, 0x0f, 0x30, 0x35, 0x6e, 
-    0x0e, 0x48, 0xca, 0xcf, 0xde, 0xf8, 0x9e, 0x72, 0xaa, 0x51, 0x2e, 0xdd, 0xa2, 0x21, 0x35, 0xac, 
-    0xa9, 0x06, 0x59, 0x99, 0x36, 0x2a, 0x51, 0x5b, 0x28, 0x07, 0xd3, 0x2b, 0xab, 0xfc, 0x51, 0xc9, 
-    0xea, 0x72, 0x11, 0x9d, 0x0a, 0x60, 0x3c, 0xa9, 0xfa, 0x78, 0x8e, 0xca, 0x2a, 0xa5, 0x54, 0xa2, 
-    0xb6, 0x14, 0xaa, 0x72, 0x37, 0xce, 0x83, 0x67, 0x90, 0x01, 0x5b, 0x4c, 0x7c, 0x5c, 0xd6, 0xec, 
-    0x20, 0xda, 0xdd, 0xba, 0x4e, 0xdf, 0xa1, 0xf9, 0xca, 0xad, 0x13, 0x7b, 0xed, 0xf6, 0x3e, 0x15, 
-    0xbc, 0xa4, 0x72, 0x39, 0x49, 0x4a, 0xb5, 0xa1, 0xd1, 0x36, 0x33, 0x6a, 0x23, 0x13, 0x6d, 0x62, 
-    0x62, 0xa6, 0xe8, 0xc7, 0x81, 0x69, 0x6c, 0xd9, 0x10, 0x5b, 0x74, 0x6a, 0xd0, 0x5c, 0x1a, 0xea, 
-    0x05, 0xdd, 0x97, 0xa1, 0x5e, 0x50, 0x2e, 0x02, 0xf0, 0x55, 0xf9, 0x06, 0x54, 0x0b, 0xd2, 0x25, 
-    0xa0, 0xce, 0xa5, 0x84, 0x50, 0xe3, 0xb0, 0x62, 0x1c, 0xa0, 0x86, 0x60, 0x04, 0xd7, 0xc0, 0x15, 
-    0xa1, 0xeb, 0x38, 0xcb, 0x56, 0x34, 0xe4, 0xa9, 0x2d, 0xb5, 0xb9, 0x7b, 0x30, 0x79, 0x39, 0xe5, 
-    0x34, 0x5c, 0x4b, 0x9f, 0xc7, 0x4a, 0x22, 0x2f, 0x9b, 0x76, 0x2c, 0x8e, 0x7e, 0x4d, 0xb1, 0x7d, 
-    0x9f, 0xb0, 0x16, 0x61, 0x3e, 0x74, 0x75, 0x9e, 0x0d, 0x8f, 0xa2, 0x3d, 0x17, 0x15, 0xf8, 0xd3, 
-    0x9f, 0x04, 0xd5, 0x3e, 0x73, 0x85, 0x1d, 0x45, 0x02, 0x2c, 0xc4, 0x76, 0x07, 0x36, 0xff, 0xed, 
-    0x48, 0x2c, 0x08, 0xa1, 0x10, 0x1c, 0x46, 0x56, 0x2c, 0x4e, 0x1b, 0x51, 0x6d, 0x77, 0xc7, 0x00, 
-    0x23, 0xe7, 0x32, 0x36, 0x1e, 0xc9, 0x54, 0x7e, 0x8c, 0x8b, 0x7b, 0x4e, 0x0e, 0x04, 0x05, 0xb8, 
-    0x82, 0x98, 0xd7, 0xeb, 0x68, 0xc6, 0xb2, 0xa8, 0x84, 0x54, 0x04, 0xf8, 0xdc, 0xd7, 0x19, 0x49, 
-    0x5f, 0x6b, 0x81, 0xe1, 0x75, 0x96, 0x98, 0x73, 0xf7, 0x8b, 0x82, 0xda, 0x9c, 0x2b, 0xf8, 0x8b, 
-    0x6b, 0xce, 0xf8, 0xde, 0xb7, 0xc3, 0x91, 0x3f, 0x30, 0xd5, 0x8f, 0x6d, 0x61, 0x61, 0x00, 0x06, 
-    0x2e, 0x93, 0x67, 0x11, 0xe5, 0xf6, 0x8c, 0xb0, 0x32, 0x2f, 0x1d, 0x6a, 0x38, 0x0d, 0xf8, 0xfe, 
-    0x7a, 0xa1, 0xd3, 0x80, 0x12, 0x68, 0xee, 0xfd, 0x9c, 0x66, 0x85, 0x83, 0x1d, 0x91, 0x5c, 0x1c, 
-    0x8e, 0x41, 0x95, 0x9a, 0x61, 0x0d, 0x8c, 0x1d, 0x12, 0xe8, 0x70, 0x48, 0x8f, 0x5c, 0x08, 0x4e, 
-    0x74, 0x6a, 0xc0, 0x65, 0x30, 0x32, 0xd3, 0x13, 0xb9, 0x81, 0x76, 0x82, 0x73, 0xeb, 0x3c, 0x07, 
-    0x6d, 0xe5, 0xb5, 0x5f, 0xde, 0x20, 0x2f, 0x79, 0xc9, 0x72, 0x6d, 0x1f, 0x28, 0x7f, 0x41, 0x21, 
-    0x0a, 0x28, 0xdd, 0x2e, 0x73, 0x06, 0x14, 0xf9, 0x84, 0x9f, 0x05, 0xc9, 0x85, 0x96, 0x53, 0x5c, 
-    0x59, 0xe0, 0xb0, 0x0d, 0xfd, 0x78, 0x09, 0xf8, 0x56, 0xfb, 0x69, 0x9a, 0x0e, 0xa4, 0xc6, 0x21, 
-    0xc4, 0x9b, 0x7d, 0x07, 0xcc, 0x87, 0x7e, 0x60, 0xae, 0x6e, 0x4e, 0x88, 0x0c, 0x08, 0x3a, 0x1c, 
-    0x4d, 0xdd, 0xc6, 0x49, 0x8f, 0x9d, 0x2a, 0x20, 0xa9, 0x0b, 0x48, 0xa7, 0x82, 0x4c, 0xb8, 0xb5, 
-    0x45, 0x66, 0x0f, 0x2e, 0x28, 0x8c, 0xad, 0xa8, 0x38, 0xac, 0xc6, 0x13, 0x50, 0xa3, 0x31, 0xc4, 
-    0x5e, 0x35, 0xa8, 0x76, 0x5a, 0x7c, 0xa3, 0x24, 0xd8, 0x5e, 0xd0, 0xe5, 0xcc, 0xba, 0x73, 0xfa, 
-    0xa3, 0x3e, 0x88, 0xa1, 0xc8, 0x13, 0x90, 0xdb, 0xf8, 0x34, 0xe5, 0x38, 0xa2, 0x8d, 0x5c, 0x2e, 
-    0xc5, 0xfc, 0xa4, 0xc5, 0x3e, 0xde, 0xd0, 0xb6, 0xd9, 0xdf, 0xd2, 0x70, 0x14, 0xf4, 0x72, 0x33, 
-    0xfb, 0x26, 0x1a, 0x33, 0xd7, 0x74, 0x51, 0x15, 0xa9, 0xbd, 0x85, 0x4b, 0xba, 0x22, 0xd7, 0x16, 
-    0xb5, 0xcd, 0x2b, 0xd1, 0x78, 0xa5, 0xdf, 0xec, 0xe5, 0x53, 0x29, 0xbe, 0xee, 0xf3, 0x69, 0xf4, 
-    0xca, 0x74, 0x80, 0x53, 0xfe, 0x19, 0x31, 0x77, 0x08, 0x59, 0x8c, 0xdf, 0xf1, 0x37, 0x9d, 0x21, 
-    0xe8, 0xd1, 0xa9, 0x38, 0x41, 0x9e, 0xeb, 0xc8, 0x30, 0x9a, 0x07, 0xe2, 0xe4, 0xee, 0xd0, 0x94, 
-    0x17, 0xf3, 0x1c, 0xf5, 0xc9, 0x43, 0xd9, 0x27, 0x7a, 0xfb, 0xc0, 0xfb, 0x4f, 0x22, 0x90, 0x79, 
-    0x35, 0x64, 0x78, 0x36, 0x1f, 0x15, 0xd3, 0x0e, 0xbc, 0x63, 0xee, 0x28, 0x12, 0x2d, 0x5a, 0x0a, 
-    0xa4, 0x7f, 0x49, 0x5c, 0x12, 0xf0, 0x76, 0x0d, 0x2f, 0xc3, 0x3c, 0x8f, 0x25, 0x24, 0x7e, 0xc5, 
-    0xde, 0x09, 0x9d, 0x0a, 0x2b, 0x11, 0x5c, 0xc9, 0x89, 0xcf, 0xc8, 0x94, 0xa1, 0x98, 0x4b, 0x62, 
-    0x3d, 0xf3, 0x44, 0xd4, 0x28, 0x9c, 0x76, 0x3c, 0x12, 0x67, 0xd5, 0x95, 0x69, 0x75, 0x52, 0xa2, 
-    0x19, 0xb8, 0x3c, 0x28, 0x5a, 0x46, 0x44, 0x74, 0xd0, 0xe3, 0xa3, 0x65, 0xb7, 0x57, 0x26, 0x62, 
-    0x9b, 0xe2, 0xee, 0x15, 0x77, 0xc5, 0x84, 0xe5, 0x50, 0xd2, 0x88, 0xab, 0xff, 0xbc, 0x80, 0x92, 
-    0xd7, 0x44, 0x9f, 0x7c, 0x81, 0xd5, 0x2b, 0x15, 0xe9, 0xea, 0x25, 0xcf, 0xad, 0x81, 0xb1, 0x95, 
-    0xaf, 0x0e, 0x77, 0xf9, 0xa4, 0x8d, 0x11, 0x4a, 0x18, 0x00, 0x87, 0xf1, 0x43, 0xf5, 0xb5, 0x1c, 
-    0x70, 0xa1, 0x3b, 0xdb, 0x88, 0x98, 0x0d, 0xbd, 0x05, 0xed, 0x10, 0x4b, 0xc3, 0xda, 0xa7, 0x46, 
-    0xdc, 0x96, 0xc4, 0x8f, 0x73, 0x51, 0x09, 0xfd, 0xdf, 0x40, 0xaf, 0x0f, 0x72, 0xd2, 0x9b, 0x21, 
-    0x8f, 0x82, 0xef, 0x89, 0xde, 0xe9, 0x44, 0x89, 0xa5, 0x46, 0x52, 0x5b, 0x55, 0xad, 0x60, 0x3c, 
-    0x68, 0xb1, 0x68, 0x15, 0x4b, 0xa3, 0x8b, 0x36, 0xe9, 0xbe, 0x6f, 0xde, 0x84, 0xc0, 0xdc, 0x3a, 
-    0xbb, 0xe3, 0x8e, 0xca, 0xba, 0xb5, 0x60, 0x31, 0xed, 0xd8, 0x21, 0x4c, 0x6f, 0x1e, 0x9f, 0xab, 
-    0x6b, 0x7b, 0x2d, 0xaf, 0x6d, 0xff, 0xfc, 0xdb, 0x0e, 0xda, 0x23, 0xec, 0x01, 0xfe, 0x78, 0xf7, 
-    0xf6, 0x14, 0x9d, 0x82, 0xbd, 0x01, 0x2e, 0xe4, 0x1c, 0xab, 0xbc, 0xee, 0xd1, 0xd3, 0xe6, 0x6e, 
-    0xc4, 0x1c, 0x98, 0x5f, 0xfa, 0x1a, 0xe0, 0xd4, 0xd2, 0x26, 0x00, 0x25, 0x5a, 0xb3, 0x7d, 0xdf, 
-    0xf3, 0x53, 0x09, 0x36, 0x37, 0x67, 0x12, 0x46, 0xda, 0x8e, 0x5d, 0x03, 0x4b, 0x3e, 0x3e, 0x1a, 
-    0xaf, 0xa6, 0xce, 0x06, 0x1a, 0x73, 0xaa, 0x25, 0x5a, 0x47, 0xd1, 0xa1, 0xff, 0x96, 0x93, 0xd4, 
-    0x58, 0xdd, 0x96, 0xc3, 0xf5, 0xdc, 0x93, 0xd5, 0xb8, 0xb9, 0x65, 0x36, 0x76, 0xe4, 0x62, 0x05, 
-    0xfd, 0xd2, 0x8f, 0x3c, 0x75, 0xdc, 0x02, 0xda, 0xe3, 0xc1, 0x4a, 0x50, 0xab, 0x44, 0xca, 0x28, 
-    0x59, 0xe8, 0x77, 0x63, 0xba, 0xa3, 0x50, 0x7a, 0x34, 0x52, 0x49, 0xb3, 0x7b, 0x6c, 0xcf, 0x1a, 
-    0x1d, 0xe6, 0xc4, 0xca, 0x8a, 0x17, 0xb1, 0xe2, 0x5c, 0x0f, 0x12, 0xd6, 0x77, 0xcd, 0xb0, 0x1e, 
-    0x2b, 0x45, 0x5a, 0x8e, 0xb0, 0xbf, 0xa7, 0x94, 0xa2, 0x3e, 0xae, 0xa6, 0x93, 0x4f, 0xce, 0x75, 
-    0x3a, 0x06, 0xd1, 0xef, 0x1c, 0x91, 0x82, 0xce, 0x25, 0xd3, 0x5b, 0xa2, 0x47, 0xee, 0x2f, 0xd9, 
-    0x88, 0x1d, 0xf6, 0xc2, 0xd0, 0x8f, 0xfa, 0x88, 0xcc, 0xf0, 0x17, 0x74, 0x07, 0x86, 0x2f, 0x88, 
-    0x32, 0xfc, 0x14, 0x3f, 0x00, 0x33, 0xf8, 0x91, 0x27, 0x4e, 0x52, 0x9b, 0x63, 0x03, 0x0f, 0x8c, 
-    0x33, 0x23, 0xf2, 0xb4, 0x61, 0x0d, 0xa2, 0x64, 0xc4, 0x5b, 0x53, 0x6b, 0xb5, 0x6d, 0x90, 0x0e, 
-    0x2e, 0xaf, 0x27, 0x09, 0x3b, 0xa1, 0xaa, 0xce, 0x0b, 0x0f, 0xf9, 0xed, 0x69, 0xa2, 0x1a, 0xa9, 
-    0xc5, 0x75, 0x1f, 0x90, 0x0a, 0xb0, 0x54, 0x47, 0x12, 0x6c, 0x79, 0xd9, 0xce, 0x3a, 0x80, 0xa8, 
-    0xad, 0xb3, 0xa4, 0x79, 0x3c, 0x9e, 0x42, 0x6d, 0x53, 0x83, 0xc9, 0xcf, 0x76, 0x17, 0x4b, 0x71, 
-    0xb1, 0xc1, 0x9f, 0xdb, 0x2b, 0x0b, 0xbb, 0xd8, 0xc0, 0xaf, 0xf9, 0x6a, 0x19, 0x1e, 0x36, 0x2e, 
-    0x3f, 0x7b, 0x5a, 0xc6, 0x99, 0xe9, 0xf1, 0x5c, 0x99, 0x92, 0x1b, 0x27, 0xe2, 0xd4, 0x68, 0xe3, 
-    0x24, 0xf6, 0x3a, 0xb9, 0x68, 0x07, 0x94, 0x07, 0x30, 0x74, 0x5d, 0x2c, 0x57, 0xfe, 0xcb, 0x5f, 
-    0xca, 0x5d, 0x60, 0xdc, 0xbf, 0xc0, 0x7f, 0xfa, 0xe3, 0x2c, 0x3e, 0xcd, 0xc0, 0xb3, 0x8c, 0xf6, 
-    0x30, 0x23, 0x8a, 0x66, 0xe2, 0xcd, 0xc6, 0xee, 0xe6, 0x3f, 0xa6, 0x8b, 0x03, 0x5d, 0x23, 0x11, 
-    0x16, 0xf0, 0x85, 0x7c, 0x8d, 0x34, 0xb5, 0x0a, 0x61, 0xf0, 0x93, 0xa3, 0x05, 0x30, 0x31, 0x1c, 
-    0x90, 0x14, 0x98, 0x36, 0x09, 0xb2, 0xb9, 0x81, 0x68, 0xce, 0x48, 0x91, 0xcb, 0x84, 0xe6, 0xd9, 
-    0x49, 0xfe, 0x95, 0x43, 0x9f, 0x7b, 0x1e, 0x42, 0xd7, 0x83, 0x54, 0x17, 0x03, 0x89, 0xfb, 0xda, 
-    0xb6, 0x68, 0xbf, 0xba, 0xad, 0x68, 0xa2, 0x8e, 0xeb, 0xe4, 0x5d, 0x86, 0x6d, 0x5a, 0xfb, 0x27, 
-    0x78, 0x18, 0x48, 0x48, 0xd5, 0x8a, 0x04, 0x55, 0x4f, 0x85, 0x15, 0xdd, 0x86, 0x98, 0x04, 0xae, 
-    0xae, 0x83, 0xab, 0x29, 0xc4, 0xd6, 0x52, 0xa0, 0x65, 0x62, 0x61, 0x61, 0x32, 0x93, 0x60, 0xae, 
-    0x19, 0x28, 0x2a, 0xa0, 0xb5, 0x46, 0x1a, 0x8a, 0xd1, 0x9d, 0x8c, 0x18, 0xb8, 0x27, 0xdc, 0x3c, 
-    0x9f, 0xba, 0x3d, 0xe5, 0x11, 0xb2, 0x2c, 0x26, 0x38, 0xe5, 0xbb, 0x76, 0xa6, 0xd5, 0x29, 0x3b, 
-    0xd3, 0x96, 0x71, 0x86, 0xab, 0x1d, 0xdb, 0x4e, 0xd9, 0x9b, 0x72, 0xdf, 0x52, 0xea, 0x3e, 0x6e, 
-    0xc4, 0xc6, 0xe2, 0x64, 0x7d, 0xfa, 0xae, 0xd4, 0x6c, 0x88, 0xce, 0x61, 0x55, 0x63, 0x73, 0xee, 
-    0x4b, 0xb5, 0xdb, 0x68, 0x0b, 0x6e, 0x4c, 0x13, 0x4d, 0x6d, 0xc7, 0xba, 0xab, 0xef, 0x2f, 0x53, 
-    0xbb, 0x36, 0x7b, 0x53, 0x5a, 0x9d, 0x77, 0x53, 0xaa, 0xb9, 0x34, 0x4e, 0xdc, 0x95, 0x9a, 0x02, 
-    0xcb, 0x08, 0x57, 0xa0, 0xc9, 0x2c, 0x71, 0xc8, 0xb6, 0xb3, 0xb0, 0x47, 0x60, 0xc2, 0xa6, 0x43, 
-    0xa7, 0xb5, 0x3b, 0x0b, 0xba, 0x07, 0x26, 0xa0, 0x88, 0x4c, 0x05, 0x3b, 0x0b, 0x7b, 0x0b, 0x2a, 
-    0x48, 0x72, 0x43, 0x8b, 0xcd, 0x4c, 0x9b, 0x18, 0x84, 0x2f, 0x2e, 0x13, 0xdf, 0x39, 0x35, 0x6a, 
-    0xd3, 0xa6, 0x86, 0xe1, 0x49, 0x2e, 0xcf, 0xa1, 0xa3, 0x43, 0xf5, 0x29, 0x33, 0x84, 0x53, 0xbb, 
-    0x40, 0x68, 0x16, 0x24, 0x59, 0xa6, 0x4f, 0x8f, 0x44, 0x63, 0x34, 0x45, 0xf4, 0x06, 0xe7, 0x9d, 
-    0x25, 0x3a, 0xa4, 0xc5, 0x67, 0x4a, 0x4a, 0x8b, 0xdb, 0xc9, 0xce, 0x4b, 0xd6, 0x4f, 0xef, 0xe8, 
-    0xec, 0xc9, 0x52, 0x9b, 0x7b, 0xb2, 0x08, 0xd7, 0xd7, 0x69, 0xf6, 0x1b, 0xee, 0x52, 0x4f, 0xd7, 
-    0x59, 0xfa, 0xd6, 0xc0, 0xea, 0x12, 0xbf, 0xd1, 0x82, 0x85, 0xd4, 0xbd, 0x09, 0xe8, 0xf6, 0x65, 
-    0xdc, 0xf8, 0x1f, 0x77, 0x95, 0x77, 0x02, 0x2c, 0x65, 0x68, 0x04, 0x38, 0xf3, 0x03, 0x71, 0x51, 
-    0x51, 0xbf, 0xaa, 0xf8, 0x39, 0xab, 0x07, 0x86, 0xa4, 0xdb, 0x79, 0x68, 0x84, 0x55, 0x0f, 0xbe, 
-    0x14, 0x4c, 0xe9, 0x22, 0x6b, 0x44, 0xee, 0x28, 0xb2, 0x4a, 0xf4, 0x44, 0xd6, 0x11, 0x36, 0x7c, 
-    0x51, 0x21, 0x11, 0xb3, 0x27, 0xaa, 0x69, 0x78, 0x60, 0x88, 0xda, 0xca, 0xdc, 0xff, 0x39, 0x9b, 
-    0x1a, 0x4f, 0x44, 0xd5, 0x96, 0x1e, 0x0b, 0xa2, 0x9e, 0x38, 0x14, 0xf8, 0x9c, 0xd5, 0x43, 0x06, 
-    0x60, 0xe1, 0xb7, 0x5c, 0xa1, 0x12, 0x0f, 0xbe, 0xac, 0x30, 0xfd, 0x88, 0x42, 0x1e, 0x0a, 0x4c, 
-    0x20, 0x10, 0xd6, 0xe7, 0x53, 0x6a, 0x12, 0x41, 0x52, 0x4a, 0xe8, 0xdd, 0x4f, 0xbe, 0xd6, 0xfa, 
-    0x17, 0x8b, 0xb3, 0x90, 0x2c, 0x1b, 0xeb, 0x93, 0xd6, 0x1b, 0xd9, 0x0f, 0x73, 0xa0, 0x8f, 0xa6, 
-    0x5e, 0x48, 0x32, 0x6f, 0x23, 0xe0, 0x46, 0xa6, 0xa8, 0xad, 0xcc, 0x82, 0x1e, 0xe1, 0x60, 0x3a, 
-    0x10, 0x3c, 0x3c, 0x31, 0x40, 0x70, 0x07, 0x5d, 0x25, 0xf5, 0x24, 0x1e, 0x20, 0xac, 0x38, 0xef, 
-    0xf1, 0x23, 0x8d, 0xbc, 0xee, 0x34, 0x7a, 0xe4, 0xc6, 0x4f, 0x0b, 0xb4, 0x92, 0x9f, 0x39, 0x13, 
-    0xe3, 0x15, 0x22, 0xb6, 0xc5, 0xf8, 0x01, 0xe9, 0x83, 0x00, 0xce, 0xb1, 0x03, 0xd0, 0x62, 0xd8, 
-    0x4c, 0xd8, 0xf4, 0x36, 0x06, 0xd9, 0x28, 0x98, 0x0e, 0xda, 0xd0, 0xe8, 0xe3, 0xc7, 0xfd, 0xda, 
-    0x25, 0x66, 0x7d, 0x5a, 0xa5, 0x9d, 0xef, 0x7e, 0xd6, 0xca, 0x7e, 0x51, 0x56, 0x4d, 0x3a, 0xb6, 
-    0xd5, 0xed, 0x97, 0xe6, 0x2d, 0x8f, 0x7b, 0x96, 0xb8, 0x26, 0xbd, 0xc5, 0x94, 0xd7, 0x8b, 0x29, 
-    0x60, 0x4c, 0x3f, 0x92, 0x07, 0x45, 0xf2, 0x39, 0xbc, 0xff, 0xe6, 0xf2, 0xfd, 0x8b, 0x6c, 0xa2, 
-    0x4f, 0xa0, 0x4c, 0xde, 0x10, 0xb2, 0x7f, 0xe8, 0x1b, 0x24, 0x13, 0x36, 0xa7, 0x86, 0x63, 0xe2, 
-    0x72, 0x77, 0x41, 0x84, 0x61, 0x64, 0x31, 0x08, 0xb1, 0x4d, 0x2b, 0x19, 0x4d, 0x74, 0x08, 0x71, 
-    0xd9, 0x1d, 0x59, 0xf8, 0x0b, 0x74, 0x7a, 0x30, 0xab, 0xbb, 0x66, 0x9c, 0xdf, 0xec, 0x94, 0xeb, 
-    0x4e, 0x2b, 0x0b, 0x3b, 0x40, 0xce, 0xe5, 0xfe, 0xa8, 0x31, 0x4a, 0xab, 0x3d, 0x27, 0x9f, 0xa4, 
-    0x5f, 0x6c, 0x91, 0x6e, 0x8c, 0x40, 0x9d, 0xca, 0x72, 0x37, 0x5c, 0x74, 0x1f, 0xca, 0x65, 0x6f, 
-    0xbb, 0x18, 0xae, 0x8e, 0xcb, 0xdc, 0x7b, 0xd1, 0xdc, 0x21, 0xf5, 0x21, 0x4e, 0xb9, 0x4b, 0x96, 
-    0x3a, 0xfe, 0x2d, 0x6d, 0x4d, 0x9d, 0x9f, 0x01, 0x34, 0x15, 0x7c, 0x39, 0x0e, 0x48, 0x71, 0xc0, 
-    0x9c, 0xdf, 0xfd, 0x52, 0xe7, 0x01, 0x28, 0xb7, 0x08, 0x17, 0xa4, 0x5e, 0xee, 0x89, 0x7b, 0x67, 
-    0x2e, 0x7b, 0xd7, 0x27, 0xe6, 0xb7, 0xb9, 0xf4, 0xc5, 0x1f, 0x82, 0x23, 0x74, 0xc1, 0x79, 0x21, 
-    0x4d, 0xb9, 0x07, 0x94, 0xf4, 0x27, 0xd5, 0xd5, 0xd2, 0x24, 0x47, 0x70, 0x8d, 0x71, 0x21, 0x76, 
-    0x10, 0x4a, 0xe6, 0x72, 0xbc, 0x90, 0xe6, 0x73, 0x9a, 0xc0, 0x4a, 0x06, 0xb2, 0x5a, 0x04, 0x2d, 
-    0x15, 0xfc, 0x6a, 0x39, 0xbc, 0x92, 0x2e, 0x9f, 0xf3, 0x3a, 0x7c, 0x6e, 0xff, 0x23, 0xde, 0xaa, 
-    0x42, 0x6c, 0x40, 0x2b, 0xd1, 0x7c, 0x46, 0x7f, 0xd6, 0x7f, 0x6c, 0xfd, 0xef, 0x70, 0xed, 0x4a, 
-    0x04, 0x8e, 0xc1, 0x0b, 0x38, 0x3c, 0x1a, 0x1d, 0xee, 0x4d, 0x78, 0x07, 0x8b, 0xde, 0xc0, 0x1d, 
-    0x93, 0x62, 0x13, 0xc8, 0x2d, 0x21, 0xde, 0xf7, 0x91, 0xb1, 0x6c, 0xf8, 0x30, 0x31, 0xf4, 0xfd, 
-    0x8c, 0x6e, 0x2c, 0xf4, 0xbb, 0x71, 0xf7, 0x98, 0xa0, 0xe7, 0xf9, 0xa1, 0xb8, 0x3c, 0x31, 0xd5, 
-    0xbf, 0x56, 0x6e, 0x02, 0x31, 0x9c, 0xc1, 0x25, 0xf5, 0x33, 0xd6, 0x6b, 0x50, 0x93, 0xb1, 0x31, 
-    0x1e, 0x3e, 0x84, 0x50, 0xd8, 0xa2, 0xc3, 0x82, 0xa8, 0x05, 0x74, 0x64, 0xcf, 0xe1, 0xa3, 0x74, 
-    0x77, 0x5b, 0x3c, 0x51, 0x28, 0xd1, 0xb6, 0x03, 0xf0, 0x16, 0x83, 0x08, 0xbd, 0x15, 0x01, 0x80, 
-    0x71, 0xab, 0x8b, 0xc8, 0xa1, 0xee, 0x2e, 0xac, 0xb5, 0x25, 0xfd, 0x24, 0x30, 0x65, 0xe6, 0x38, 
-    0x62, 0x33, 0x32, 0xff, 0xbc, 0x11, 0x97, 0x03, 0xa7, 0xc6, 0xcf, 0x30, 0x54, 0xd7, 0x14, 0xbf, 
-    0x52, 0x47, 0x2a, 0xad, 0x5c, 0x4c, 0x47, 0x89, 0x80, 0xb0, 0x24, 0x9d, 0x89, 0x93, 0x52, 0x89, 
-    0x59, 0x6f, 0x74, 0x0d, 0x75, 0x8a, 0x8a, 0xeb, 0x08, 0xd5, 0x36, 0xd5, 0x57, 0xd1, 0xe1, 0x4e, 
-    0x8d, 0xd2, 0xf2, 0x7a, 0x08, 0xba, 0x49, 0x28, 0xd0, 0xe2, 0x21, 0x14, 0xe9, 0x50, 0xd1, 0xf2, 
-    0x7d, 0x6b, 0x8c, 0x57, 0x98, 0xbe, 0x8e, 0x84, 0xa3, 0xa6, 0x82, 0xc6, 0xeb, 0x5d, 0xf5, 0xec, 
-    0x48, 0xed, 0x65, 0x41, 0x88, 0x3e, 0x2e, 0x3c, 0x31, 0x0e, 0x12, 0x1c, 0x43, 0x05, 0xb6, 0x3c, 
-    0x18, 0xd4, 0x16, 0x3f, 0xa4, 0x5c, 0x99, 0x69, 0x7d, 0x4a, 0x8d, 0xd7, 0x1e, 0x91, 0x65, 0x60, 
-    0xdd, 0x38, 0x5d, 0x2b, 0xf4, 0xd0, 0x25, 0xd4, 0x93, 0x4a, 0x55, 0xcc, 0x6c, 0xf3, 0x3c, 0x7a, 
-    0xc3, 0x30, 0x75, 0x50, 0x30, 0x1a, 0x62, 0x12, 0x8c, 0xc8, 0x22, 0xa1, 0x5b, 0x6e, 0x18, 0x4b, 
-    0x05, 0x49, 0xb1, 0x84, 0x38, 0x37, 0x5e, 0x78, 0x81, 0x43, 0xc7, 0xc1, 0x43, 0x2f, 0x48, 0x89, 
-    0x0f, 0x33, 0x9f, 0x6a, 0x0a, 0x75, 0x4b, 0x94, 0x7c, 0x20, 0x40, 0x0d, 0x95, 0x02, 0xe5, 0x27, 
-    0x4e, 0xe6, 0x16, 0xd4, 0x55, 0x75, 0x90, 0x32, 0xf8, 0x7e, 0x0c, 0xe6, 0x43, 0x41, 0xf8, 0xfb, 
-    0x0a, 0xca, 0x80, 0x8a, 0xe3, 0xb6, 0x89, 0x26, 0x5d, 0x2d, 0xfc, 0x16, 0x79, 0xd2, 0x72, 0xbb, 
-    0x06, 0x65, 0x97, 0x53, 0x03, 0x1c, 0x3f, 0x1d, 0xb7, 0x22, 0x8e, 0x15, 0x63, 0x42, 0x77, 0xce, 
-    0x9a, 0x23, 0x07, 0xa0, 0xea, 0xec, 0x02, 0x23, 0x4f, 0x42, 0xc6, 0x19, 0xb4, 0x5c, 0xc0, 0x8a, 
-    0x3b, 0x8b, 0x01, 0x33, 0x80, 0x6e, 0x8e, 0xf9, 0xaa, 0x1c, 0x9e, 0x18, 0xda, 0x64, 0x24, 0xca, 
-    0x3b, 0xea, 0xdc, 0x69, 0xcc, 0x44, 0x1d, 0x25, 0x60, 0x7d, 0x3a, 0x79, 0x83, 0x3a, 0x8e, 0xcf, 
-    0x60, 0x4e, 0x8d, 0x2c, 0x97, 0xb7, 0x84, 0x34, 0x70, 0x64, 0x98, 0x0c, 0x3e, 0x11, 0x00, 0x60, 
-    0x1b, 0xd8, 0x47, 0x46, 0x09, 0xd3, 0x1f, 0x1f, 0xb4, 0x53, 0x9f, 0x02, 0x63, 0xc7, 0x9f, 0x03, 
-    0xc1, 0x65, 0x47, 0xc5, 0x9b, 0x89, 0x97, 0xd1, 0xf8, 0xc4, 0xdb, 0xd5, 0x9c, 0x1a, 0x1e, 0xef, 
-    0x7a, 0x97, 0xee, 0xc6, 0x4c, 0x7b, 0xbc, 0xb8, 0xe3, 0x32, 0xe0, 0xc9, 0x7d, 0x9e, 0x65, 0xaf, 
-    0x0d, 0x3d, 0x85, 0x64, 0x9b, 0x7c, 0x41, 0xb6, 0x30, 0x04, 0x12, 0xbd, 0xd3, 0x7a, 0x39, 0xcd, 
-    0xd9, 0x49, 0x34, 0xf2, 0x10, 0x77, 0x5a, 0xfe, 0x5d, 0xee, 0x6a, 0x99, 0xb7, 0xa6, 0x66, 0xf4, 
-    0xf8, 0xa0, 0x9d, 0xde, 0x61, 0x7c, 0x4e, 0x1d, 0x6a, 0xb5, 0xe7, 0xe9, 0x6e, 0xf5, 0xbb, 0xba, 
-    0xfb, 0x9d, 0x17, 0xa3, 0x8c, 0x0e, 0x93, 0x6a, 0x3e, 0xbd, 0xcb, 0xc8, 0xad, 0xe9, 0x9d, 0xa6, 
-    0x37, 0xbc, 0xdb, 0x08, 0x67, 0x8e, 0x8e, 0xd7, 0xbe, 0xab, 0xe3, 0xe9, 0x17, 0x9f, 0xb4, 0xe8, 
-    0x7b, 0x3d, 0x2b, 0x00, 0x59, 0xa3, 0x4d, 0x68, 0x3e, 0x67, 0xc5, 0x5a, 0x82, 0x8e, 0xd8, 0x04, 
-    0xab, 0xce, 0x93, 0xf3, 0x45, 0xc5, 0x2a, 0x2b, 0x33, 0xf0, 0xae, 0x1b, 0x78, 0x57, 0x14, 0xca, 
-    0x0b, 0x5d, 0x45, 0x8a, 0x85, 0xfa, 0x0b, 0x48, 0x32, 0x61, 0xd4, 0x42, 0x8c, 0x95, 0x69, 0x0f, 
-    0x2d, 0x1f, 0x74, 0x02, 0x77, 0x5c, 0xe0, 0xc8, 0xd2, 0x31, 0xa4, 0x4f, 0xcb, 0x70, 0x24, 0xb7, 
-    0xf0, 0x60, 0xc0, 0x1f, 0x2f, 0x78, 0xb3, 0x49, 0x1f, 0x6f, 0x43, 0xad, 0x9a, 0xd2, 0xdf, 0xb5, 
-    0xa9, 0x96, 0xa5, 0xf8, 0x78, 0x45, 0xf7, 0x05, 0x0c, 0xe7, 0xa0, 0x7b, 0xc3, 0x40, 0xbe, 0xa5, 
-    0xb7, 0x56, 0x30, 0x9d, 0x26, 0xb7, 0x94, 0xd4, 0x88, 0x19, 0x51, 0xc5, 0x1b, 0x98, 0x5e, 0x85, 
-    0xa4, 0x7d, 0x7e, 0x2b, 0xe2, 0x42, 0x65, 0xec, 0x9c, 0xcf, 0xe3, 0x89, 0x47, 0x69, 0x04, 0x7d, 
-    0x4b, 0x92, 0xa2, 0x6f, 0x87, 0x3d, 0xaf, 0x8d, 0x81, 0x8b, 0x5e, 0x5f, 0x5e, 0x65, 0x0b, 0xd2, 
-    0x6d, 0x85, 0xa7, 0x96, 0xdf, 0x82, 0xa1, 0xcc, 0x8a, 0xad, 0x5a, 0x11, 0x73, 0x83, 0x64, 0xa1, 
-    0xa0, 0x35, 0x44, 0xa5, 0x86, 0xd0, 0x2f, 0xa3, 0xf7, 0x53, 0x96, 0x07, 0xc8, 0x23, 0x3b, 0x23, 
-    0xec, 0xe2, 0xb6, 0xd8, 0x8b, 0xcb, 0xd7, 0xe7, 0x25, 0x7e, 0x23, 0xd0, 0xe9, 0x8c, 0xc9, 0x73, 
-    0x29, 0x6f, 0x78, 0x7f, 0xe8, 0x0e, 0x5e, 0x29, 0xae, 0x54, 0x71, 0x0d, 0x56, 0x5d, 0x17, 0x56, 
-    0x4a, 0x2c, 0xaf, 0x5a, 0x0a, 0x46, 0xad, 0x16, 0x86, 0x1c, 0xfb, 0x99, 0x65, 0xc5, 0x57, 0xba, 
-    0xf5, 0x45, 0x5e, 0x52, 0x51, 0x29, 0x11, 0xe3, 0x5d, 0x73, 0x6c, 0x34, 0xab, 0xe7, 0x93, 0x3e, 
-    0x7b, 0x4a, 0x33, 0xf1, 0x29, 0x65, 0x63, 0x2e, 0x8f, 0x7e, 0x48, 0xd2, 0x61, 0x2f, 0xe1, 0x9b, 
-    0x32, 0x1d, 0x57, 0x85, 0x4e, 0xf6, 0x98, 0x1c, 0x51, 0x70, 0x8d, 0x95, 0x96, 0xe1, 0xe8, 0x36, 
-    0x39, 0x66, 0x69, 0x25, 0x37, 0x54, 0x07, 0xd6, 0x5b, 0xd2, 0xde, 0x62, 0x0a, 0x01, 0xe2, 0x41, 
-    0xd7, 0x72, 0x78, 0xab, 0xf1, 0xd1, 0xfe, 0x2c, 0x42, 0x5f, 0x16, 0x44, 0x2e, 0xbd, 0x82, 0x88, 
-    0xc7, 0x59, 0xe0, 0xb1, 0x2f, 0x83, 0x2f, 0x8a, 0xce, 0x17, 0xa0, 0x57, 0x3a, 0x81, 0x5d, 0xb2, 
-    0x5c, 0x37, 0xf7, 0x59, 0x8c, 0x9b, 0xce, 0x21, 0x02, 0x10, 0xee, 0xd3, 0x7b, 0xf6, 0x20, 0xe7, 
-    0x23, 0x3d, 0xe4, 0xd8, 0xe4, 0x0b, 0x29, 0x15, 0xd4, 0x86, 0x6a, 0xce, 0xf2, 0x82, 0x05, 0x53, 
-    0xcb, 0x97, 0x88, 0xb6, 0x62, 0x14, 0x72, 0xf7, 0x0f, 0xe9, 0x10, 0x78, 0x97, 0xe6, 0x85, 0x40, 
-    0x00, 0xbe, 0x18, 0x16, 0x26, 0x11, 0x43, 0xf4, 0x90, 0xef, 0x1f, 0x73, 0xa2, 0xcb, 0x46, 0x11, 
-    0x9e, 0x99, 0x10, 0xf3, 0xeb, 0xe6, 0x78, 0x07, 0xf3, 0xa6, 0xfd, 0x0a, 0xfb, 0xc0, 0xb3, 0x6e, 
-    0x76, 0x8d, 0x37, 0x94, 0x2e, 0x38, 0xc8, 0x71, 0x14, 0xa5, 0xb2, 0xe9, 0x5b, 0xb7, 0x32, 0xc0, 
-    0xb0, 0xde, 0x96, 0xc1, 0x4a, 0x4c, 0x46, 0x4d, 0x27, 0x7e, 0x81, 0x47, 0xdb, 0xa9, 0x71, 0x3c, 
-    0x62, 0xa8, 0xd3, 0xe4, 0x22, 0x4e, 0x30, 0x63, 0x9f, 0xe2, 0x73, 0x1e, 0x96, 0xeb, 0x12, 0xc5, 
-    0x2c, 0x6d, 0x49, 0x5b, 0xe3, 0x16, 0x05, 0xa5, 0x12, 0x77, 0x74, 0x40, 0x7a, 0x6b, 0xae, 0xe0, 
-    0xb4, 0x5c, 0xc0, 0xe4, 0xb0, 0x6e, 0x80, 0x4b, 0x71, 0x17, 0x5b, 0x60, 0x1e, 0xc2, 0xbb, 0x75, 
-    0xd0, 0x9b, 0x1e, 0xdd, 0xe8, 0x31, 0xff, 0x28, 0x0f, 0x8a, 0x4a, 0x21, 0x6e, 0x85, 0x23, 0xca, 
-    0xad, 0x0a, 0xa9, 0xaa, 0xb9, 0x3f, 0x46, 0x70, 0x61, 0xef, 0x6f, 0x3e, 0x89, 0xae, 0x03, 0x57, 
-    0x74, 0xef, 0xd4, 0xc9, 0xc1, 0x5d, 0x77, 0x77, 0xd2, 0x21, 0x68, 0x9b, 0xe4, 0xe9, 0x81, 0x61, 
-    0x23, 0x71, 0x7d, 0xcb, 0xe2, 0xb0, 0x3e, 0x4f, 0xac, 0xfb, 0x25, 0x16, 0x73, 0x82, 0xea, 0x89, 
-    0xae, 0xab, 0x5e, 0x89, 0xdf, 0xfc, 0xf6, 0xa9, 0x44, 0x48, 0xb5, 0x22, 0xde, 0x1a, 0xa7, 0xd6, 
-    0x4f, 0x6e, 0xc9, 0x83, 0xfb, 0xd6, 0xac, 0x32, 0x71, 0x37, 0x22, 0x06, 0xb5, 0x28, 0x2c, 0x1d, 
-    0x71, 0xab, 0x85, 0xe1, 0xfd, 0x46, 0x5c, 0xca, 0x88, 0x7b, 0xa2, 0xbc, 0xa4, 0xa3, 0x81, 0x1a, 
-    0xd0, 0x98, 0x7b, 0xb3, 0x71, 0xa0, 0xae, 0xb9, 0x63, 0xfe, 0xaa, 0x03, 0x95, 0xed, 0x0f, 0x28, 
-    0x35, 0x5a, 0xfc, 0x76, 0xa9, 0x7c, 0x2b, 0xef, 0xb9, 0xde, 0x96, 0x04, 0x39, 0x4b, 0xe2, 0xc6, 
-    0xab, 0xba, 0x51, 0x9a, 0x56, 0x0b, 0x96, 0xd6, 0x21, 0xd6, 0x3a, 0x83, 0x9f, 0x25, 0xca, 0x6b, 
-    0x9b, 0x8b, 0x00, 0xe0, 0x4b, 0xdb, 0xa7, 0xd4, 0xc1, 0xf9, 0x87, 0xff, 0xfe, 0xf7, 0x33, 0x40, 
-    0x61, 0x0c, 0x67, 0x13, 0x01, 0x7c, 0x42, 0xbb, 0x95, 0x07, 0xd0, 0x81, 0xf0, 0x85, 0x1c, 0xf2, 
-    0x08, 0x2b, 0xfe, 0x25, 0x16, 0x8b, 0xdc, 0x6e, 0x59, 0x41, 0x98, 0xd9, 0xa5, 0xa8, 0x09, 0xb7, 
-    0x25, 0xf9, 0x20, 0x72, 0x47, 0x6d, 0x44, 0xde, 0xa8, 0xed, 0x68, 0x2b, 0x22, 0xbd, 0x3c, 0x7f, 
-    0x4d, 0x83, 0x46, 0x19, 0x71, 0x8c, 0x76, 0xe8, 0xc1, 0x8f, 0xf7, 0x64, 0x1a, 0x7f, 0x48, 0xa2, 
-    0x21, 0xc9, 0xd9, 0xd6, 0xc9, 0xa8, 0x17, 0x48, 0xa1, 0x5c, 0x9b, 0x28, 0x76, 0x66, 0xdd, 0x45, 
-    0xd4, 0xe2, 0x7f, 0x7f, 0x95, 0x77, 0x1a, 0x75, 0x5f, 0xd4, 0x88, 0x13, 0x96, 0xe4, 0x3c, 0xee, 
-    0xa8, 0x69, 0x84, 0x7f, 0x03, 0xe1, 0x62, 0xc7, 0xa6, 0x91, 0x6e, 0x4c, 0xd0, 0xc5, 0x13, 0xcd, 
-    0x80, 0xe8, 0xb7, 0x26, 0x2e, 0xe0, 0x4d, 0xea, 0x0b, 0x75, 0xa1, 0x40, 0x73, 0x77, 0x12, 0x2c, 
-    0x8c, 0xb2, 0xec, 0x1c, 0x44, 0x15, 0xfa, 0x74, 0x80, 0x74, 0x22, 0x3c, 0x84, 0xb5, 0x61, 0x9a, 
-    0x60, 0x98, 0x22, 0x71, 0xf0, 0x1e, 0x3a, 0xfb, 0x69, 0x2a, 0x22, 0xdb, 0x2b, 0xd3, 0x97, 0x12, 
-    0xac, 0x94, 0x7a, 0x29, 0x51, 0x5f, 0x56, 0x66, 0x38, 0x96, 0x6a, 0x59, 0xdc, 0x63, 0xd4, 0xff, 
-    0x35, 0x31, 0x11, 0xe6, 0xc8, 0x93, 0xfa, 0x1e, 0xf4, 0x39, 0x4a, 0xb5, 0xc7, 0x13, 0xa5, 0x26, 
-    0x8a, 0x89, 0x0c, 0xa7, 0x18, 0xb7, 0xfc, 0x86, 0x17, 0x15, 0x77, 0xd2, 0x7f, 0xbc, 0x0f, 0x4a, 
-    0xe2, 0x89, 0xbc, 0xc4, 0x3e, 0x61, 0x3a, 0xce, 0x93, 0xad, 0xf5, 0x02, 0xbd, 0x36, 0x40, 0x01, 
-    0x0b, 0x66, 0x20, 0x42, 0xcd, 0x3a, 0xc3, 0xef, 0x6f, 0xf1, 0xdd, 0x10, 0x83, 0xa0, 0xce, 0x6e, 
-    0x8d, 0x26, 0x53, 0xc7, 0xf5, 0x60, 0xed, 0x0d, 0x4a, 0x23, 0xaa, 0xc4, 0xca, 0x6c, 0xbd, 0x92, 
-    0x7f, 0xe8, 0x33, 0xc4, 0x45, 0x3c, 0xfa, 0x09, 0x1e, 0x3d, 0x04, 0xdf, 0x8d, 0xd5, 0x31, 0x66, 
-    0x50, 0x79, 0xbb, 0x77, 0x36, 0x1b, 0x2f, 0xc0, 0x06, 0xb4, 0xf1, 0x21, 0xc3, 0x00, 0x9b, 0xb5, 
-    0xb5, 0xbc, 0xb2, 0x3a, 0x55, 0xf3, 0x0f, 0xec, 0xe5, 0xfe, 0x77, 0x23, 0x42, 0x99, 0xc0, 0x2f, 
-    0x9d, 0xee, 0xc0, 0x72, 0xe7, 0x19, 0x11, 0x3f, 0x08, 0x9c, 0x07, 0xd6, 0xde, 0xef, 0x1b, 0x0d, 
-    0x93, 0x90, 0xa1, 0x20, 0xb5, 0xc7, 0x9e, 0xcf, 0x1d, 0x35, 0x72, 0x8a, 0x69, 0xe2, 0x71, 0x22, 
-    0xbd, 0x3e, 0x6c, 0xf8, 0x6c, 0xc1, 0x8e, 0x41, 0xee, 0xa6, 0x5a, 0x60, 0x37, 0x35, 0xdd, 0x85, 
-    0x60, 0x58, 0x05, 0x1e, 0xbf, 0xa9, 0x46, 0xfe, 0xbe, 0xff, 0xe2, 0xa6, 0x5c, 0xe0, 0x91, 0x46, 
-    0xb8, 0xbd, 0xbb, 0x04, 0x5f, 0xfb, 0xd6, 0x30, 0xc7, 0x83, 0x6c, 0x68, 0x3e, 0x1a, 0x43, 0x8c, 
-    0xb4, 0x7a, 0x53, 0x5b, 0xa8, 0xa6, 0x8a, 0xf8, 0xea, 0xf0, 0x88, 0xaf, 0x0e, 0x7b, 0xc6, 0xea, 
-    0xf0, 0x91, 0x08, 0xf8, 0x8a, 0x66, 0xc0, 0xea, 0x67, 0x87, 0xe2, 0x65, 0xc0, 0x4a, 0xd0, 0xc4, 
-    0xdf, 0x35, 0xf9, 0x3b, 0xda, 0x5c, 0x58, 0x50, 0xbf, 0x29, 0xad, 0xc6, 0xac, 0x58, 0xd5, 0xdf, 
-    0xec, 0x6a, 0x6f, 0xaa, 0xd2, 0x26, 0x2a, 0x7e, 0x57, 0xd2, 0x2e, 0xc9, 0xc4, 0x68, 0x2a, 0x64, 
-    0x96, 0xa0, 0x5d, 0xfa, 0x4e, 0x20, 0xb1, 0xef, 0x93, 0x59, 0x79, 0x40, 0x73, 0x2e, 0xe9, 0x99, 
-    0x7c, 0xed, 0xa1, 0x17, 0xcc, 0xce, 0xf5, 0x5c, 0xc6, 0x08, 0x39, 0x81, 0x72, 0xc4, 0x23, 0x59, 
-    0xee, 0x97, 0xbc, 0x6b, 0xf3, 0x58, 0x73, 0xea, 0xd5, 0x18, 0xe3, 0x4e, 0x05, 0xc0, 0x12, 0xe8, 
-    0x4b, 0x35, 0x29, 0xb4, 0xba, 0x7f, 0x95, 0xde, 0xf2, 0xd2, 0x75, 0xd4, 0x64, 0x11, 0xb3, 0xdb, 
-    0x05, 0x13, 0x4c, 0x1e, 0xe8, 0x5d, 0x89, 0x9f, 0x98, 0x08, 0xd6, 0x9b, 0xee, 0xb0, 0xa3, 0x8b, 
-    0x39, 0x2d, 0x40, 0x08, 0x20, 0xa0, 0xaa, 0xeb, 0x26, 0x03, 0xf5, 0xd0, 0x90, 0xc5, 0x26, 0x6e, 
-    0xda, 0xc5, 0x07, 0xc6, 0x7e, 0x8d, 0x32, 0x23, 0xc1, 0x62, 0x8e, 0x5d, 0xc5, 0x65, 0xf3, 0xaf, 
-    0x23, 0xdf, 0x7d, 0x98, 0x98, 0x6c, 0x9a, 0xaf, 0x12, 0xc5, 0xa6, 0xd5, 0xee, 0xd2, 0x8c, 0x33, 
-    0xba, 0xfa, 0xc0, 0x34, 0x65, 0xce, 0xda, 0xfd, 0x35, 0xc5, 0x18, 0x61, 0xec, 0x28, 0xca, 0x7f, 
-    0x66, 0xa7, 0xdd, 0x01, 0xaa, 0xff, 0xa4, 0x15, 0xe2, 0xd1, 0x02, 0x87, 0xcf, 0xf9, 0x0a, 0xa3, 
-    0xca, 0xf1, 0x48, 0xc1, 0xb0, 0xe7, 0xfc, 0x73, 0x79, 0x42, 0xd8, 0x40, 0xbe, 0xd1, 0x51, 0x26, 
-    0x68, 0xda, 0xa8, 0x2a, 0xab, 0x0c, 0xbf, 0x99, 0x2c, 0x46, 0xad, 0xa4, 0x1e, 0x83, 0x7e, 0xbc, 
-    0x87, 0x1b, 0x8a, 0x92, 0x13, 0xd0, 0xa7, 0xf6, 0x4e, 0x5d, 0x23, 0x8b, 0x27, 0xaa, 0x88, 0x8a, 
-    0x24, 0x1c, 0x29, 0xd3, 0x72, 0x5a, 0x44, 0x01, 0xf4, 0x08, 0x23, 0xb5, 0x40, 0x2b, 0x64, 0x8c, 
-    0x3d, 0x48, 0x1c, 0x1b, 0xf5, 0x52, 0xa1, 0xa3, 0xe7, 0xc7, 0xd0, 0xde, 0xa7, 0x39, 0x75, 0xbe, 
-    0xb2, 0xbb, 0x56, 0x6b, 0x2c, 0x0e, 0xc8, 0x12, 0x95, 0x3f, 0x6b, 0x0e, 0x00, 0x2d, 0xb9, 0x07, 
-    0x88, 0xf8, 0x28, 0xf5, 0xba, 0xec, 0x16, 0x53, 0x25, 0x4b, 0xea, 0xf2, 0x89, 0xfe, 0x50, 0xde, 
-    0x45, 0x31, 0x9e, 0x4d, 0xbe, 0x5c, 0xfb, 0xa0, 0x61, 0xa0, 0x32, 0x9c, 0x20, 0x1d, 0xb4, 0x9f, 
-    0x25, 0x51, 0x75, 0x0e, 0xd4, 0xa2, 0x3a, 0x06, 0x72, 0xd1, 0x63, 0x1d, 0x3d, 0xed, 0xe9, 0x2c, 
-    0x04, 0xd1, 0x92, 0x4b, 0xf7, 0xe6, 0xe5, 0x3d, 0x84, 0x88, 0xb1, 0xe8, 0xf4, 0x4b, 0x1f, 0x54, 
-    0xd1, 0x1d, 0xe3, 0x5c, 0x20, 0xfd, 0x02, 0x5b, 0xd4, 0x0d, 0x15, 0xc4, 0xee, 0xaf, 0x05, 0xe6, 
-    0x90, 0x41, 0x60, 0xfe, 0x5b, 0xc7, 0x80, 0xaa, 0x7e, 0x85, 0x51, 0xe7, 0xb5, 0xc8, 0x46, 0x17, 
-    0x71, 0x7e, 0xe4, 0xbb, 0x9e, 0xc6, 0xfb, 0xea, 0x6d, 0xc4, 0xfd, 0x7a, 0xea, 0x15, 0xbd, 0x44, 
-    0x92, 0xf9, 0xe3, 0x49, 0x5a, 0xe2, 0xd8, 0x18, 0x0e, 0xc1, 0x11, 0x46, 0x46, 0x1a, 0x97, 0x34, 
-    0xa4, 0xf4, 0x02, 0x11, 0x5e, 0xb1, 0xec, 0x2f, 0xb1, 0x72, 0xb1, 0x4d, 0xb1, 0xf9, 0x96, 0x9f, 
-    0x7e, 0xb7, 0x39, 0x9f, 0xe9, 0x2f, 0xf6, 0x35, 0x77, 0xef, 0x68, 0xfe, 0x04, 0xa0, 0xb1, 0xbb, 
-    0xf6, 0x2c, 0x3f, 0x6c, 0xec, 0xf4, 0xbd, 0x61, 0x95, 0xdc, 0x8a, 0x41, 0x3f, 0xd1, 0x5c, 0x63, 
-    0x4c, 0x43, 0x64, 0x12, 0x0b, 0xb3, 0x14, 0x77, 0x62, 0x89, 0x97, 0x3b, 0xd6, 0x5c, 0x5b, 0x38, 
-    0x03, 0x7c, 0x49, 0x0e, 0x4a, 0x4a, 0x92, 0x9c, 0x68, 0x5c, 0xc4, 0x66, 0x20, 0xca, 0x25, 0x20, 
-    0x07, 0x45, 0xde, 0x34, 0x9c, 0xb5, 0xed, 0xc7, 0xbd, 0x5c, 0x71, 0x34, 0x70, 0xf4, 0x53, 0x4d, 
-    0x55, 0xbb, 0x84, 0x2f, 0x08, 0xbd, 0xce, 0x2c, 0xaf, 0x05, 0xda, 0x0c, 0x15, 0x51, 0x6f, 0x4d, 
-    0x05, 0x44, 0xaf, 0xc9, 0x37, 0x6b, 0x96, 0x8b, 0x99, 0x91, 0xae, 0x21, 0x09, 0x48, 0x4b, 0xff, 
-    0x00, 0xd0, 0x36, 0xe7, 0x87, 0x96, 0x9a, 0xbd, 0x21, 0x37, 0x19, 0x70, 0x5e, 0xe6, 0x72, 0x88, 
-    0x4d, 0x02, 0x34, 0xc1, 0x1e, 0x8b, 0xfd, 0xb6, 0x24, 0xfb, 0x8a, 0xe6, 0x3e, 0xa1, 0x5e, 0x4e, 
-    0xd7, 0x08, 0xb0, 0x64, 0x51, 0xee, 0xdb, 0xa3, 0x0b, 0xf8, 0x26, 0x00, 0xdd, 0xec, 0x1b, 0x3d, 
-    0x55, 0x39, 0x1a, 0x90, 0x2e, 0x06, 0x3a, 0x18, 0xf9, 0x44, 0xcb, 0x2d, 0x24, 0xe2, 0x32, 0xd1, 
-    0x89, 0x3d, 0x88, 0x44, 0xdd, 0xa8, 0x28, 0x84, 0xd3, 0xa1, 0xcd, 0x13, 0x3c, 0x39, 0x52, 0x7d, 
-    0x32, 0xba, 0xaa, 0x65, 0x77, 0xd0, 0xf8, 0x6b, 0xb1, 0x6c, 0x15, 0x3a, 0xae, 0x03, 0x19, 0x88, 
-    0x5f, 0x4e, 0xdf, 0x08, 0xdf, 0xd9, 0x70, 0x45, 0xf2, 0x07, 0x8d, 0x25, 0x14, 0xb8, 0x4b, 0x7c, 
-    0x75, 0x82, 0xd9, 0x15, 0x8c, 0xd0, 0x2f, 0xec, 0xe7, 0xf4, 0x42, 0x5b, 0xac, 0x56, 0x9b, 0xa3, 
-    0x41, 0x4a, 0x1a, 0x91, 0xd6, 0xdc, 0xd1, 0xa0, 0x3d, 0xab, 0x31, 0x59, 0x64, 0x8b, 0x6d, 0x6c, 
-    0x2f, 0x92, 0x62, 0x24, 0xbd, 0xc1, 0x7d, 0x83, 0x35, 0x6b, 0x95, 0xed, 0xef, 0xce, 0x5a, 0x92, 
-    0x9b, 0x02, 0x5d, 0x63, 0xfc, 0xef, 0x4c, 0x28, 0x92, 0x9b, 0x36, 0xe4, 0xf9, 0xd4, 0x14, 0x23, 
-    0xd2, 0x9b, 0x5a, 0xcb, 0x97, 0x95, 0x4f, 0xba, 0x96, 0x10, 0x8b, 0xbe, 0x1e, 0xa8, 0x44, 0x59, 
-    0xcc, 0xea, 0x50, 0xe8, 0x62, 0x94, 0x56, 0x2d, 0x51, 0x2d, 0x30, 0x54, 0x4c, 0xdd, 0x2e, 0xbe, 
-    0x88, 0x21, 0x1b, 0x1a, 0xc4, 0xc9, 0x1d, 0xde, 0xa1, 0x27, 0x94, 0x7b, 0x89, 0x1d, 0x44, 0x6b, 
-    0xe8, 0x0f, 0x95, 0x0a, 0x8f, 0x29, 0x2e, 0xdf, 0xbc, 0xb5, 0x5b, 0x21, 0x1a, 0xed, 0xf0, 0x1a, 
-    0xf9, 0x1a, 0xff, 0xa3, 0x7c, 0x70, 0x9e, 0x47, 0xe9, 0xc2, 0xf8, 0xbe, 0xa5, 0x88, 0x07, 0x8f, 
-    0x1d, 0xdb, 0x8f, 0x1b, 0xc5, 0xa7, 0xd8, 0xb9, 0x93, 0xd6, 0xed, 0xa9, 0xf6, 0xee, 0xe4, 0xcb, 
-    0xcf, 0x95, 0x2f, 0x13, 0x6c, 0xc7, 0x7a, 0x91, 0x14, 0x4b, 0x74, 0xdc, 0x02, 0xfd, 0x5d, 0x16, 
-    0x69, 0xb5, 0xf6, 0x27, 0x08, 0xba, 0xbe, 0xbe, 0x2e, 0xb3, 0x99, 0xe0, 0x3b, 0x8f, 0x07, 0x6e, 
-    0xaf, 0xae, 0x63, 0xae, 0x3f, 0x6b, 0x10, 0x00, 0x9b, 0xf9, 0x4e, 0x47, 0x2b, 0x81, 0xfc, 0xbc, 
-    0x87, 0x09, 0x07, 0x29, 0xca, 0x2f, 0xdd, 0xe5, 0xd2, 0xeb, 0x03, 0xec, 0x2b, 0x4a, 0x18, 0x76, 
-    0xee, 0x19, 0xb4, 0xcf, 0x16, 0x58, 0xb5, 0x56, 0xa1, 0x3f, 0xe9, 0xf7, 0xbd, 0x78, 0x94, 0xbf, 
-    0xdb, 0x28, 0x7c, 0x98, 0xf4, 0x9f, 0x13, 0xa9, 0xe3, 0x28, 0xba, 0xd8, 0x0a, 0x3f, 0x68, 0x11, 
-    0x8b, 0xfd, 0x98, 0x14, 0xb9, 0x9c, 0x91, 0x4b, 0xae, 0xc0, 0x6e, 0x63, 0xc6, 0x08, 0xac, 0x70, 
-    0x60, 0x18, 0x02, 0x73, 0x82, 0x1c, 0x49, 0x62, 0x54, 0xad, 0xaa, 0x55, 0xb3, 0xe7, 0x60, 0xb0, 
-    0xe9, 0xb4, 0x48, 0x63, 0x5b, 0xcc, 0x72, 0x1b, 0xbd, 0x14, 0x64, 0x6e, 0x7a, 0x6e, 0x9b, 0x55, 
-    0xd7, 0x92, 0xb4, 0x36, 0x68, 0x19, 0x59, 0xb6, 0x05, 0x11, 0x6b, 0x8d, 0x7c, 0x1c, 0xd2, 0x7a, 
-    0x65, 0x26, 0x10, 0xdd, 0x70, 0x2f, 0x47, 0xa3, 0x12, 0x75, 0xc6, 0x44, 0xb8, 0x33, 0x09, 0xdb, 
-    0xb5, 0xcd, 0x19, 0x0d, 0xcd, 0xb4, 0xf5, 0xa3, 0x98, 0xfb, 0xef, 0x7f, 0xaf, 0x18, 0x62, 0x7d, 
-    0x12, 0x0a, 0x96, 0x65, 0x25, 0x50, 0x48, 0xe3, 0xcb, 0x09, 0xdd, 0x54, 0xc7, 0x03, 0xb2, 0xa1, 
-    0xcd, 0x24, 0xd5, 0xaa, 0xb5, 0x19, 0xe0, 0xb2, 0x1f, 0x9c, 0x41, 0x9b, 0xfb, 0x4f, 0x46, 0x90, 
-    0x6f, 0xe1, 0xd9, 0xe5, 0xd0, 0x06, 0x36, 0x45, 0x4f, 0xca, 0xfe, 0xb0, 0x27, 0xfb, 0x52, 0xab, 
-    0x56, 0x34, 0x4b, 0xd5, 0xc0, 0x23, 0x81, 0x62, 0xdf, 0x62, 0x06, 0x47, 0x3b, 0x37, 0xa1, 0x97, 
-    0x72, 0xfe, 0x19, 0xcd, 0x42, 0xd5, 0x52, 0xe8, 0xa1, 0xc1, 0xda, 0xb5, 0xf1, 0xd8, 0xfa, 0x92, 
-    0xc7, 0xde, 0xfd, 0xfc, 0xa5, 0x80, 0x57, 0x13, 0x61, 0x81, 0x03, 0x94, 0x6a, 0xc5, 0xb6, 0xd3, 
-    0x05, 0xf5, 0xb1, 0xc0, 0xfa, 0xce, 0x60, 0x14, 0xda, 0xda, 0x23, 0xd8, 0xd8, 0x48, 0x8c, 0xea, 
-    0xb5, 0x7c, 0x8a, 0x11, 0x3f, 0xe5, 0x26, 0xaa, 0xa1, 0xcf, 0xcc, 0xaf, 0x3f, 0xfd, 0xac, 0x14, 
-    0x0d, 0x4d, 0xa7, 0x10, 0xd1, 0x6e, 0x28, 0x3c, 0x5d, 0xe8, 0x85, 0x96, 0xab, 0x9c, 0x42, 0xa2, 
-    0xd9, 0x1d, 0x37, 0x2f, 0xd0, 0xe5, 0x7b, 0x2c, 0x1b, 0x69, 0xdc, 0x95, 0xed, 0xef, 0x71, 0x13, 
-    0x33, 0x80, 0xad, 0xee, 0x98, 0x1d, 0xfc, 0x99, 0xd5, 0x61, 0xf1, 0xab, 0x6e, 0xeb, 0xae, 0x64, 
-    0x78, 0x43, 0x1d, 0x1d, 0x5d, 0xab, 0xda, 0x46, 0x4b, 0xdc, 0xf5, 0x8e, 0xc3, 0xe2, 0x15, 0x95, 
-    0x47, 0x56, 0x94, 0x4e, 0x00, 0x2f, 0x93, 0x47, 0xfb, 0x9c, 0x87, 0x28, 0xe9, 0x8e, 0xd1, 0xb3, 
-    0x14, 0x04, 0x11, 0xe6, 0x4a, 0x74, 0x9e, 0xa1, 0x12, 0x63, 0x9a, 0xd2, 0x4d, 0x9e, 0x5b, 0xe8, 
-    0x55, 0x65, 0x13, 0xfa, 0xb1, 0x44, 0xb4, 0x11, 0x4b, 0xac, 0x81, 0x22, 0x0a, 0x00, 0x2e, 0xc8, 
-    0x2a, 0x4a, 0x8b, 0xbe, 0xf0, 0x25, 0x80, 0x99, 0x2b, 0xdf, 0xd4, 0xa3, 0x1b, 0xb1, 0x00, 0xa6, 
-    0x96, 0x49, 0xac, 0x83, 0x7c, 0xcd, 0x9a, 0x54, 0x36, 0xe1, 0x81, 0xa4, 0x17, 0xd4, 0x56, 0xc4, 
-    0x94, 0xc7, 0xb3, 0x9a, 0xd1, 0x56, 0x48, 0xdd, 0x8c, 0x02, 0x8b, 0xc2, 0x5c, 0x6b, 0x4b, 0xdc, 
-    0xf5, 0x38, 0x59, 0x89, 0x8f, 0x3f, 0x5d, 0x69, 0x93, 0xae, 0x00, 0xbf, 0xeb, 0x44, 0x3b, 0xb3, 
-    0x86, 0x72, 0x95, 0xe4, 0xc1, 0xf3, 0xf1, 0x8c, 0x4c, 0x9f, 0x5f, 0x62, 0x7a, 0x39, 0xd1, 0x71, 
-    0x79, 0x9a, 0x45, 0x3c, 0xcd, 0xf0, 0x92, 0x62, 0x24, 0x4f, 0x77, 0x8d, 0xfe, 0x32, 0x2d, 0x1e, 
-    0x7f, 0xe4, 0x22, 0xf6, 0x2a, 0x0a, 0xad, 0xa9, 0x64, 0x82, 0x24, 0x32, 0xde, 0x3e, 0x16, 0x64, 
-    0xa9, 0x16, 0xeb, 0xda, 0xaf, 0xb5, 0xe2, 0x7a, 0x1e, 0xa7, 0x18, 0xb9, 0x8e, 0x55, 0x4d, 0xb7, 
-    0x79, 0x0e, 0x03, 0xe8, 0xf9, 0x8a, 0x7c, 0x3f, 0x53, 0x27, 0xb9, 0x66, 0xf5, 0x55, 0x43, 0x03, 
-    0xfd, 0x75, 0xe8, 0x1c, 0xd0, 0x80, 0x90, 0xf4, 0x16, 0x0c, 0x46, 0x4d, 0x35, 0x17, 0xa3, 0xca, 
-    0x45, 0x3d, 0x2a, 0xae, 0xe6, 0x7d, 0x2a, 0x22, 0xe6, 0x1a, 0x1e, 0x65, 0x51, 0xb1, 0xd8, 0x74, 
-    0xc4, 0x31, 0x20, 0x37, 0x74, 0xd7, 0xf4, 0x65, 0x8d, 0xe6, 0xa4, 0x28, 0x19, 0x41, 0x88, 0x4d, 
-    0x84, 0x89, 0x93, 0x6d, 0xf2, 0x2c, 0xe4, 0x48, 0x7e, 0xd1, 0x3b, 0x3a, 0x6d, 0x22, 0x8a, 0xe2, 
-    0x11, 0x06, 0x0f, 0x06, 0x2e, 0x1a, 0x75, 0xf8, 0x50, 0xa7, 0x2a, 0x5b, 0x51, 0x6d, 0x9a, 0xcd, 
-    0x58, 0x46, 0x8e, 0x91, 0x72, 0x99, 0x29, 0x68, 0x94, 0x2e, 0x6a, 0x71, 0xf5, 0xcd, 0xdb, 0xee, 
-    0x51, 0xfb, 0x34, 0x78, 0x3b, 0xe6, 0xe8, 0xcd, 0x91, 0xf4, 0x20, 0xe2, 0xc4, 0x83, 0xe8, 0x2a, 
-    0x73, 0x55, 0xb7, 0x4c, 0xc5, 0xf9, 0x04, 0x6b, 0x3a, 0x69, 0x51, 0x8e, 0xe7, 0xf4, 0xbc, 0x8d, 
-    0x7c, 0x6f, 0x89, 0x36, 0xb2, 0xbc, 0xec, 0xb8, 0xe1, 0x52, 0x3b, 0xb5, 0xab, 0xd5, 0x39, 0x32, 
-    0x0a, 0x68, 0xdd, 0x13, 0xf7, 0xb0, 0x97, 0xec, 0xdb, 0x02, 0x9e, 0xb6, 0xba, 0xaf, 0x2d, 0x1f, 
-    0x7e, 0xac, 0xa4, 0xfa, 0x67, 0xfa, 0xce, 0x7e, 0x57, 0x0f, 0xeb, 0x46, 0x0f, 0x85, 0x5b, 0xec, 
-    0xe2, 0x5d, 0x44, 0x24, 0x45, 0x65, 0x95, 0x12, 0xfe, 0x91, 0x30, 0x5c, 0x33, 0x30, 0x3c, 0xe5, 
-    0x17, 0xd8, 0x97, 0x1b, 0x82, 0xf9, 0x5d, 0x5f, 0x79, 0x8f, 0x8c, 0x14, 0xf7, 0xe8, 0x09, 0xbb, 
-    0x60, 0x97, 0xc4, 0x49, 0x25, 0x66, 0xc6, 0xb6, 0x5c, 0x57, 0x3a, 0x82, 0xc9, 0x4d, 0x98, 0x90, 
-    0x0e, 0x62, 0xff, 0x15, 0x9f, 0xe1, 0xca, 0xdf, 0x2d, 0xbe, 0x2e, 0xa6, 0x4c, 0x73, 0x29, 0xd5, 
-    0x2f, 0xed, 0xf0, 0x77, 0xdd, 0x85, 0xf1, 0xbe, 0x70, 0xc3, 0xf1, 0x22, 0x5b, 0xb2, 0xd4, 0x2d, 
-    0xc1, 0x54, 0x7d, 0xde, 0x68, 0xdf, 0xb5, 0x3b, 0xe1, 0xef, 0xa4, 0xcf, 0xf3, 0x48, 0x79, 0xa9, 
-    0xad, 0x92, 0x25, 0x69, 0xc2, 0xd6, 0x73, 0x73, 0x73, 0x33, 0x65, 0x5f, 0x23, 0x47, 0x26, 0x8b, 
-    0x7b, 0x04, 0x09, 0x79, 0x85, 0xc5, 0xae, 0x56, 0x3c, 0xe2, 0x26, 0x77, 0x7d, 0xd1, 0x4d, 0xee, 
-    0x5a, 0x43, 0x61, 0xa4, 0x56, 0xf4, 0xb6, 0x35, 0x0e, 0xcc, 0xfc, 0xb5, 0x87, 0x64, 0xf0, 0xd2, 
-    0x98, 0x8a, 0xfd, 0x99, 0xd5, 0xf5, 0x7c, 0x63, 0x63, 0xd4, 0xad, 0x13, 0x6e, 0x5e, 0xb2, 0x6e, 
-    0x21, 0x82, 0xb2, 0x0a, 0xf2, 0x85, 0x87, 0xd2, 0x86, 0x3a, 0xd1, 0xb9, 0x52, 0x5b, 0x9e, 0x2b, 
-    0xe9, 0x3a, 0x10, 0xb6, 0xb9, 0x51, 0x81, 0x2a, 0x0e, 0x34, 0xd7, 0x68, 0x6c, 0xa7, 0xdb, 0x56, 
-    0xfc, 0x6e, 0xd3, 0xca, 0xd5, 0x1a, 0x8d, 0x82, 0xfc, 0x57, 0x29, 0x55, 0x1a, 0xf9, 0x98, 0xb5, 
-    0x84, 0x38, 0x1b, 0xfb, 0x3b, 0x26, 0x07, 0x64, 0xe8, 0xf7, 0xa6, 0x0c, 0x35, 0x39, 0x79, 0x2c, 
-    0x67, 0xb3, 0xec, 0x34, 0xd6, 0x8c, 0x51, 0x9e, 0x7c, 0xd4, 0x30, 0x5a, 0x29, 0xe0, 0x80, 0x1b, 
-    0x0c, 0xb3, 0x7d, 0xd1, 0x46, 0x6d, 0x6d, 0x52, 0x1b, 0x1a, 0x1c, 0x6e, 0x59, 0x90, 0x80, 0xd6, 
-    0x6a, 0x93, 0x3b, 0x22, 0xcd, 0x0b, 0x29, 0x9c, 0x32, 0xb9, 0xa5, 0x09, 0x2c, 0x3f, 0xd9, 0xfe, 
-    0x10, 0x79, 0xcc, 0x29, 0x9b, 0x43, 0xad, 0x2a, 0xb0, 0xab, 0x37, 0xf4, 0x54, 0x00, 0x74, 0x63, 
-    0x8f, 0x3c, 0xed, 0x51, 0x6c, 0xe1, 0xd7, 0x9c, 0xce, 0x53, 0xab, 0x78, 0xa9, 0xa5, 0x9e, 0x66, 
-    0x58, 0x4a, 0x59, 0xcf, 0xff, 0x59, 0xaa, 0xfd, 0x93, 0x49, 0x35, 0x3d, 0x3e, 0x4f, 0x5c, 0xac, 
-    0x9d, 0xb6, 0xb8, 0x48, 0xe3, 0xab, 0xeb, 0x22, 0x59, 0xab, 0x74, 0x42, 0x4e, 0x32, 0x7f, 0xcd, 
-    0x92, 0x92, 0x84, 0x9f, 0x66, 0x79, 0xdb, 0x8c, 0xa4, 0xdb, 0x15, 0x46, 0x70, 0x58, 0xcc, 0x08, 
-    0x57, 0x9b, 0x65, 0xed, 0x9b, 0x2b, 0xb9, 0x16, 0xc5, 0x16, 0x8e, 0x0c, 0xb3, 0x11, 0x46, 0x07, 
-    0x32, 0x6d, 0x96, 0x29, 0x70, 0xb9, 0x3f, 0x0b, 0xb2, 0x09, 0x20, 0x82, 0xdb, 0x55, 0xca, 0x41, 
-    0x42, 0x4e, 0x4b, 0x6d, 0x3d, 0x47, 0xa4, 0xc7, 0x63, 0xe9, 0x99, 0x3c, 0x45, 0x4f, 0x31, 0x15, 
-    0x0b, 0x9e, 0xcf, 0x04, 0x82, 0xeb, 0xf1, 0xff, 0x7a, 0x76, 0x48, 0xa7, 0xd3, 0x41, 0x46, 0xc2, 
-    0xa0, 0x38, 0xaa, 0x2d, 0xdc, 0x18, 0xe3, 0xc3, 0x1c, 0xa6, 0xe1, 0xe2, 0x50, 0xd4, 0x13, 0xb3, 
-    0xea, 0x21, 0x17, 0xf6, 0x24, 0x00, 0x5a, 0xb6, 0xe3, 0xe6, 0x14, 0xbc, 0x32, 0xcb, 0x55, 0x2b, 
-    0x95, 0x0a, 0x08, 0xeb, 0x75, 0xf5, 0xa7, 0xb6, 0x96, 0x17, 0xd7, 0x7a, 0xe2, 0xd4, 0xad, 0x4f, 
-    0x59, 0xab, 0x26, 0xcf, 0x34, 0x25, 0x06, 0x25, 0x26, 0x68, 0x1c, 0x44, 0xfa, 0x29, 0x0a, 0x6f, 
-    0x44, 0x14, 0x3e, 0xe4, 0xc6, 0x6c, 0x63, 0x8a, 0xae, 0xcd, 0xd3, 0xaa, 0xe2, 0x7b, 0xb9, 0xbc, 
-    0xe1, 0x8d, 0x6e, 0x3a, 0x9e, 0xce, 0x5e, 0x8e, 0x28, 0xb8, 0xd4, 0x19, 0x0f, 0x68, 0x75, 0x35, 
-    0xa2, 0xf8, 0x4f, 0x1f, 0x28, 0x55, 0x42, 0xf6, 0xaa, 0x37, 0xa2, 0xeb, 0x29, 0xbe, 0x83, 0x1f, 
-    0x97, 0x56, 0x98, 0xfd, 0x92, 0x44, 0x5c, 0x00, 0xfb, 0x6c, 0xd2, 0x1e, 0xfa, 0x92, 0xcb, 0x7f, 
-    0x89, 0x82, 0xce, 0xea, 0x79, 0xd2, 0xcc, 0x92, 0x67, 0x18, 0x46, 0x44, 0x94, 0xa5, 0xa2, 0x71, 
-    0x40, 0xc8, 0x0b, 0xd2, 0x30, 0x49, 0x96, 0xe7, 0xa4, 0x9d, 0x3e, 0xb1, 0x77, 0xf8, 0x5e, 0x69, 
-    0xfa, 0xcf, 0x12, 0x33, 0xc6, 0x39, 0x72, 0xb7, 0x26, 0xe2, 0x33, 0xc4, 0x4f, 0x86, 0xb8, 0x20, 
-    0xfd, 0x87, 0xff, 0xf8, 0xaf, 0x68, 0x04, 0xb5, 0x82, 0xba, 0x44, 0x8d, 0xce, 0x6c, 0xf6, 0x65, 
-    0x18, 0xbf, 0x85, 0xb5, 0x45, 0x25, 0xdc, 0x54, 0xf8, 0xc2, 0x57, 0xd2, 0xe2, 0x39, 0x31, 0x58, 
-    0x08, 0x85, 0xc1, 0x12, 0x25, 0x9f, 0xed, 0x50, 0x22, 0xba, 0xfb, 0x74, 0x2d, 0xa2, 0x9a, 0x22, 
-    0xa7, 0xb5, 0x6d, 0x9b, 0x06, 0x64, 0x73, 0x0a, 0x90, 0xb5, 0x89, 0x40, 0xee, 0xe7, 0xd2, 0xc2, 
-    0x54, 0x02, 0x58, 0x07, 0xcf, 0x46, 0xd9, 0xad, 0xe7, 0xb7, 0x19, 0x86, 0xb7, 0x50, 0xdd, 0xc6, 
-    0x27, 0x41, 0x7a, 0xc6, 0x3d, 0xee, 0xcd, 0xca, 0xb2, 0x2a, 0x1e, 0xac, 0xeb, 0x0c, 0xec, 0xc8, 
-    0x11, 0x05, 0x9f, 0x88, 0xdd, 0xd9, 0x2b, 0x4c, 0xb6, 0x2a, 0x03, 0x5c, 0x10, 0x44, 0xa5, 0xbe, 
-    0x52, 0x8b, 0xf1, 0xe4, 0x2e, 0x76, 0x20, 0xab, 0xe8, 0x00, 0x7e, 0x36, 0x7e, 0xc9, 0x29, 0x4c, 
-    0x00, 0xb6, 0xe8, 0x43, 0xf3, 0x79, 0x83, 0x6e, 0xf7, 0x6d, 0x2b, 0x18, 0xf9, 0x36, 0xb1, 0x8b, 
-    0x84, 0x98, 0x2f, 0xdd, 0x3a, 0x6d, 0xb2, 0x03, 0xe3, 0xf4, 0x56, 0x5b, 0x5a, 0xed, 0xf2, 0x0f, 
-    0x95, 0xe2, 0x3d, 0x91, 0x77, 0x6b, 0xa3, 0xe7, 0xdb, 0xe6, 0x65, 0x1f, 0x81, 0x63, 0xd4, 0x74, 
-    0x2c, 0x73, 0xa3, 0x59, 0x4c, 0xe2, 0x60, 0xc6, 0xa4, 0x5f, 0xa4, 0x71, 0x2d, 0x15, 0xd0, 0xc0, 
-    0x3e, 0xb1, 0xc9, 0x07, 0x63, 0x87, 0x19, 0xec, 0x06, 0x44, 0xaa, 0x6d, 0x62, 0x3e, 0x3a, 0x83, 
-    0x7f, 0xf0, 0x69, 0x0d, 0x2d, 0x8d, 0x9b, 0xda, 0x82, 0x44, 0xfb, 0x8a, 0x4f, 0x14, 0x5c, 0xb6, 
-    0x02, 0x0b, 0x57, 0x8e, 0x37, 0x2b, 0x0c, 0xe5, 0x68, 0xe1, 0x82, 0x25, 0x48, 0x6b, 0xa8, 0xcc, 
-    0x6a, 0x3c, 0x0b, 0x2c, 0x96, 0x52, 0x9b, 0x0f, 0xfc, 0x19, 0xdb, 0x7f, 0xe8, 0xd3, 0x94, 0xbf, 
-    0x26, 0x79, 0x2a, 0x9a, 0xe3, 0x3b, 0x92, 0x08, 0x6e, 0x4c, 0xc7, 0xe5, 0x7e, 0x4f, 0xba, 0x10, 
-    0xe0, 0xfe, 0x51, 0x13, 0x8f, 0x87, 0xa7, 0x6f, 0x61, 0xb4, 0x90, 0xa1, 0x1f, 0x68, 0xe0, 0x77, 
-    0x58, 0x9c, 0x35, 0xf4, 0x46, 0x04, 0x77, 0xac, 0x0a, 0x4f, 0x8a, 0x98, 0xe4, 0xe6, 0x74, 0xd2, 
-    0xa1, 0x95, 0xf1, 0x46, 0x75, 0xad, 0xd2, 0x28, 0xe8, 0x4f, 0xd5, 0xe9, 0xe7, 0x0c, 0x59, 0x3e, 
-    0xef, 0x16, 0x29, 0x52, 0x99, 0x22, 0x4c, 0xe5, 0x1a, 0x55, 0xab, 0x4d, 0xb0, 0xf7, 0xc7, 0xcd, 
-    0x47, 0x8f, 0xb9, 0x48, 0xa1, 0x96, 0x83, 0x3a, 0x0b, 0x5e, 0x08, 0x85, 0x45, 0xe4, 0x7f, 0xaf, 
-    0x35, 0x6b, 0xc5, 0xb8, 0xd1, 0xee, 0x7a, 0x5d, 0xaf, 0x48, 0xce, 0x2b, 0x8c, 0x3c, 0x57, 0x44, 
-    0x22, 0xb1, 0x1c, 0x5f, 0x37, 0xec, 0x36, 0xba, 0xa1, 0x82, 0x06, 0xe1, 0xe7, 0xb5, 0x8c, 0x43, 
-    0x5d, 0xef, 0x23, 0x9f, 0x54, 0x05, 0xfa, 0x81, 0x33, 0x8c, 0x6f, 0xc0, 0x29, 0x76, 0x46, 0x9b, 
-    0xd1, 0xce, 0x0f, 0x3f, 0x81, 0xd0, 0x16, 0x79, 0x1f, 0xa2, 0x2d, 0xab, 0x4b, 0x8f, 0x53, 0x69, 
-    0x79, 0x7c, 0x5c, 0xd1, 0x9d, 0x4a, 0x9a, 0x76, 0xd7, 0x19, 0x5c, 0x58, 0xa8, 0xc8, 0xc8, 0x47, 
-    0x54, 0x97, 0x06, 0x8e, 0x37, 0x5f, 0x04, 0x21, 0x20, 0x5b, 0x87, 0x99, 0x0c, 0xdf, 0x1b, 0xeb, 
-    0xb0, 0x3d, 0x84, 0x7f, 0x9b, 0xc6, 0x21, 0x2f, 0x87, 0x00, 0x78, 0x7d, 0xe8, 0x39, 0xa1, 0xe8, 
-    0x22, 0x10, 0x8f, 0xb0, 0x9a, 0xa9, 0xef, 0xa7, 0xe0, 0x81, 0xb1, 0x64, 0xae, 0x3c, 0x85, 0x44, 
-    0xb5, 0xa2, 0x21, 0x51, 0x53, 0xa5, 0x70, 0xf2, 0xab, 0x52, 0xb0, 0x71, 0x5d, 0x13, 0xa5, 0xd2, 
-    0x0b, 0xe8, 0x60, 0x56, 0x75, 0x30, 0x14, 0xc2, 0xd5, 0x6c, 0x5f, 0xf6, 0x49, 0x6c, 0x12, 0x44, 
-    0x5c, 0x52, 0x0a, 0x32, 0xd8, 0xb4, 0x5d, 0xef, 0x96, 0xc0, 0x2c, 0xaf, 0x07, 0xcc, 0xe5, 0x17, 
-    0xc1, 0xcd, 0xd3, 0x5a, 0x72, 0xd7, 0xc7, 0xc8, 0xfb, 0x2a, 0xfb, 0x92, 0xb2, 0x8f, 0x8a, 0xc0, 
-    0x19, 0x2e, 0x13, 0x62, 0x59, 0x57, 0x09, 0x5e, 0xf9, 0x41, 0x00, 0x48, 0x79, 0xe4, 0xd7, 0x02, 
-    0x1b, 0xe2, 0x05, 0x6c, 0xcc, 0x2e, 0x92, 0x5f, 0xd8, 0x50, 0xb6, 0x36, 0x71, 0x0e, 0x63, 0x3a, 
-    0xd9, 0x49, 0x49, 0x69, 0xe7, 0xca, 0x48, 0x8b, 0xee, 0x5e, 0x95, 0x64, 0x1f, 0xb1, 0x88, 0xec, 
-    0x5c, 0xa3, 0x92, 0xf4, 0x91, 0xa8, 0x2f, 0xb4, 0x2f, 0x31, 0xd4, 0x48, 0xad, 0xf5, 0xc8, 0xdf, 
-    0x63, 0x53, 0xd1, 0xef, 0x3d, 0x08, 0xcf, 0x80, 0x22, 0xd5, 0xbc, 0x77, 0xda, 0xb6, 0x17, 0x30, 
-    0x4c, 0x80, 0xc3, 0x9a, 0x63, 0x26, 0x12, 0xe1, 0x2c, 0xb2, 0x1c, 0xcd, 0x9c, 0xbb, 0xdc, 0x07, 
-    0x04, 0xfe, 0x3c, 0x6d, 0xa0, 0x71, 0xb1, 0xc0, 0xd6, 0x53, 0x26, 0xeb, 0x4c, 0x28, 0xb0, 0x4d, 
-    0x9e, 0x09, 0x46, 0xeb, 0xdc, 0x82, 0x1c, 0xbf, 0x3e, 0x69, 0xec, 0x6f, 0x88, 0x52, 0x8b, 0x0e, 
-    0x3e, 0xd5, 0x9a, 0x34, 0xec, 0xf4, 0x12, 0xd0, 0xdf, 0x90, 0x9b, 0xb1, 0xd8, 0xb0, 0x57, 0x96, 
-    0x1f, 0x76, 0x02, 0x9d, 0x15, 0xb0, 0xab, 0x0d, 0x8d, 0x24, 0x38, 0xca, 0x8f, 0x47, 0x13, 0xe2, 
-    0x99, 0xc5, 0x89, 0x82, 0xd5, 0x26, 0x53, 0x05, 0xdf, 0xe2, 0x66, 0xbd, 0xf6, 0x7b, 0xd0, 0x05, 
-    0x81, 0x67, 0x25, 0x74, 0xa2, 0x4c, 0x5c, 0xb5, 0x48, 0x9c, 0xe3, 0x3c, 0xb2, 0x6e, 0x41, 0xb1, 
-    0x9f, 0x60, 0x1f, 0x61, 0xf8, 0xe4, 0x33, 0x5a, 0x84, 0xff, 0x79, 0x7b, 0x9c, 0x18, 0x31, 0x19, 
-    0x47, 0xbb, 0x16, 0xd3, 0x60, 0xd0, 0xa9, 0x99, 0x8c, 0x88, 0x0b, 0xd1, 0x6c, 0x96, 0xa3, 0x1f, 
-    0x6e, 0xbb, 0xe3, 0x96, 0xcb, 0xa9, 0xb6, 0x60, 0x11, 0xf5, 0x46, 0x86, 0x5f, 0x94, 0x41, 0x03, 
-    0x35, 0xff, 0x1f, 0x0a, 0x45, 0xc8, 0x43, 0x10, 0xd2, 0x7d, 0xc9, 0x1e, 0xcc, 0x29, 0xe0, 0x03, 
-    0x0a, 0x11, 0x24, 0x8b, 0x2f, 0x79, 0x7a, 0x11, 0x93, 0x93, 0x71, 0x49, 0x59, 0xaf, 0x70, 0xf9, 
-    0x48, 0xc2, 0xb2, 0xba, 0x5e, 0x91, 0xda, 0x51, 0x42, 0x56, 0x6a, 0xb1, 0x83, 0x04, 0x45, 0x67, 
-    0x9b, 0x5c, 0xe3, 0x84, 0xfb, 0x9f, 0xff, 0xf9, 0xef, 0xfe, 0xdb, 0xff, 0xf8, 0xaf, 0xff, 0xd6, 
-    0xf4, 0x32, 0x95, 0xb0, 0x8f, 0xa7, 0xf6, 0x73, 0xc2, 0x59, 0x44, 0x35, 0xfd, 0x18, 0x62, 0x99, 
-    0x60, 0x8d, 0xe6, 0x6a, 0x2b, 0xeb, 0xaa, 0xf5, 0xb0, 0xa1, 0xa1, 0x7a, 0x89, 0x79, 0xd0, 0xf5, 
-    0x10, 0x1d, 0x7a, 0xcc, 0x48, 0x11, 0x9f, 0x51, 0xed, 0x7f, 0xa7, 0x1c, 0x0f, 0xc5, 0xfa, 0x52, 
-    0x4d, 0xeb, 0x4b, 0x0c, 0xb1, 0xd4, 0x60, 0x90, 0x31, 0xdf, 0x49, 0x79, 0x03, 0xd1, 0xbc, 0x2c, 
-    0x77, 0xee, 0x71, 0x0e, 0x5b, 0xe8, 0xd0, 0x6a, 0xe9, 0x51, 0x9d, 0x73, 0xa0, 0xe2, 0xce, 0xc8, 
-    0x72, 0x26, 0x1b, 0x4e, 0xa7, 0xe6, 0xce, 0x2e, 0x6e, 0xd2, 0xd6, 0xd3, 0xae, 0xa6, 0x08, 0x35, 
-    0xb4, 0xc0, 0x8c, 0x6d, 0x0b, 0x2f, 0xe3, 0xa2, 0xe0, 0x82, 0xda, 0xc7, 0x23, 0xd7, 0xfd, 0x04, 
-    0x4f, 0x92, 0xa9, 0x80, 0x54, 0x90, 0xe5, 0x22, 0x3f, 0x70, 0x8f, 0xf2, 0xfb, 0xf0, 0xe8, 0xc9, 
-    0x52, 0xae, 0xf0, 0xc4, 0x3a, 0xac, 0x25, 0x0c, 0xf0, 0xfc, 0x14, 0x96, 0x3b, 0x90, 0xa4, 0x38, 
-    0xb2, 0x70, 0xdc, 0x6c, 0x5e, 0x67, 0x47, 0xd5, 0xb2, 0x39, 0x94, 0x1c, 0x22, 0x27, 0x08, 0x26, 
-    0xf1, 0xe0, 0x65, 0x39, 0x2e, 0x32, 0x25, 0xdb, 0x38, 0x7a, 0x4e, 0x98, 0x68, 0xf1, 0x42, 0xda, 
-    0xdc, 0xd6, 0xaf, 0xfa, 0x8d, 0x10, 0xf5, 0xe4, 0x2a, 0x72, 0x83, 0x73, 0xda, 0xe1, 0x45, 0x31, 
-    0x44, 0xd9, 0xd0, 0x0a, 0x02, 0xdc, 0xba, 0x8d, 0x80, 0x45, 0x06, 0x98, 0xf7, 0x00, 0x2b, 0x45, 
-    0x1e, 0xf5, 0x36, 0x7b, 0x86, 0xe4, 0x92, 0x5d, 0xc0, 0x97, 0xab, 0xab, 0x9a, 0x69, 0xa9, 0x9d, 
-    0xea, 0xb0, 0x33, 0x7f, 0x4f, 0xa7, 0xf5, 0x35, 0xbd, 0xb7, 0xd2, 0x25, 0x62, 0xae, 0xce, 0x6a, 
-    0xb7, 0xb9, 0xb1, 0x7c, 0xcc, 0xb7, 0x36, 0x0d, 0x2d, 0x8d, 0x8b, 0xf0, 0xb2, 0x03, 0x71, 0xcc, 
-    0x4f, 0xac, 0xfa, 0x54, 0xb3, 0x7d, 0xca, 0x43, 0x0b, 0x1e, 0x9a, 0x80, 0x4a, 0x94, 0x23, 0xdf, 
-    0x6c, 0xbe, 0xe5, 0xd1, 0xaa, 0x56, 0x2a, 0xda, 0x09, 0x80, 0x59, 0xb7, 0x09, 0x15, 0xd7, 0xb4, 
-    0x6a, 0x94, 0xc5, 0x19, 0xea, 0xac, 0x69, 0x29, 0x5e, 0xcc, 0x1a, 0x50, 0x65, 0x15, 0x24, 0x33, 
-    0x1a, 0x5b, 0x1a, 0x5a, 0xc5, 0x6e, 0xa2, 0x54, 0x11, 0x6a, 0x92, 0xfb, 0x69, 0x99, 0x4e, 0x42, 
-    0x55, 0x06, 0x1b, 0xb4, 0x5e, 0x56, 0x9f, 0xb2, 0x3f, 0x43, 0xef, 0x56, 0x19, 0x16, 0x6b, 0xc3, 
-    0xbf, 0x2e, 0x16, 0x6d, 0xa0, 0xab, 0x6a, 0x5d, 0x43, 0xd6, 0x31, 0x81, 0xb6, 0x62, 0xc8, 0x5e, 
-    0xe3, 0xc8, 0x9a, 0xc8, 0xe2, 0x55, 0xae, 0x5c, 0xbd, 0x86, 0x36, 0x23, 0x68, 0xc1, 0x16, 0x9f, 
-    0x0e, 0xb4, 0x80, 0x53, 0xe9, 0x1a, 0x1b, 0xd8, 0x88, 0x4a, 0xf7, 0x63, 0x48, 0x23, 0x46, 0xd5, 
-    0x2a, 0x54, 0x20, 0xa3, 0x13, 0xd6, 0x74, 0x11, 0xfd, 0xb5, 0x46, 0x55, 0x6b, 0x55, 0xb2, 0x8b, 
-    0x5e, 0x11, 0xcb, 0xbb, 0xd0, 0xc0, 0x06, 0x54, 0xe9, 0x13, 0x90, 0x35, 0xea, 0x77, 0x35, 0x2f, 
-    0x27, 0xb0, 0x3a, 0x7f, 0x41, 0x04, 0xd3, 0xcb, 0xff, 0x44, 0xe5, 0x57, 0x79, 0x79, 0xc1, 0x33, 
-    0xf7, 0x1a, 0x3f, 0x61, 0x50, 0xb7, 0xb8, 0xf6, 0x47, 0x27, 0xcf, 0xca, 0x1f, 0x92, 0xdc, 0x7c, 
-    0x8d, 0x8c, 0xd4, 0x5e, 0x78, 0x39, 0xb4, 0x5a, 0x18, 0x07, 0x85, 0xb2, 0x56, 0x99, 0xd6, 0xc6, 
-    0x8f, 0x91, 0xb5, 0x91, 0x7b, 0x5d, 0x0b, 0x33, 0xa3, 0x56, 0x4b, 0x98, 0x19, 0xd3, 0xdc, 0x3f, 
-    0xa9, 0x8a, 0xe9, 0xef, 0x39, 0x69, 0x91, 0xb7, 0xfc, 0x56, 0x4e, 0xb4, 0xc8, 0x0d, 0x8e, 0x51, 
-    0x0b, 0xe4, 0x72, 0x5e, 0xc0, 0x90, 0x82, 0x20, 0x66, 0x89, 0xa4, 0x17, 0xa7, 0x78, 0xd8, 0x36, 
-    0xc1, 0x64, 0xe7, 0xd0, 0x44, 0x97, 0x5e, 0x46, 0x3f, 0x8b, 0xd5, 0x18, 0x75, 0xf3, 0x1f, 0xd6, 
-    0xd6, 0xd6, 0xb2, 0x49, 0x7d, 0x21, 0x19, 0xf8, 0xb7, 0xe3, 0xdb, 0x41, 0xcf, 0xb4, 0xc4, 0xcd, 
-    0x1d, 0xeb, 0x8c, 0x3f, 0xd3, 0xee, 0x28, 0xa5, 0xa7, 0x31, 0xb5, 0x6e, 0x6c, 0x19, 0xfc, 0xe5, 
-    0x11, 0x3c, 0x79, 0xa5, 0x23, 0xef, 0x76, 0x7a, 0x48, 0x41, 0x71, 0x8d, 0x6b, 0x4b, 0xc9, 0x3e, 
-    0xbc, 0x0b, 0xba, 0xb5, 0xc0, 0x45, 0x52, 0x79, 0xf5, 0x95, 0x3c, 0xfd, 0xb7, 0xe6, 0x48, 0x20, 
-    0x97, 0xbc, 0x42, 0xaa, 0x42, 0xb2, 0x45, 0xd7, 0xd9, 0xe6, 0x01, 0x94, 0xbc, 0x4f, 0x27, 0x82, 
-    0x02, 0x16, 0x12, 0xb7, 0x29, 0xb7, 0x8c, 0x5f, 0xfc, 0x7d, 0xfc, 0xce, 0xda, 0xd6, 0x72, 0x57, 
-    0x1e, 0x63, 0xc0, 0xd4, 0xfd, 0xc3, 0x79, 0x7a, 0x90, 0x72, 0xe5, 0x31, 0x9f, 0x40, 0xae, 0xbd, 
-    0x18, 0x34, 0xed, 0x3e, 0x63, 0x1c, 0xd6, 0xfe, 0x42, 0xe4, 0x9d, 0x74, 0x69, 0x31, 0x2f, 0xb3, 
-    0xfa, 0x2c, 0x1a, 0x1f, 0x32, 0x1e, 0x19, 0x72, 0xe1, 0x98, 0x90, 0x53, 0xa2, 0x41, 0x2e, 0x1b, 
-    0x09, 0x52, 0xb0, 0xff, 0xa3, 0x04, 0x82, 0x9c, 0x75, 0xe7, 0xd6, 0x88, 0xa4, 0x31, 0x15, 0x89, 
-    0x29, 0x11, 0x1e, 0xd3, 0x63, 0x6a, 0xa4, 0xb5, 0x29, 0xe3, 0x6b, 0x80, 0x36, 0x8a, 0x11, 0xa6, 
-    0x41, 0x93, 0x19, 0xd8, 0x36, 0xda, 0xaa, 0x61, 0xcd, 0x8c, 0xca, 0x61, 0xc8, 0x0e, 0x54, 0x37, 
-    0xb1, 0x6d, 0xa7, 0x95, 0x22, 0x8e, 0x84, 0xc8, 0x93, 0xde, 0x97, 0x73, 0x86, 0x88, 0xd1, 0x85, 
-    0x61, 0x59, 0x80, 0xc8, 0xce, 0x3f, 0x44, 0x69, 0x31, 0x35, 0xa3, 0x78, 0x95, 0x09, 0x6a, 0xc6, 
-    0xf2, 0xaf, 0x46, 0xa4, 0x75, 0xda, 0x05, 0x99, 0xa2, 0x2f, 0xe8, 0xea, 0xc2, 0xd4, 0x9e, 0x76, 
-    0x6b, 0xdb, 0xe1, 0xfe, 0x25, 0xb6, 0xcb, 0x23, 0xc2, 0x8b, 0xad, 0x57, 0x56, 0xc4, 0xc3, 0x93, 
-    0x19, 0x99, 0x44, 0x11, 0xf3, 0xc6, 0x2d, 0x34, 0xb3, 0x4d, 0x89, 0xd3, 0x63, 0xf1, 0x3f, 0x13, 
-    0x05, 0xb3, 0x30, 0xba, 0x8d, 0x8a, 0x74, 0x4b, 0xc0, 0xd3, 0x84, 0xe7, 0xfb, 0x8d, 0xf5, 0x06, 
-    0xa2, 0x27, 0xc2, 0xc2, 0x68, 0x69, 0xe5, 0x79, 0x40, 0x32, 0x90, 0xae, 0x32, 0x0e, 0x00, 0x0c, 
-    0x76, 0x20, 0x6b, 0xf0, 0x9d, 0x14, 0xcb, 0xbd, 0xc5, 0xc8, 0xdc, 0x3d, 0x98, 0xad, 0xac, 0xe9, 
-    0x84, 0x01, 0x28, 0x05, 0xc5, 0x2a, 0xec, 0x87, 0xf7, 0xf1, 0x29, 0x5a, 0xcb, 0xe9, 0x61, 0xa5, 
-    0xb8, 0x96, 0xd7, 0x56, 0xb3, 0x6e, 0x13, 0x00, 0x5c, 0x79, 0x27, 0xf6, 0x5d, 0xee, 0xc6, 0x5c, 
-    0xfa, 0x7d, 0x52, 0x34, 0xe0, 0x21, 0xdb, 0xdd, 0x05, 0x50, 0x79, 0xf6, 0x27, 0x56, 0xb9, 0xab, 
-    0x1e, 0xe7, 0xd9, 0xb3, 0x67, 0xba, 0xc3, 0x63, 0x57, 0x2f, 0xd6, 0xe0, 0xa5, 0xea, 0xbc, 0x54, 
-    0xcd, 0xd4, 0x38, 0xa9, 0x50, 0x1c, 0x88, 0x50, 0x53, 0xb2, 0x3f, 0x20, 0x4d, 0x3f, 0x83, 0xfa, 
-    0x0b, 0x0b, 0x7a, 0xf3, 0x0b, 0xc5, 0x53, 0xba, 0x43, 0xaa, 0xdd, 0x95, 0x42, 0x4f, 0x58, 0x65, 
-    0xaa, 0xeb, 0xb0, 0xc9, 0xb5, 0xda, 0x24, 0x5e, 0x73, 0xb0, 0xe4, 0x67, 0x2b, 0x59, 0x58, 0x50, 
-    0xbf, 0x7a, 0xce, 0x20, 0x97, 0x8d, 0x27, 0x6d, 0xed, 0xd9, 0x77, 0x57, 0xde, 0x5b, 0xea, 0x5c, 
-    0x0e, 0xbe, 0xc7, 0xfb, 0xa5, 0x44, 0x1f, 0xbc, 0x13, 0x0e, 0x9a, 0xe4, 0x6f, 0x87, 0x1b, 0xb5, 
-    0x98, 0x4e, 0x9a, 0x52, 0xb4, 0x8e, 0x21, 0xfb, 0x62, 0x45, 0x9b, 0xe9, 0x45, 0x81, 0xfc, 0x1b, 
-    0x51, 0x51, 0x99, 0xac, 0x16, 0x94, 0x02, 0x20, 0x56, 0x9d, 0xa8, 0x80, 0x94, 0xfd, 0x5b, 0x78, 
-    0xd4, 0xc5, 0x47, 0x35, 0x7a, 0xd4, 0xa0, 0x27, 0x4d, 0x5e, 0x46, 0x32, 0x07, 0xc5, 0x00, 0x65, 
-    0xef, 0x4e, 0x61, 0xcb, 0x83, 0xa7, 0x09, 0x7e, 0xb0, 0xc2, 0x1b, 0x3e, 0x78, 0xfd, 0xea, 0xf5, 
-    0xdb, 0xbf, 0x1e, 0x9f, 0x1e, 0xbd, 0x3a, 0xbc, 0x24, 0xaf, 0x9c, 0x26, 0x4a, 0x5a, 0x8c, 0x19, 
-    0x4b, 0x7e, 0x38, 0x94, 0xf0, 0x50, 0x7c, 0xbe, 0x1e, 0x1c, 0x88, 0xa7, 0xad, 0xb1, 0x35, 0x90, 
-    0x9f, 0xd1, 0x53, 0xcf, 0xc7, 0x0c, 0x0c, 0xd1, 0xb7, 0xe8, 0x4d, 0xd3, 0xe5, 0xce, 0x3d, 0xf8, 
-    0x19, 0x3d, 0xed, 0xfa, 0xd6, 0x58, 0x7e, 0x8a, 0xa7, 0x18, 0x69, 0x3d, 0x26, 0x99, 0x44, 0xf0, 
-    0xd2, 0xe8, 0x2e, 0x36, 0x85, 0x31, 0xd5, 0x6f, 0x62, 0xaf, 0x68, 0x89, 0xc5, 0xf1, 0x94, 0x04, 
-    0xa7, 0x96, 0xd7, 0xe1, 0xb7, 0x8b, 0x79, 0x06, 0x06, 0xde, 0x79, 0xd4, 0xdc, 0xb2, 0xea, 0x1e, 
-    0x7e, 0xd6, 0xc8, 0xa2, 0x10, 0x25, 0x63, 0x24, 0xf0, 0x22, 0x79, 0x84, 0xe7, 0xeb, 0x77, 0xdb, 
-    0x29, 0xf1, 0xfa, 0xa5, 0x78, 0xb1, 0x07, 0xea, 0x5d, 0xb6, 0x44, 0x85, 0x8b, 0xcd, 0x10, 0xe3, 
-    0xf2, 0xcb, 0x43, 0x70, 0xf8, 0x15, 0x1d, 0x7f, 0xc3, 0x0f, 0x2d, 0x29, 0x44, 0xe8, 0x75, 0xbb, 
-    0x6e, 0x94, 0x29, 0xab, 0x10, 0x0d, 0x39, 0x96, 0x43, 0x84, 0x61, 0xda, 0x73, 0xa0, 0x79, 0x42, 
-    0x37, 0xde, 0x87, 0xd8, 0xf1, 0xb8, 0x40, 0x59, 0x04, 0x5e, 0x98, 0x0b, 0x63, 0x52, 0x41, 0x1e, 
-    0x19, 0x61, 0x84, 0xa9, 0xe1, 0x4b, 0xf8, 0xa3, 0xb6, 0x10, 0xc3, 0x16, 0x4d, 0x7b, 0xe5, 0x1e, 
-    0x9e, 0x98, 0x08, 0x5b, 0x6e, 0xcb, 0x73, 0x31, 0x02, 0x54, 0x60, 0xb7, 0xa4, 0xfb, 0xb6, 0xba, 
-    0xcc, 0xe1, 0xf5, 0x2f, 0xf9, 0xd3, 0x69, 0x7a, 0x2a, 0x2f, 0x58, 0xe4, 0x60, 0x44, 0x5e, 0x3c, 
-    0xbd, 0x6e, 0x4a, 0x47, 0xa0, 0xf9, 0x36, 0xe5, 0x34, 0x4c, 0x70, 0xc7, 0x13, 0xba, 0x92, 0xb2, 
-    0x9d, 0x12, 0xc6, 0x86, 0x73, 0x84, 0x40, 0xd6, 0x19, 0x60, 0xb8, 0x59, 0x07, 0xf4, 0x36, 0x3f, 
-    0xd0, 0xc3, 0xcb, 0xf2, 0xe0, 0xba, 0xea, 0xce, 0x3b, 0xff, 0xf9, 0xb9, 0xf6, 0x25, 0x8a, 0xe5, 
-    0x64, 0xb5, 0x0f, 0x10, 0xc4, 0x73, 0x58, 0x68, 0x87, 0xb0, 0x62, 0x5b, 0xfe, 0xb5, 0x44, 0x43, 
-    0x15, 0x2e, 0xe1, 0x53, 0xb1, 0x80, 0xc5, 0x2b, 0xb8, 0x64, 0x0b, 0x4e, 0xd4, 0x70, 0x23, 0xaf, 
-    0x09, 0x43, 0x82, 0xc5, 0xaa, 0xe3, 0x10, 0x15, 0x44, 0x1f, 0x8c, 0x2c, 0x23, 0xfc, 0x41, 0x74, 
-    0xe3, 0x42, 0x97, 0x07, 0x8a, 0x43, 0x3a, 0x98, 0x11, 0x2b, 0xee, 0x96, 0xc3, 0x89, 0x30, 0x65, 
-    0x7c, 0x7e, 0xfd, 0xf1, 0x1e, 0x9b, 0x7d, 0x28, 0xfe, 0x78, 0x4f, 0x00, 0x1e, 0x7e, 0x35, 0x96, 
-    0x6f, 0x90, 0x72, 0x8b, 0x54, 0x2e, 0x42, 0xf9, 0x5f, 0xb5, 0xc5, 0x5d, 0x34, 0x0f, 0x04, 0x47, 
-    0x40, 0x18, 0xdf, 0x87, 0xfa, 0xf2, 0x99, 0x4a, 0x7f, 0x31, 0x63, 0x6e, 0xc4, 0xed, 0x32, 0x50, 
-    0xe3, 0xbd, 0x85, 0xeb, 0xb7, 0xbe, 0x7e, 0x19, 0xf5, 0x95, 0x71, 0x86, 0x37, 0xa3, 0x82, 0x6d, 
-    0xf0, 0x9a, 0xdb, 0x2a, 0xf8, 0xcf, 0x5d, 0xea, 0x1b, 0xe9, 0xcd, 0xa3, 0xc5, 0xd1, 0x16, 0xec, 
-    0x43, 0x31, 0xa4, 0x2c, 0x86, 0x29, 0x33, 0xc2, 0x22, 0xcf, 0x83, 0x01, 0xbc, 0x95, 0xab, 0xec, 
-    0x1c, 0x20, 0xab, 0x3a, 0x2d, 0x90, 0xf5, 0x3b, 0x67, 0x80, 0x72, 0xcb, 0xb7, 0x3a, 0x61, 0xde, 
-    0x1c, 0x4e, 0xe2, 0x53, 0x1a, 0x53, 0x11, 0xcb, 0x99, 0xae, 0xd5, 0x68, 0xa3, 0x19, 0x49, 0x46, 
-    0x8c, 0x66, 0xaa, 0x7e, 0x49, 0xde, 0x4c, 0x7b, 0xf8, 0x39, 0x02, 0xf4, 0x25, 0x2d, 0x76, 0x38, 
-    0x17, 0x70, 0x29, 0x6a, 0x25, 0x9f, 0x34, 0x24, 0x72, 0x31, 0x9f, 0x88, 0xb2, 0xff, 0xa6, 0xe7, 
-    0x58, 0x11, 0x8e, 0x5c, 0x5c, 0x0c, 0xb3, 0x69, 0x48, 0x90, 0xb1, 0x31, 0x7d, 0xae, 0x50, 0xa9, 
-    0x68, 0x8a, 0x4c, 0x9a, 0x20, 0xbc, 0x58, 0x34, 0x2f, 0xa6, 0x75, 0x47, 0x6a, 0xe6, 0x05, 0xf6, 
-    0x2b, 0x8e, 0x12, 0xa8, 0xb6, 0x3f, 0xde, 0xf3, 0xfa, 0x68, 0x1e, 0x7f, 0x10, 0xa3, 0xf6, 0xab, 
-    0x1a, 0xca, 0x03, 0x17, 0x4d, 0x5a, 0x18, 0x79, 0x3a, 0x4d, 0x36, 0x80, 0x64, 0x68, 0xba, 0x56, 
-    0xeb, 0x5a, 0x33, 0xb0, 0x61, 0x79, 0xee, 0x24, 0x4a, 0x04, 0xcb, 0xa5, 0x65, 0xf8, 0x49, 0x00, 
-    0x8d, 0x81, 0x33, 0x32, 0xfe, 0x28, 0x85, 0x01, 0xdf, 0xc8, 0x08, 0x23, 0xd2, 0x1f, 0x64, 0x9e, 
-    0xc9, 0xfb, 0x59, 0x92, 0x53, 0x10, 0xec, 0x8b, 0x2a, 0x48, 0xcb, 0x88, 0x2a, 0xf7, 0xfd, 0xd3, 
-    0xfc, 0x11, 0x26, 0x7a, 0xca, 0x54, 0xd7, 0x6f, 0x9e, 0xc5, 0x26, 0x27, 0xd1, 0x24, 0xba, 0x46, 
-    0xa6, 0xcf, 0x4e, 0xe3, 0xd5, 0x83, 0x16, 0xf9, 0xff, 0x61, 0x01, 0x1e, 0xc9, 0xf2, 0xc9, 0xc7, 
-    0x47, 0x95, 0xa7, 0x13, 0xd2, 0x95, 0x2b, 0xb9, 0x02, 0xc3, 0x7b, 0xc0, 0x2b, 0x52, 0xb4, 0xbe, 
-    0x43, 0x81, 0xc0, 0x55, 0xd6, 0x1b, 0x70, 0x78, 0x3b, 0x22, 0x97, 0x4f, 0x2c, 0x4e, 0xd7, 0xbc, 
-    0x40, 0xb1, 0x6a, 0x73, 0x4a, 0xd6, 0x4e, 0x41, 0x71, 0x73, 0xfd, 0x4f, 0x64, 0xb1, 0x7a, 0x8c, 
-    0x35, 0x7a, 0x81, 0x55, 0x3a, 0xa1, 0x16, 0x91, 0x5c, 0xcf, 0xd6, 0x44, 0xa2, 0x02, 0xa0, 0x3f, 
-    0xae, 0xd8, 0x3c, 0x21, 0xf3, 0x72, 0x03, 0x30, 0x5d, 0x1f, 0x5a, 0x8e, 0xfe, 0x69, 0x30, 0x1f, 
-    0x87, 0xfc, 0x5a, 0x8f, 0x89, 0x17, 0xe5, 0xec, 0xa4, 0x0d, 0x37, 0x5f, 0xc1, 0x40, 0x43, 0x19, 
-    0x8e, 0x42, 0xf6, 0xac, 0xb8, 0x4b, 0x13, 0x8f, 0x7e, 0xe5, 0x57, 0x66, 0x4b, 0x86, 0x79, 0xe5, 
-    0xc2, 0x1f, 0x6f, 0xf1, 0x8f, 0x24, 0x82, 0x90, 0x07, 0xde, 0x80, 0xd3, 0x40, 0x8d, 0x98, 0x21, 
-    0x0a, 0x74, 0xa1, 0xb1, 0xcd, 0xed, 0x50, 0x52, 0x5a, 0x24, 0x2a, 0x1a, 0x57, 0x86, 0xcb, 0xff, 
-    0xe2, 0x87, 0xcf, 0x95, 0xe2, 0xd3, 0xbd, 0xe2, 0xb1, 0x55, 0xec, 0x7c, 0xb9, 0x5f, 0x7f, 0xf8, 
-    0xb1, 0x5c, 0x42, 0x2f, 0xde, 0x9c, 0x82, 0x9e, 0x37, 0xaf, 0xa9, 0x27, 0x75, 0x07, 0xd1, 0x6a, 
-    0xe2, 0x76, 0xfa, 0x43, 0x4c, 0x6f, 0xc0, 0x31, 0x4e, 0x31, 0xea, 0xea, 0x6b, 0x88, 0x38, 0xa1, 
-    0xd1, 0xf7, 0x37, 0x29, 0x26, 0x39, 0x83, 0x3b, 0x75, 0xd1, 0x50, 0x92, 0x6c, 0xf5, 0x73, 0x6c, 
-    0x82, 0xa1, 0x9b, 0x59, 0x45, 0x4f, 0x32, 0xad, 0xd4, 0xf9, 0xb9, 0x1a, 0x90, 0xbc, 0x9f, 0x02, 
-    0x9f, 0xf8, 0x48, 0x81, 0x4f, 0x37, 0x26, 0x6b, 0xfd, 0xe1, 0xa6, 0x47, 0xd5, 0xba, 0x4a, 0x2a, 
-    0x83, 0xc7, 0x77, 0x22, 0xaf, 0x98, 0xb9, 0x5e, 0xc2, 0x18, 0x19, 0xab, 0xb2, 0x13, 0x08, 0x89, 
-    0x60, 0xb7, 0xc5, 0x9a, 0x1b, 0xdf, 0x0d, 0xaa, 0x2b, 0xe8, 0xa4, 0x54, 0xb7, 0x64, 0x44, 0x94, 
-    0x7b, 0x75, 0xf8, 0xe6, 0x5f, 0x6f, 0xb1, 0x7b, 0x95, 0x4a, 0x86, 0x26, 0x06, 0x3e, 0x58, 0xd1, 
-    0xc6, 0x6c, 0x9e, 0x35, 0x37, 0xea, 0xaa, 0x7f, 0x7d, 0x32, 0x9d, 0xf3, 0xb1, 0x48, 0x8c, 0xed, 
-    0x7f, 0x36, 0xb9, 0x46, 0xfa, 0x7c, 0x03, 0x2e, 0x33, 0x60, 0x51, 0x99, 0xe9, 0xc0, 0xf8, 0xfe, 
-    0x85, 0x63, 0x05, 0xb3, 0x69, 0x22, 0x8b, 0x8b, 0x32, 0x06, 0x83, 0x6b, 0x44, 0x23, 0xad, 0x4c, 
-    0xaa, 0xde, 0x3b, 0x86, 0xf9, 0x44, 0xd6, 0x4c, 0x5c, 0xe7, 0xc6, 0xa4, 0x66, 0xb2, 0x13, 0xd3, 
-    0x9a, 0x96, 0x85, 0x26, 0xb6, 0x4d, 0x05, 0xd2, 0x1b, 0x57, 0x75, 0x53, 0x97, 0xfe, 0xf9, 0x53, 
-    0x14, 0x89, 0xec, 0x2e, 0xff, 0x4b, 0xa5, 0x28, 0x8a, 0xe9, 0x31, 0x4b, 0x9b, 0xa5, 0xa7, 0x27, 
-    0x17, 0x9a, 0xb8, 0x41, 0x30, 0xed, 0xce, 0x7c, 0x4a, 0x6a, 0xf9, 0x85, 0x12, 0x36, 0xe2, 0x00, 
-    0x13, 0x2e, 0x4e, 0x57, 0x94, 0xdf, 0x62, 0x21, 0x73, 0x8e, 0x03, 0x78, 0xb1, 0x73, 0x92, 0xf1, 
-    0x7a, 0x83, 0x98, 0xba, 0xfc, 0x87, 0x1d, 0xe0, 0x7b, 0xbd, 0xd3, 0x2a, 0x16, 0xf1, 0xa2, 0x23, 
-    0x9e, 0x66, 0xe7, 0xd6, 0x42, 0x3a, 0xbc, 0xa5, 0x64, 0x51, 0x82, 0x58, 0x94, 0xc3, 0x49, 0x17, 
-    0x22, 0x62, 0x63, 0x38, 0x85, 0x20, 0xa9, 0xa7, 0x90, 0x72, 0x32, 0x4d, 0xce, 0x2e, 0x34, 0xbf, 
-    0x46, 0xad, 0x0f, 0x26, 0xd1, 0x23, 0x9b, 0x4f, 0xbd, 0x3c, 0x33, 0x0f, 0xcf, 0xa5, 0x9e, 0xa9, 
-    0x3c, 0x3c, 0x06, 0x0b, 0x13, 0x66, 0x09, 0x1e, 0xd6, 0x6e, 0x06, 0x44, 0x96, 0xf6, 0x94, 0x1c, 
-    0x59, 0xa2, 0xd0, 0x42, 0x27, 0x1f, 0x2a, 0x13, 0xf3, 0x9c, 0xc1, 0xec, 0x35, 0x8f, 0xd1, 0x49, 
-    0xa9, 0x96, 0x64, 0x84, 0x25, 0x71, 0x58, 0xa4, 0x9d, 0x38, 0x09, 0x04, 0xdf, 0x9d, 0x72, 0xa9, 
-    0xa3, 0x85, 0x46, 0x9a, 0x3f, 0xbc, 0x66, 0x31, 0x11, 0x61, 0x33, 0x95, 0xf0, 0x66, 0x46, 0x29, 
-    0x8d, 0xc4, 0xc4, 0xa7, 0x92, 0x9c, 0x88, 0xc6, 0x16, 0x0c, 0x81, 0x3d, 0x51, 0x60, 0xa0, 0x50, 
-    0x31, 0xe9, 0x2a, 0x14, 0xa2, 0xa1, 0xf3, 0xd2, 0x1e, 0x4f, 0xdb, 0x91, 0x8c, 0xc3, 0x22, 0x14, 
-    0x2a, 0x5e, 0xdb, 0x2a, 0x11, 0x79, 0x09, 0xe6, 0x64, 0x5f, 0xbf, 0x9c, 0x2b, 0xbc, 0xe8, 0x67, 
-    0x40, 0x11, 0xa5, 0x62, 0x50, 0xb4, 0x44, 0x0f, 0x7f, 0xc3, 0x13, 0x3d, 0x28, 0xcf, 0xc7, 0x27, 
-    0x02, 0x39, 0x34, 0xc4, 0x88, 0xca, 0x69, 0xfc, 0x28, 0x86, 0x32, 0x8d, 0x23, 0x2f, 0x28, 0x01, 
-    0x02, 0x23, 0x8f, 0x4a, 0xb6, 0x77, 0x71, 0xca, 0xa0, 0x17, 0xe4, 0x8f, 0x2e, 0x31, 0xe6, 0x7b, 
-    0x9e, 0xec, 0xc4, 0x90, 0x95, 0x3c, 0xc1, 0x2b, 0x1d, 0xa8, 0x32, 0x10, 0xaa, 0x41, 0xb8, 0x30, 
-    0x43, 0xfe, 0xe3, 0x8a, 0x48, 0x4e, 0xb1, 0x02, 0x33, 0xae, 0x42, 0x6c, 0xc9, 0x9f, 0xc9, 0x50, 
-    0xee, 0xcb, 0x88, 0xcf, 0x27, 0x93, 0xe4, 0xe7, 0x7c, 0x83, 0x62, 0x4a, 0x1d, 0x52, 0x70, 0xd3, 
-    0xb2, 0xea, 0xc5, 0x03, 0xdb, 0xcc, 0x96, 0x4b, 0x53, 0xf8, 0x20, 0xb6, 0xb8, 0xca, 0xf4, 0x75, 
-    0x93, 0x46, 0x7d, 0xaf, 0xdd, 0x36, 0x62, 0xac, 0xf1, 0xe4, 0xbc, 0x1d, 0xb2, 0xdc, 0x61, 0x22, 
-    0x70, 0xf4, 0xb4, 0xc9, 0xc9, 0xb9, 0x67, 0xb9, 0x3e, 0x0c, 0x21, 0x26, 0xef, 0x55, 0x15, 0xf2, 
-    0x92, 0x81, 0x45, 0x61, 0x8c, 0xa1, 0x86, 0x1d, 0xd5, 0x7e, 0x72, 0x2f, 0xb8, 0x27, 0x7a, 0xd4, 
-    0x23, 0xb1, 0xd3, 0xb3, 0x82, 0x4f, 0xbc, 0x23, 0xf1, 0x20, 0x6c, 0xa5, 0xc0, 0x83, 0x85, 0x5e, 
-    0x46, 0x46, 0x8c, 0x87, 0x4e, 0xd2, 0xc6, 0x27, 0x02, 0xa1, 0x19, 0x72, 0x27, 0x47, 0xcd, 0x9f, 
-    0x98, 0x1e, 0x54, 0x52, 0x84, 0xae, 0x0a, 0x51, 0xbe, 0x6f, 0x45, 0xe4, 0xac, 0x38, 0x60, 0x8b, 
-    0xa7, 0xa6, 0x66, 0x82, 0x6b, 0x0c, 0x31, 0xbe, 0x2d, 0x96, 0x56, 0x3a, 0x93, 0xe6, 0xab, 0x6a, 
-    0xf2, 0x44, 0x3d, 0x26, 0x53, 0x23, 0x75, 0x86, 0xff, 0x4c, 0x3d, 0x7b, 0xc2, 0x83, 0x58, 0x46, 
-    0x8a, 0x2c, 0x1e, 0x34, 0x30, 0xca, 0x2d, 0x1e, 0x93, 0x6c, 0xc7, 0x7c, 0x67, 0x31, 0x9f, 0x78, 
-    0x4b, 0x48, 0xb4, 0x79, 0x6a, 0x2b, 0xb1, 0x26, 0x0f, 0xd6, 0xb4, 0x86, 0xf3, 0x3a, 0x16, 0x6a, 
-    0x63, 0xcb, 0xcf, 0x52, 0x94, 0x6c, 0xcb, 0x46, 0xd7, 0xb6, 0xb5, 0x56, 0xf3, 0x06, 0x0e, 0x66, 
-    0xdd, 0xe4, 0x45, 0xa7, 0x6c, 0x8c, 0x32, 0x38, 0x07, 0x02, 0xb9, 0x72, 0x25, 0x69, 0x43, 0xaf, 
-    0x0f, 0x9d, 0x9b, 0xa9, 0x5d, 0xd3, 0xa6, 0x53, 0x10, 0xf5, 0xee, 0x89, 0xac, 0x6b, 0x8c, 0x89, 
-    0x3a, 0xd7, 0x31, 0x62, 0x33, 0xca, 0xa2, 0x29, 0x99, 0xaf, 0x16, 0x4e, 0x72, 0x24, 0xae, 0x70, 
-    0xcd, 0x4e, 0x70, 0x64, 0x07, 0x2d, 0x6b, 0x68, 0x9f, 0x84, 0x7d, 0x37, 0xa7, 0x13, 0x4b, 0xde, 
-    0x18, 0x4b, 0x12, 0x30, 0x9f, 0x92, 0xa0, 0x6a, 0x61, 0xf4, 0xa2, 0xab, 0x62, 0x73, 0x64, 0xc5, 
-    0x32, 0xee, 0xae, 0xb4, 0xe3, 0xd7, 0xb8, 0x1e, 0x03, 0x1d, 0xba, 0x9c, 0xb4, 0x0c, 0x22, 0xfc, 
-    0x4a, 0xd1, 0xe3, 0xa0, 0x80, 0x97, 0x61, 0x96, 0xc3, 0x81, 0x6e, 0xf0, 0xa4, 0x20, 0xf1, 0x6b, 
-    0x5a, 0x46, 0x47, 0x17, 0x83, 0xf7, 0xa3, 0xa4, 0xff, 0x3d, 0xd8, 0x8e, 0x2f, 0x2e, 0xb3, 0x32, 
-    0xae, 0xd1, 0xf5, 0x9a, 0x9d, 0x0c, 0x19, 0x56, 0xb6, 0x7e, 0xe8, 0xac, 0xaf, 0xa7, 0x31, 0x62, 
-    0x84, 0xe7, 0x1c, 0x3d, 0x7b, 0x12, 0x13, 0x12, 0x4f, 0x52, 0xf8, 0x76, 0x5a, 0x77, 0xb3, 0xc9, 
-    0x60, 0x06, 0xff, 0xd4, 0x64, 0xd9, 0xdc, 0xdc, 0x84, 0x69, 0x4c, 0xb6, 0xe1, 0x2b, 0x9b, 0xe2, 
-    0xc8, 0x60, 0x3e, 0x26, 0xd0, 0x5b, 0x26, 0x51, 0xc3, 0x58, 0x25, 0x0c, 0x36, 0x19, 0x8c, 0xfa, 
-    0xda, 0x0a, 0x01, 0xbf, 0xd0, 0x22, 0x82, 0x1f, 0x4f, 0x78, 0x98, 0x4a, 0xe9, 0xe6, 0xc2, 0x8f, 
-    0x79, 0xf0, 0x85, 0x66, 0x8b, 0xc3, 0xca, 0x52, 0x9a, 0xe1, 0xab, 0xdd, 0x1d, 0x74, 0xb9, 0xc6, 
-    0xff, 0x54, 0x45, 0x7a, 0x5e, 0x56, 0x8f, 0xb5, 0x84, 0x6d, 0x18, 0x38, 0xe1, 0x2c, 0x9b, 0x52, 
-    0x3d, 0xad, 0x6e, 0xbc, 0xe2, 0xcb, 0xac, 0xe6, 0x96, 0x02, 0xc5, 0x22, 0x67, 0x9b, 0x98, 0x3f, 
-    0x0d, 0xef, 0x2c, 0x3a, 0x34, 0xed, 0x75, 0xbd, 0x1c, 0x7a, 0x6e, 0xc2, 0xe0, 0xf5, 0x87, 0xfa, 
-    0xd9, 0x65, 0xf4, 0x4c, 0x76, 0xf6, 0xdc, 0xbe, 0x91, 0x97, 0x70, 0xb5, 0x3b, 0x0d, 0x14, 0x9d, 
-    0x05, 0xbe, 0xc6, 0x83, 0xe9, 0xf0, 0x5b, 0x0d, 0xe2, 0x32, 0x3a, 0x41, 0xd2, 0x5c, 0xa6, 0x9d, 
-    0x41, 0x60, 0x7a, 0x4c, 0x53, 0x0d, 0x4c, 0xa5, 0x27, 0x53, 0x28, 0x23, 0x12, 0x54, 0xec, 0x19, 
-    0xfa, 0x20, 0x4b, 0x14, 0x5e, 0x8c, 0x78, 0xbb, 0xd9, 0x58, 0x91, 0xf5, 0x88, 0x3c, 0xf4, 0x04, 
-    0x68, 0xd1, 0x67, 0x56, 0xd7, 0xd3, 0xb0, 0xc5, 0xeb, 0x5f, 0xb1, 0x46, 0xa9, 0x28, 0xe5, 0xef, 
-    0x93, 0xe0, 0x78, 0xa1, 0x67, 0x18, 0xdb, 0x47, 0xc2, 0xe3, 0x8f, 0x00, 0x60, 0x4f, 0x01, 0x14, 
-    0x6f, 0x34, 0x48, 0xbc, 0x50, 0x99, 0xea, 0x41, 0xd1, 0xb6, 0x28, 0x9a, 0xdc, 0x26, 0xa1, 0x05, 
-    0xed, 0x9f, 0xb7, 0x49, 0xf1, 0x6d, 0xd2, 0x04, 0x4d, 0x79, 0x3a, 0x74, 0xcd, 0x6a, 0x81, 0xd3, 
-    0x1d, 0x75, 0x66, 0x20, 0xc3, 0x40, 0x1c, 0x62, 0x95, 0x4a, 0xa2, 0x07, 0xd1, 0x6e, 0x6a, 0xc2, 
-    0x76, 0x8b, 0xfd, 0xaf, 0xbf, 0xb9, 0x92, 0xdd, 0xbb, 0xea, 0xd9, 0xca, 0xbd, 0x93, 0x92, 0xc7, 
-    0xd8, 0xa2, 0x87, 0x73, 0x6c, 0x24, 0x97, 0xf0, 0xe9, 0x9c, 0x3a, 0x3e, 0x8f, 0x9c, 0x7f, 0x5d, 
-    0xed, 0x01, 0x23, 0x3f, 0x4c, 0x6d, 0x0f, 0x40, 0x9e, 0x97, 0xf9, 0x47, 0xd8, 0xc8, 0x1d, 0x28, 
-    0x0e, 0x22, 0xe2, 0xb1, 0x0e, 0x6d, 0xec, 0x4c, 0x1b, 0x13, 0xbf, 0x6a, 0x38, 0xd5, 0xc2, 0x44, 
-    0x45, 0x82, 0x85, 0x0c, 0x4c, 0x74, 0x03, 0x2e, 0x98, 0xdb, 0xbe, 0xa4, 0x07, 0x76, 0x95, 0x6a, 
-    0x3b, 0x07, 0x81, 0xf3, 0x54, 0x4f, 0x30, 0xf7, 0x8f, 0x6d, 0x33, 0xe2, 0x58, 0xc4, 0xac, 0x45, 
-    0x8a, 0x3a, 0xa4, 0xbf, 0xc3, 0x92, 0x61, 0x5c, 0x53, 0xd6, 0x25, 0x21, 0xde, 0x85, 0x3c, 0x15, 
-    0xa7, 0x7e, 0x13, 0xc5, 0x18, 0xb5, 0x51, 0xc4, 0xa2, 0xfa, 0xa6, 0x4a, 0x84, 0xa5, 0xff, 0xe0, 
-    0x5b, 0xc3, 0xd9, 0x95, 0x45, 0xe1, 0x22, 0x86, 0x53, 0x4a, 0x01, 0x72, 0x4a, 0xe1, 0x73, 0xe7, 
-    0x83, 0xa1, 0x57, 0xc7, 0x5b, 0x8f, 0x33, 0x36, 0x3e, 0xbc, 0x2e, 0x16, 0xd4, 0x2b, 0x8e, 0x86, 
-    0x48, 0xbd, 0xfd, 0x70, 0xea, 0xe9, 0x7d, 0x33, 0x1c, 0x14, 0x45, 0x75, 0x61, 0xc8, 0x90, 0x32, 
-    0x5a, 0x91, 0x8d, 0x2e, 0x93, 0x72, 0xe7, 0xa2, 0xd8, 0xb3, 0xcf, 0x15, 0xe5, 0x52, 0xa4, 0x51, 
-    0x2a, 0x91, 0xfc, 0x47, 0x66, 0xf4, 0xe1, 0xe6, 0x48, 0x81, 0x14, 0xbe, 0xe7, 0x79, 0x80, 0x76, 
-    0x48, 0xfa, 0xa4, 0xca, 0xeb, 0x68, 0x00, 0x31, 0xa4, 0x6a, 0xa2, 0xf1, 0x28, 0xf0, 0x07, 0x26, 
-    0x96, 0xa4, 0x62, 0x68, 0x20, 0xd0, 0x7b, 0x40, 0x06, 0x87, 0x12, 0x5d, 0x31, 0xcf, 0xf1, 0x19, 
-    0xf1, 0x97, 0xf2, 0xd7, 0xa1, 0xfd, 0x73, 0xb7, 0x9c, 0x4f, 0x9b, 0xc8, 0x82, 0x14, 0xc9, 0x69, 
-    0x4c, 0xfc, 0xfc, 0xe2, 0xe2, 0x39, 0xe3, 0xc4, 0xb0, 0x7c, 0xd8, 0xb1, 0x8e, 0x86, 0x43, 0xcf, 
-    0x0f, 0xe5, 0x64, 0xfe, 0xbd, 0x68, 0x60, 0xf6, 0x0f, 0x07, 0x99, 0x42, 0x07, 0xbe, 0xdc, 0x67, 
-    0x7d, 0xeb, 0x4e, 0xda, 0x6d, 0xa8, 0xab, 0xf4, 0x6e, 0x97, 0x32, 0xf6, 0x46, 0xc1, 0xae, 0xe6, 
-    0xea, 0xdd, 0x31, 0x91, 0xce, 0xf3, 0x78, 0x74, 0x1b, 0x50, 0x82, 0xac, 0x3b, 0x46, 0x6d, 0xe4, 
-    0x4b, 0x4c, 0x84, 0x56, 0xe6, 0x29, 0x47, 0xf4, 0x2b, 0xb9, 0xaa, 0xcd, 0xfc, 0xef, 0xdd, 0x7f, 
-    0xba, 0x32, 0x1e, 0xa5, 0x88, 0x90, 0x0b, 0x09, 0xc5, 0x0f, 0xe0, 0xd7, 0x23, 0xb1, 0x03, 0x6f, 
-    0xe9, 0x41, 0x4e, 0xd8, 0x79, 0xf0, 0x7b, 0xc9, 0x1b, 0x90, 0x00, 0xd9, 0x51, 0xb2, 0x34, 0x12, 
-    0x39, 0xd1, 0xac, 0x2c, 0x05, 0x3e, 0xde, 0x65, 0x04, 0x56, 0xa1, 0xe0, 0x80, 0x25, 0xbe, 0x50, 
-    0xcc, 0xd1, 0x25, 0x9e, 0xb2, 0x4a, 0xac, 0x5c, 0x7c, 0x96, 0xc6, 0x3c, 0xf8, 0xd3, 0xc9, 0xb5, 
-    0x2d, 0x6f, 0xc7, 0x08, 0x2c, 0xf1, 0x63, 0x2f, 0x40, 0xc3, 0xfe, 0xbb, 0xb7, 0xaf, 0xa8, 0x1c, 
-    0x9f, 0x86, 0xd3, 0x86, 0x4e, 0xd3, 0x55, 0xde, 0x92, 0x31, 0x0f, 0x84, 0x25, 0xa7, 0x2b, 0xe7, 
-    0xc6, 0x54, 0x1a, 0x8b, 0x1c, 0x0d, 0x49, 0x25, 0x92, 0x97, 0x26, 0x09, 0xfa, 0x58, 0xa2, 0xb3, 
-    0x27, 0x87, 0x67, 0x46, 0x3d, 0x5e, 0x6e, 0xa2, 0x06, 0xda, 0xb3, 0x82, 0xe3, 0xd4, 0xe9, 0x8f, 
-    0xfb, 0xa7, 0x34, 0x89, 0xa0, 0x6e, 0x76, 0x06, 0x47, 0xc2, 0xee, 0xb9, 0xa3, 0x5b, 0x31, 0xb1, 
-    0x5a, 0xc2, 0xa8, 0x49, 0x81, 0xd2, 0xb5, 0xd0, 0xce, 0xc4, 0x52, 0x7c, 0xd5, 0x41, 0x85, 0xe2, 
-    0xb7, 0x91, 0x03, 0xd3, 0xdd, 0xa2, 0xe6, 0xa4, 0x6c, 0x89, 0xc0, 0x03, 0xc0, 0x27, 0x02, 0xcb, 
-    0x85, 0xe6, 0xdc, 0xb9, 0x27, 0x66, 0xb4, 0xf0, 0x60, 0x98, 0x43, 0x65, 0x9d, 0xcc, 0x04, 0xa9, 
-    0xe8, 0xa0, 0x8a, 0x04, 0xfa, 0x29, 0x3c, 0x45, 0xe5, 0x15, 0x95, 0xa4, 0x77, 0x34, 0xce, 0xe2, 
-    0x41, 0x7e, 0x6a, 0x5e, 0xb7, 0xf8, 0xc2, 0x90, 0x9c, 0xab, 0x71, 0x55, 0xf8, 0xb4, 0xa3, 0x4c, 
-    0xcd, 0x18, 0xcc, 0x01, 0x54, 0x22, 0xa0, 0x19, 0x52, 0x12, 0xbb, 0x59, 0xe0, 0xb9, 0x32, 0x46, 
-    0xca, 0x05, 0x5f, 0x30, 0x48, 0xa4, 0x54, 0x4c, 0x23, 0xe8, 0x3c, 0x8a, 0x4e, 0x99, 0xc3, 0xd6, 
-    0x34, 0xec, 0x49, 0x3a, 0xf6, 0xd2, 0x5a, 0xf6, 0x44, 0x3d, 0xdb, 0xe1, 0x96, 0x68, 0x9d, 0xb1, 
-    0x94, 0x81, 0xba, 0xa0, 0x32, 0x88, 0x8a, 0x29, 0x21, 0xd4, 0xec, 0xe8, 0x14, 0x63, 0x2e, 0xd5, 
-    0x78, 0xba, 0x12, 0x6b, 0x9a, 0xbc, 0x89, 0x20, 0x59, 0x2d, 0xde, 0x7e, 0x64, 0xe2, 0x96, 0x7a, 
-    0xa4, 0x1e, 0x8b, 0x3f, 0x69, 0x12, 0x4f, 0x9e, 0x8e, 0x48, 0x6b, 0x7c, 0xba, 0x08, 0xe2, 0x0a, 
-    0xac, 0xe8, 0x1f, 0x1f, 0x87, 0xf6, 0x93, 0x08, 0x81, 0xd8, 0x49, 0xef, 0x7c, 0x13, 0x24, 0xe5, 
-    0xd4, 0x45, 0x1a, 0xd1, 0x35, 0x15, 0x5a, 0x38, 0x8b, 0x2c, 0xc3, 0xc5, 0x2a, 0xdd, 0xa4, 0xee, 
-    0xb4, 0x62, 0x1e, 0xe0, 0x48, 0xd6, 0xe6, 0xf3, 0x46, 0x31, 0xb3, 0x1e, 0x6b, 0x70, 0xb2, 0x6e, 
-    0xa2, 0x07, 0x24, 0xf4, 0xfb, 0xe2, 0xdc, 0x96, 0x16, 0x2b, 0xf1, 0x53, 0xd2, 0x5a, 0xbe, 0x2e, 
-    0x01, 0xeb, 0xc1, 0x60, 0xe4, 0xb2, 0x24, 0x4b, 0x0b, 0x4c, 0xac, 0x04, 0xa9, 0x45, 0x84, 0xd8, 
-    0x94, 0xcc, 0xa5, 0xc7, 0x2d, 0x51, 0xd3, 0xb0, 0xc0, 0x82, 0xa1, 0xdd, 0x02, 0x0e, 0x65, 0xb7, 
-    0x3d, 0x07, 0xf4, 0x6d, 0x95, 0x8a, 0x47, 0xec, 0xcc, 0x93, 0x73, 0x2f, 0x62, 0xa8, 0x44, 0x83, 
-    0xa2, 0x0e, 0xb1, 0x34, 0x6a, 0xe2, 0x69, 0xac, 0x9e, 0x37, 0xe8, 0x36, 0x6d, 0xca, 0xf2, 0x05, 
-    0x87, 0xcf, 0xdc, 0x99, 0x7b, 0x62, 0x3e, 0xe9, 0x24, 0x46, 0x8b, 0x1c, 0x00, 0xce, 0xe3, 0x40, 
-    0x41, 0x9a, 0x9d, 0x15, 0x3b, 0x3f, 0x83, 0x3a, 0x94, 0x08, 0x07, 0xfe, 0x6f, 0x45, 0xab, 0x01, 
-    0xcb, 0x69, 0xe7, 0x69, 0x79, 0x6d, 0x5a, 0x3e, 0x49, 0xa1, 0xe0, 0xd4, 0x13, 0xac, 0x35, 0xe3, 
-    0x04, 0x4b, 0x60, 0xc7, 0xc7, 0xe7, 0x21, 0xe1, 0x48, 0x35, 0x65, 0x6a, 0xa7, 0x4c, 0x6c, 0xe3, 
-    0xe8, 0x8a, 0xa3, 0xed, 0x3a, 0x62, 0xd7, 0x3e, 0x79, 0xb6, 0x0b, 0x33, 0x5a, 0x40, 0x29, 0x3e, 
-    0x94, 0x28, 0xfe, 0x59, 0x4e, 0x6d, 0x31, 0xfa, 0x30, 0xa9, 0x71, 0x19, 0xe1, 0xcf, 0xf8, 0x18, 
-    0xc2, 0x33, 0x68, 0xad, 0x6f, 0xa3, 0x95, 0x33, 0x3a, 0xae, 0x14, 0xf0, 0x4b, 0xd9, 0x34, 0x6f, 
-    0x91, 0xa9, 0xb2, 0x04, 0x2f, 0x61, 0xce, 0xf4, 0x0f, 0x59, 0x48, 0x66, 0xd0, 0xd4, 0x8d, 0xcb, 
-    0x8c, 0xef, 0x95, 0x18, 0xb3, 0x6d, 0x02, 0x13, 0x17, 0x7e, 0x03, 0x23, 0xae, 0x56, 0xdb, 0x31, 
-    0x7b, 0xc5, 0xf7, 0x61, 0x97, 0xe6, 0x4d, 0xd1, 0xb6, 0x71, 0xb7, 0xce, 0x35, 0x3c, 0x27, 0x76, 
-    0xab, 0x44, 0xb9, 0x5f, 0x1d, 0x52, 0x21, 0xc1, 0xf9, 0x58, 0xd4, 0xf0, 0xb4, 0x4a, 0x31, 0x3c, 
-    0x2c, 0x2a, 0xd8, 0x1c, 0x21, 0x3d, 0x1c, 0x21, 0x2d, 0xe6, 0xb4, 0x61, 0x94, 0x39, 0xf6, 0xff, 
-    0xc4, 0x82, 0xe2, 0x2d, 0x39, 0x74, 0xf3, 0x0b, 0x3e, 0x92, 0x85, 0xd3, 0xce, 0xaa, 0x13, 0xa7, 
-    0xe0, 0x20, 0xc7, 0x31, 0xf6, 0x8a, 0x3c, 0x07, 0x7f, 0x12, 0x4f, 0xd1, 0x43, 0xc1, 0xb2, 0x0c, 
-    0x41, 0xca, 0x93, 0xf0, 0x10, 0x91, 0x14, 0xc7, 0xd2, 0x29, 0x3f, 0x29, 0x51, 0x51, 0x31, 0xf4, 
-    0xfa, 0xf1, 0xed, 0xbe, 0xe5, 0x0c, 0x70, 0xb6, 0xf2, 0xc9, 0x2e, 0xd3, 0x17, 0x26, 0x25, 0x50, 
-    0x7a, 0xaa, 0xc2, 0xf4, 0x24, 0x69, 0x69, 0x48, 0xed, 0x32, 0x8d, 0x73, 0x54, 0x55, 0xa3, 0x4c, 
-    0xb1, 0x98, 0xe2, 0xfa, 0x3c, 0x4d, 0x5a, 0x4d, 0x15, 0x4b, 0x31, 0x09, 0x60, 0xb9, 0xb6, 0x1f, 
-    0xe6, 0x52, 0xe6, 0xb8, 0xe0, 0x5b, 0x73, 0x8e, 0xa7, 0xcf, 0x50, 0x0e, 0xc3, 0xac, 0x91, 0x36, 
-    0x07, 0xd3, 0x8e, 0x72, 0xf8, 0x3e, 0xae, 0x89, 0x7f, 0xa3, 0xd9, 0x43, 0x3f, 0x65, 0xb2, 0x31, 
-    0x75, 0x8a, 0xc3, 0xf6, 0xb3, 0x66, 0x14, 0x19, 0xdc, 0x94, 0x9b, 0x36, 0x1d, 0x1e, 0x22, 0x7f, 
-    0x1f, 0x25, 0xc2, 0x4b, 0xfa, 0x7b, 0xb6, 0x9f, 0xfd, 0x32, 0x31, 0x32, 0x0d, 0x7d, 0x75, 0xbd, 
-    0xae, 0x6c, 0xbe, 0xcc, 0xd4, 0x93, 0xeb, 0xbc, 0x7e, 0x77, 0x98, 0x0e, 0x8d, 0x8e, 0x81, 0xc6, 
-    0x61, 0x4e, 0xe0, 0x26, 0x8a, 0x0e, 0xbd, 0xdb, 0xdc, 0x35, 0x86, 0x6e, 0xd6, 0xcf, 0x78, 0xf2, 
-    0x2a, 0xac, 0x36, 0xa1, 0x44, 0x59, 0xf3, 0x84, 0x4d, 0x72, 0x00, 0x4b, 0x80, 0xe5, 0xa2, 0x49, 
-    0x01, 0x2f, 0x2e, 0x91, 0xe1, 0xb0, 0x69, 0x63, 0xcc, 0x10, 0x31, 0x58, 0x98, 0xec, 0x3c, 0x26, 
-    0x64, 0xd0, 0xbe, 0x97, 0x30, 0x51, 0xca, 0xfb, 0x71, 0x0a, 0x4a, 0xe0, 0x8d, 0x7c, 0x98, 0x5c, 
-    0x78, 0xc6, 0x0f, 0xc8, 0xc2, 0x63, 0x31, 0x8d, 0x38, 0x77, 0x5c, 0x60, 0xa0, 0xd2, 0xc0, 0x2e, 
-    0xc1, 0xf3, 0xdc, 0x67, 0xe9, 0x96, 0xad, 0xae, 0xf5, 0x17, 0xb4, 0x27, 0xea, 0xd4, 0x43, 0x7f, 
-    0x28, 0x19, 0x8b, 0x1e, 0xc9, 0x4b, 0x7e, 0x94, 0x91, 0xd0, 0xbf, 0x36, 0xb3, 0x42, 0xd3, 0x71, 
-    0x81, 0x30, 0x4f, 0x1a, 0xd3, 0x59, 0x37, 0x6f, 0xc6, 0x0c, 0x13, 0x49, 0x26, 0x9d, 0x69, 0xcb, 
-    0x44, 0x3a, 0x32, 0xfa, 0x1e, 0x19, 0x30, 0xd3, 0xdb, 0x10, 0xde, 0x7c, 0x0e, 0xd0, 0x09, 0x3a, 
-    0xef, 0xdd, 0x46, 0x74, 0xc6, 0xc8, 0xcb, 0x04, 0x42, 0x32, 0x26, 0x27, 0xf4, 0x36, 0x7d, 0xca, 
-    0xe4, 0x48, 0x97, 0xb6, 0xe5, 0xb7, 0x28, 0x28, 0x4e, 0x60, 0x87, 0xa7, 0x78, 0x30, 0x02, 0x3b, 
-    0xea, 0x9c, 0x24, 0x5d, 0x41, 0x9d, 0x84, 0x3d, 0x2b, 0xf3, 0xc0, 0x0e, 0xbb, 0xf0, 0x0d, 0x05, 
-    0x26, 0x7e, 0xf6, 0xc2, 0xbe, 0xbb, 0xbb, 0xf2, 0xff, 0x03, 0x90, 0xfd, 0x44, 0xa3, 0x4e, 0x66, 
+// Word aligned so it can be copied out of flash a word at a time
+const uint8_t admin_html_gz[] PROGMEM __attribute__((aligned(4))) = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xbd, 0xdb, 0x76, 0x1b, 0xcb, 
+    0x92, 0x18, 0xf8, 0xce, 0xaf, 0x48, 0xe1, 0xec, 0xdd, 0x00, 0x0e, 0x71, 0x07, 0x41, 0x52, 0xa4, 
+    0xc8, 0xdd, 0xbc, 0x8a, 0x94, 0x44, 0x8a, 0x12, 0xa9, 0xdb, 0xd6, 0x91, 0x8f, 0x0a, 0x40, 0x01, 
+    0x28, 0xb1, 0x80, 0xc2, 0xae, 0x2a, 0x90, 0x84, 0xd8, 0x7c, 0xf1, 0x8c, 0x1f, 0xc7, 0x9e, 0xb5, 
+    0x66, 0xad, 0x1e, 0x3f, 0x8c, 0x97, 0x5f, 0xe6, 0x03, 0xfa, 0xc9, 0xcb, 0x0f, 0x7e, 0xf2, 0xfc, 
+    0x49, 0xff, 0x80, 0xfd, 0x09, 0x13, 0x11, 0x79, 0xa9, 0xcc, 0xaa, 0xc2, 0x55, 0xdc, 0xdd, 0xdb, 
+    0x76, 0xef, 0x73, 0x44, 0x00, 0x55, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 
+    0xcf, 0x9e, 0x1c, 0xbe, 0x3e, 0xb8, 0xfa, 0x74, 0x71, 0xc4, 0x7a, 0x61, 0xdf, 0xdd, 0x5d, 0x79, 
+    0x86, 0x1f, 0xcc, 0xb5, 0x06, 0xdd, 0x9d, 0x8c, 0x3d, 0xc8, 0xe0, 0x03, 0xdb, 0x6a, 0xc3, 0x47, 
+    0xdf, 0x0e, 0x2d, 0xd6, 0xea, 0x59, 0x7e, 0x60, 0x87, 0x3b, 0x99, 0x77, 0x57, 0xc7, 0xc5, 0xcd, 
+    0x8c, 0x7c, 0x3c, 0xb0, 0xfa, 0xf6, 0x4e, 0xe6, 0xc6, 0xb1, 0x6f, 0x87, 0x9e, 0x1f, 0x66, 0x58, 
+    0xcb, 0x1b, 0x84, 0xf6, 0x00, 0xc0, 0x6e, 0x9d, 0x76, 0xd8, 0xdb, 0x69, 0xdb, 0x37, 0x4e, 0xcb, 
+    0x2e, 0xd2, 0x8f, 0x82, 0x33, 0x70, 0x42, 0xc7, 0x72, 0x8b, 0x41, 0xcb, 0x72, 0xed, 0x9d, 0x2a, 
+    0xe2, 0x08, 0x9d, 0xd0, 0xb5, 0x77, 0x8f, 0x86, 0x4e, 0xeb, 0x83, 0x6d, 0x85, 0x3d, 0xdb, 0xdf, 
+    0xf7, 0xee, 0xd8, 0x5e, 0xbb, 0xef, 0x0c, 0x9e, 0x95, 0xf9, 0xbb, 0x95, 0x67, 0x4f, 0x8a, 0x45, 
+    0x76, 0x39, 0x1a, 0xb0, 0x8e, 0x05, 0xb8, 0xbc, 0x01, 0x2b, 0xb2, 0x0e, 0xfc, 0xea, 0x59, 0xc3, 
+    0xe1, 0x98, 0x05, 0xf0, 0x0d, 0x1f, 0x3e, 0x61, 0xc5, 0x22, 0x80, 0xba, 0xce, 0xe0, 0x9a, 0xf9, 
+    0xb6, 0xbb, 0x93, 0xc1, 0x87, 0x19, 0x16, 0x8e, 0x87, 0x40, 0x9d, 0xd3, 0xb7, 0xba, 0x76, 0x39, 
+    0xb8, 0xe9, 0xae, 0xde, 0xf5, 0xdd, 0x0c, 0xeb, 0xf9, 0x76, 0x67, 0x27, 0xd3, 0xb6, 0x42, 0x6b, 
+    0xcb, 0x78, 0x53, 0xf8, 0xb9, 0x7e, 0x00, 0x5f, 0x19, 0x7c, 0x1d, 0x04, 0x3b, 0xd9, 0x5e, 0x18, 
+    0x0e, 0xb7, 0xca, 0xe5, 0xdb, 0xdb, 0xdb, 0xd2, 0x6d, 0xbd, 0xe4, 0xf9, 0xdd, 0x72, 0xad, 0x52, 
+    0xa9, 0x20, 0x70, 0x96, 0x61, 0x7b, 0x81, 0xd2, 0x9d, 0x6c, 0x85, 0x55, 0xd8, 0xfa, 0x1a, 0xfc, 
+    0x3f, 0xfb, 0x73, 0xfd, 0x08, 0xca, 0xb7, 0x1c, 0xbf, 0xe5, 0xda, 0xac, 0x05, 0xaf, 0xea, 0xb5, 
+    0x2c, 0x6b, 0x8d, 0xf9, 0xa7, 0x0f, 0x1f, 0x95, 0x2c, 0xeb, 0x38, 0xae, 0xbb, 0x93, 0xfd, 0xb9, 
+    0x56, 0xaf, 0x5a, 0x55, 0xab, 0x66, 0x67, 0xcb, 0xbc, 0x50, 0x37, 0x7a, 0x71, 0x7c, 0x7c, 0xf8, 
+    0xb4, 0x7e, 0x98, 0x65, 0x41, 0xe8, 0x7b, 0xd7, 0x76, 0xca, 0x23, 0xce, 0xca, 0x9d, 0x6c, 0x4d, 
+    0x3d, 0x80, 0x36, 0xdb, 0x2d, 0x6b, 0xb8, 0x93, 0xf5, 0xbd, 0xd1, 0xa0, 0x2d, 0xe8, 0xc0, 0x87, 
+    0xec, 0xae, 0xca, 0x6b, 0x1f, 0xc3, 0xe7, 0x66, 0x96, 0xdd, 0xd5, 0xc4, 0x4f, 0xf8, 0xac, 0x36, 
+    0x64, 0xe5, 0x0a, 0x72, 0xed, 0x29, 0x87, 0x84, 0x57, 0x04, 0xba, 0xb6, 0xc6, 0x41, 0x6b, 0x95, 
+    0x04, 0x68, 0x63, 0x9d, 0x83, 0x22, 0x36, 0x02, 0x7d, 0xca, 0x41, 0xe1, 0xf7, 0x24, 0xac, 0xf8, 
+    0xa9, 0x63, 0x85, 0xcf, 0xf2, 0x04, 0x52, 0x11, 0xbb, 0x4e, 0x2b, 0x14, 0x8d, 0x83, 0x22, 0x8d, 
+    0x3a, 0x56, 0xa0, 0x71, 0x12, 0xd6, 0x4d, 0x93, 0x54, 0x2a, 0x99, 0x4e, 0xaa, 0x44, 0x2a, 0x19, 
+    0x20, 0x91, 0x46, 0x0c, 0x28, 0x77, 0xf9, 0x67, 0xdb, 0xee, 0x04, 0xfc, 0x9b, 0x6f, 0xb5, 0x41, 
+    0xa2, 0x9f, 0xe3, 0x07, 0x48, 0x3d, 0x73, 0xda, 0x3b, 0xd9, 0x00, 0xe4, 0x03, 0xfb, 0x7f, 0xad, 
+    0xf2, 0x73, 0xad, 0xc1, 0x45, 0x80, 0x7f, 0xe5, 0x25, 0x82, 0xd0, 0x1b, 0x32, 0xaf, 0xd3, 0xc1, 
+    0xb1, 0x94, 0xe5, 0x20, 0xf8, 0xa8, 0xd8, 0xf2, 0x5c, 0xcf, 0x17, 0x1d, 0x7e, 0xb4, 0xbe, 0x7e, 
+    0x28, 0xeb, 0x34, 0xe0, 0xab, 0x95, 0x09, 0x25, 0x48, 0x44, 0x24, 0x95, 0x26, 0x51, 0xe2, 0x61, 
+    0x44, 0xf3, 0x64, 0x19, 0xad, 0xae, 0x49, 0x19, 0x1d, 0xf9, 0x6e, 0x0e, 0x10, 0x07, 0xdd, 0xbc, 
+    0xc4, 0xaa, 0x95, 0xaa, 0x6d, 0xf0, 0x52, 0xb5, 0xa7, 0x54, 0xaa, 0x96, 0xd5, 0xe5, 0xf7, 0x69, 
+    0xa3, 0x52, 0x49, 0x29, 0x53, 0x9f, 0xb7, 0xcc, 0x10, 0xd4, 0x00, 0x03, 0x36, 0x9e, 0xd5, 0xd6, 
+    0x59, 0x7d, 0xfd, 0x4d, 0xbd, 0xc6, 0xd6, 0x6a, 0xac, 0xbe, 0x09, 0xdf, 0x63, 0xa3, 0x82, 0x0a, 
+    0x25, 0x47, 0x05, 0x47, 0x3b, 0xf0, 0x06, 0xf6, 0xa4, 0x11, 0x22, 0xd9, 0x04, 0x23, 0x19, 0xbe, 
+    0x65, 0x84, 0x86, 0x71, 0x5e, 0x5f, 0xb2, 0x9e, 0xd7, 0xb7, 0x59, 0xd0, 0xf2, 0x6d, 0x9b, 0x6b, 
+    0x15, 0x96, 0xeb, 0x8f, 0x82, 0x90, 0x35, 0x6d, 0x76, 0x71, 0xfe, 0xbc, 0xc0, 0x06, 0x5e, 0xc8, 
+    0x2e, 0xdf, 0x3f, 0xcf, 0xc7, 0x75, 0x0d, 0x68, 0x22, 0xd7, 0x2e, 0x86, 0xde, 0xa8, 0xd5, 0x2b, 
+    0x72, 0xbd, 0x93, 0x50, 0x31, 0xc3, 0x41, 0x77, 0xbb, 0x69, 0x05, 0xf6, 0xfa, 0x5a, 0xc1, 0x79, 
+    0xbf, 0xff, 0xfa, 0xed, 0x6d, 0xe5, 0xe5, 0xf3, 0xae, 0xb7, 0x07, 0xff, 0x9d, 0x5f, 0xbe, 0xeb, 
+    0x1d, 0xbd, 0xeb, 0xc2, 0xb7, 0x57, 0x6f, 0xe0, 0xcf, 0x41, 0xe5, 0x60, 0xef, 0x14, 0x3f, 0xc7, 
+    0x7e, 0xe3, 0xd8, 0x85, 0x2f, 0x87, 0x9b, 0x47, 0xee, 0xd1, 0x9b, 0xf7, 0x6f, 0xd7, 0x6a, 0xa3, 
+    0x7a, 0xbb, 0x5e, 0x3f, 0x79, 0x77, 0xb6, 0x7f, 0xb0, 0xd7, 0xfa, 0xb5, 0xf6, 0xfc, 0xfd, 0x5a, 
+    0xb3, 0x5e, 0xd9, 0x3b, 0x3f, 0x3c, 0x68, 0x5c, 0xbe, 0x79, 0xe3, 0xbe, 0x38, 0x3f, 0xb8, 0xbe, 
+    0x7e, 0x11, 0x1e, 0xed, 0x5d, 0x1d, 0x9f, 0x1d, 0x02, 0xa2, 0xcd, 0xa3, 0xb3, 0x57, 0x27, 0x17, 
+    0xe5, 0x7a, 0xfd, 0xc3, 0xc6, 0x4d, 0x6d, 0x75, 0xb8, 0xfa, 0xa6, 0x7f, 0xe1, 0xd6, 0x6b, 0x17, 
+    0xbf, 0x3d, 0xbd, 0xfe, 0xf0, 0xbe, 0xd1, 0x3e, 0xe9, 0xad, 0xad, 0x1e, 0x7f, 0x38, 0x38, 0x7d, 
+    0xd9, 0x7d, 0xd3, 0xdd, 0xdf, 0xec, 0xee, 0xb7, 0xbc, 0xbd, 0xd6, 0xe9, 0x5e, 0xe7, 0x74, 0xef, 
+    0xe3, 0xcb, 0xbd, 0x93, 0x83, 0xbd, 0x93, 0xf1, 0xde, 0xf3, 0x37, 0x7b, 0xab, 0x6f, 0xf6, 0x5e, 
+    0xbf, 0xdb, 0x7b, 0x7d, 0xbd, 0x77, 0x71, 0xbd, 0x77, 0xe8, 0xee, 0x1d, 0x0e, 0xf7, 0x0e, 0x1b, 
+    0x7b, 0x87, 0x1a, 0xcc, 0xf1, 0xb8, 0xbb, 0x7f, 0xcb, 0xcb, 0x77, 0x0f, 0x39, 0xcc, 0xe8, 0xfb, 
+    0xe9, 0xeb, 0xf1, 0x91, 0x37, 0xfc, 0xf8, 0xbd, 0xbc, 0x3a, 0x3a, 0x39, 0x7f, 0x79, 0xb7, 0x5a, 
+    0x2e, 0xef, 0xef, 0x7d, 0xe8, 0xbf, 0xd1, 0x71, 0xec, 0x35, 0xde, 0xec, 0xad, 0x73, 0xfc, 0x6f, 
+    0xf6, 0x39, 0x8e, 0xd5, 0xc6, 0xaf, 0xdf, 0x6e, 0x36, 0xce, 0xdb, 0x2f, 0x0e, 0xbf, 0x0d, 0xee, 
+    0xdc, 0x5f, 0xcb, 0x1f, 0xbe, 0x95, 0xcb, 0xeb, 0x5e, 0xef, 0xd3, 0xb0, 0x73, 0xf1, 0xed, 0xee, 
+    0xd0, 0xae, 0x8e, 0x7b, 0x83, 0xf7, 0x97, 0x9f, 0xca, 0xde, 0xe0, 0x5b, 0xe7, 0xb7, 0xfd, 0xf1, 
+    0xe1, 0x6f, 0xe5, 0xb7, 0xe3, 0xd5, 0xfd, 0x93, 0xd3, 0xd5, 0xba, 0xb5, 0xe1, 0xfe, 0xfa, 0x76, 
+    0xf5, 0xf0, 0x64, 0x63, 0xf5, 0xd7, 0xd0, 0xf6, 0x3f, 0xf6, 0xfc, 0xce, 0xfb, 0xef, 0xbf, 0x7e, 
+    0x38, 0x7f, 0x71, 0xf1, 0xf4, 0xd5, 0x7a, 0xb5, 0x33, 0xfe, 0xad, 0xf9, 0xe2, 0xe4, 0xee, 0x28, 
+    0x3c, 0xfc, 0xbe, 0xf7, 0xc2, 0x0d, 0x0e, 0x2e, 0xbc, 0x8b, 0xeb, 0x9b, 0xbb, 0xee, 0xdd, 0xd0, 
+    0x3a, 0x2c, 0x3b, 0x4f, 0xbd, 0xf1, 0xc7, 0x37, 0x27, 0x37, 0xbf, 0x9e, 0xdc, 0x9d, 0xb8, 0x97, 
+    0xad, 0xd7, 0xaf, 0xed, 0x8b, 0x4d, 0xef, 0xd3, 0xfa, 0xaf, 0xa7, 0xad, 0xd1, 0xed, 0xfb, 0xf5, 
+    0xa7, 0xef, 0x86, 0xbf, 0x36, 0xec, 0xe7, 0x7b, 0x5e, 0xad, 0xdf, 0xdd, 0xec, 0xdf, 0x9d, 0xd9, 
+    0xa7, 0x87, 0x77, 0x1b, 0x1b, 0xe5, 0x8b, 0x93, 0x93, 0xb3, 0xef, 0xb5, 0xd5, 0x8d, 0xf0, 0xed, 
+    0xc7, 0xf0, 0xb5, 0x33, 0xb2, 0x4f, 0x0e, 0x6e, 0x9c, 0xf2, 0x4d, 0xf3, 0xe6, 0xc5, 0xda, 0x87, 
+    0x4f, 0x2f, 0x36, 0x7f, 0x3b, 0x38, 0xee, 0x9f, 0xdb, 0xdd, 0x4f, 0xf6, 0xbb, 0x4f, 0xd5, 0x93, 
+    0x4a, 0xb9, 0x7c, 0xf3, 0xaa, 0xfa, 0x7e, 0xd8, 0x7a, 0xf7, 0xe1, 0x6a, 0xf5, 0xf2, 0x70, 0xe0, 
+    0xd4, 0x8f, 0xee, 0xde, 0xbd, 0xee, 0xf8, 0x9d, 0x37, 0x57, 0xe5, 0xf5, 0xd5, 0x5a, 0x70, 0xf7, 
+    0xa6, 0x71, 0x7c, 0x16, 0xd4, 0xad, 0xfd, 0x86, 0xdd, 0x5b, 0x3d, 0xaa, 0x9d, 0xf7, 0x37, 0x5e, 
+    0x6e, 0x1c, 0x5f, 0x1f, 0x9c, 0x7e, 0xeb, 0x04, 0x97, 0x61, 0xa3, 0xb7, 0xbf, 0xf1, 0xa2, 0xfd, 
+    0xed, 0x66, 0xf4, 0xe2, 0x69, 0xff, 0xed, 0xa8, 0xf3, 0x74, 0x54, 0x79, 0x51, 0xb9, 0xa8, 0x94, 
+    0xbd, 0xd7, 0xbd, 0xd5, 0xbb, 0xb3, 0xcd, 0xf6, 0xa7, 0xd7, 0xdf, 0x5c, 0xcb, 0x59, 0x3f, 0x7a, 
+    0xb7, 0xe9, 0xfc, 0x5a, 0x7e, 0xfb, 0x72, 0x73, 0xef, 0xba, 0x52, 0x7b, 0xdd, 0xda, 0x1c, 0xaf, 
+    0xad, 0x5d, 0xdb, 0x77, 0x57, 0x2f, 0xf6, 0x7e, 0xad, 0x5f, 0xae, 0xf5, 0x2b, 0xeb, 0x2f, 0xaf, 
+    0xc7, 0xdd, 0xbb, 0xd5, 0x17, 0x2f, 0xec, 0x6f, 0x07, 0x57, 0x17, 0x97, 0xab, 0xef, 0x9f, 0xbf, 
+    0xfa, 0xb5, 0xfd, 0xfd, 0xf8, 0xcd, 0xdd, 0xc7, 0xe1, 0xdd, 0xdd, 0x6d, 0x38, 0x3c, 0xad, 0x7f, 
+    0xb8, 0x08, 0xfa, 0xed, 0xf1, 0xd3, 0xe3, 0x37, 0xbd, 0xc6, 0xcb, 0x51, 0x6b, 0xfd, 0x7a, 0xfd, 
+    0xf8, 0x45, 0xf5, 0xd5, 0x7a, 0x7f, 0xdd, 0xfd, 0x7e, 0xf5, 0xc6, 0xbe, 0xa9, 0x5f, 0xdc, 0x9d, 
+    0x1e, 0xbe, 0x1b, 0x8f, 0xc3, 0x13, 0xcf, 0x3a, 0xb8, 0x78, 0x3b, 0x3e, 0xba, 0xe8, 0xbf, 0x39, 
+    0xea, 0xaf, 0xd7, 0x9e, 0xb7, 0x87, 0xb5, 0x41, 0xaf, 0xd1, 0xb9, 0xa9, 0xf7, 0x36, 0x3f, 0xb8, 
+    0x77, 0xd7, 0xeb, 0xa3, 0x8b, 0xc3, 0x8f, 0x37, 0x17, 0x8d, 0x0f, 0xeb, 0xb5, 0xea, 0xc5, 0xb7, 
+    0x8d, 0xea, 0xc7, 0x5f, 0xcb, 0x83, 0xce, 0x75, 0xb5, 0xf9, 0x7d, 0xf0, 0xa1, 0x0f, 0xb2, 0x33, 
+    0x7e, 0x71, 0x5a, 0x7b, 0xe1, 0x96, 0x3b, 0xeb, 0xd5, 0xde, 0x78, 0x74, 0xb4, 0xf1, 0xc2, 0x0e, 
+    0x6a, 0xce, 0x87, 0xca, 0xd1, 0xe1, 0xde, 0xd3, 0x97, 0xe7, 0xc3, 0xcd, 0xf5, 0x7e, 0xa5, 0xb3, 
+    0xf1, 0xad, 0x52, 0xdf, 0xbb, 0x39, 0x7b, 0xde, 0x7e, 0x33, 0xb2, 0xdf, 0x7f, 0x6a, 0x39, 0x87, 
+    0x9f, 0x7e, 0x7b, 0xf7, 0xf2, 0xf5, 0xda, 0xdb, 0xf3, 0xa7, 0xf5, 0xf7, 0xdf, 0x8f, 0xdd, 0xfe, 
+    0xb9, 0xfb, 0xad, 0x7f, 0xf0, 0xb2, 0x7e, 0xd1, 0xf8, 0xf4, 0x7e, 0x1c, 0x74, 0xf7, 0xab, 0xe3, 
+    0xd0, 0x3d, 0x0e, 0xdf, 0x35, 0x6e, 0x8f, 0x1a, 0x47, 0x17, 0x2f, 0xde, 0x55, 0xac, 0x4a, 0xd7, 
+    0xbd, 0x1b, 0xdf, 0x0c, 0xab, 0xb5, 0x9b, 0xc6, 0xf5, 0xfa, 0xb7, 0xde, 0xab, 0xaa, 0xfb, 0xaa, 
+    0xfe, 0x9a, 0xcb, 0xe8, 0xfe, 0xf1, 0xa0, 0xb6, 0xff, 0xbc, 0xf1, 0xca, 0xbb, 0x38, 0xeb, 0x7e, 
+    0xba, 0x1b, 0x5f, 0x1d, 0xd8, 0x17, 0xee, 0x6a, 0xe7, 0xb0, 0x5a, 0x1b, 0x9d, 0x9f, 0xdf, 0x3d, 
+    0xdf, 0x1c, 0x1c, 0xdd, 0x9c, 0xdf, 0x7c, 0xbf, 0xba, 0x7d, 0x7d, 0x08, 0x2c, 0x3e, 0x7a, 0x73, 
+    0xf7, 0x66, 0xe3, 0xb7, 0xa7, 0x1f, 0xef, 0x9e, 0x76, 0xce, 0xfc, 0x6f, 0x1b, 0xf6, 0xcd, 0x51, 
+    0xe3, 0xfc, 0xfa, 0xf2, 0xd7, 0x9e, 0xe3, 0x36, 0xac, 0xb5, 0x97, 0xe7, 0xfe, 0x65, 0xeb, 0xe9, 
+    0xa7, 0xee, 0xc7, 0x8f, 0xe5, 0x0b, 0xfb, 0xec, 0xe3, 0xf8, 0x34, 0x78, 0xb3, 0xf9, 0x7c, 0xed, 
+    0xee, 0xe3, 0x5a, 0x70, 0xfc, 0xe1, 0xe3, 0x71, 0x7f, 0xfd, 0x8d, 0x77, 0x32, 0x6c, 0x9f, 0x7e, 
+    0x1b, 0xbc, 0x5f, 0x75, 0xf7, 0xce, 0x3f, 0x1c, 0xde, 0x56, 0xdf, 0xfb, 0xce, 0xfb, 0x93, 0xdb, 
+    0xdb, 0x4d, 0x1f, 0xfa, 0xf5, 0xf4, 0xf2, 0xbc, 0xf9, 0xe2, 0xdd, 0xe0, 0x6c, 0x7c, 0x75, 0x57, 
+    0xbf, 0x1c, 0xbd, 0x59, 0xfd, 0xde, 0x7c, 0xf5, 0xf6, 0x3a, 0x70, 0xda, 0x2f, 0xdf, 0x9f, 0x56, 
+    0x2a, 0xef, 0x7f, 0x3d, 0xb1, 0xee, 0xde, 0x6c, 0x6e, 0x7c, 0x7f, 0xfb, 0xd6, 0x2d, 0xf7, 0xba, 
+    0xb5, 0xf7, 0x8d, 0xaa, 0x75, 0xfc, 0xe9, 0xfb, 0xb9, 0xfb, 0xa2, 0xbd, 0xf1, 0xf2, 0xea, 0x7d, 
+    0xa3, 0xf6, 0xad, 0xf6, 0xb1, 0xfd, 0xbc, 0x79, 0xfd, 0xdb, 0xe5, 0xa7, 0xb5, 0x8d, 0xb3, 0x76, 
+    0x78, 0x7c, 0x31, 0xb8, 0xaa, 0x9c, 0x5d, 0x3e, 0x7f, 0xb5, 0xfa, 0x66, 0xed, 0xec, 0x43, 0xeb, 
+    0xac, 0x59, 0x1b, 0xde, 0x85, 0xfb, 0xe5, 0x8f, 0x7e, 0xd5, 0xdf, 0xa8, 0xf6, 0x86, 0xdf, 0xcf, 
+    0x5f, 0x5d, 0x5e, 0x55, 0xc7, 0xd7, 0x1b, 0xe7, 0x1f, 0x3e, 0x5a, 0xdf, 0x36, 0x5b, 0x76, 0xb3, 
+    0xfc, 0xeb, 0x5a, 0xf0, 0x3d, 0xbc, 0x0e, 0xae, 0x46, 0xd7, 0x9d, 0x0f, 0x1f, 0xc3, 0x97, 0xb5, 
+    0xf0, 0xc4, 0xfa, 0x16, 0x5e, 0x5e, 0x6f, 0x9e, 0xdb, 0x4f, 0x47, 0x6f, 0x4f, 0x4f, 0xec, 0x0f, 
+    0x6b, 0x83, 0x8d, 0xdb, 0xb1, 0xd7, 0xf8, 0x7e, 0xf7, 0xe1, 0xf9, 0xf8, 0x74, 0xf5, 0x53, 0xf9, 
+    0xe5, 0xe1, 0x49, 0xe3, 0xc8, 0xbd, 0xbc, 0x38, 0x1f, 0x1c, 0x1d, 0x1f, 0x5d, 0x34, 0x3c, 0xbb, 
+    0xf5, 0xf4, 0xfb, 0xe5, 0xb7, 0x93, 0x46, 0xf3, 0xed, 0xf7, 0x37, 0xef, 0xc6, 0xe5, 0x8f, 0x2f, 
+    0x0f, 0x2f, 0xae, 0xbf, 0x0d, 0x7a, 0xdf, 0x9f, 0xbe, 0x7e, 0x6d, 0xad, 0x9d, 0xbe, 0xdd, 0x38, 
+    0xfd, 0x76, 0xe7, 0xb9, 0xdf, 0x86, 0xfd, 0x0f, 0x97, 0xd7, 0x57, 0x77, 0x37, 0x9e, 0x75, 0xfa, 
+    0x69, 0xa3, 0xb1, 0xfe, 0xc9, 0x79, 0xbe, 0xe9, 0x6f, 0x0e, 0x07, 0x9b, 0xed, 0xc6, 0xd5, 0x53, 
+    0xff, 0x76, 0x90, 0xa6, 0x67, 0x94, 0x1e, 0x00, 0x3d, 0x73, 0xbc, 0x37, 0x3a, 0x3b, 0xfd, 0xf8, 
+    0x7a, 0x86, 0xfe, 0xd9, 0x6b, 0xf4, 0xf6, 0x0e, 0xa7, 0xeb, 0x12, 0xad, 0x9e, 0xae, 0xf5, 0x7d, 
+    0x73, 0x2f, 0x70, 0x8e, 0xd6, 0x36, 0x5b, 0x87, 0x27, 0xcf, 0x83, 0x57, 0xa8, 0x70, 0xf7, 0x8e, 
+    0xdc, 0xe3, 0xab, 0x6b, 0xe8, 0x86, 0xfe, 0xc1, 0x81, 0x54, 0xfe, 0x7b, 0x83, 0xb6, 0xef, 0x39, 
+    0xed, 0xf2, 0xc5, 0x87, 0x3d, 0x06, 0x13, 0x6d, 0xe8, 0x0c, 0xba, 0x01, 0xd7, 0xf2, 0x9a, 0x91, 
+    0x0b, 0xe6, 0x69, 0xdf, 0xe6, 0xb3, 0xae, 0x66, 0xe7, 0xfe, 0x89, 0xdb, 0x72, 0x31, 0x83, 0xb8, 
+    0xef, 0x35, 0x1d, 0x98, 0x13, 0x6e, 0xed, 0x66, 0x11, 0x66, 0x87, 0x22, 0xcc, 0x3e, 0x56, 0xd3, 
+    0xb5, 0xb5, 0x62, 0x63, 0x3b, 0x88, 0x15, 0xe1, 0xb3, 0xc8, 0x63, 0x15, 0x0c, 0x42, 0x2b, 0x1c, 
+    0x05, 0xc5, 0xa6, 0xe5, 0xc3, 0xd7, 0xb1, 0x81, 0xa1, 0xe9, 0x5a, 0xad, 0xeb, 0x62, 0xe8, 0x5b, 
+    0x83, 0xc0, 0x1d, 0xb5, 0xe0, 0xd1, 0x3c, 0xf8, 0xc8, 0x18, 0xd7, 0x90, 0x44, 0xe6, 0x3a, 0x96, 
+    0xa6, 0x2a, 0x76, 0x57, 0xfe, 0x7c, 0xdf, 0xf4, 0xee, 0x8a, 0x81, 0xf3, 0x1d, 0xf8, 0xb7, 0xd5, 
+    0xf4, 0xfc, 0xb6, 0xed, 0x17, 0xe1, 0xc9, 0x76, 0xdf, 0xf2, 0xbb, 0xce, 0x60, 0xab, 0xb2, 0x3d, 
+    0xb4, 0xda, 0x6d, 0x7c, 0x57, 0x79, 0x58, 0x69, 0x7a, 0xed, 0xf1, 0x7d, 0x07, 0xd0, 0x15, 0x3b, 
+    0x56, 0xdf, 0x71, 0xc7, 0x5b, 0x45, 0x5e, 0x6f, 0x30, 0x0e, 0x42, 0xbb, 0x5f, 0xe0, 0x1f, 0xc5, 
+    0x91, 0x53, 0x08, 0x80, 0xce, 0x62, 0x60, 0xfb, 0x4e, 0x07, 0x66, 0xd0, 0xd6, 0x75, 0x97, 0x26, 
+    0xf1, 0x2d, 0xc1, 0xf6, 0x6d, 0xea, 0x8e, 0xad, 0x3f, 0xd9, 0xb6, 0xbd, 0x0d, 0x8b, 0x86, 0x62, 
+    0xcf, 0x76, 0xba, 0xbd, 0x70, 0x0b, 0xec, 0xa4, 0x9b, 0xde, 0xc3, 0x4a, 0x09, 0xc9, 0xb5, 0x60, 
+    0xf6, 0xf7, 0xef, 0xfb, 0xd6, 0x1d, 0x37, 0x12, 0xb6, 0x36, 0x2b, 0x95, 0x61, 0x44, 0x12, 0xb3, 
+    0x46, 0xa1, 0xa7, 0xe8, 0xaa, 0x36, 0x86, 0x77, 0x0f, 0x2b, 0xbd, 0xea, 0xbd, 0x40, 0x5b, 0xa9, 
+    0xb4, 0xd7, 0x3a, 0x9d, 0xed, 0xd0, 0xbe, 0x0b, 0x8b, 0x96, 0xeb, 0x74, 0x07, 0x5b, 0xc8, 0x2f, 
+    0xdb, 0x37, 0x0a, 0xb0, 0xca, 0x36, 0xb5, 0x03, 0xda, 0x6d, 0x6f, 0x55, 0x4b, 0x0d, 0xbb, 0x0f, 
+    0x35, 0x77, 0x7d, 0xa7, 0x7d, 0xdf, 0x76, 0x82, 0xa1, 0x6b, 0x8d, 0xb7, 0xf0, 0xc7, 0x36, 0xfe, 
+    0x29, 0x42, 0x9b, 0xe0, 0x49, 0x48, 0x62, 0x34, 0xea, 0x0f, 0x82, 0xad, 0x6a, 0xc7, 0xdf, 0xee, 
+    0x5a, 0x43, 0x51, 0xf3, 0xdf, 0xf6, 0x6d, 0x30, 0xdd, 0x72, 0xd8, 0x12, 0x4e, 0xec, 0x3a, 0x12, 
+    0x9b, 0xbf, 0xe7, 0xe8, 0xd2, 0x31, 0xd4, 0xd6, 0x01, 0x84, 0x01, 0x9e, 0x07, 0x6c, 0xb0, 0xe5, 
+    0xb7, 0xef, 0x35, 0x36, 0xf9, 0xdd, 0xa6, 0x95, 0xab, 0x35, 0x1a, 0x05, 0xf9, 0xaf, 0x52, 0xaa, 
+    0x34, 0xf2, 0xdb, 0xa2, 0x6f, 0xd0, 0x42, 0x1c, 0x01, 0x0d, 0xc8, 0x10, 0xbd, 0x45, 0xe2, 0xfd, 
+    0x56, 0x15, 0x10, 0x07, 0x9e, 0xeb, 0xb4, 0x59, 0x0a, 0x9e, 0x6a, 0x5e, 0xd4, 0xc7, 0x7a, 0xf5, 
+    0x18, 0xbf, 0x38, 0x73, 0xa1, 0xeb, 0xc3, 0xd0, 0xeb, 0x6f, 0x55, 0x41, 0x41, 0xe9, 0x1c, 0x22, 
+    0xfe, 0x0c, 0x7d, 0x1b, 0x17, 0x51, 0xc5, 0x5b, 0xdf, 0x1a, 0x2a, 0x3e, 0x75, 0x5c, 0x1b, 0x20, 
+    0xe1, 0x4f, 0xb1, 0xed, 0xf8, 0x76, 0x2b, 0x74, 0x3c, 0x60, 0x38, 0x35, 0x73, 0x9b, 0xb8, 0x5f, 
+    0x74, 0xa0, 0xf5, 0x81, 0xe8, 0x83, 0x87, 0x95, 0x3f, 0x09, 0x24, 0xf7, 0x82, 0xdc, 0x9a, 0x22, 
+    0xf7, 0x4f, 0xf5, 0x7a, 0x3d, 0xd6, 0xc8, 0x4d, 0x6c, 0x96, 0x26, 0x3f, 0xb0, 0x96, 0xdb, 0x26, 
+    0xdb, 0xac, 0xe8, 0xdb, 0x03, 0x80, 0xc3, 0xb6, 0x0f, 0x9d, 0x3b, 0x1b, 0x79, 0xdb, 0xd6, 0x08, 
+    0x74, 0x06, 0x1d, 0xef, 0x5e, 0x34, 0x08, 0xac, 0x6e, 0xc2, 0x13, 0x35, 0xa6, 0x52, 0xda, 0xb4, 
+    0xfb, 0x52, 0x08, 0x37, 0x37, 0x37, 0xa1, 0x60, 0x33, 0x1c, 0x14, 0x7d, 0xef, 0xd6, 0x6c, 0x14, 
+    0x76, 0xf1, 0xa6, 0x12, 0x3b, 0x42, 0x44, 0x5c, 0xa7, 0xc6, 0x22, 0x0f, 0xb6, 0xf0, 0x0f, 0x2f, 
+    0x7d, 0x2f, 0xbb, 0x62, 0x13, 0xfb, 0x75, 0x3d, 0xea, 0x0e, 0x34, 0x6a, 0x63, 0xad, 0xc2, 0xb7, 
+    0xad, 0x91, 0x1f, 0x40, 0xf5, 0x43, 0xcf, 0x21, 0xd1, 0x34, 0x88, 0x03, 0x61, 0xdc, 0xa6, 0x91, 
+    0xee, 0x10, 0x33, 0x2d, 0xd7, 0x65, 0x95, 0x52, 0x2d, 0x10, 0x64, 0x0e, 0x7d, 0xe0, 0x80, 0x3f, 
+    0xbe, 0x37, 0xf9, 0x42, 0x5d, 0x28, 0x9a, 0xc4, 0x47, 0x99, 0x09, 0xbe, 0xd5, 0xf3, 0x6e, 0x60, 
+    0x44, 0x99, 0x85, 0xac, 0xcd, 0x56, 0x4b, 0x80, 0x05, 0x36, 0x0c, 0xbb, 0x76, 0x0c, 0x6f, 0xaa, 
+    0x00, 0x69, 0xa3, 0x37, 0x5e, 0x36, 0x59, 0x49, 0x0a, 0x86, 0x5a, 0x5e, 0x14, 0x03, 0x86, 0x25, 
+    0x40, 0x2b, 0x85, 0x5a, 0xb5, 0x26, 0xab, 0x6a, 0xa8, 0xba, 0x44, 0xfb, 0x34, 0x09, 0x6f, 0x5b, 
+    0x41, 0xcf, 0x06, 0x99, 0xe1, 0x6f, 0x22, 0x8c, 0x13, 0x48, 0xd0, 0xf1, 0xd6, 0x1a, 0x1a, 0x05, 
+    0x25, 0xe8, 0x71, 0x54, 0xd6, 0xed, 0x7b, 0x6f, 0x68, 0xb5, 0x9c, 0x70, 0x0c, 0x1d, 0xb0, 0x26, 
+    0x7b, 0x07, 0xd6, 0x0e, 0xa0, 0x41, 0x5c, 0xef, 0xd6, 0x6e, 0x6f, 0x8b, 0x9e, 0x2a, 0xda, 0x37, 
+    0x20, 0xc8, 0x81, 0xd1, 0xad, 0xa4, 0x48, 0xb7, 0x48, 0x88, 0x01, 0x71, 0xc7, 0xf3, 0xfb, 0x45, 
+    0xac, 0x7b, 0x78, 0x9f, 0x1c, 0x52, 0xc6, 0x7b, 0xe6, 0x5a, 0x4d, 0xdb, 0x55, 0x32, 0xd7, 0x74, 
+    0xbd, 0xd6, 0x75, 0x6c, 0x18, 0xae, 0xc5, 0x05, 0xb7, 0x11, 0x49, 0xae, 0x65, 0x59, 0x26, 0x3a, 
+    0x67, 0x30, 0x1c, 0x85, 0x05, 0xfd, 0x49, 0x60, 0xbb, 0x30, 0x22, 0x8d, 0x47, 0xa8, 0x16, 0x2d, 
+    0xdf, 0xb6, 0xee, 0xb9, 0xae, 0xc2, 0xc5, 0xe9, 0xb6, 0x26, 0xbb, 0x49, 0x2d, 0x92, 0x32, 0x2c, 
+    0xd7, 0x63, 0xc3, 0xb2, 0x66, 0xd5, 0xac, 0x35, 0x43, 0xad, 0xeb, 0x34, 0x3f, 0x25, 0xdd, 0x11, 
+    0xa7, 0x73, 0xab, 0xe3, 0xb5, 0x46, 0x41, 0x0a, 0xb5, 0x29, 0x2f, 0x24, 0xcd, 0xfc, 0xd5, 0xbd, 
+    0x37, 0x0a, 0x71, 0x75, 0x68, 0xf4, 0x81, 0x21, 0x28, 0xb2, 0x3a, 0x7d, 0x44, 0x4f, 0x57, 0xe7, 
+    0x4c, 0xa9, 0xf4, 0x0a, 0x75, 0xd2, 0x2d, 0x9f, 0x29, 0x8b, 0x03, 0xc0, 0x30, 0x65, 0x22, 0x31, 
+    0x81, 0x11, 0xf1, 0x7d, 0xd4, 0xf2, 0x1a, 0xce, 0x2a, 0x9c, 0x13, 0xb7, 0x7c, 0x86, 0x6b, 0x7a, 
+    0x6e, 0x5b, 0x83, 0xc7, 0x51, 0x73, 0xaf, 0xcf, 0x42, 0xd5, 0x78, 0xe7, 0x4a, 0x48, 0x5c, 0xa0, 
+    0xea, 0x98, 0x25, 0x47, 0x61, 0x85, 0x1c, 0x84, 0xa6, 0xd2, 0xfa, 0x06, 0x8b, 0x5f, 0xa7, 0x33, 
+    0x2e, 0x8a, 0x49, 0x7f, 0x2b, 0x00, 0xb1, 0xb6, 0x8b, 0x4d, 0x3b, 0xbc, 0x85, 0x05, 0x72, 0x42, 
+    0x95, 0xe1, 0x60, 0xe9, 0x80, 0x80, 0x17, 0xef, 0xb6, 0x70, 0x4e, 0xd5, 0xb0, 0x16, 0xdb, 0xd6, 
+    0x78, 0x4a, 0xd3, 0x71, 0xc2, 0x89, 0x66, 0xbc, 0xb5, 0x86, 0x14, 0x6d, 0x55, 0x96, 0x95, 0x10, 
+    0x81, 0x2e, 0x07, 0x1b, 0x71, 0xa5, 0x6b, 0x82, 0xc7, 0xda, 0x58, 0x2d, 0x99, 0xad, 0xe4, 0x40, 
+    0x31, 0x16, 0x93, 0x26, 0x07, 0x20, 0x6e, 0x38, 0xdd, 0x27, 0xe5, 0x58, 0x97, 0xd8, 0x84, 0x1a, 
+    0x8f, 0x8d, 0x2b, 0x85, 0xa7, 0x14, 0x8c, 0x5a, 0x2d, 0x3b, 0x08, 0xd2, 0xb4, 0x48, 0xa5, 0x52, 
+    0x80, 0x21, 0x43, 0x6a, 0x4c, 0x29, 0xa7, 0xd6, 0x7a, 0x54, 0xd4, 0xf6, 0x7d, 0x2f, 0x45, 0x03, 
+    0x42, 0x91, 0x06, 0xfd, 0x5f, 0x2f, 0xd8, 0x59, 0xc7, 0x82, 0xa1, 0xd5, 0x0c, 0xcc, 0x2e, 0x54, 
+    0x46, 0x18, 0x57, 0x1b, 0xe6, 0x48, 0x8c, 0xe9, 0x14, 0xce, 0x78, 0xc0, 0x71, 0xaf, 0x0b, 0x25, 
+    0x23, 0x83, 0x20, 0x36, 0xc7, 0x98, 0x68, 0xa3, 0x79, 0x97, 0xa6, 0x9a, 0x21, 0x8c, 0xaf, 0x41, 
+    0xa8, 0xf5, 0x4f, 0xca, 0x10, 0x86, 0x5a, 0x4a, 0x16, 0x4c, 0xf0, 0x37, 0xf6, 0x7d, 0x9a, 0x5e, 
+    0x4e, 0x8c, 0x41, 0x80, 0x97, 0x62, 0xa8, 0x1a, 0x88, 0x63, 0xd6, 0x7c, 0x25, 0x51, 0x1a, 0x6a, 
+    0x10, 0x40, 0xd0, 0x55, 0x13, 0xe8, 0x93, 0x38, 0xb5, 0x29, 0x21, 0x91, 0x12, 0x92, 0x59, 0xa9, 
+    0xf6, 0x0c, 0x18, 0x8b, 0x13, 0x3a, 0x7b, 0xa5, 0xfc, 0x67, 0x76, 0x60, 0x41, 0x27, 0x81, 0xda, 
+    0x61, 0xa4, 0xc2, 0x03, 0xf6, 0xe7, 0x32, 0x59, 0x47, 0xf4, 0xac, 0xe8, 0x3a, 0x30, 0xb6, 0x4c, 
+    0xfb, 0x94, 0x98, 0xad, 0x00, 0xd0, 0xb0, 0x99, 0x65, 0xb7, 0xd5, 0xf3, 0x73, 0x69, 0xd4, 0x4d, 
+    0xdd, 0x98, 0xa3, 0x0e, 0xac, 0x45, 0x12, 0x2b, 0x7a, 0x0c, 0x61, 0x0c, 0x39, 0x49, 0x9a, 0x57, 
+    0x4a, 0x85, 0xc9, 0xbe, 0xef, 0xfa, 0x56, 0x33, 0x4e, 0xf2, 0x96, 0xec, 0xc3, 0x08, 0xa4, 0x09, 
+    0xf5, 0xc6, 0xc1, 0x4a, 0x6d, 0xdf, 0xea, 0x42, 0xf5, 0x5d, 0x6d, 0x66, 0x6c, 0x4c, 0xea, 0x6a, 
+    0xb3, 0x24, 0x68, 0xcd, 0x62, 0xd0, 0xf3, 0x6e, 0xb1, 0xb0, 0x59, 0xa0, 0xd3, 0x59, 0x6f, 0xd6, 
+    0x1b, 0xf1, 0x02, 0x8c, 0xea, 0x2a, 0xf6, 0xac, 0x41, 0xdb, 0x55, 0xb2, 0xb5, 0xbe, 0xbe, 0xbe, 
+    0x9d, 0x54, 0x07, 0xb1, 0x72, 0xf8, 0xb7, 0x98, 0xd0, 0x1c, 0xf5, 0xc9, 0xa0, 0x68, 0x18, 0x22, 
+    0xf3, 0xb6, 0xaa, 0x13, 0x20, 0x68, 0xcd, 0x74, 0x1f, 0xd7, 0xda, 0x29, 0xa3, 0x21, 0xad, 0x70, 
+    0xdb, 0x0e, 0x5a, 0xa6, 0xce, 0x6b, 0x18, 0x4a, 0x4f, 0xd7, 0x41, 0xb5, 0xa4, 0x30, 0x09, 0x2c, 
+    0xb0, 0x9c, 0x08, 0x75, 0xb9, 0xd2, 0xe6, 0x39, 0xfe, 0x3d, 0x9d, 0x43, 0x58, 0x93, 0x39, 0xe2, 
+    0xa5, 0x44, 0x81, 0x15, 0xc1, 0x36, 0xa7, 0x56, 0x27, 0xcc, 0xa6, 0xa9, 0xdd, 0x2a, 0xc0, 0x7d, 
+    0xbb, 0x0f, 0xb0, 0x4b, 0xd0, 0x87, 0x3d, 0xb8, 0x1c, 0x85, 0xbc, 0x4a, 0x93, 0x46, 0xae, 0x3c, 
+    0x15, 0x74, 0x0b, 0x28, 0x01, 0x84, 0x41, 0xd2, 0x82, 0x27, 0xb5, 0x31, 0x55, 0xf7, 0xc7, 0xe7, 
+    0x25, 0xa0, 0xa9, 0xd8, 0x1c, 0xc1, 0x98, 0x1b, 0x04, 0xb3, 0x17, 0x04, 0xb5, 0x94, 0x05, 0x01, 
+    0xaa, 0x96, 0x33, 0xaf, 0x6d, 0x19, 0x7a, 0xa5, 0x8f, 0x0f, 0x0c, 0x3d, 0x08, 0x36, 0xa5, 0x30, 
+    0xf1, 0x3b, 0xb0, 0x86, 0x69, 0x6f, 0x23, 0xbe, 0xca, 0xb6, 0x6b, 0x77, 0x42, 0xf8, 0xd0, 0xcc, 
+    0xb3, 0x48, 0xff, 0xfc, 0xbc, 0x9d, 0x9c, 0x92, 0xe8, 0x7f, 0xa5, 0x8d, 0xfc, 0xf6, 0x77, 0x90, 
+    0xee, 0x36, 0x4a, 0x36, 0x2c, 0x92, 0x52, 0x54, 0x43, 0xdc, 0x30, 0x50, 0xea, 0x93, 0x08, 0x8b, 
+    0x6b, 0x61, 0x6c, 0x92, 0x7c, 0xa7, 0x94, 0x78, 0xca, 0x52, 0x7e, 0x1e, 0xe5, 0x46, 0x3c, 0x92, 
+    0x3d, 0x5d, 0x43, 0xf6, 0xf3, 0xc6, 0x3d, 0x85, 0xf6, 0x44, 0x4b, 0xfc, 0x35, 0xb1, 0xc4, 0xbf, 
+    0x93, 0xfa, 0xf6, 0x69, 0xe5, 0xa6, 0x17, 0x19, 0x28, 0x63, 0x69, 0xa0, 0x18, 0x24, 0xcd, 0x5c, 
+    0xc6, 0xf2, 0xf9, 0x91, 0x97, 0x99, 0xd8, 0xa7, 0xd5, 0x4a, 0xac, 0x53, 0x51, 0x64, 0xe2, 0xfc, 
+    0xa2, 0x4e, 0x86, 0x55, 0x27, 0xef, 0xde, 0x53, 0x50, 0x24, 0xac, 0xe9, 0xdd, 0x41, 0xe7, 0x82, 
+    0x85, 0xc2, 0xb8, 0xe7, 0x83, 0xc1, 0xb4, 0x46, 0x7d, 0x8d, 0x6a, 0x06, 0x9d, 0x28, 0x0b, 0xaf, 
+    0xea, 0x97, 0x9a, 0x07, 0xa6, 0x9b, 0x7c, 0x69, 0x8b, 0x70, 0x4e, 0x20, 0x5f, 0x7e, 0x4c, 0x98, 
+    0xf2, 0x85, 0x45, 0x44, 0x80, 0x37, 0x96, 0x3b, 0x8a, 0xcf, 0xf9, 0xba, 0x86, 0x6c, 0x54, 0x2a, 
+    0x00, 0x3a, 0x1a, 0xb6, 0xd1, 0xaa, 0x6e, 0x5a, 0xed, 0xae, 0xa1, 0x1e, 0x60, 0x79, 0xd0, 0x80, 
+    0x05, 0x82, 0xd2, 0x0a, 0x9d, 0xf5, 0xed, 0x84, 0x8a, 0x94, 0x6d, 0xae, 0x73, 0x3d, 0x10, 0xe3, 
+    0xca, 0x5a, 0xc4, 0x03, 0x1a, 0x1d, 0x9b, 0xd2, 0x10, 0x68, 0xc3, 0xca, 0xd3, 0xb7, 0x68, 0x08, 
+    0x09, 0xc3, 0x42, 0x27, 0x22, 0x65, 0xcd, 0x5b, 0xb7, 0x36, 0xac, 0xba, 0xc5, 0xbb, 0xf0, 0xca, 
+    0xeb, 0x76, 0x5d, 0x9b, 0x05, 0xb7, 0x4e, 0xd8, 0xea, 0x51, 0xb7, 0x85, 0xf4, 0x24, 0xe9, 0x08, 
+    0x58, 0x94, 0xc1, 0x66, 0x17, 0x56, 0xa6, 0x1a, 0x74, 0x0f, 0x7a, 0xb5, 0x5b, 0x2e, 0x5a, 0xba, 
+    0xad, 0x9e, 0xe3, 0xb6, 0xef, 0xcd, 0x42, 0xd2, 0x6e, 0x22, 0xd0, 0x7b, 0xa5, 0x38, 0x7c, 0x74, 
+    0x7d, 0xc0, 0xb8, 0x15, 0x23, 0x6a, 0x0d, 0x39, 0x25, 0x86, 0x4f, 0x6d, 0x8d, 0x9b, 0x86, 0xbc, 
+    0x95, 0xb4, 0xe6, 0x8a, 0x66, 0x72, 0x01, 0x5f, 0x91, 0xc0, 0x95, 0x88, 0x8c, 0x00, 0x28, 0x03, 
+    0xae, 0xa9, 0x2a, 0xc0, 0x3c, 0x85, 0x75, 0x52, 0x68, 0xc7, 0x55, 0xb7, 0xa1, 0xad, 0x7c, 0x8e, 
+    0x65, 0x5b, 0x50, 0x5b, 0x31, 0x96, 0x87, 0x49, 0x8d, 0x80, 0xb4, 0xe9, 0x2e, 0x8e, 0x4a, 0xa9, 
+    0x1e, 0xc4, 0x29, 0xd8, 0x6a, 0xda, 0x68, 0xfb, 0xa7, 0x11, 0x22, 0xba, 0x21, 0x93, 0x51, 0xaa, 
+    0x71, 0x53, 0x29, 0x15, 0xfa, 0x4a, 0x54, 0xd5, 0x49, 0x8e, 0x88, 0x9e, 0x7a, 0x6c, 0xc1, 0xda, 
+    0x89, 0x8c, 0x56, 0x41, 0x51, 0x03, 0x74, 0xd1, 0x24, 0x82, 0xc4, 0x82, 0xb5, 0xd5, 0xb3, 0x5b, 
+    0xd7, 0x76, 0x7b, 0x35, 0xc6, 0xa8, 0xa4, 0x1f, 0x66, 0xbe, 0x82, 0xb2, 0x7d, 0x54, 0x2b, 0x2e, 
+    0x57, 0xb7, 0xb8, 0x77, 0x17, 0xc4, 0xf7, 0x63, 0x0e, 0xb5, 0x64, 0x5e, 0xd8, 0xa8, 0x38, 0x6c, 
+    0xd8, 0xd0, 0x01, 0x14, 0xbe, 0x61, 0xa7, 0xe2, 0xf3, 0xa4, 0xac, 0x4e, 0x33, 0x0a, 0x75, 0x1f, 
+    0xd5, 0x4c, 0xa9, 0x54, 0xf8, 0x67, 0x0a, 0x25, 0x87, 0xe4, 0xda, 0x84, 0xdb, 0x56, 0x69, 0x9a, 
+    0x84, 0x43, 0x49, 0xef, 0x1f, 0xef, 0xac, 0x7a, 0xcd, 0x94, 0xd7, 0x94, 0x71, 0x9f, 0x9c, 0x60, 
+    0x1a, 0x8d, 0x86, 0x42, 0xc7, 0xc5, 0x5a, 0xba, 0x5d, 0xb5, 0x26, 0xa2, 0x41, 0xb1, 0x3e, 0xa7, 
+    0x3b, 0x63, 0x6d, 0x3e, 0x77, 0x86, 0x70, 0x79, 0xf7, 0xbd, 0x81, 0x47, 0x0a, 0x60, 0x72, 0x23, 
+    0x53, 0xbd, 0x3f, 0x7c, 0x26, 0xd2, 0x00, 0x74, 0x53, 0x33, 0xb2, 0x2c, 0xb7, 0xa7, 0x4d, 0x67, 
+    0xca, 0x8f, 0x69, 0x3a, 0x14, 0x60, 0x7a, 0x03, 0xa9, 0x22, 0xef, 0x09, 0x2c, 0x3e, 0xa7, 0x99, 
+    0x2c, 0x89, 0x69, 0x11, 0xd4, 0x58, 0x38, 0x90, 0xbd, 0xf6, 0xb8, 0x7e, 0x20, 0x9c, 0x51, 0x66, 
+    0xba, 0x39, 0x53, 0x96, 0x73, 0x92, 0x2a, 0x69, 0x92, 0xa4, 0x2d, 0x39, 0xe2, 0x8e, 0xc1, 0x69, 
+    0x6e, 0x44, 0xf4, 0xf6, 0xf1, 0x6d, 0xa0, 0x25, 0x58, 0xc4, 0x0b, 0xa6, 0xf0, 0x88, 0x54, 0xbb, 
+    0xc6, 0xa8, 0x85, 0xfc, 0xd8, 0x49, 0x09, 0x5b, 0x86, 0x51, 0x8a, 0xb6, 0xf9, 0x39, 0xa5, 0x97, 
+    0x62, 0xe2, 0x2b, 0x6e, 0x20, 0xdd, 0xa7, 0x48, 0x55, 0x02, 0x70, 0x91, 0xd5, 0x0d, 0x9f, 0x7c, 
+    0x5a, 0x30, 0x71, 0x7a, 0x7d, 0x4e, 0x50, 0x60, 0x78, 0x28, 0xb6, 0x67, 0x58, 0x46, 0xb5, 0x34, 
+    0xcb, 0x28, 0x66, 0xa2, 0xc5, 0x2b, 0x28, 0xf5, 0x9c, 0x76, 0xdb, 0x1e, 0xc4, 0x7c, 0x0d, 0xa8, 
+    0x43, 0x5f, 0x79, 0x2d, 0xb2, 0x12, 0x58, 0x60, 0x5b, 0x3e, 0x4c, 0xf6, 0x6d, 0xdf, 0x1b, 0xb6, 
+    0xbd, 0xdb, 0x01, 0x29, 0x52, 0xfe, 0x8c, 0x6f, 0x6a, 0x24, 0x26, 0xd6, 0x07, 0xf5, 0x5e, 0x96, 
+    0x49, 0x99, 0x90, 0xf8, 0xb2, 0x02, 0x66, 0x90, 0xf8, 0x6c, 0x98, 0xec, 0xf2, 0xa9, 0xc3, 0x0a, 
+    0xf1, 0xa4, 0xec, 0x17, 0x50, 0xbc, 0x9a, 0xd0, 0x67, 0x9a, 0x7d, 0x5c, 0x5b, 0x33, 0x3c, 0x78, 
+    0xdc, 0x40, 0xd6, 0x56, 0x01, 0xdb, 0x31, 0x9f, 0x4b, 0xac, 0x1d, 0x93, 0xfc, 0x2e, 0x31, 0x30, 
+    0xee, 0xe5, 0x48, 0xda, 0xa4, 0x53, 0x9d, 0x4b, 0x89, 0xc9, 0x24, 0x0d, 0xe9, 0xcc, 0x79, 0x25, 
+    0xb5, 0xd0, 0x6c, 0xff, 0x3e, 0x0d, 0xf8, 0xb4, 0xb2, 0xac, 0x84, 0xc6, 0x0f, 0x97, 0x77, 0xe5, 
+    0x8f, 0x48, 0xb3, 0x64, 0xa7, 0x14, 0x6e, 0xdb, 0xa1, 0xe5, 0x4c, 0x36, 0x9a, 0x61, 0x3c, 0x24, 
+    0x96, 0xf8, 0x02, 0x9b, 0xeb, 0x59, 0xc8, 0xc2, 0x88, 0x95, 0xb5, 0x34, 0x77, 0xd6, 0xf6, 0x74, 
+    0x73, 0x5c, 0x52, 0xe6, 0xdc, 0x70, 0xdb, 0x23, 0x92, 0x9b, 0x54, 0x37, 0x21, 0x55, 0xc2, 0xd4, 
+    0x16, 0xae, 0x5a, 0xb1, 0x26, 0x30, 0x15, 0x91, 0x90, 0x89, 0x63, 0x1b, 0x17, 0xf2, 0x89, 0x89, 
+    0xe8, 0x61, 0xe5, 0x59, 0x59, 0x6c, 0x21, 0x3f, 0x2b, 0x8b, 0xa0, 0x53, 0xdc, 0x1f, 0x86, 0x0f, 
+    0x40, 0xca, 0x5a, 0xd0, 0xbb, 0xc1, 0x4e, 0x46, 0x6d, 0xe6, 0x52, 0x68, 0x6a, 0x95, 0x1b, 0x30, 
+    0x3b, 0x99, 0x59, 0x26, 0x4b, 0xfa, 0x62, 0x95, 0x5b, 0x32, 0x40, 0x7f, 0x66, 0xf7, 0x19, 0x06, 
+    0x7d, 0xf2, 0x00, 0xb2, 0x4c, 0x7d, 0x3d, 0xc3, 0xf8, 0x98, 0xe0, 0xdf, 0x65, 0xa0, 0x67, 0x46, 
+    0x05, 0x7a, 0x02, 0x7c, 0x14, 0xd6, 0x96, 0xa9, 0xd7, 0x32, 0x18, 0xd6, 0x46, 0x9f, 0x3e, 0x7c, 
+    0x54, 0x32, 0x3c, 0x00, 0x4d, 0x85, 0x05, 0x94, 0x77, 0x9f, 0x75, 0xe5, 0x23, 0x1e, 0xa6, 0x97, 
+    0x91, 0x61, 0x6c, 0xf1, 0x07, 0x22, 0x88, 0x2d, 0x53, 0xcb, 0xc4, 0x03, 0xd7, 0x32, 0x24, 0x9e, 
+    0x50, 0xb3, 0x8c, 0x55, 0xa4, 0xfa, 0xc6, 0xf0, 0xb9, 0x99, 0xc1, 0x50, 0x45, 0xfe, 0x13, 0x3e, 
+    0xab, 0x0d, 0xac, 0x50, 0x41, 0xad, 0x3d, 0xe5, 0x50, 0xf0, 0x98, 0xc0, 0xd6, 0xd6, 0x38, 0x58, 
+    0xad, 0x62, 0x80, 0x35, 0xd6, 0x39, 0x18, 0x62, 0x21, 0xb0, 0xa7, 0x1c, 0x0c, 0x7e, 0xa7, 0x61, 
+    0xc3, 0x4f, 0x1d, 0x1b, 0x7c, 0x96, 0x53, 0x48, 0x43, 0xac, 0x3a, 0x6d, 0x50, 0x4c, 0x07, 0x43, 
+    0x9a, 0x74, 0x6c, 0x40, 0x53, 0x1a, 0xb6, 0x4d, 0x93, 0x34, 0x2a, 0x95, 0x24, 0x4d, 0x22, 0x93, 
+    0x0d, 0x95, 0xc8, 0x78, 0x43, 0xcb, 0xdd, 0xdd, 0x67, 0x18, 0xfe, 0xb8, 0xfb, 0x2c, 0x19, 0xae, 
+    0x99, 0x09, 0xba, 0x19, 0xea, 0xc9, 0xb5, 0xca, 0xcf, 0xbc, 0x2b, 0xf1, 0x0b, 0xc8, 0x84, 0x16, 
+    0x76, 0x99, 0xc1, 0x57, 0x5a, 0xc8, 0x25, 0x76, 0x1c, 0x86, 0x68, 0x22, 0x6e, 0x03, 0x0e, 0x15, 
+    0x77, 0x02, 0x92, 0xba, 0x18, 0xa9, 0x30, 0x2b, 0x87, 0x07, 0x9c, 0xa6, 0xc9, 0xd2, 0x54, 0x5d, 
+    0x93, 0xd2, 0x84, 0xe1, 0x98, 0x7f, 0x0a, 0xba, 0x79, 0xc4, 0xa3, 0xc1, 0xd7, 0x36, 0x38, 0x7c, 
+    0xed, 0x29, 0xc1, 0xd7, 0x32, 0x91, 0xa4, 0x61, 0x74, 0x64, 0x0c, 0xba, 0x3e, 0x1b, 0x5a, 0x04, 
+    0x5f, 0x66, 0x92, 0xc1, 0x97, 0x86, 0xd4, 0x12, 0x78, 0x52, 0x6a, 0x39, 0x3a, 0xd4, 0xb8, 0x93, 
+    0x24, 0x18, 0xd9, 0x00, 0xa3, 0x0d, 0xd8, 0x36, 0xb4, 0x06, 0xfc, 0xaf, 0x1c, 0xc6, 0x86, 0x6d, 
+    0x91, 0xa1, 0x90, 0x70, 0x80, 0x9d, 0x04, 0xd6, 0x41, 0x98, 0x28, 0x06, 0x45, 0x42, 0xca, 0x8f, 
+    0x5e, 0xd5, 0x54, 0x1d, 0xb8, 0x59, 0x97, 0xe1, 0x8f, 0x62, 0x3a, 0x05, 0xe3, 0x17, 0xf4, 0x58, 
+    0x04, 0x84, 0x6a, 0x59, 0x83, 0x1b, 0x2b, 0x20, 0xe9, 0x10, 0xaf, 0x32, 0x52, 0x3f, 0xc0, 0x44, 
+    0x19, 0x29, 0x08, 0xfc, 0x01, 0x95, 0x71, 0x70, 0x13, 0xaf, 0x1e, 0x3d, 0x90, 0xd9, 0x05, 0xc0, 
+    0x3b, 0xf8, 0xc7, 0x0e, 0xb9, 0xaa, 0x62, 0x17, 0xfc, 0x2d, 0x48, 0x40, 0x9c, 0x1e, 0x11, 0x3c, 
+    0x80, 0x54, 0x70, 0x17, 0x93, 0xf6, 0x82, 0x19, 0x1b, 0xe4, 0x19, 0xe6, 0x0d, 0x5a, 0x2e, 0x2c, 
+    0xe5, 0xa0, 0x11, 0x63, 0xe8, 0xe2, 0x4b, 0x0a, 0x5b, 0xcd, 0xe5, 0x33, 0xbb, 0xe7, 0xa0, 0x7f, 
+    0x19, 0xff, 0xf9, 0xac, 0xcc, 0xb1, 0x2c, 0x84, 0xce, 0xb7, 0x3b, 0xbe, 0x1d, 0xf4, 0x04, 0x91, 
+    0x88, 0xf1, 0x2d, 0x7f, 0xa2, 0x61, 0x13, 0x94, 0x97, 0x53, 0x19, 0x9a, 0x91, 0x9d, 0x15, 0x33, 
+    0xb2, 0x44, 0x0f, 0xa4, 0x2a, 0xee, 0x85, 0xfd, 0x22, 0xc9, 0x0d, 0x71, 0x9a, 0x16, 0xea, 0x66, 
+    0xdd, 0x5b, 0xd0, 0x43, 0x07, 0x23, 0x1f, 0x37, 0xa4, 0x98, 0x10, 0x17, 0x90, 0x8e, 0xfa, 0x3c, 
+    0xfc, 0x10, 0x78, 0xf4, 0x55, 0x60, 0x9a, 0xbf, 0x37, 0xde, 0x0f, 0xa2, 0x16, 0x69, 0x26, 0xaa, 
+    0x0e, 0xf9, 0xc7, 0xbf, 0xff, 0x4f, 0x49, 0xfe, 0x21, 0x37, 0x50, 0xcc, 0xe4, 0xe6, 0xac, 0x60, 
+    0x49, 0x66, 0xf7, 0x15, 0x9f, 0xe1, 0x4b, 0xa5, 0x52, 0x8c, 0xd5, 0x51, 0xc1, 0x14, 0xbe, 0x9b, 
+    0x8f, 0x70, 0x37, 0x30, 0xf9, 0x88, 0x71, 0x5b, 0x2d, 0xc3, 0x30, 0x3a, 0xb9, 0x08, 0x0f, 0xa8, 
+    0x2c, 0x79, 0xbe, 0x81, 0x55, 0xe2, 0x5b, 0x4a, 0xc7, 0x02, 0xa4, 0x5e, 0x46, 0x51, 0x2a, 0x64, 
+    0x7a, 0x76, 0x09, 0x32, 0xfc, 0x33, 0xbb, 0x57, 0xf8, 0x31, 0x1b, 0x9a, 0x7b, 0x41, 0x33, 0xbb, 
+    0x97, 0xf4, 0x69, 0xb6, 0x9e, 0xc7, 0xec, 0x1d, 0xec, 0xbd, 0x7d, 0xfd, 0xee, 0xf2, 0xe8, 0x15, 
+    0xbb, 0xda, 0xdb, 0xe7, 0xb1, 0x7a, 0x92, 0x9b, 0xaa, 0x3d, 0x1a, 0x6e, 0xe5, 0xe5, 0x15, 0xcd, 
+    0x07, 0xf0, 0xa1, 0x01, 0x4c, 0x4b, 0x12, 0xd5, 0xeb, 0x93, 0x02, 0x25, 0xb4, 0xa5, 0x89, 0x21, 
+    0x79, 0x87, 0xbe, 0xd5, 0x65, 0xa1, 0xc7, 0x7c, 0x9b, 0xcc, 0x28, 0x11, 0x44, 0x1e, 0x40, 0xef, 
+    0x0d, 0x53, 0x08, 0xa3, 0xfd, 0xc0, 0x8c, 0xd6, 0x75, 0xda, 0xd3, 0xdd, 0x14, 0xde, 0x68, 0xbb, 
+    0x08, 0x93, 0x35, 0x03, 0x00, 0x49, 0x06, 0xd2, 0xa9, 0x17, 0x57, 0x48, 0xa0, 0x26, 0xa0, 0xde, 
+    0xd0, 0x1e, 0xd0, 0x66, 0x42, 0x2e, 0x2b, 0xdf, 0x66, 0x41, 0x3e, 0x57, 0xd5, 0xa2, 0x66, 0xa6, 
+    0xbe, 0x88, 0x57, 0x42, 0x7b, 0x25, 0x68, 0xd8, 0xa6, 0xd7, 0xa2, 0x5e, 0xf3, 0x6a, 0x0e, 0xe4, 
+    0xcf, 0xc5, 0xeb, 0xa1, 0xc5, 0xd9, 0x84, 0x4a, 0xe8, 0x9d, 0xa8, 0x81, 0xbe, 0xb3, 0x2b, 0x18, 
+    0x71, 0x0b, 0xd7, 0x31, 0xf6, 0x46, 0xe1, 0xa8, 0x69, 0xa7, 0x57, 0x22, 0x5e, 0xf2, 0x5a, 0x3e, 
+    0x79, 0xa3, 0x2b, 0xf8, 0xb1, 0x70, 0x0d, 0x14, 0x6f, 0x96, 0x8e, 0x9f, 0x5e, 0x71, 0xec, 0xa7, 
+    0xf8, 0x35, 0x5d, 0x57, 0xc4, 0x25, 0x46, 0x6e, 0x55, 0x51, 0x0c, 0x26, 0x4e, 0x7d, 0xb2, 0x23, 
+    0x83, 0x2d, 0xc6, 0xa7, 0x4d, 0x14, 0x3b, 0xe8, 0x6b, 0x0e, 0x99, 0xd9, 0xad, 0x88, 0x29, 0xb2, 
+    0x5c, 0x17, 0x5f, 0x44, 0x39, 0xd5, 0x33, 0x46, 0xc1, 0x56, 0x7b, 0x66, 0x39, 0xe2, 0xb7, 0x51, 
+    0x66, 0x84, 0x2b, 0xb1, 0xe9, 0xa5, 0x04, 0xff, 0xf4, 0x62, 0xe3, 0x64, 0xa1, 0xaa, 0x59, 0x88, 
+    0xd8, 0x62, 0x90, 0xe7, 0xf4, 0xbb, 0x53, 0x6a, 0x9a, 0x3c, 0xb9, 0x4e, 0x99, 0x9e, 0xd2, 0xfb, 
+    0x51, 0x04, 0xbe, 0x69, 0x3d, 0x17, 0x58, 0x37, 0xb6, 0x54, 0x96, 0xa8, 0xe2, 0x2f, 0xe1, 0x37, 
+    0x8b, 0xb4, 0xe7, 0x24, 0x3d, 0xaf, 0x3a, 0x8e, 0x87, 0x78, 0x44, 0x83, 0x5d, 0x57, 0x6c, 0x87, 
+    0xa7, 0x97, 0x17, 0xaf, 0xf6, 0x3e, 0x25, 0xf5, 0x9a, 0xd4, 0xb9, 0x29, 0x6a, 0x2d, 0xa6, 0xe7, 
+    0xa3, 0x80, 0x27, 0x7c, 0x41, 0xee, 0xd4, 0xdd, 0x2b, 0xbb, 0x3f, 0xb4, 0x7d, 0xa8, 0xd6, 0xb7, 
+    0xd9, 0xbb, 0x81, 0x03, 0xe3, 0x83, 0x3f, 0x07, 0xf6, 0x92, 0x2f, 0x8b, 0xaa, 0xc0, 0xa0, 0x98, 
+    0xe2, 0x08, 0xde, 0x62, 0x39, 0x6f, 0x48, 0x8e, 0x0e, 0xda, 0xb2, 0x01, 0x9c, 0x99, 0xdd, 0x63, 
+    0xab, 0x07, 0x33, 0x29, 0x98, 0x3f, 0x50, 0x98, 0xbf, 0x4c, 0x40, 0xb5, 0x60, 0x12, 0xb1, 0xdd, 
+    0xc0, 0x19, 0x05, 0x1a, 0x48, 0x99, 0xd7, 0x90, 0xda, 0x29, 0x69, 0xa4, 0x72, 0xe3, 0x85, 0x1d, 
+    0xe0, 0x7c, 0xca, 0x72, 0x7c, 0x4e, 0x0e, 0xf2, 0x11, 0xc1, 0xe4, 0xaa, 0x15, 0x87, 0xfb, 0x06, 
+    0xa3, 0x7e, 0x13, 0x96, 0x84, 0x9c, 0xbd, 0x58, 0xa0, 0x18, 0x3a, 0x30, 0xcf, 0x48, 0x7a, 0xaa, 
+    0x60, 0xaf, 0xf5, 0x9d, 0x01, 0x58, 0xbf, 0xf0, 0x69, 0x81, 0x15, 0xbc, 0x5e, 0xc9, 0xcc, 0x4d, 
+    0xc7, 0x3e, 0x79, 0x5f, 0x06, 0x76, 0x10, 0xa4, 0xd7, 0xed, 0x5b, 0x03, 0x1c, 0xcf, 0x58, 0x75, 
+    0x53, 0x81, 0x8a, 0xfa, 0xaa, 0xa2, 0xbe, 0x2a, 0x9a, 0xca, 0x82, 0x98, 0xcd, 0x8a, 0x1c, 0xa8, 
+    0xb1, 0x32, 0xb8, 0x2d, 0x96, 0xd9, 0xdd, 0xac, 0xfc, 0x3c, 0x45, 0x7a, 0x35, 0x02, 0xa7, 0x08, 
+    0x30, 0x91, 0x19, 0x7b, 0x1f, 0x2d, 0xb4, 0x33, 0x92, 0xb5, 0xaf, 0xa9, 0x6b, 0xb4, 0x66, 0xe9, 
+    0x33, 0xb1, 0xda, 0x43, 0x52, 0x6a, 0xe5, 0xb2, 0xe7, 0xdd, 0xb2, 0x63, 0x11, 0x3e, 0x25, 0x6c, 
+    0xcb, 0x40, 0xd1, 0xca, 0xeb, 0x34, 0x4a, 0x83, 0x64, 0xeb, 0x8c, 0xa2, 0x6d, 0x8b, 0xa6, 0x77, 
+    0xc7, 0x79, 0x85, 0xf1, 0x1c, 0x45, 0x19, 0x8c, 0x05, 0xd2, 0xcc, 0xf7, 0x34, 0x84, 0x9d, 0x6f, 
+    0x12, 0xc1, 0xf7, 0x37, 0x32, 0x91, 0x65, 0x2f, 0xe9, 0x15, 0xfc, 0x19, 0xa6, 0x4d, 0xd8, 0x13, 
+    0xfc, 0x0d, 0x22, 0x7a, 0x17, 0xd6, 0x0d, 0x3d, 0xe0, 0x80, 0x3d, 0xa0, 0x58, 0xcd, 0x02, 0xb3, 
+    0xad, 0x56, 0x8f, 0xb9, 0xca, 0xab, 0x07, 0xb4, 0x05, 0xac, 0x2e, 0x27, 0x70, 0x96, 0x6b, 0x09, 
+    0xeb, 0x71, 0x95, 0xd5, 0x98, 0xa4, 0x39, 0x5f, 0x62, 0x84, 0x43, 0x06, 0x7c, 0x16, 0x40, 0x31, 
+    0xb8, 0x63, 0x26, 0x41, 0x85, 0x35, 0xc7, 0x9c, 0x80, 0xd0, 0x0d, 0x84, 0x15, 0xf0, 0x7b, 0x75, 
+    0xe9, 0x39, 0x4a, 0x11, 0x06, 0x09, 0xd8, 0xf3, 0x76, 0xe7, 0x11, 0xb5, 0x9d, 0xe9, 0x05, 0x97, 
+    0xec, 0xca, 0x01, 0xa2, 0x28, 0x92, 0x9b, 0x5d, 0x30, 0x34, 0xb3, 0x54, 0x3f, 0x4a, 0x15, 0xa7, 
+    0xe1, 0x93, 0xe7, 0x30, 0x52, 0x59, 0x53, 0x89, 0x56, 0x13, 0x3a, 0x2f, 0x45, 0x23, 0x67, 0xa9, 
+    0x97, 0xd0, 0xf2, 0x43, 0x96, 0x6b, 0x3b, 0xfd, 0x7c, 0xaa, 0x12, 0xe4, 0x44, 0x04, 0x08, 0x45, 
+    0x14, 0x2f, 0xa6, 0xbc, 0x8e, 0x06, 0x6d, 0x96, 0xe3, 0x43, 0xdb, 0x1e, 0x4c, 0xab, 0xc0, 0x26, 
+    0x97, 0x4e, 0x02, 0xfd, 0x7c, 0xb5, 0xf0, 0xbe, 0x5b, 0x40, 0x41, 0xf1, 0x3a, 0xe7, 0x52, 0x53, 
+    0x35, 0x53, 0x4d, 0xc5, 0x4b, 0x72, 0x65, 0x55, 0x4b, 0x2a, 0xab, 0x1f, 0x19, 0x93, 0x87, 0x4e, 
+    0x3f, 0x60, 0x62, 0x82, 0x63, 0xed, 0x11, 0x86, 0xe3, 0x33, 0xaa, 0x98, 0xf5, 0xbc, 0x91, 0x1f, 
+    0x94, 0xf0, 0x04, 0xb8, 0xef, 0x04, 0x76, 0x19, 0x3e, 0x41, 0x32, 0x18, 0x9f, 0x5b, 0x02, 0x06, 
+    0xb3, 0xa9, 0x1a, 0x6f, 0x68, 0x69, 0x4d, 0x1c, 0x6b, 0x33, 0x57, 0xd6, 0xe9, 0x93, 0xbc, 0x58, 
+    0xde, 0xa8, 0x39, 0xfe, 0x52, 0x48, 0xe5, 0xe4, 0x39, 0x5e, 0x34, 0x62, 0xea, 0x14, 0x7f, 0x75, 
+    0x72, 0x74, 0x76, 0x94, 0x9c, 0xe0, 0xf9, 0x12, 0x69, 0xb9, 0xe9, 0xfd, 0x92, 0x8b, 0x97, 0x58, 
+    0x5e, 0xa5, 0xe9, 0x01, 0x63, 0xdf, 0x2a, 0x93, 0xf6, 0x12, 0x59, 0x61, 0x2e, 0x0f, 0xf1, 0xf1, 
+    0x4e, 0x06, 0xdd, 0x1c, 0x09, 0x60, 0xf4, 0x7d, 0xc3, 0x64, 0x8f, 0x8f, 0xd0, 0x55, 0x83, 0xad, 
+    0x4b, 0x02, 0xd1, 0xa2, 0x6a, 0xf7, 0x35, 0xc8, 0x8e, 0x33, 0xb0, 0x40, 0xb1, 0xd0, 0xe6, 0x8a, 
+    0x00, 0x4e, 0x59, 0x03, 0x4a, 0x2a, 0xcc, 0xea, 0xab, 0x93, 0xab, 0x3f, 0x43, 0xff, 0x92, 0x6f, 
+    0x75, 0xc2, 0xe9, 0x04, 0xec, 0xe3, 0x86, 0xc4, 0x18, 0x54, 0xbd, 0x1f, 0xf6, 0x60, 0x99, 0x06, 
+    0x52, 0xbc, 0x28, 0x0d, 0xb5, 0x29, 0x2c, 0x20, 0x1b, 0x78, 0x3a, 0x01, 0x60, 0xf1, 0xfa, 0xa9, 
+    0xad, 0x5f, 0x68, 0xd0, 0x53, 0xe7, 0x4e, 0xd6, 0xf4, 0xc6, 0xde, 0x6d, 0x26, 0xe5, 0x5d, 0xa2, 
+    0x7f, 0xf1, 0x29, 0x75, 0xef, 0xde, 0x28, 0xf4, 0x52, 0x88, 0x90, 0xa5, 0x0c, 0x70, 0xe8, 0x8e, 
+    0x43, 0xcb, 0xbf, 0x9e, 0x17, 0x1c, 0x38, 0xf7, 0x0a, 0x07, 0xf2, 0x0f, 0x6a, 0x89, 0x35, 0xd4, 
+    0x12, 0x48, 0x26, 0x0e, 0x79, 0x50, 0x15, 0x40, 0x01, 0xb3, 0x42, 0xae, 0x23, 0x0a, 0xcc, 0x25, 
+    0x55, 0x21, 0xf4, 0x46, 0xdb, 0x1a, 0x27, 0xd5, 0x80, 0x5c, 0x9b, 0xa8, 0x2d, 0xbe, 0x68, 0xfd, 
+    0xad, 0x3f, 0x65, 0x7c, 0xe3, 0x6f, 0xee, 0x59, 0xe4, 0xd8, 0xc7, 0xae, 0x4f, 0xe9, 0x8c, 0xa5, 
+    0x3c, 0x79, 0xb8, 0xb1, 0x43, 0x9d, 0x4c, 0x91, 0x1a, 0x41, 0xae, 0x92, 0xe7, 0xae, 0x20, 0xa6, 
+    0x86, 0xd9, 0x12, 0xfe, 0xbc, 0x38, 0xd2, 0xaa, 0x44, 0xaa, 0x0d, 0x9e, 0xf9, 0xd1, 0x8a, 0x5e, 
+    0xd3, 0xf7, 0x23, 0xd7, 0xeb, 0x75, 0xdd, 0x0b, 0xe6, 0xc2, 0x30, 0xe3, 0x63, 0x82, 0x6a, 0x45, 
+    0xd5, 0x79, 0x80, 0xcf, 0xd8, 0x9e, 0xeb, 0xce, 0xe5, 0x42, 0x8c, 0xe2, 0x1a, 0x32, 0x13, 0xdf, 
+    0x88, 0x03, 0x89, 0x24, 0x89, 0x34, 0x22, 0x58, 0x91, 0xed, 0x2b, 0x9a, 0x78, 0xa4, 0x4b, 0x30, 
+    0x5d, 0xd6, 0x66, 0x6c, 0x4a, 0x01, 0xd5, 0x5c, 0x22, 0x30, 0x28, 0x0f, 0x06, 0x55, 0x1f, 0x0f, 
+    0xeb, 0x40, 0x33, 0x19, 0x8c, 0x6b, 0x98, 0x33, 0x9d, 0x81, 0xcc, 0x14, 0x10, 0xb1, 0x22, 0xf2, 
+    0xf6, 0x18, 0x04, 0x93, 0x18, 0x18, 0x56, 0x91, 0x16, 0xe6, 0x02, 0xca, 0x49, 0x2b, 0xcf, 0xad, 
+    0x23, 0xc3, 0xde, 0x12, 0xe7, 0x4d, 0xf5, 0x82, 0xca, 0x2b, 0x4d, 0xf3, 0x0d, 0x70, 0xa0, 0xd8, 
+    0xec, 0xc6, 0xcc, 0x34, 0xdc, 0x84, 0x8b, 0x95, 0xa2, 0xd7, 0x46, 0x99, 0x62, 0xcf, 0xbe, 0xa3, 
+    0xf9, 0xdf, 0xb5, 0x07, 0x5d, 0x74, 0x6f, 0x6f, 0xa4, 0xba, 0x9f, 0xe6, 0x6a, 0xc5, 0x05, 0x9f, 
+    0x3e, 0x85, 0xeb, 0x65, 0xd9, 0x76, 0x10, 0xd9, 0x0b, 0xb7, 0x84, 0xb6, 0x3e, 0x1f, 0xb1, 0x2d, 
+    0x57, 0xb0, 0x82, 0x64, 0x7f, 0x63, 0xf5, 0x87, 0xdb, 0xec, 0xc4, 0xb6, 0xc0, 0x70, 0x0d, 0x96, 
+    0x6f, 0x51, 0x6b, 0x6c, 0x0d, 0x16, 0x6f, 0x11, 0x96, 0x7a, 0xcc, 0x16, 0x9d, 0x80, 0x7e, 0x64, 
+    0xe8, 0x01, 0x58, 0xbe, 0x21, 0x1e, 0x37, 0x26, 0x17, 0x6e, 0x0a, 0x2f, 0xf7, 0x98, 0x8d, 0x79, 
+    0x05, 0x8b, 0xd1, 0x1f, 0x6b, 0x4b, 0x13, 0xec, 0xdc, 0x25, 0x06, 0x0c, 0x94, 0x7a, 0xcc, 0x76, 
+    0x5c, 0x4a, 0xad, 0xfa, 0x83, 0x83, 0xa6, 0xeb, 0xa3, 0x23, 0x7e, 0xd1, 0xd6, 0x60, 0xa9, 0x69, 
+    0xad, 0x79, 0x44, 0xc5, 0x7c, 0x80, 0xbb, 0x6c, 0xbf, 0x9b, 0x4a, 0x76, 0x06, 0x01, 0x2c, 0x2e, 
+    0xd5, 0xe2, 0x9c, 0xe1, 0x56, 0x48, 0xc0, 0x2c, 0x98, 0x05, 0x3a, 0x9e, 0x17, 0xc2, 0xba, 0xa0, 
+    0x69, 0x61, 0xbd, 0xcb, 0xa8, 0x66, 0x22, 0xfc, 0x31, 0xf4, 0x33, 0xdf, 0x9e, 0x59, 0x58, 0x0b, 
+    0x40, 0xa9, 0xc7, 0x14, 0x38, 0x6a, 0xce, 0x8f, 0x2b, 0xe8, 0xd7, 0x83, 0x83, 0xa5, 0x9a, 0x13, 
+    0x95, 0x7d, 0xf4, 0x46, 0xed, 0xb5, 0x70, 0x5b, 0xf0, 0x07, 0xd5, 0xf4, 0xb2, 0xed, 0x8a, 0xca, 
+    0x3e, 0x7a, 0xbb, 0x1e, 0x4d, 0x6f, 0x2f, 0xdb, 0x36, 0xbd, 0xf4, 0xa3, 0xb7, 0xee, 0x71, 0x14, 
+    0xf9, 0xb2, 0x4d, 0x8b, 0xca, 0x3e, 0x7a, 0xc3, 0x94, 0x66, 0xff, 0x31, 0xa5, 0xbe, 0x6c, 0xcb, 
+    0xa2, 0xb2, 0xbf, 0xa3, 0x82, 0x7f, 0xa5, 0xbc, 0x87, 0xff, 0xcb, 0x9a, 0xde, 0x2e, 0xf7, 0x8c, 
+    0x2d, 0x66, 0x7b, 0xcb, 0x42, 0x7f, 0x28, 0xe3, 0x9b, 0x13, 0xb5, 0xb0, 0xf5, 0x1d, 0x15, 0xfb, 
+    0x03, 0x9a, 0xdf, 0x9c, 0xb8, 0x85, 0xed, 0xef, 0xa8, 0xd8, 0x1f, 0xc7, 0x00, 0xe7, 0x34, 0x2d, 
+    0x61, 0x81, 0xeb, 0x05, 0xff, 0x30, 0x26, 0xb8, 0x18, 0x01, 0x8b, 0xda, 0xe0, 0x51, 0xb1, 0x3f, 
+    0x98, 0x11, 0xce, 0x09, 0x5b, 0xd8, 0x0a, 0x8f, 0x8a, 0xfd, 0x53, 0x69, 0xe9, 0xff, 0xa5, 0xed, 
+    0x70, 0x31, 0xae, 0x17, 0x9d, 0x50, 0xa3, 0x62, 0x7f, 0x1c, 0x4b, 0x3c, 0x52, 0xbb, 0x4b, 0x58, 
+    0x08, 0xf1, 0xc2, 0x7f, 0x28, 0x5b, 0x3c, 0x52, 0xbe, 0x4b, 0xb7, 0xec, 0x0f, 0x6b, 0x8d, 0xeb, 
+    0xba, 0x78, 0xe9, 0xd6, 0xfd, 0x71, 0xed, 0xf1, 0x48, 0x3d, 0x2f, 0xdd, 0xb8, 0x3f, 0xac, 0x45, 
+    0x1e, 0xa9, 0xea, 0xa5, 0xdb, 0xb6, 0x90, 0x4d, 0xfe, 0xbb, 0xc7, 0x2e, 0x29, 0xcf, 0x3c, 0x6d, 
+    0x6a, 0x8a, 0x4d, 0xc3, 0x49, 0x3b, 0x9a, 0x62, 0xe7, 0x70, 0xca, 0x7e, 0xe6, 0xe5, 0xa7, 0xcb, 
+    0xab, 0xa3, 0xb3, 0xe4, 0x86, 0xa6, 0x88, 0xe2, 0x5c, 0x6e, 0x47, 0xf3, 0x90, 0x72, 0x87, 0xd3, 
+    0xf1, 0x78, 0x73, 0x87, 0x85, 0xd6, 0x39, 0x3c, 0xb1, 0x38, 0x8f, 0xaf, 0x9e, 0x18, 0x2d, 0xbb, 
+    0x5c, 0xac, 0x85, 0x08, 0x3a, 0x05, 0x45, 0x36, 0x39, 0x48, 0x26, 0xde, 0x1f, 0x66, 0xde, 0x86, 
+    0xcc, 0x32, 0x01, 0xd7, 0x22, 0x72, 0x58, 0x0b, 0xb8, 0x8e, 0x42, 0x96, 0x97, 0xda, 0xf6, 0xe1, 
+    0x21, 0x2d, 0x25, 0x4a, 0x46, 0x9c, 0x2d, 0xf3, 0xe3, 0xec, 0xd9, 0xcc, 0xee, 0xb1, 0xe3, 0xf7, 
+    0x6f, 0x2d, 0x8c, 0x02, 0xa3, 0x27, 0x3f, 0xb8, 0xf9, 0xd3, 0x32, 0x36, 0x7f, 0x9c, 0x4e, 0x0e, 
+    0x80, 0x3b, 0x50, 0x43, 0x2e, 0xfb, 0xd6, 0x6e, 0xc2, 0xbc, 0xcf, 0x78, 0x4f, 0xfd, 0x92, 0xcd, 
+    0xe7, 0xe3, 0x14, 0xf9, 0x04, 0x90, 0xc5, 0xe6, 0xe2, 0x97, 0xc9, 0x02, 0xe8, 0x3a, 0x37, 0x49, 
+    0xf9, 0x9b, 0x6f, 0x70, 0x6c, 0x26, 0x72, 0x6a, 0x64, 0x96, 0x6c, 0xe8, 0xd3, 0xf5, 0x49, 0x0d, 
+    0xbd, 0xb4, 0x3a, 0x7c, 0x57, 0x96, 0x61, 0x33, 0x02, 0x76, 0xeb, 0x84, 0x3d, 0x8c, 0xae, 0x80, 
+    0x81, 0xe7, 0xb2, 0x8e, 0x4d, 0x21, 0x77, 0xdc, 0x56, 0x02, 0xcb, 0x08, 0xcf, 0x9c, 0x8d, 0x4b, 
+    0x60, 0x85, 0x0d, 0x42, 0x67, 0x30, 0x4a, 0xe5, 0x8b, 0x35, 0x74, 0xca, 0x01, 0xe0, 0xc4, 0xfd, 
+    0xd3, 0x2c, 0x0e, 0xd1, 0x8e, 0xdc, 0xf4, 0xfd, 0xa1, 0x9e, 0xaa, 0xaf, 0x3f, 0x9d, 0xd8, 0x53, 
+    0xb8, 0x47, 0xc8, 0xf3, 0xee, 0x33, 0x21, 0x8d, 0x40, 0x31, 0xae, 0xb6, 0xdf, 0x9d, 0xb2, 0x8e, 
+    0xef, 0xf5, 0x59, 0x47, 0x0a, 0x0d, 0xda, 0x73, 0xbc, 0xe3, 0x82, 0xd9, 0xad, 0xf0, 0xed, 0xa1, 
+    0xef, 0xdd, 0x38, 0x01, 0x06, 0x1a, 0x63, 0x37, 0x47, 0xd5, 0xfc, 0x60, 0x5b, 0x9e, 0x4e, 0x94, 
+    0xba, 0x63, 0x0b, 0x77, 0xbf, 0xc7, 0xec, 0xad, 0x8d, 0x61, 0x22, 0xb4, 0x19, 0x09, 0x46, 0xa8, 
+    0xeb, 0x46, 0x79, 0x5d, 0xb1, 0x05, 0x1f, 0x9c, 0x63, 0x87, 0xb5, 0x7c, 0xbb, 0x0d, 0xaa, 0xc8, 
+    0xb1, 0x5c, 0x68, 0xca, 0x55, 0xcf, 0x09, 0xc0, 0x64, 0x1d, 0x60, 0x92, 0xef, 0xa6, 0xcd, 0xa0, 
+    0x16, 0x6f, 0x60, 0x4f, 0x6f, 0xa1, 0x8f, 0x55, 0xe0, 0x80, 0xd2, 0xab, 0x9c, 0x67, 0x87, 0x73, 
+    0xba, 0x2e, 0xaa, 0x55, 0x74, 0x5d, 0xb4, 0x77, 0x71, 0xca, 0x8e, 0x06, 0x6d, 0x3a, 0x1c, 0x99, 
+    0xae, 0x8a, 0x64, 0x86, 0x90, 0xd8, 0x1c, 0x18, 0xe5, 0xe5, 0xc8, 0xec, 0x52, 0x67, 0xdc, 0x4a, 
+    0x65, 0xc2, 0x27, 0x40, 0x4b, 0x64, 0x29, 0xd7, 0xdf, 0x65, 0x8c, 0xc2, 0x14, 0x0e, 0xa4, 0x28, 
+    0x4c, 0xcb, 0x92, 0xa1, 0xce, 0xe0, 0xd0, 0x86, 0xff, 0xb3, 0xb2, 0x95, 0x36, 0x3a, 0xe7, 0xa5, 
+    0x8f, 0xba, 0xb0, 0x9b, 0x4a, 0x1e, 0x7f, 0xb5, 0x38, 0x75, 0xea, 0xb0, 0xae, 0xc4, 0xfd, 0x43, 
+    0x04, 0x72, 0x0d, 0x94, 0x4a, 0xa0, 0x50, 0x4e, 0x0b, 0x13, 0x28, 0xe6, 0x38, 0x89, 0xd9, 0xda, 
+    0x7d, 0x9c, 0x09, 0xec, 0xc2, 0xf7, 0xbe, 0x61, 0x34, 0xd0, 0x2b, 0x4c, 0x67, 0xb6, 0xac, 0xd0, 
+    0x3c, 0x77, 0xc2, 0x93, 0x51, 0x33, 0xde, 0x5c, 0xbc, 0x16, 0x23, 0xd8, 0x2a, 0x97, 0xbb, 0xa0, 
+    0xe4, 0x46, 0xcd, 0x52, 0xcb, 0xeb, 0x97, 0x7d, 0xb0, 0xb8, 0xfb, 0xd6, 0xc8, 0xb5, 0xcb, 0xf6, 
+    0xd0, 0x69, 0x09, 0x51, 0xa2, 0x10, 0xc1, 0x10, 0x08, 0xc4, 0x83, 0x71, 0x7f, 0x6d, 0xba, 0xd6, 
+    0xe0, 0x7a, 0x71, 0xf6, 0x5c, 0x7a, 0x23, 0xbf, 0x25, 0x7d, 0x41, 0x87, 0x5e, 0x2b, 0x58, 0xbe, 
+    0x07, 0x41, 0xf9, 0xd8, 0x56, 0x60, 0x07, 0x3f, 0xd0, 0x1e, 0x18, 0xf0, 0x1c, 0xc7, 0x8f, 0x37, 
+    0xec, 0xd0, 0xbb, 0x1d, 0x90, 0x32, 0x94, 0x7a, 0x75, 0xf9, 0x86, 0x9d, 0x06, 0xc1, 0xe8, 0xc7, 
+    0x9a, 0xe5, 0x10, 0x86, 0x1f, 0x6f, 0xd4, 0x5b, 0x1b, 0xef, 0x80, 0x61, 0xcd, 0x51, 0x37, 0x4d, 
+    0x94, 0x93, 0x82, 0xad, 0x23, 0x9b, 0x96, 0x5d, 0x39, 0x35, 0x07, 0x18, 0x3f, 0x7c, 0xb5, 0xbb, 
+    0xf2, 0x37, 0x2d, 0x6f, 0x38, 0xde, 0x66, 0xb5, 0x4a, 0xad, 0xc1, 0xe6, 0x6a, 0x7d, 0xa2, 0x9d, 
+    0xbb, 0xea, 0x15, 0x52, 0xcd, 0xfe, 0x8e, 0x3d, 0x8a, 0xac, 0xc7, 0x2e, 0xb5, 0x41, 0xd4, 0x2b, 
+    0xd3, 0x38, 0xc2, 0x0d, 0xe9, 0xb3, 0xd7, 0x87, 0x7b, 0xaf, 0x2e, 0x4d, 0x23, 0x9a, 0x67, 0x9c, 
+    0x8a, 0x8e, 0xf3, 0x44, 0xc1, 0x56, 0x18, 0x87, 0x19, 0x0f, 0xc0, 0x8a, 0x12, 0x5a, 0x89, 0xf3, 
+    0x70, 0x49, 0x14, 0xd2, 0x37, 0xb4, 0xd7, 0x6e, 0x6b, 0x27, 0x7f, 0xe8, 0x54, 0xdc, 0xcc, 0x20, 
+    0x43, 0xca, 0x79, 0x80, 0xa6, 0xcc, 0x81, 0x13, 0x8e, 0x53, 0x35, 0x8b, 0x96, 0x03, 0x21, 0x13, 
+    0x0b, 0x47, 0xe5, 0xeb, 0x24, 0x79, 0x24, 0x85, 0x03, 0x66, 0xd8, 0xd0, 0xb5, 0x5a, 0x76, 0xcf, 
+    0x73, 0xdb, 0xb6, 0xbf, 0x93, 0xb9, 0x02, 0x40, 0x86, 0xc7, 0xe3, 0x29, 0x19, 0x39, 0xcb, 0xd9, 
+    0xa5, 0x6e, 0xa9, 0xc0, 0xf6, 0x46, 0x3e, 0x88, 0x5a, 0x81, 0xbd, 0x1e, 0x00, 0x97, 0x1d, 0x2f, 
+    0x9f, 0xa1, 0xb4, 0xdd, 0xd0, 0x1f, 0x43, 0xd7, 0x0e, 0x01, 0xb1, 0x87, 0xc7, 0x41, 0x35, 0x7b, 
+    0x51, 0x61, 0x2f, 0xc2, 0x1c, 0x3d, 0x72, 0xc3, 0x48, 0x33, 0xc7, 0xce, 0xe3, 0xcf, 0xb1, 0xf2, 
+    0x32, 0x4f, 0xb7, 0xf3, 0x83, 0x63, 0xa9, 0xaf, 0x84, 0xfb, 0xfc, 0xb5, 0xcf, 0x48, 0x8a, 0x61, 
+    0xce, 0xf1, 0x7c, 0x10, 0x63, 0x30, 0xb1, 0x03, 0x58, 0xed, 0x0d, 0x46, 0x60, 0x84, 0x8c, 0xb7, 
+    0xe6, 0x08, 0x05, 0x57, 0xdc, 0x56, 0xb3, 0xd7, 0xb9, 0xa5, 0xc7, 0x74, 0xa6, 0x73, 0x74, 0x60, 
+    0xdf, 0x62, 0x07, 0xf3, 0x98, 0x44, 0x93, 0xa7, 0x9c, 0x87, 0xd0, 0x77, 0x21, 0x75, 0xfb, 0xc4, 
+    0xea, 0xe7, 0x8b, 0x9e, 0x7e, 0x05, 0x34, 0x85, 0xa3, 0xb6, 0x3d, 0xfb, 0x38, 0x86, 0x24, 0xc9, 
+    0xb5, 0x42, 0xd4, 0x1c, 0xf6, 0x70, 0x27, 0x53, 0x29, 0x55, 0x2a, 0x95, 0x6a, 0x8c, 0xbe, 0xb5, 
+    0x8d, 0xd2, 0x7a, 0x65, 0xbd, 0x96, 0x59, 0x80, 0x31, 0x83, 0xee, 0xa2, 0x34, 0xe0, 0xc8, 0x99, 
+    0x42, 0x43, 0xb1, 0x5a, 0xab, 0x95, 0xea, 0xf5, 0x5a, 0x35, 0x93, 0x90, 0x85, 0xf9, 0x97, 0x5c, 
+    0xa3, 0xc0, 0x3e, 0x1b, 0xcb, 0x5e, 0x3b, 0xf6, 0xfc, 0x73, 0x3a, 0x3e, 0x2b, 0xf5, 0x5c, 0x94, 
+    0x86, 0x2f, 0xb3, 0xfb, 0x2e, 0x00, 0x93, 0x7e, 0x9c, 0x76, 0xee, 0x2e, 0x31, 0x9a, 0x67, 0x1e, 
+    0xfc, 0x4b, 0x3d, 0x12, 0xec, 0x7a, 0x40, 0x4b, 0xf2, 0xa8, 0xdf, 0x81, 0x35, 0x68, 0x19, 0x07, 
+    0x94, 0x66, 0x38, 0x0d, 0xe8, 0x98, 0x0a, 0x3c, 0x50, 0xaa, 0x03, 0x9d, 0x07, 0x31, 0x5f, 0x82, 
+    0x7e, 0xd4, 0x15, 0x54, 0xca, 0x44, 0x03, 0x58, 0xea, 0x39, 0x53, 0xaf, 0x69, 0x27, 0x08, 0x97, 
+    0x56, 0x6c, 0x0a, 0x87, 0xae, 0xd9, 0xb4, 0xc3, 0x86, 0xf3, 0xa8, 0xb6, 0x23, 0x4c, 0xc6, 0xcd, 
+    0x50, 0xfd, 0xa4, 0x87, 0xec, 0x83, 0x1c, 0xb5, 0xda, 0x74, 0x8e, 0x8f, 0x9a, 0xdf, 0x43, 0x37, 
+    0x1c, 0xf4, 0x38, 0x2d, 0xa1, 0x55, 0x55, 0xc7, 0x8e, 0xed, 0xb6, 0x03, 0x64, 0x44, 0xfc, 0x5c, 
+    0x54, 0x25, 0xb3, 0xbb, 0xef, 0xf8, 0x61, 0xaf, 0x8d, 0x47, 0x65, 0x27, 0x9c, 0x9d, 0x02, 0xd9, 
+    0x3b, 0xb2, 0x40, 0x46, 0xfd, 0x89, 0x10, 0x30, 0x46, 0x4e, 0x78, 0x16, 0x71, 0x3c, 0xdb, 0x3d, 
+    0x01, 0xa8, 0x9e, 0xd9, 0x7d, 0x6f, 0xb9, 0xb8, 0xb0, 0x19, 0xd8, 0xd9, 0x80, 0x1d, 0x4e, 0xa9, 
+    0x71, 0x0d, 0x24, 0xa2, 0xe7, 0x3b, 0x41, 0xd8, 0xb7, 0x82, 0x89, 0x40, 0x0d, 0x19, 0xe2, 0x0c, 
+    0xa8, 0xd0, 0x5d, 0xb0, 0xe8, 0xb1, 0x2e, 0x79, 0x94, 0x90, 0xfa, 0x26, 0x11, 0xd2, 0x8c, 0x0f, 
+    0xe7, 0xd1, 0x6d, 0x12, 0x81, 0xe1, 0x39, 0xab, 0x57, 0x53, 0x55, 0xdd, 0x99, 0xd7, 0x87, 0x86, 
+    0x4b, 0x7e, 0xcf, 0xd0, 0x78, 0x92, 0x3c, 0x4a, 0xf6, 0x97, 0xb6, 0xab, 0x92, 0x26, 0x2d, 0x67, 
+    0x20, 0x89, 0xbd, 0x69, 0x82, 0xd2, 0x47, 0x80, 0x4c, 0x5a, 0x17, 0xbf, 0xc0, 0xa9, 0xc0, 0x8f, 
+    0xfa, 0x24, 0xd9, 0xc5, 0xc7, 0x76, 0xd3, 0x9f, 0x06, 0x02, 0x1d, 0x7c, 0x86, 0x13, 0xcf, 0xb4, 
+    0x6e, 0xdd, 0x83, 0x21, 0xec, 0x4e, 0x42, 0xd0, 0x40, 0x04, 0x13, 0xd1, 0xaf, 0x03, 0x8d, 0xa3, 
+    0x81, 0x3d, 0x11, 0xfb, 0x06, 0xbe, 0x77, 0x27, 0x16, 0xdf, 0xc4, 0x30, 0xed, 0x2e, 0x08, 0xcc, 
+    0x24, 0x80, 0xa7, 0xb8, 0xe9, 0x36, 0x0c, 0x6d, 0x54, 0xd2, 0x93, 0xc7, 0x02, 0x0c, 0x98, 0xd7, 
+    0xb0, 0xac, 0xd6, 0x61, 0xe2, 0x20, 0xc0, 0xcc, 0x73, 0xef, 0xc6, 0xc4, 0x13, 0x87, 0xa9, 0xe1, 
+    0x1a, 0xab, 0x15, 0xaf, 0x6b, 0xd1, 0x33, 0x3d, 0x34, 0x86, 0xe6, 0x99, 0x6a, 0x48, 0x8e, 0xc6, 
+    0xb1, 0xb3, 0x35, 0x28, 0xa5, 0x51, 0xff, 0x4f, 0x31, 0x35, 0x1e, 0x49, 0xe1, 0x1b, 0xa7, 0xae, 
+    0x97, 0xd5, 0xf8, 0x91, 0x4e, 0x4d, 0x51, 0xf9, 0x4a, 0xe1, 0x2d, 0xa9, 0xf3, 0xc5, 0x69, 0xee, 
+    0xe5, 0x15, 0x3e, 0x0f, 0xd9, 0xd7, 0xb5, 0x7d, 0x74, 0xf0, 0x5b, 0xe5, 0xbe, 0x98, 0x47, 0xed, 
+    0xf3, 0x00, 0x03, 0x96, 0x83, 0x8e, 0x62, 0xd5, 0x75, 0x7e, 0xcb, 0x65, 0x7e, 0x2e, 0x7d, 0x84, 
+    0xe7, 0x9c, 0x7b, 0x54, 0xda, 0x50, 0x49, 0xd5, 0xf5, 0x54, 0x95, 0xf4, 0x66, 0xe4, 0x85, 0xf6, 
+    0x02, 0x27, 0x4f, 0xbd, 0x36, 0xdf, 0x90, 0xe6, 0x94, 0x6d, 0x56, 0x12, 0x94, 0xc9, 0x8b, 0x0c, 
+    0x4c, 0x82, 0x30, 0x6b, 0x92, 0x41, 0xce, 0x66, 0x25, 0xc3, 0x40, 0xcb, 0x05, 0x74, 0x00, 0xd6, 
+    0xa0, 0x8b, 0x8e, 0xa4, 0xf4, 0xed, 0x20, 0xb0, 0xba, 0x76, 0xa9, 0x54, 0x42, 0x4b, 0x58, 0xe2, 
+    0x34, 0xd7, 0x67, 0x8b, 0x1c, 0xd0, 0xd0, 0x4e, 0x8d, 0x01, 0x49, 0x48, 0x4d, 0xe2, 0x84, 0xf6, 
+    0x66, 0x65, 0xb1, 0x43, 0x2f, 0xc7, 0x7c, 0xf3, 0x98, 0xf8, 0x50, 0xaf, 0x2c, 0xda, 0x43, 0x7c, 
+    0xeb, 0xd9, 0x9c, 0x34, 0x2a, 0xa9, 0x3d, 0x74, 0x82, 0x3b, 0x21, 0x16, 0xeb, 0x42, 0xfb, 0x43, 
+    0x3c, 0x42, 0xf2, 0x24, 0xf3, 0xbb, 0x8e, 0x51, 0x95, 0xb4, 0x60, 0xe9, 0x01, 0xca, 0xc7, 0x40, 
+    0xda, 0xe8, 0xa4, 0x37, 0x51, 0x42, 0x98, 0xc5, 0x07, 0xa8, 0x4a, 0x85, 0xb0, 0xf4, 0x08, 0x15, 
+    0x18, 0xe4, 0x10, 0x15, 0x27, 0xfe, 0xd9, 0x01, 0xd8, 0x4d, 0x03, 0xdb, 0x65, 0x97, 0xa1, 0x85, 
+    0xde, 0xcc, 0x79, 0x46, 0xa8, 0x2c, 0x8a, 0x8e, 0xd0, 0x97, 0xf6, 0x04, 0x3d, 0x3c, 0x84, 0xe2, 
+    0xb7, 0x1e, 0xa6, 0x9e, 0x11, 0xc9, 0x04, 0xac, 0xa1, 0x53, 0xbc, 0xb6, 0xc7, 0xb1, 0x9e, 0xde, 
+    0x3b, 0xfd, 0x6e, 0x5d, 0x8e, 0x49, 0xda, 0x97, 0x3c, 0x81, 0xf4, 0xdc, 0x0e, 0x41, 0x48, 0x3a, 
+    0xc0, 0x5a, 0x06, 0xe8, 0xb9, 0x6f, 0x3c, 0xe1, 0x2f, 0x00, 0xa6, 0x04, 0x9e, 0x6b, 0x97, 0xa0, 
+    0xc3, 0x47, 0xed, 0x52, 0xd7, 0xf3, 0xba, 0xf8, 0xc3, 0xeb, 0xa3, 0xab, 0x30, 0x28, 0x6b, 0x6e, 
+    0xe7, 0xa4, 0xcf, 0x25, 0x3d, 0x1b, 0xd2, 0x73, 0x42, 0xc1, 0x0e, 0x10, 0x1f, 0xba, 0xa4, 0x11, 
+    0x3b, 0x7a, 0x14, 0x4a, 0x4c, 0x1c, 0xe5, 0x95, 0x4c, 0x02, 0x0b, 0xcd, 0x22, 0x4e, 0xdd, 0xd4, 
+    0x4b, 0x8b, 0x2c, 0x35, 0x65, 0xbf, 0x9c, 0x50, 0xde, 0xfc, 0x59, 0xa3, 0x0b, 0x93, 0x35, 0xf0, 
+    0x02, 0x31, 0xfe, 0xa2, 0xf1, 0xea, 0xa2, 0x93, 0xbd, 0xd4, 0x81, 0x41, 0x8f, 0x12, 0xb4, 0x2c, 
+    0x9f, 0x3f, 0x38, 0x61, 0xcf, 0xc3, 0xaa, 0x7b, 0x36, 0xfb, 0x5b, 0x16, 0x8c, 0xfb, 0x4d, 0xcf, 
+    0x85, 0xd6, 0xde, 0x59, 0xb8, 0xe4, 0xdf, 0x62, 0x89, 0x8a, 0x52, 0xcf, 0x7b, 0x49, 0x21, 0x4c, 
+    0xdb, 0x3a, 0x8a, 0xbf, 0x9f, 0x72, 0xce, 0xf8, 0xf7, 0xd3, 0x02, 0x5a, 0x56, 0x91, 0x39, 0xd5, 
+    0x40, 0x1a, 0xc6, 0xd0, 0x0e, 0x42, 0x21, 0x00, 0x38, 0xdc, 0xaf, 0xec, 0x20, 0x5c, 0x5c, 0x9d, 
+    0x28, 0x5e, 0x24, 0xf5, 0x89, 0x86, 0x1b, 0xa7, 0xda, 0xd0, 0x9b, 0x92, 0xe9, 0x62, 0xaa, 0x5a, 
+    0x11, 0xf9, 0x4f, 0x96, 0x56, 0x2a, 0xfc, 0xbe, 0x2e, 0xa1, 0x52, 0xde, 0x0d, 0xc9, 0x81, 0x2a, 
+    0xb2, 0xa5, 0x2c, 0x30, 0xd7, 0xf3, 0x69, 0x95, 0x4e, 0xe6, 0x33, 0x4c, 0xd5, 0x86, 0x99, 0x36, 
+    0x0b, 0x6c, 0x21, 0x03, 0x80, 0x13, 0x32, 0xef, 0xec, 0xcf, 0x8e, 0x29, 0xdd, 0xef, 0xfc, 0xb3, 
+    0xbf, 0x38, 0xcb, 0xfb, 0xe2, 0xe2, 0x39, 0x6f, 0x9e, 0x30, 0x4f, 0x2a, 0x95, 0x97, 0xfb, 0x13, 
+    0x48, 0xeb, 0x38, 0xae, 0xad, 0x93, 0xc6, 0x7f, 0x5b, 0xad, 0x16, 0x18, 0xda, 0x3b, 0x99, 0xd2, 
+    0xb7, 0x61, 0xb7, 0x00, 0x7f, 0xec, 0xae, 0xbe, 0x76, 0x05, 0x93, 0xd4, 0xc1, 0x45, 0x0f, 0x55, 
+    0xa1, 0x65, 0xfb, 0x5a, 0x72, 0xc4, 0xbe, 0x42, 0x4d, 0xe6, 0x33, 0xaa, 0x3f, 0x60, 0xb8, 0x55, 
+    0x48, 0xf7, 0x7c, 0xb7, 0x59, 0x9b, 0x33, 0x9a, 0x75, 0x9c, 0x90, 0x61, 0x26, 0xb4, 0xea, 0x66, 
+    0x83, 0xf6, 0xe0, 0xb8, 0xb3, 0x17, 0x00, 0xbc, 0x81, 0x3c, 0xf9, 0x5d, 0x62, 0x17, 0xbe, 0x07, 
+    0x33, 0x70, 0x10, 0x38, 0x30, 0x19, 0x43, 0xfb, 0x39, 0x22, 0xdc, 0x93, 0x0b, 0x46, 0x43, 0xf4, 
+    0x2e, 0xdb, 0xed, 0xf4, 0xa3, 0x9d, 0xbc, 0xd9, 0x46, 0x26, 0xb7, 0x78, 0x9e, 0x31, 0x4a, 0x87, 
+    0x1a, 0xbf, 0xbd, 0x21, 0xe1, 0x7c, 0x26, 0x9f, 0x65, 0xbf, 0x9b, 0x44, 0xaa, 0xe9, 0x07, 0x79, 
+    0xcf, 0x40, 0x2d, 0x7e, 0xcf, 0x00, 0x7f, 0x90, 0x92, 0xd9, 0x38, 0x2d, 0x55, 0x6b, 0x26, 0x41, 
+    0x3e, 0x72, 0x3a, 0x3d, 0x05, 0xd5, 0xc4, 0xe4, 0xb8, 0x0d, 0x5d, 0x41, 0xa5, 0xf2, 0x64, 0xca, 
+    0xbe, 0xf9, 0x23, 0x69, 0x31, 0x95, 0xbb, 0x68, 0x59, 0x53, 0x46, 0x10, 0x6a, 0x6a, 0x9e, 0x11, 
+    0x8d, 0x6f, 0x12, 0x4e, 0x74, 0xa2, 0xc9, 0x5c, 0x1b, 0x62, 0xdc, 0xcf, 0xd4, 0x3c, 0x41, 0xcb, 
+    0x77, 0x86, 0xb0, 0xc2, 0x2b, 0x97, 0xf9, 0xa4, 0x08, 0x26, 0x91, 0x0f, 0xa8, 0x56, 0x5c, 0x9b, 
+    0x22, 0x13, 0x49, 0x7d, 0x9d, 0x62, 0x42, 0x39, 0xb6, 0xc3, 0x3e, 0x7f, 0xd9, 0xa6, 0xe7, 0xd2, 
+    0xcb, 0xa5, 0x3f, 0x53, 0xeb, 0x20, 0xe3, 0xa1, 0x66, 0x61, 0xe9, 0xcf, 0x85, 0x12, 0xa5, 0x0a, 
+    0x77, 0xd8, 0x60, 0xe4, 0xba, 0xdb, 0x8c, 0x01, 0x05, 0x72, 0x7a, 0xe6, 0xdb, 0x90, 0x23, 0xbe, 
+    0x6b, 0x42, 0x83, 0x80, 0xa6, 0x1e, 0x2a, 0x4b, 0x4c, 0x30, 0x50, 0x32, 0x2a, 0xcb, 0x35, 0x80, 
+    0x08, 0x78, 0xc7, 0x6d, 0x56, 0x41, 0x01, 0xe5, 0x1a, 0x11, 0xe9, 0x5c, 0x76, 0x58, 0x65, 0x5b, 
+    0x7f, 0x1c, 0x4b, 0x42, 0x77, 0xda, 0xbe, 0x8b, 0x40, 0xc4, 0x9e, 0x85, 0x4e, 0x23, 0x3d, 0xa7, 
+    0x28, 0x9f, 0xc4, 0x53, 0x67, 0xe0, 0x84, 0x07, 0xc2, 0xcf, 0x0e, 0x2f, 0x3a, 0x60, 0xb4, 0xd8, 
+    0xbc, 0x4d, 0xc7, 0x2e, 0x4f, 0x79, 0x86, 0xc3, 0x03, 0x5d, 0x67, 0xb6, 0xe5, 0xbb, 0x63, 0xa6, 
+    0x2e, 0x53, 0x94, 0x87, 0xb1, 0x11, 0x01, 0x61, 0x1a, 0x78, 0xb7, 0x97, 0xfc, 0x22, 0x1f, 0xc0, 
+    0x53, 0xac, 0x62, 0xeb, 0x18, 0x6f, 0xa1, 0xba, 0x3a, 0x89, 0x92, 0xe3, 0x8a, 0x30, 0xff, 0xb6, 
+    0xd8, 0x19, 0xe5, 0x0d, 0xcc, 0x61, 0x08, 0x08, 0x13, 0x46, 0x47, 0x7e, 0x05, 0x7b, 0xf5, 0xa8, 
+    0x0d, 0xfa, 0x04, 0x43, 0x24, 0xf0, 0xd6, 0xa9, 0xd6, 0x35, 0xe0, 0xa5, 0x6a, 0xf0, 0x0a, 0x1a, 
+    0xf8, 0x8e, 0x5d, 0xab, 0xba, 0x00, 0xa0, 0xef, 0x55, 0x9f, 0xb7, 0xef, 0x0a, 0xa4, 0x34, 0x0b, 
+    0xc4, 0xcc, 0x53, 0xcc, 0x70, 0xfc, 0xc0, 0x6e, 0x29, 0x25, 0x0c, 0x2f, 0x5a, 0xa0, 0x52, 0xfc, 
+    0x11, 0xdf, 0x88, 0x22, 0xc4, 0xdc, 0xd9, 0x8f, 0xb1, 0xe9, 0x68, 0x97, 0x68, 0xa8, 0x0f, 0xed, 
+    0x26, 0xc8, 0x08, 0xd0, 0x8a, 0x89, 0x87, 0x7c, 0xda, 0x1c, 0x71, 0xcd, 0x24, 0xd1, 0x2b, 0x2b, 
+    0x68, 0x11, 0xa2, 0xdc, 0x51, 0x62, 0xc9, 0x1d, 0x50, 0x89, 0xad, 0x11, 0x06, 0xcd, 0x96, 0xc0, 
+    0xf6, 0x3b, 0xe2, 0xf1, 0xb3, 0xfb, 0xe3, 0xd3, 0x76, 0x2e, 0x2b, 0x74, 0x4d, 0x36, 0xbf, 0x2d, 
+    0x8b, 0x84, 0xd8, 0x75, 0xbc, 0x20, 0x42, 0x63, 0x3c, 0x02, 0xa8, 0xac, 0x5c, 0xb6, 0xd6, 0x46, 
+    0x20, 0x01, 0x75, 0x7a, 0xf0, 0xfa, 0xfc, 0x12, 0xe0, 0xee, 0x57, 0x98, 0xaa, 0x7b, 0x8b, 0x65, 
+    0xff, 0xfb, 0x7f, 0xfc, 0xbf, 0xfe, 0x8f, 0x6c, 0x01, 0x9e, 0x29, 0x21, 0xde, 0x22, 0x10, 0xc6, 
+    0x2a, 0xf4, 0xf6, 0xdf, 0xfe, 0xeb, 0x6c, 0x01, 0x5b, 0x20, 0x3d, 0x65, 0xf4, 0xaa, 0x4a, 0xaf, 
+    0xfe, 0xcf, 0x7f, 0xe0, 0xaf, 0xb8, 0x43, 0x92, 0x5e, 0xd4, 0x78, 0x99, 0xff, 0x8d, 0xbf, 0x50, 
+    0x7e, 0x48, 0x7a, 0x57, 0x87, 0x77, 0xff, 0xf8, 0x1f, 0xfe, 0xdf, 0xff, 0xf6, 0x9f, 0xff, 0x1d, 
+    0x7f, 0xab, 0x1c, 0x90, 0xf4, 0x76, 0x8d, 0x97, 0xfc, 0xdf, 0xf9, 0x3b, 0xe5, 0x71, 0xa4, 0x77, 
+    0x0d, 0x4e, 0xe7, 0xbf, 0xc9, 0x72, 0x51, 0xa0, 0x81, 0x05, 0x2f, 0x1e, 0x88, 0x6c, 0x91, 0x5d, 
+    0x0c, 0x01, 0xfe, 0x03, 0x35, 0x44, 0x0c, 0x30, 0xac, 0xed, 0xef, 0xff, 0x13, 0xd5, 0x06, 0x0f, 
+    0x69, 0xe4, 0x10, 0xd4, 0xdf, 0xff, 0x17, 0x7c, 0xb6, 0xf2, 0xa0, 0x18, 0x73, 0xf4, 0xfe, 0xe8, 
+    0xfc, 0xea, 0xaf, 0xe7, 0x7b, 0x67, 0x47, 0xc8, 0x9e, 0xcf, 0x59, 0xd9, 0x52, 0xa0, 0x24, 0xcb, 
+    0x9b, 0x86, 0xdf, 0x54, 0x5b, 0xf0, 0x87, 0x22, 0xfd, 0x2f, 0xd9, 0x00, 0x7f, 0x2b, 0x72, 0xe9, 
+    0x07, 0x5f, 0xb6, 0x7d, 0x91, 0xdd, 0x73, 0xf6, 0xfa, 0xfc, 0xea, 0x44, 0xc3, 0xff, 0xc2, 0x02, 
+    0x1c, 0xd9, 0x63, 0xbb, 0x09, 0x7f, 0xcf, 0x2c, 0x40, 0x9e, 0xdd, 0x1b, 0xfa, 0xf4, 0x1d, 0xaa, 
+    0xcc, 0xbe, 0x18, 0x0d, 0xe8, 0xaf, 0x8b, 0xcf, 0x47, 0x5d, 0xf8, 0x7b, 0x69, 0x0f, 0xe1, 0xef, 
+    0xeb, 0x56, 0x08, 0x7f, 0xcf, 0xbd, 0x1b, 0xf8, 0x7b, 0x68, 0xb7, 0x10, 0x3d, 0x4a, 0xf8, 0x95, 
+    0xd5, 0x14, 0x57, 0x8a, 0xa0, 0x0c, 0x2a, 0x99, 0xf9, 0x6d, 0x64, 0xfb, 0xe3, 0x4b, 0x91, 0xe6, 
+    0x61, 0xcf, 0x05, 0x05, 0x8c, 0x77, 0xa0, 0x65, 0xf3, 0x78, 0xbf, 0xdd, 0x91, 0xd5, 0xea, 0xe5, 
+    0x30, 0xcb, 0xe3, 0xce, 0x2e, 0xf5, 0x34, 0xde, 0xb3, 0x26, 0x34, 0x2a, 0xd0, 0x97, 0xcb, 0xcb, 
+    0xe7, 0x8c, 0x2d, 0x80, 0x0e, 0x0b, 0x85, 0x25, 0x52, 0xe2, 0xaf, 0x80, 0x15, 0x25, 0x7e, 0x87, 
+    0x52, 0x2e, 0xcb, 0x53, 0x49, 0x64, 0xf3, 0x20, 0x87, 0x73, 0x60, 0x94, 0x56, 0x9d, 0x86, 0xb9, 
+    0x85, 0x98, 0x5b, 0xb3, 0x31, 0x63, 0x2b, 0x22, 0x20, 0x18, 0x93, 0x11, 0x44, 0xac, 0xea, 0xd8, 
+    0x78, 0xc2, 0x82, 0x38, 0xca, 0x03, 0x3b, 0x44, 0x12, 0xf2, 0xd3, 0xb0, 0x80, 0xd0, 0x3c, 0xe4, 
+    0x39, 0xe3, 0xa3, 0xb4, 0x3a, 0x8c, 0x27, 0x2e, 0x5a, 0x99, 0x38, 0x60, 0xa3, 0xb4, 0x38, 0xd0, 
+    0x2e, 0x6f, 0xc0, 0x6d, 0xb2, 0x1d, 0x66, 0x4b, 0x46, 0xcf, 0x51, 0x10, 0xf7, 0xd6, 0xa1, 0x30, 
+    0x0e, 0xeb, 0x03, 0x91, 0xa4, 0x12, 0x10, 0x94, 0xf8, 0xca, 0xb0, 0x44, 0x8e, 0x43, 0xb6, 0xca, 
+    0xb2, 0x3f, 0x67, 0xb7, 0x49, 0xb0, 0x81, 0x3e, 0x9e, 0xfc, 0xa7, 0x39, 0x3f, 0x95, 0xf1, 0x14, 
+    0x3e, 0x0b, 0xd2, 0x9a, 0x96, 0x01, 0x68, 0x19, 0x8a, 0xb9, 0xb6, 0xe6, 0xf7, 0x99, 0x14, 0x29, 
+    0x37, 0x56, 0xb9, 0x87, 0x47, 0x06, 0x64, 0x68, 0xd6, 0xac, 0x06, 0xe8, 0x79, 0xa6, 0xa8, 0x09, 
+    0xdc, 0x94, 0xc5, 0x79, 0x09, 0x14, 0x30, 0xdf, 0x83, 0x9a, 0xa7, 0x25, 0x46, 0x7e, 0x29, 0x40, 
+    0x44, 0x16, 0x57, 0x49, 0x66, 0x1f, 0xda, 0x81, 0xf9, 0xc7, 0x09, 0x4a, 0x22, 0x2d, 0x19, 0xfb, 
+    0x85, 0x65, 0x29, 0x9f, 0x7d, 0x96, 0x81, 0x8a, 0x41, 0x1b, 0x32, 0x6a, 0xd5, 0x29, 0xcc, 0x6d, 
+    0xb0, 0x8c, 0x07, 0x1b, 0x4d, 0xe4, 0x2a, 0xe2, 0x0d, 0xc4, 0xe3, 0x4b, 0x72, 0x83, 0x39, 0x58, 
+    0x91, 0xa4, 0xd1, 0x4c, 0x48, 0x7c, 0xc0, 0x58, 0x3e, 0x3e, 0x3c, 0x02, 0x41, 0x2f, 0x57, 0x26, 
+    0x94, 0x71, 0x0a, 0x5e, 0x4c, 0x9b, 0x20, 0xb4, 0xdc, 0x54, 0x5c, 0x6c, 0x79, 0x51, 0x98, 0x75, 
+    0xe7, 0x2a, 0x08, 0x70, 0xbc, 0x18, 0x50, 0x8f, 0x6b, 0xb9, 0x40, 0x64, 0x55, 0x0a, 0x8c, 0xac, 
+    0x4a, 0x38, 0x8b, 0xf0, 0x5f, 0x38, 0x59, 0x65, 0x63, 0x3e, 0xf5, 0x62, 0x35, 0xb3, 0xcb, 0xb3, 
+    0x30, 0x4d, 0xf2, 0xba, 0x17, 0x6b, 0x04, 0x81, 0x98, 0x15, 0x48, 0x56, 0xab, 0x15, 0x53, 0x3a, 
+    0x69, 0x75, 0xe1, 0x8c, 0x99, 0xc3, 0x0a, 0x7b, 0x64, 0xa5, 0xc0, 0xc7, 0x33, 0x58, 0x28, 0xc0, 
+    0xe7, 0xea, 0x6a, 0x5e, 0x68, 0x2b, 0xde, 0x4a, 0x58, 0xfc, 0xe3, 0xa4, 0x8e, 0xef, 0xab, 0x35, 
+    0xec, 0x98, 0xbd, 0x33, 0xea, 0x95, 0x8b, 0xb3, 0xec, 0xb6, 0x06, 0x86, 0xe8, 0xe1, 0x3d, 0x02, 
+    0xee, 0xec, 0x00, 0x46, 0x80, 0x84, 0x9f, 0x5b, 0x2c, 0xd7, 0x63, 0xbb, 0xbc, 0x60, 0x0f, 0xc4, 
+    0x8f, 0x1e, 0xf5, 0x84, 0x02, 0xa1, 0xa6, 0xae, 0x26, 0xdb, 0x9a, 0x05, 0x39, 0xee, 0xa1, 0x2c, 
+    0x67, 0x76, 0xe9, 0x2b, 0xc7, 0x0c, 0xbf, 0xb7, 0x2a, 0x15, 0x86, 0x4f, 0x88, 0x24, 0xf8, 0x6d, 
+    0xb6, 0xf3, 0x01, 0xfe, 0xc9, 0xde, 0x2c, 0x39, 0x60, 0xb3, 0xf8, 0x27, 0x57, 0x67, 0xaf, 0x80, 
+    0x22, 0xac, 0x07, 0x01, 0x78, 0x7f, 0xa5, 0xbe, 0x02, 0x1e, 0x5d, 0xda, 0x18, 0x36, 0xdb, 0xb1, 
+    0x30, 0x72, 0x41, 0xc7, 0xc4, 0x47, 0x16, 0x50, 0x59, 0xab, 0x65, 0xb9, 0x11, 0x56, 0xad, 0xb0, 
+    0x8b, 0xb3, 0x08, 0x9f, 0x02, 0xd8, 0xc8, 0x6e, 0x4b, 0xeb, 0x6a, 0x83, 0xed, 0x9d, 0xad, 0x3c, 
+    0xac, 0xa4, 0x4b, 0x9f, 0xd0, 0x77, 0xe8, 0x6d, 0xc6, 0x95, 0x2f, 0xe8, 0x43, 0x0a, 0x5c, 0xa0, 
+    0xac, 0xa2, 0xd4, 0x2f, 0x03, 0xfb, 0x56, 0x4c, 0xc3, 0xc2, 0x14, 0x9b, 0x32, 0x46, 0x75, 0x27, 
+    0xf4, 0xa2, 0x1a, 0xc6, 0xf0, 0x16, 0xcf, 0xd0, 0x2d, 0x25, 0xbe, 0xda, 0x56, 0xc3, 0x90, 0xdf, 
+    0x8f, 0x47, 0x57, 0x3e, 0xe2, 0x44, 0xa9, 0x06, 0x5c, 0x94, 0x5e, 0x15, 0xed, 0x3d, 0x2e, 0x4a, 
+    0x13, 0xcc, 0x43, 0x1e, 0x2d, 0x0a, 0xd6, 0x2c, 0x4c, 0x0b, 0x34, 0x8a, 0x01, 0x94, 0xef, 0xed, 
+    0x12, 0x02, 0xe4, 0x59, 0x8e, 0x1b, 0x8d, 0x64, 0x01, 0x93, 0xd4, 0x4c, 0x6c, 0x0c, 0x5f, 0x56, 
+    0xa1, 0x74, 0x50, 0xbd, 0xd3, 0x26, 0x1d, 0xa7, 0xc3, 0x08, 0x2f, 0x09, 0xaa, 0xbe, 0x71, 0xc3, 
+    0x26, 0xec, 0x2c, 0x43, 0xa3, 0x57, 0xa2, 0x16, 0x6a, 0xab, 0xb0, 0xa8, 0x89, 0x4b, 0xd0, 0x15, 
+    0x9f, 0x77, 0xb7, 0x67, 0x71, 0xca, 0x96, 0xc6, 0x37, 0x17, 0x58, 0x9e, 0xdf, 0xa7, 0x43, 0x34, 
+    0x26, 0x5a, 0x15, 0xc5, 0x1f, 0xc4, 0x4d, 0x8f, 0x38, 0x81, 0x51, 0xdc, 0x0e, 0x48, 0x80, 0x92, 
+    0xe5, 0xec, 0xf6, 0xbc, 0xa5, 0x64, 0xb4, 0x4f, 0x76, 0x56, 0xdb, 0x16, 0xc5, 0xa6, 0x8f, 0xd3, 
+    0x99, 0xf4, 0xe8, 0x91, 0x38, 0x8b, 0xb4, 0x43, 0x0b, 0x97, 0x59, 0xaa, 0x18, 0x72, 0x38, 0x56, 
+    0xec, 0x81, 0xd9, 0x20, 0xad, 0x53, 0xa4, 0xec, 0x7e, 0x36, 0x6e, 0x11, 0xf5, 0xa0, 0xe3, 0xae, 
+    0xcc, 0x43, 0x93, 0xdc, 0xb0, 0x5f, 0xb4, 0x2d, 0x72, 0xf3, 0x5c, 0x2f, 0x57, 0x9d, 0xb3, 0x20, 
+    0x5a, 0xf6, 0x89, 0x62, 0xe9, 0x4c, 0x10, 0xfb, 0x2f, 0x73, 0x71, 0x20, 0xda, 0xea, 0x5b, 0xb8, 
+    0x31, 0x9a, 0x3e, 0x5c, 0xbc, 0x20, 0xdf, 0xbc, 0x5a, 0xb4, 0xe8, 0x14, 0x3d, 0x2a, 0x7a, 0x2e, 
+    0x95, 0x23, 0xc2, 0x8b, 0x33, 0x8b, 0x21, 0x91, 0x7f, 0x71, 0x11, 0xba, 0x74, 0x87, 0xe9, 0xe2, 
+    0xe5, 0x74, 0xb7, 0x5e, 0x8a, 0xb9, 0x26, 0xad, 0xb2, 0x39, 0x30, 0x71, 0x67, 0xd8, 0xa2, 0x23, 
+    0xda, 0xf4, 0x51, 0x41, 0x69, 0xe9, 0x8c, 0x42, 0x5b, 0xd1, 0x1f, 0xd9, 0x7c, 0xca, 0xd7, 0x15, 
+    0xf3, 0x04, 0xed, 0xad, 0x19, 0x7b, 0x9c, 0xf1, 0x6c, 0x68, 0xf9, 0x81, 0x7d, 0x3a, 0x08, 0x73, 
+    0x8b, 0x8c, 0x41, 0xcd, 0xf0, 0xa3, 0x21, 0xf6, 0x9c, 0xae, 0xb6, 0x9f, 0x62, 0xfc, 0x99, 0xd1, 
+    0x37, 0xba, 0xe1, 0x88, 0x64, 0xce, 0x53, 0x3c, 0x8a, 0x8e, 0x21, 0xb7, 0x03, 0x37, 0x53, 0x94, 
+    0x01, 0x4f, 0xc8, 0x59, 0x13, 0xd6, 0x59, 0xe4, 0xcd, 0x45, 0x5a, 0xe3, 0xd3, 0x40, 0x85, 0xfd, 
+    0xdd, 0xdf, 0x31, 0xf5, 0xab, 0x01, 0xac, 0xd0, 0x3d, 0x0f, 0x0c, 0x23, 0x4a, 0xe5, 0xda, 0x9f, 
+    0x69, 0xad, 0x4a, 0x76, 0x36, 0x37, 0xc6, 0x35, 0x31, 0xbe, 0x9f, 0x59, 0x44, 0xc9, 0xc7, 0x43, 
+    0x82, 0x72, 0x6c, 0x97, 0x49, 0x38, 0xcb, 0x71, 0xc7, 0x00, 0xa3, 0xf3, 0x20, 0x6e, 0x6b, 0x84, 
+    0xd7, 0x28, 0xb6, 0xf3, 0xf1, 0xf6, 0x54, 0x45, 0x0b, 0x34, 0x07, 0x89, 0xe2, 0xe5, 0x34, 0x0a, 
+    0x52, 0x86, 0x5e, 0x4d, 0xa0, 0x52, 0x6e, 0x08, 0xb0, 0x4e, 0x5f, 0xb7, 0x42, 0x56, 0xaf, 0xfe, 
+    0x10, 0xda, 0xba, 0x40, 0xab, 0x1c, 0x1a, 0x80, 0xf6, 0xd8, 0x6e, 0xb2, 0xea, 0xda, 0x0f, 0xa1, 
+    0x5d, 0x13, 0x68, 0x95, 0x5f, 0x04, 0xd0, 0x1e, 0xda, 0x2d, 0x56, 0x6b, 0x2c, 0x8a, 0xf6, 0x7e, 
+    0x56, 0x01, 0xbc, 0xb6, 0x25, 0xab, 0x06, 0x17, 0x19, 0x1f, 0xe8, 0x5d, 0x54, 0xfe, 0x5b, 0x86, 
+    0x37, 0x26, 0x44, 0x83, 0x8e, 0xfb, 0x1e, 0xa3, 0xb4, 0xec, 0xda, 0x68, 0x43, 0xc0, 0xa9, 0x12, 
+    0xae, 0xdf, 0xc1, 0xc0, 0xc7, 0x07, 0x7e, 0x4b, 0xa8, 0x09, 0xb1, 0x32, 0x02, 0x11, 0xa4, 0xb1, 
+    0x8d, 0xeb, 0x95, 0x02, 0x6b, 0xb5, 0xf5, 0x1f, 0x20, 0xc5, 0xda, 0xcf, 0xb1, 0xfe, 0xc3, 0xe9, 
+    0x77, 0xd5, 0x2f, 0xc2, 0x65, 0x38, 0xa2, 0x95, 0x5b, 0x24, 0x87, 0x7e, 0x50, 0x80, 0x6e, 0xdf, 
+    0x69, 0xfe, 0x1a, 0x31, 0x5c, 0x9d, 0x1b, 0xbd, 0x19, 0x2d, 0x0c, 0x56, 0xb0, 0x45, 0x4b, 0x72, 
+    0x59, 0x78, 0xab, 0xec, 0x1b, 0xe7, 0x86, 0xdb, 0x40, 0x18, 0x3b, 0x8c, 0xc4, 0x1b, 0x97, 0x61, 
+    0xa3, 0x0d, 0x98, 0x73, 0xd0, 0x2b, 0x0c, 0x1d, 0xaa, 0x39, 0x66, 0x61, 0x49, 0xc5, 0xb4, 0x1b, 
+    0xd7, 0x69, 0x71, 0xa5, 0x63, 0xa4, 0x7b, 0xdc, 0x69, 0xc3, 0x39, 0x52, 0x7c, 0xe2, 0x8d, 0xf0, 
+    0xb2, 0xd0, 0x8d, 0x71, 0xf0, 0x16, 0x90, 0x53, 0x0b, 0x39, 0xbf, 0xf0, 0x5a, 0xf5, 0x02, 0x1f, 
+    0xa2, 0x05, 0x86, 0x19, 0x51, 0x79, 0x41, 0x94, 0x2b, 0xba, 0xe5, 0x3d, 0xd2, 0x12, 0x42, 0xb8, 
+    0xa4, 0xe7, 0x7a, 0x85, 0x3b, 0x89, 0x45, 0x27, 0x7a, 0x2d, 0xc0, 0xac, 0x9c, 0xf4, 0x9f, 0xf9, 
+    0xd5, 0xf2, 0xd2, 0x89, 0xfb, 0x05, 0x15, 0xcc, 0xfd, 0xc3, 0xb6, 0x28, 0x82, 0x55, 0x02, 0x34, 
+    0x79, 0x46, 0x4b, 0xb2, 0x8c, 0x7c, 0xc9, 0xf5, 0x15, 0xe1, 0x2a, 0x51, 0x9c, 0x39, 0x14, 0xcd, 
+    0xaa, 0x70, 0x6b, 0xce, 0x1d, 0x03, 0x39, 0x3c, 0xa9, 0xe6, 0x65, 0x69, 0x6c, 0x00, 0x14, 0xfe, 
+    0xfa, 0xca, 0x0a, 0xb7, 0xd8, 0x4f, 0xf7, 0x88, 0x04, 0x74, 0xc4, 0x2f, 0xa5, 0xd0, 0x3b, 0xc6, 
+    0xcb, 0xb7, 0x73, 0x30, 0x42, 0x10, 0xdf, 0x2f, 0xd9, 0x87, 0x02, 0x34, 0x64, 0xa0, 0x60, 0xbc, 
+    0x41, 0x1a, 0xcc, 0x57, 0x89, 0x56, 0x0a, 0xd5, 0xea, 0x2a, 0x7f, 0xa2, 0x0d, 0x3e, 0x93, 0x49, 
+    0x52, 0xf5, 0xa8, 0xe9, 0xc5, 0xe0, 0x52, 0x0b, 0x67, 0xa5, 0x68, 0xd7, 0x62, 0x01, 0x2e, 0xa9, 
+    0x42, 0x9f, 0x5b, 0x6d, 0xaa, 0x8d, 0x80, 0xb9, 0x77, 0x36, 0xce, 0x39, 0x84, 0xa0, 0xaf, 0x00, 
+    0xa1, 0x39, 0x59, 0xcd, 0x92, 0x8a, 0x40, 0x55, 0x1c, 0x1b, 0x23, 0x40, 0x54, 0x53, 0xc4, 0x2b, 
+    0xc5, 0x57, 0xe1, 0x98, 0x05, 0xc0, 0x48, 0xfb, 0x2a, 0x04, 0x86, 0xea, 0xd0, 0x0a, 0x69, 0x8e, 
+    0xd8, 0xcf, 0x58, 0x03, 0x99, 0x90, 0x48, 0x04, 0xd4, 0x00, 0x6b, 0xfd, 0x2f, 0xb8, 0x46, 0xe7, 
+    0x1d, 0x0b, 0x2f, 0x71, 0xc2, 0xa1, 0x57, 0x0a, 0xab, 0xe4, 0x60, 0x7b, 0xbe, 0x1e, 0x90, 0x1a, 
+    0x5b, 0x9b, 0xb2, 0x14, 0xfb, 0x47, 0xa4, 0x69, 0x8c, 0x1d, 0xa2, 0x45, 0xfa, 0x80, 0xca, 0x25, 
+    0xb8, 0x0d, 0x4f, 0x4b, 0xdc, 0x7a, 0xe2, 0x8c, 0xe5, 0x2b, 0x72, 0x8e, 0x3e, 0x1b, 0x93, 0xcb, 
+    0x1c, 0x41, 0xa3, 0x15, 0x48, 0xb0, 0x68, 0x30, 0x8d, 0x9a, 0x41, 0x88, 0xbb, 0x31, 0x39, 0x50, 
+    0x42, 0x6b, 0x30, 0xc6, 0x56, 0x35, 0xa0, 0x5f, 0xc4, 0x72, 0x9a, 0xed, 0xc2, 0x2b, 0xd4, 0x00, 
+    0xa5, 0x52, 0xc9, 0x18, 0xf8, 0x2c, 0xd2, 0x69, 0x33, 0x19, 0x23, 0xe7, 0x1c, 0xb1, 0xe1, 0x95, 
+    0xd6, 0x42, 0xe1, 0xc2, 0x8f, 0x37, 0x51, 0xdb, 0x3a, 0xfb, 0xa5, 0x24, 0x36, 0x7a, 0xce, 0xc5, 
+    0xd0, 0x4c, 0x7b, 0xc7, 0x23, 0x55, 0xa8, 0x85, 0xa2, 0xb2, 0x38, 0x1f, 0x8c, 0x52, 0xb4, 0xd9, 
+    0x0d, 0xad, 0xfb, 0xfa, 0xd3, 0x3d, 0xee, 0xb8, 0x5b, 0xe1, 0x39, 0x45, 0x6e, 0xe6, 0x34, 0x20, 
+    0x62, 0x53, 0xcb, 0x77, 0xe0, 0x71, 0x90, 0x7f, 0x60, 0xda, 0xaf, 0xaf, 0xc8, 0x0e, 0x19, 0x22, 
+    0x43, 0x3b, 0x76, 0xaa, 0xae, 0xf1, 0x9c, 0x8c, 0x91, 0xb3, 0x26, 0xed, 0xe6, 0x19, 0x02, 0x83, 
+    0x9b, 0xcd, 0x3b, 0xc6, 0xee, 0xdf, 0x02, 0xe2, 0x42, 0xc5, 0xe2, 0xac, 0x04, 0x8c, 0x9a, 0xb0, 
+    0xe4, 0xf0, 0x27, 0xda, 0xeb, 0xa4, 0xe8, 0x7e, 0x61, 0xfa, 0xcf, 0x12, 0x4c, 0xb5, 0x0e, 0x4c, 
+    0x1c, 0x65, 0x10, 0x92, 0xa1, 0x37, 0x84, 0x29, 0x13, 0x1a, 0xca, 0x37, 0x1c, 0x27, 0x29, 0xc1, 
+    0xb8, 0x16, 0x44, 0x74, 0xb8, 0x4b, 0x0d, 0x98, 0x39, 0x63, 0xf7, 0xc7, 0xa1, 0x1d, 0xe4, 0xe4, 
+    0x63, 0xc4, 0x48, 0x3f, 0x64, 0x07, 0x64, 0xf9, 0xfe, 0xad, 0xdd, 0x26, 0x19, 0x3b, 0xf7, 0x42, 
+    0x28, 0x36, 0x92, 0x5e, 0x49, 0x6a, 0x9f, 0x98, 0x24, 0x15, 0x4b, 0x57, 0xd4, 0x24, 0xa3, 0xcf, 
+    0xc6, 0x5f, 0x05, 0xb8, 0x71, 0x2e, 0x0e, 0xe7, 0xa7, 0x22, 0x39, 0x82, 0xec, 0xcc, 0xee, 0x3f, 
+    0xfe, 0xfb, 0x7f, 0x90, 0x19, 0xea, 0x53, 0x40, 0xb1, 0x69, 0x45, 0xe4, 0x65, 0x66, 0xf7, 0xa7, 
+    0x7b, 0xfc, 0x7c, 0x88, 0x01, 0xeb, 0xa7, 0xf0, 0x08, 0x96, 0x52, 0x0d, 0x28, 0xbd, 0x93, 0x78, 
+    0x2f, 0xc2, 0x52, 0x7e, 0xba, 0x07, 0xbe, 0x58, 0x43, 0xfb, 0x24, 0xec, 0xbb, 0x39, 0x7a, 0x96, 
+    0x7f, 0x10, 0x9b, 0xd2, 0x13, 0x8b, 0xf2, 0x1c, 0xe1, 0x46, 0x49, 0x7c, 0x14, 0x2b, 0x68, 0xfe, 
+    0x30, 0xb7, 0xd6, 0x09, 0x0d, 0x3a, 0x65, 0xb4, 0x0d, 0x74, 0xfc, 0x79, 0xa0, 0x19, 0x18, 0x39, 
+    0x68, 0x67, 0xfb, 0xee, 0x21, 0x0f, 0x9c, 0xf9, 0x7f, 0xfe, 0x6d, 0xb4, 0x7f, 0x3e, 0x19, 0x1f, 
+    0xf7, 0x9c, 0x18, 0x89, 0x0a, 0xf0, 0x41, 0x3a, 0xce, 0xff, 0xef, 0xff, 0x36, 0x51, 0x7e, 0x15, 
+    0xd3, 0x3f, 0x6e, 0x90, 0xe2, 0xe5, 0x58, 0xb4, 0x49, 0x1c, 0xa8, 0xae, 0xf4, 0x06, 0xd8, 0x57, 
+    0xe4, 0xd9, 0xd4, 0x1d, 0x84, 0xf8, 0x9f, 0x4d, 0x12, 0x77, 0x45, 0x77, 0x99, 0xdb, 0x7e, 0x09, 
+    0xac, 0x0a, 0x1c, 0x9d, 0xb9, 0x2c, 0x2e, 0x65, 0xcb, 0x60, 0x1a, 0x3a, 0xb8, 0x4d, 0x87, 0xc6, 
+    0x91, 0x92, 0x44, 0x69, 0xeb, 0x44, 0x3e, 0x36, 0x32, 0x54, 0xd0, 0x82, 0x11, 0x40, 0x0f, 0xdb, 
+    0xb1, 0x9a, 0xc1, 0x54, 0x54, 0x1b, 0x62, 0x66, 0x79, 0xe9, 0x2f, 0x8a, 0xa3, 0x88, 0xca, 0xe2, 
+    0x11, 0x7e, 0x49, 0xb4, 0x5d, 0x12, 0xfb, 0xdf, 0x87, 0xdc, 0x5f, 0x9b, 0x8b, 0x41, 0x7b, 0xc3, 
+    0x64, 0xf3, 0xd2, 0x4b, 0x48, 0x7d, 0x80, 0x21, 0x85, 0x7c, 0xc3, 0x5e, 0xad, 0x0d, 0x63, 0x1c, 
+    0xe9, 0xa6, 0x70, 0x24, 0x1f, 0xc3, 0x12, 0x7a, 0x1c, 0x07, 0xd9, 0x61, 0xd1, 0xdc, 0x2b, 0x91, 
+    0x3f, 0x01, 0x95, 0x44, 0x20, 0xfa, 0xfc, 0x2b, 0xf4, 0x11, 0x77, 0xf8, 0x99, 0xa6, 0x29, 0xea, 
+    0x89, 0x96, 0x2d, 0x8b, 0x17, 0x40, 0x0f, 0x7c, 0xae, 0x7c, 0xd9, 0x8e, 0x4a, 0xa6, 0x01, 0x13, 
+    0xfe, 0x02, 0xd9, 0xbd, 0xf0, 0x38, 0x1f, 0x41, 0xc7, 0xed, 0x74, 0x73, 0x16, 0x7e, 0x90, 0x76, 
+    0x23, 0x75, 0xe6, 0x70, 0x08, 0xc0, 0x07, 0x78, 0xb1, 0x6f, 0x0e, 0x58, 0xca, 0x37, 0xea, 0xf8, 
+    0x02, 0x74, 0xaa, 0x07, 0x2f, 0xdd, 0xfd, 0x21, 0x2d, 0xac, 0xa9, 0xde, 0x5b, 0x79, 0xe9, 0x55, 
+    0xa2, 0xb4, 0x30, 0x0e, 0xa6, 0x17, 0x56, 0xb7, 0x5f, 0x25, 0x8b, 0xcb, 0x49, 0x74, 0x2a, 0x82, 
+    0xf1, 0xa4, 0xe2, 0xe3, 0x39, 0x0a, 0xab, 0x0b, 0xb1, 0x12, 0xa5, 0xa5, 0x52, 0x95, 0x4b, 0x77, 
+    0x9e, 0xfa, 0x83, 0xbc, 0xdd, 0x62, 0xe0, 0xe3, 0xb4, 0x66, 0x07, 0xd1, 0x52, 0xd8, 0x75, 0xfa, 
+    0x0e, 0x8d, 0x57, 0xee, 0xca, 0xd8, 0x6b, 0xb7, 0xf7, 0x09, 0xf0, 0x92, 0xe0, 0x72, 0x92, 0x95, 
+    0x6a, 0xf5, 0xa3, 0xad, 0x7c, 0xd4, 0xaa, 0x27, 0x5a, 0xf1, 0xc4, 0xfc, 0xd6, 0x8f, 0x83, 0xd3, 
+    0x58, 0xdf, 0x21, 0xb5, 0x18, 0x01, 0xa1, 0xc5, 0x3f, 0xd4, 0x0b, 0x7a, 0xe0, 0x43, 0xbd, 0xa0, 
+    0xe2, 0x09, 0xe0, 0xab, 0x0a, 0x24, 0xa8, 0x16, 0x64, 0xfc, 0x40, 0x9d, 0x6b, 0x09, 0x61, 0xc6, 
+    0x61, 0xc1, 0x38, 0x42, 0x8d, 0xc0, 0x08, 0xaf, 0x41, 0x2b, 0x62, 0xd7, 0x69, 0x96, 0xb5, 0x68, 
+    0xc4, 0x53, 0x5d, 0x6a, 0x25, 0xf8, 0x60, 0xca, 0x72, 0xca, 0xd6, 0xb9, 0x76, 0xf9, 0x1f, 0x2b, 
+    0x89, 0x5b, 0xe5, 0xb4, 0x3d, 0x74, 0x0c, 0xaa, 0x8a, 0x2d, 0x12, 0x85, 0x6b, 0x09, 0x6f, 0x73, 
+    0x57, 0x9b, 0xdf, 0xf0, 0x28, 0x5a, 0x73, 0x11, 0xc0, 0xdf, 0xfc, 0x8d, 0xe0, 0xda, 0x67, 0x6e, 
+    0xb0, 0xa3, 0x4a, 0x80, 0x89, 0xd8, 0xee, 0x38, 0x03, 0x30, 0xb8, 0x95, 0x5a, 0x10, 0x4a, 0x21, 
+    0x38, 0x8c, 0x5c, 0x5e, 0x9c, 0x37, 0xa2, 0xd8, 0xee, 0x8e, 0x81, 0x46, 0x8e, 0x65, 0xac, 0x3c, 
+    0xd2, 0xa9, 0x7c, 0xcf, 0x17, 0x17, 0xa8, 0x1c, 0x09, 0x2a, 0x70, 0x85, 0x31, 0xaf, 0x97, 0xd1, 
+    0x3c, 0x6b, 0x11, 0x84, 0x34, 0x04, 0xf8, 0xd8, 0xd7, 0x05, 0x49, 0x9f, 0x6b, 0x41, 0xe0, 0x75, 
+    0x91, 0x98, 0x73, 0xa9, 0x8c, 0x8a, 0xda, 0x1c, 0x2b, 0xf8, 0x8b, 0x5b, 0xce, 0xf8, 0xde, 0xb7, 
+    0xc3, 0x91, 0x3f, 0x30, 0xcd, 0x8f, 0x6d, 0xe1, 0x8e, 0x00, 0x01, 0x2e, 0x53, 0x18, 0x12, 0xdd, 
+    0x4c, 0x1a, 0x51, 0x65, 0x9e, 0x8a, 0xd4, 0x68, 0x1a, 0xf0, 0xc5, 0xf8, 0x42, 0x5b, 0x07, 0x25, 
+    0xb0, 0xdc, 0xfb, 0x39, 0xcd, 0x65, 0x07, 0x2b, 0x22, 0x39, 0x39, 0x1c, 0x83, 0x29, 0x35, 0xc3, 
+    0x75, 0x18, 0xdb, 0x51, 0xd0, 0xf1, 0x90, 0x1d, 0xb9, 0x10, 0x9e, 0x68, 0x8b, 0x81, 0xeb, 0x60, 
+    0x14, 0xa6, 0x27, 0x72, 0x01, 0xed, 0x04, 0xe7, 0xd6, 0x79, 0x0e, 0xea, 0xca, 0x6b, 0xbf, 0xbc, 
+    0x41, 0x5e, 0xca, 0x92, 0xe5, 0xda, 0x3e, 0x70, 0xfe, 0x82, 0x72, 0x28, 0xd0, 0x65, 0xc1, 0xcc, 
+    0x19, 0x50, 0x6a, 0x16, 0xbe, 0x71, 0x24, 0x27, 0x5a, 0xce, 0x71, 0xe5, 0xae, 0xc3, 0x3a, 0xf4, 
+    0xbd, 0x28, 0x90, 0x5b, 0xed, 0xa7, 0xe9, 0x3a, 0x90, 0x16, 0x87, 0x50, 0x6f, 0xf6, 0x1d, 0x08, 
+    0x1f, 0xfa, 0x35, 0x5c, 0xdd, 0x9d, 0x10, 0x39, 0x10, 0x74, 0x3c, 0x9a, 0xb9, 0x8d, 0x83, 0x1e, 
+    0x1b, 0x55, 0x40, 0x56, 0x17, 0x90, 0x4f, 0x05, 0x79, 0x5d, 0xd8, 0x16, 0xb9, 0x3d, 0xb8, 0xa2, 
+    0x30, 0x96, 0xa2, 0x62, 0x67, 0x1b, 0xb7, 0x4b, 0x8d, 0xca, 0x90, 0x7a, 0x55, 0xa1, 0x5a, 0x69, 
+    0xf1, 0x85, 0x92, 0x10, 0x7b, 0xc1, 0x97, 0x33, 0xeb, 0xce, 0xe9, 0x8f, 0xfa, 0xa0, 0x86, 0xa2, 
+    0x30, 0x44, 0xee, 0x10, 0xd4, 0x8c, 0xe3, 0x88, 0x37, 0x72, 0xba, 0x14, 0xe3, 0x93, 0x26, 0xfb, 
+    0x78, 0x45, 0xdb, 0x66, 0x7b, 0x4b, 0xc3, 0x51, 0xd0, 0xcb, 0xcd, 0x6c, 0x9b, 0xa8, 0xcc, 0x9c, 
+    0xd3, 0x45, 0x51, 0xe4, 0xf6, 0x16, 0x4e, 0xe9, 0x8a, 0x5d, 0x5b, 0x54, 0x37, 0x2f, 0x44, 0xfd, 
+    0x95, 0x7e, 0xf4, 0x98, 0x0f, 0xa5, 0xf8, 0xbc, 0xcf, 0x87, 0xd1, 0x2b, 0x33, 0x5a, 0x4e, 0x05, 
+    0x73, 0xc4, 0x62, 0x27, 0x24, 0x18, 0x4f, 0x42, 0x60, 0x46, 0x4e, 0xd0, 0xa3, 0x53, 0xb1, 0xdd, 
+    0x3c, 0xd7, 0xfe, 0x62, 0x34, 0x0e, 0xc4, 0x36, 0xdf, 0xa1, 0xa9, 0x2f, 0xe6, 0xd9, 0x17, 0x94, 
+    0x3b, 0xb8, 0x4f, 0xf4, 0xfa, 0x41, 0xf6, 0x9f, 0x44, 0x28, 0xf3, 0xaa, 0xcb, 0x70, 0x23, 0x3f, 
+    0x02, 0xd3, 0x76, 0xc7, 0x63, 0xb1, 0x2b, 0x92, 0x2c, 0x9a, 0x0a, 0x64, 0x30, 0x4a, 0x5c, 0x13, 
+    0xf0, 0x7a, 0x8d, 0x90, 0xc4, 0x3c, 0x4f, 0x76, 0x24, 0x7e, 0xc5, 0xde, 0x09, 0x9b, 0x0a, 0x0b, 
+    0x11, 0x5e, 0x29, 0x89, 0xcf, 0xc8, 0x95, 0xa1, 0x84, 0x4b, 0x52, 0x3d, 0x73, 0xfb, 0xd4, 0x00, 
+    0x4e, 0xdb, 0x4b, 0x89, 0x8b, 0xea, 0xca, 0xb4, 0x32, 0x29, 0xe9, 0x16, 0x5c, 0x9e, 0xd2, 0x2d, 
+    0x23, 0x52, 0x4e, 0xe8, 0xd9, 0xdd, 0xb2, 0xdb, 0x2b, 0x13, 0xa9, 0x4d, 0x89, 0x0d, 0x8b, 0xc7, 
+    0x6d, 0xc2, 0x74, 0x28, 0x79, 0xc4, 0xcd, 0x7f, 0x0e, 0xa0, 0xf4, 0x35, 0xf1, 0x27, 0x5f, 0x60, 
+    0xf5, 0x4a, 0x45, 0xc6, 0x85, 0xc9, 0x4d, 0x6e, 0x10, 0x6c, 0x15, 0xd8, 0xc3, 0xe3, 0x43, 0x69, 
+    0x61, 0x84, 0x1a, 0x06, 0xd0, 0x61, 0xf6, 0x53, 0x7d, 0x2e, 0x07, 0x5a, 0xe8, 0x50, 0x39, 0x12, 
+    0x66, 0x43, 0x6b, 0xc1, 0x3a, 0x44, 0x68, 0x98, 0xfb, 0x54, 0x8f, 0xdb, 0x92, 0xf9, 0x71, 0x29, 
+    0x2a, 0x61, 0xb0, 0x1c, 0xd8, 0xf5, 0x41, 0x4e, 0x86, 0x3e, 0xe4, 0x51, 0xf1, 0x3d, 0xd1, 0x1b, 
+    0x9d, 0x80, 0x58, 0xaa, 0x27, 0xb5, 0x59, 0xd5, 0x0a, 0xc6, 0x83, 0x16, 0x8b, 0x66, 0xb1, 0x34, 
+    0xbe, 0x68, 0x83, 0xee, 0xc7, 0xc6, 0x4d, 0x08, 0xc2, 0xad, 0x8b, 0x3b, 0xae, 0xa8, 0xac, 0x5b, 
+    0x0b, 0x26, 0xd3, 0x8e, 0x1d, 0xc2, 0xf0, 0xe6, 0x09, 0xc4, 0xba, 0xb6, 0xd7, 0xf2, 0xda, 0xf6, 
+    0x2f, 0xbf, 0xed, 0xa0, 0x3f, 0xc2, 0x1e, 0xe0, 0x8f, 0x77, 0x6f, 0x4f, 0x31, 0x22, 0xd9, 0x1b, 
+    0xe0, 0x44, 0xce, 0xa9, 0xca, 0xeb, 0xe1, 0x3f, 0x6d, 0x1e, 0xc3, 0xcc, 0x91, 0xf9, 0xa5, 0x6f, 
+    0x01, 0x0e, 0x2d, 0x6d, 0x00, 0xd0, 0x35, 0x71, 0xb6, 0xef, 0x7b, 0x7e, 0x2a, 0xc3, 0xe6, 0x96, 
+    0x4c, 0xa2, 0x48, 0x5b, 0xb1, 0x6b, 0x68, 0x29, 0x20, 0x48, 0x93, 0xd5, 0xd4, 0xd1, 0x40, 0x7d, 
+    0x4e, 0xa5, 0x44, 0xed, 0xa8, 0x3a, 0xf4, 0xdf, 0x72, 0x90, 0x1a, 0xb3, 0xdb, 0x72, 0xb4, 0x9e, 
+    0x7b, 0xb2, 0x18, 0x77, 0xb7, 0xcc, 0xa6, 0x8e, 0xe2, 0xb1, 0xa0, 0x5d, 0xfa, 0xfe, 0xa8, 0x4e, 
+    0x5b, 0x40, 0x6b, 0x3c, 0x98, 0x09, 0x6a, 0x95, 0xc8, 0x18, 0x25, 0x0f, 0xfd, 0x6e, 0xcc, 0x76, 
+    0x14, 0x46, 0x8f, 0xc6, 0x2a, 0xe9, 0x76, 0x8f, 0xad, 0x59, 0xa3, 0x9d, 0x9f, 0x18, 0xac, 0x78, 
+    0x11, 0x03, 0xe7, 0x76, 0x90, 0xf0, 0xbe, 0x6b, 0x8e, 0xf5, 0x18, 0x14, 0x59, 0x39, 0xc2, 0xff, 
+    0x9e, 0x02, 0x45, 0x6d, 0x5c, 0x4d, 0x67, 0x9f, 0x1c, 0xeb, 0xb4, 0x67, 0xa2, 0x1f, 0x8a, 0x22, 
+    0x03, 0x9d, 0x6b, 0xa6, 0xb7, 0xc4, 0x8f, 0xdc, 0x5f, 0xb2, 0x91, 0x38, 0xec, 0x85, 0xa1, 0x1f, 
+    0xb5, 0x11, 0x85, 0xe1, 0x2f, 0x18, 0x3b, 0x0c, 0x5f, 0x90, 0x64, 0xf8, 0x29, 0x7e, 0x00, 0x65, 
+    0xf0, 0x23, 0x4f, 0x92, 0xa4, 0x16, 0xc7, 0x06, 0x1d, 0x98, 0x08, 0x47, 0xdc, 0x32, 0x87, 0x25, 
+    0x88, 0x93, 0x91, 0x6c, 0x4d, 0x2d, 0xd5, 0xb6, 0x41, 0x3b, 0xb8, 0xbc, 0x9c, 0x64, 0xec, 0x84, 
+    0xa2, 0xba, 0x2c, 0x3c, 0xe4, 0xb7, 0xa7, 0xa9, 0x6a, 0xe4, 0x16, 0xb7, 0x7d, 0x40, 0x2b, 0xc0, 
+    0x54, 0x1d, 0x69, 0xb0, 0xe5, 0x75, 0x3b, 0xeb, 0x00, 0xa1, 0xb6, 0x2e, 0x92, 0xe6, 0x5e, 0x7a, 
+    0x0a, 0xb7, 0x4d, 0x0b, 0x26, 0x3f, 0x3b, 0xb6, 0x2c, 0x25, 0x1e, 0x07, 0x7f, 0x6e, 0xaf, 0x2c, 
+    0x1c, 0x8f, 0x03, 0xbf, 0xe6, 0x2b, 0x65, 0x84, 0xe3, 0xb8, 0x7c, 0xef, 0x69, 0x99, 0xc8, 0xa7, 
+    0xc7, 0x8b, 0x7b, 0x4a, 0x2e, 0x9c, 0x48, 0x52, 0xa3, 0x85, 0x93, 0x58, 0xeb, 0xe4, 0xa2, 0x15, 
+    0x50, 0x1e, 0xd0, 0xd0, 0x79, 0xb6, 0x5c, 0xf9, 0x2f, 0x7f, 0x29, 0x77, 0x41, 0x70, 0xff, 0x02, 
+    0xff, 0xe9, 0x8f, 0xb3, 0xf8, 0x34, 0x03, 0xcf, 0x32, 0xda, 0xc3, 0x8c, 0x00, 0xcd, 0xc4, 0xab, 
+    0x8d, 0x25, 0x0f, 0x78, 0xcc, 0x78, 0x08, 0x3a, 0xc3, 0x22, 0x3c, 0xe0, 0x0b, 0x05, 0x26, 0x69, 
+    0x66, 0x15, 0xe2, 0xe0, 0x3b, 0x47, 0x0b, 0x50, 0x62, 0x44, 0x2b, 0x29, 0x34, 0x6d, 0x52, 0x64, 
+    0x73, 0x23, 0xd1, 0x22, 0x97, 0xa2, 0xf8, 0x0a, 0x2d, 0x0c, 0x94, 0x82, 0x31, 0x87, 0x3e, 0x0f, 
+    0x53, 0x84, 0xa6, 0x07, 0xa9, 0xf1, 0x08, 0x92, 0xf6, 0xb5, 0x6d, 0x51, 0x7f, 0x75, 0x5b, 0xf1, 
+    0x44, 0x6d, 0xd7, 0xc9, 0x83, 0x0f, 0xdb, 0x34, 0xf7, 0x4f, 0x08, 0x47, 0x90, 0x98, 0xaa, 0x15, 
+    0x89, 0xaa, 0x9e, 0x8a, 0x2b, 0x3a, 0x3a, 0x31, 0x09, 0x5d, 0x5d, 0x47, 0x57, 0x53, 0x84, 0xad, 
+    0xa5, 0x60, 0xcb, 0xc4, 0xf2, 0xd6, 0x64, 0x26, 0xe1, 0x5c, 0x33, 0x48, 0x54, 0x48, 0x6b, 0x8d, 
+    0x34, 0x12, 0xa3, 0x03, 0x1c, 0x31, 0x74, 0x4f, 0xb8, 0x7b, 0x3e, 0x75, 0x79, 0xca, 0x53, 0x78, 
+    0x59, 0x4c, 0x48, 0xca, 0x0f, 0xad, 0x4c, 0xab, 0x53, 0x56, 0xa6, 0x2d, 0x63, 0x0f, 0x57, 0xdb, 
+    0xb6, 0x9d, 0xb2, 0x36, 0xe5, 0x81, 0xa8, 0xd4, 0x7c, 0x5c, 0x88, 0x8d, 0xc5, 0xce, 0xfa, 0xf4, 
+    0x55, 0xa9, 0x59, 0x11, 0xed, 0xc3, 0xaa, 0xca, 0xe6, 0x5c, 0x97, 0x6a, 0x47, 0xe1, 0x16, 0x5c, 
+    0x98, 0x26, 0xaa, 0xda, 0x8e, 0x35, 0x57, 0x5f, 0x5f, 0xa6, 0x36, 0x6d, 0xf6, 0xa2, 0xb4, 0x3a, 
+    0xef, 0xa2, 0x54, 0x8b, 0x7f, 0x9c, 0xb8, 0x2a, 0x35, 0x15, 0x96, 0x91, 0x4f, 0x41, 0xd3, 0x59, 
+    0x62, 0x93, 0x6d, 0x67, 0xe1, 0xf0, 0xc1, 0x84, 0x4f, 0x87, 0x76, 0x6b, 0x77, 0x16, 0x8c, 0x25, 
+    0x4c, 0x60, 0x11, 0xf7, 0x2c, 0xec, 0x2c, 0x1c, 0x5a, 0xa8, 0x30, 0xc9, 0x05, 0x2d, 0x56, 0x33, 
+    0x6d, 0x60, 0x10, 0xbd, 0x38, 0x4d, 0xfc, 0xe0, 0xd0, 0xa8, 0x4d, 0x1b, 0x1a, 0x46, 0xd8, 0xb9, 
+    0xdc, 0x87, 0x8e, 0x36, 0xd5, 0xa7, 0x8c, 0x10, 0xce, 0xed, 0x02, 0x91, 0x59, 0x90, 0x6c, 0x99, 
+    0x3e, 0x3c, 0x12, 0x95, 0xd1, 0x10, 0xd1, 0x2b, 0x9c, 0x77, 0x94, 0xe8, 0x98, 0x16, 0x1f, 0x29, 
+    0x29, 0x35, 0x6e, 0x27, 0x1b, 0x2f, 0x45, 0x3f, 0xbd, 0xa1, 0xb3, 0x07, 0x4b, 0x6d, 0xee, 0xc1, 
+    0x22, 0xe2, 0x64, 0xa7, 0xf9, 0x6f, 0x78, 0xfc, 0x3d, 0x9d, 0x7d, 0xe9, 0x5b, 0x03, 0xab, 0x4b, 
+    0xf2, 0x46, 0x13, 0x16, 0x72, 0xf7, 0x26, 0xa0, 0xa3, 0x9a, 0x71, 0xe7, 0x7f, 0x3c, 0xae, 0xde, 
+    0x09, 0x10, 0xca, 0xb0, 0x08, 0x70, 0xe4, 0x07, 0xe2, 0x54, 0xa3, 0x7e, 0xae, 0xf1, 0x73, 0x56, 
+    0xcf, 0x5c, 0x49, 0x47, 0xf9, 0xd0, 0x09, 0xab, 0x1e, 0x7c, 0x29, 0x98, 0xda, 0x45, 0x96, 0x88, 
+    0xc2, 0x51, 0x64, 0x91, 0xe8, 0x89, 0x2c, 0x23, 0x7c, 0xf8, 0xa2, 0x40, 0x22, 0xa9, 0x50, 0x54, 
+    0xd2, 0x88, 0xc0, 0x10, 0xa5, 0x95, 0xbb, 0xff, 0x73, 0x36, 0x35, 0xe1, 0x89, 0x2a, 0x2d, 0x23, 
+    0x16, 0x44, 0x39, 0xb1, 0x29, 0xf0, 0x39, 0xab, 0xe7, 0x34, 0x40, 0xe0, 0xb7, 0xdc, 0xa0, 0x12, 
+    0x0f, 0xbe, 0xac, 0x30, 0x7d, 0x8b, 0x42, 0x6e, 0x0a, 0x4c, 0x60, 0x10, 0x96, 0xe7, 0x43, 0x6a, 
+    0x12, 0x43, 0x52, 0x20, 0xf4, 0xe6, 0x27, 0x5f, 0x6b, 0xed, 0x8b, 0x25, 0x82, 0x48, 0xc2, 0xc6, 
+    0xda, 0xa4, 0xb5, 0x46, 0xb6, 0xc3, 0xec, 0xe8, 0xa3, 0xa9, 0xa7, 0x97, 0xcc, 0xa3, 0x0b, 0xb8, 
+    0x90, 0x29, 0x6a, 0x33, 0xb3, 0xe0, 0x47, 0x38, 0x98, 0x8e, 0x04, 0x37, 0x4f, 0x0c, 0x14, 0x3c, 
+    0x9a, 0x57, 0x69, 0x3d, 0x49, 0x07, 0x28, 0x2b, 0x2e, 0x7b, 0x7c, 0x4b, 0x23, 0xaf, 0x47, 0x98, 
+    0x1e, 0xb9, 0xf1, 0xdd, 0x02, 0x0d, 0xf2, 0x33, 0x17, 0x62, 0x3c, 0x6f, 0xc4, 0xb6, 0x18, 0xdf, 
+    0x20, 0x7d, 0x10, 0xc8, 0x39, 0x75, 0x80, 0x5a, 0x74, 0x9b, 0x89, 0x9b, 0xde, 0xc6, 0x30, 0x1b, 
+    0x80, 0xe9, 0xa8, 0x0d, 0x8b, 0x3e, 0xbe, 0xdd, 0xaf, 0x9d, 0x78, 0xd6, 0x87, 0x55, 0xda, 0xfe, 
+    0xee, 0x67, 0x0d, 0xf6, 0x8b, 0xf2, 0x6a, 0xd2, 0xb6, 0xad, 0xee, 0xbf, 0x34, 0x8f, 0x84, 0xdc, 
+    0xb3, 0xc4, 0x99, 0xea, 0x2d, 0xa6, 0xa2, 0x5e, 0x4c, 0x05, 0x63, 0xc6, 0x91, 0x3c, 0x28, 0x96, 
+    0xcf, 0x11, 0xfd, 0x37, 0x57, 0xec, 0x5f, 0xe4, 0x13, 0x7d, 0x02, 0x30, 0x79, 0x43, 0xc9, 0xfe, 
+    0xa1, 0x8f, 0x9b, 0x4c, 0x58, 0x9c, 0x1a, 0x81, 0x89, 0xcb, 0x1d, 0x1c, 0x11, 0x8e, 0x91, 0xc5, 
+    0x30, 0xc4, 0x16, 0xad, 0xe4, 0x34, 0xd1, 0x31, 0xc4, 0x75, 0x77, 0xe4, 0xe1, 0x2f, 0xd0, 0xee, 
+    0xc1, 0xac, 0xe6, 0x9a, 0x89, 0x88, 0xb3, 0x53, 0xce, 0x46, 0xad, 0x2c, 0x1c, 0x00, 0x39, 0x57, 
+    0xf8, 0xa3, 0x26, 0x28, 0xad, 0xf6, 0x9c, 0x72, 0x92, 0x7e, 0x0a, 0x46, 0x86, 0x31, 0x02, 0x77, 
+    0x2a, 0xcb, 0x1d, 0x87, 0xd1, 0x63, 0x28, 0x97, 0x3d, 0x1a, 0x63, 0x84, 0x3a, 0x2e, 0x73, 0x48, 
+    0x46, 0x0b, 0x87, 0xd4, 0xbb, 0x38, 0xe5, 0xe0, 0x59, 0x6a, 0xff, 0xb7, 0xb4, 0x39, 0x75, 0x7e, 
+    0x01, 0xd0, 0x4c, 0xf0, 0xe5, 0x24, 0x20, 0x25, 0x00, 0x73, 0xfe, 0xf0, 0x4b, 0x5d, 0x06, 0x00, 
+    0x6e, 0x11, 0x29, 0x48, 0x3d, 0x09, 0x14, 0x8f, 0xce, 0x5c, 0xf6, 0x60, 0x50, 0x2c, 0x6e, 0x73, 
+    0xe9, 0x53, 0x42, 0x84, 0x47, 0xd8, 0x82, 0xf3, 0x62, 0x9a, 0x72, 0x68, 0x28, 0x19, 0x4f, 0xaa, 
+    0x9b, 0xa5, 0x49, 0x89, 0xe0, 0x16, 0xe3, 0x42, 0xe2, 0x20, 0x8c, 0xcc, 0xe5, 0x64, 0x21, 0x2d, 
+    0xe6, 0x34, 0x41, 0x95, 0xcc, 0xb4, 0xb5, 0x08, 0x59, 0x2a, 0x3b, 0xd7, 0x72, 0x74, 0x25, 0x43, 
+    0x3e, 0xe7, 0x0d, 0xf8, 0xdc, 0xfe, 0x27, 0x3c, 0x82, 0x85, 0xd4, 0x80, 0x55, 0xa2, 0xc5, 0x8c, 
+    0xfe, 0xa2, 0xff, 0xd8, 0xfa, 0x9f, 0xe1, 0x8c, 0x96, 0xc8, 0x5a, 0x83, 0xa7, 0x75, 0x78, 0xba, 
+    0x3c, 0x5c, 0x9b, 0xf0, 0x06, 0x16, 0xbd, 0x81, 0x3b, 0x26, 0xc3, 0x26, 0x90, 0x4b, 0x42, 0x3c, 
+    0x0c, 0x21, 0x13, 0xe9, 0xf0, 0x6e, 0x62, 0x18, 0xfb, 0x19, 0x9d, 0x58, 0xe8, 0x77, 0xe3, 0xe1, 
+    0x31, 0x41, 0xcf, 0xf3, 0x43, 0x71, 0xd2, 0x62, 0x6a, 0x7c, 0xad, 0x5c, 0x04, 0xe2, 0x01, 0x8b, 
+    0x4b, 0x6a, 0x67, 0xac, 0xd5, 0x60, 0x26, 0x63, 0x65, 0x3c, 0xd7, 0x08, 0x91, 0xb0, 0x45, 0x9b, 
+    0x05, 0x51, 0x0d, 0x18, 0xc8, 0x9e, 0xc3, 0x47, 0xe9, 0xe1, 0xb6, 0xb8, 0xa3, 0x50, 0xa2, 0x65, 
+    0x07, 0xd0, 0x2d, 0x3a, 0x11, 0x5a, 0x2b, 0x32, 0x14, 0xe3, 0x52, 0x17, 0x89, 0x43, 0xdb, 0x5d, 
+    0x78, 0x6b, 0x4b, 0xfa, 0x4e, 0x60, 0xca, 0xc8, 0x71, 0xc4, 0x62, 0x64, 0xfe, 0x71, 0x23, 0x4e, 
+    0x12, 0x4e, 0x4d, 0xb6, 0x61, 0x98, 0xae, 0x29, 0x71, 0xa5, 0x8e, 0x34, 0x5a, 0xb9, 0x9a, 0x8e, 
+    0x6e, 0x2a, 0x42, 0x48, 0xda, 0x13, 0x27, 0xa3, 0x12, 0xaf, 0xe5, 0xd1, 0x2d, 0xd4, 0x29, 0x26, 
+    0xae, 0x23, 0x4c, 0xdb, 0xd4, 0x58, 0x45, 0x87, 0x07, 0x35, 0x4a, 0xcf, 0xeb, 0x21, 0xd8, 0x26, 
+    0xa1, 0x20, 0x8b, 0xe7, 0x78, 0xa4, 0x4d, 0x45, 0xcb, 0xf7, 0xad, 0x31, 0x9e, 0x77, 0xfa, 0x36, 
+    0x12, 0x81, 0x9a, 0x0a, 0x1b, 0x2f, 0x77, 0xd5, 0xb3, 0x23, 0xb3, 0x97, 0x05, 0x21, 0xc6, 0xb8, 
+    0xf0, 0x9b, 0x7b, 0x90, 0xe1, 0x98, 0xd6, 0xa8, 0xe5, 0x41, 0xa7, 0xb6, 0xf8, 0x26, 0xe5, 0xca, 
+    0x4c, 0xef, 0x53, 0x6a, 0x42, 0xf9, 0x88, 0x2d, 0x03, 0xeb, 0xc6, 0xe9, 0x5a, 0xa1, 0x87, 0x21, 
+    0xa1, 0x9e, 0x34, 0xaa, 0x62, 0x6e, 0x9b, 0xe7, 0xd1, 0x1b, 0x33, 0x8f, 0x5a, 0x9a, 0xe7, 0x86, 
+    0xb1, 0x54, 0x94, 0x94, 0x78, 0x88, 0x4b, 0xe3, 0x85, 0x17, 0x38, 0xb4, 0x1d, 0x3c, 0xf4, 0x82, 
+    0x94, 0x64, 0x32, 0xf3, 0x99, 0xa6, 0x50, 0xb6, 0x44, 0xb7, 0x23, 0x04, 0x68, 0xa1, 0x52, 0x26, 
+    0xff, 0xc4, 0xce, 0xdc, 0x82, 0xb6, 0xaa, 0x8e, 0x52, 0xde, 0x0e, 0x10, 0xc3, 0xf9, 0x50, 0x10, 
+    0xf1, 0xbe, 0x82, 0x33, 0x60, 0xe2, 0xb8, 0x6d, 0xe2, 0x49, 0x57, 0xcb, 0xfd, 0x45, 0x91, 0xb4, 
+    0xdc, 0xaf, 0x41, 0x77, 0xe3, 0xa9, 0x0e, 0x8e, 0xef, 0x8e, 0x5b, 0x91, 0xc4, 0x8a, 0x3e, 0xa1, 
+    0x03, 0x6a, 0xcd, 0x91, 0x03, 0x58, 0x75, 0x71, 0x81, 0x9e, 0x27, 0x25, 0xe3, 0x0c, 0x5a, 0x2e, 
+    0x50, 0xc5, 0x83, 0xc5, 0x40, 0x18, 0xc0, 0x36, 0xc7, 0xe4, 0x76, 0x0e, 0xcf, 0x77, 0x65, 0x0a, 
+    0x12, 0xdd, 0x9a, 0xea, 0xdc, 0x69, 0xc2, 0x44, 0x0d, 0x25, 0x64, 0x7d, 0xda, 0x79, 0x83, 0x32, 
+    0x8e, 0xcf, 0x60, 0x4c, 0x8d, 0x2c, 0x97, 0xd7, 0x84, 0x3c, 0x70, 0x64, 0x4e, 0x0d, 0x3e, 0x10, 
+    0x00, 0x61, 0x1b, 0xc4, 0x47, 0xa6, 0x28, 0xd3, 0x1f, 0x1f, 0xb4, 0x53, 0x9f, 0x82, 0x60, 0xc7, 
+    0x9f, 0x03, 0xc3, 0x55, 0x86, 0x2e, 0xfe, 0x66, 0xe2, 0xc9, 0x35, 0x3e, 0xf0, 0x76, 0xb5, 0xa0, 
+    0x86, 0xc7, 0x3b, 0xde, 0xa5, 0x87, 0x31, 0xd3, 0x1a, 0x2f, 0x1e, 0xb8, 0x0c, 0x74, 0xf2, 0x98, 
+    0x67, 0xd9, 0x6a, 0xc3, 0x4e, 0x21, 0xdd, 0x26, 0x5f, 0x90, 0x2f, 0x0c, 0x91, 0x44, 0xef, 0xb4, 
+    0x56, 0x4e, 0x0b, 0x76, 0x12, 0x95, 0x3c, 0xc4, 0x83, 0x96, 0x7f, 0x97, 0xb3, 0x5a, 0xe6, 0xa9, 
+    0xa9, 0x19, 0x2d, 0x3e, 0x68, 0xa7, 0x37, 0x18, 0x9f, 0x53, 0x83, 0x5a, 0xed, 0x79, 0x9a, 0x5b, 
+    0xfd, 0xa1, 0xe6, 0xfe, 0xe0, 0xc1, 0x28, 0xa3, 0xc1, 0x64, 0x9a, 0x4f, 0x6f, 0x32, 0x4a, 0x6b, 
+    0x7a, 0xa3, 0xe9, 0x0d, 0x6f, 0x36, 0xe2, 0x99, 0xa3, 0xe1, 0xb5, 0x1f, 0x6a, 0x78, 0xfa, 0xc1, 
+    0x27, 0x2d, 0xf5, 0x5f, 0xcf, 0x0a, 0x40, 0xd7, 0x68, 0x03, 0x9a, 0x8f, 0x59, 0x31, 0x97, 0x60, 
+    0x20, 0x36, 0xe1, 0xaa, 0xf3, 0xdb, 0x03, 0x23, 0xb0, 0xca, 0xca, 0x0c, 0xba, 0xeb, 0x06, 0xdd, 
+    0x15, 0x45, 0xf2, 0x42, 0x47, 0x91, 0x62, 0x79, 0x06, 0x45, 0xfe, 0x4e, 0x98, 0x06, 0xc0, 0x7e, 
+    0x0a, 0xec, 0xa1, 0xe5, 0x83, 0x4d, 0xe0, 0x8e, 0x0b, 0x9c, 0x58, 0xda, 0x86, 0xf4, 0x69, 0x1a, 
+    0x8e, 0xf4, 0x16, 0x6e, 0x0c, 0xf8, 0xe3, 0x05, 0x4f, 0x36, 0xe9, 0xfd, 0x6d, 0x98, 0x55, 0x53, 
+    0xda, 0xbb, 0x36, 0xd5, 0xb3, 0x14, 0xef, 0xaf, 0xe8, 0xbc, 0x80, 0x11, 0x1c, 0x74, 0x6f, 0x38, 
+    0xc8, 0xb7, 0xf4, 0xda, 0x0a, 0x66, 0xd0, 0xe4, 0x96, 0xd2, 0x1a, 0x31, 0x27, 0xaa, 0x78, 0x03, 
+    0xc3, 0xab, 0x90, 0xf4, 0xcf, 0x6f, 0x45, 0x52, 0xa8, 0x9c, 0x9d, 0xf3, 0x45, 0x3c, 0xf1, 0x14, 
+    0x91, 0x60, 0x6f, 0x49, 0x56, 0xf4, 0xed, 0xb0, 0xe7, 0xb5, 0x31, 0xcb, 0xd1, 0xeb, 0xcb, 0xab, 
+    0x6c, 0x41, 0x86, 0xad, 0x90, 0x65, 0x07, 0xf5, 0xdc, 0xe3, 0x31, 0x4b, 0x5a, 0xaa, 0x15, 0xf1, 
+    0xf2, 0x92, 0x2c, 0x00, 0x5a, 0x43, 0x34, 0x6a, 0x88, 0xfc, 0x32, 0x46, 0x3f, 0x65, 0x79, 0x36, 
+    0x3d, 0xf2, 0x33, 0xc2, 0x2a, 0x6e, 0x8b, 0xbd, 0xb8, 0x7c, 0x7d, 0x5e, 0xe2, 0x27, 0x02, 0x9d, 
+    0xce, 0x98, 0x22, 0x97, 0xf2, 0x46, 0xf4, 0x87, 0x1e, 0xe0, 0x95, 0x12, 0x4a, 0x15, 0xb7, 0x60, 
+    0xd5, 0xd9, 0x62, 0x65, 0xc4, 0xf2, 0xa2, 0xa5, 0x60, 0xd4, 0x6a, 0x61, 0x7e, 0xb2, 0x5f, 0x58, 
+    0x56, 0x7c, 0xa5, 0x53, 0x5f, 0x14, 0x25, 0x15, 0x41, 0x89, 0x24, 0xf4, 0x5a, 0x60, 0xa3, 0x59, 
+    0x3c, 0x9f, 0x8c, 0xd9, 0x53, 0x96, 0x89, 0x4f, 0x77, 0x4a, 0xe6, 0xf2, 0x18, 0x87, 0x24, 0x03, 
+    0xf6, 0x12, 0xb1, 0x29, 0xd3, 0x69, 0x55, 0xe4, 0x64, 0x8f, 0x29, 0x10, 0x05, 0xe7, 0x58, 0xe9, 
+    0x19, 0x8e, 0x8e, 0x9e, 0xe3, 0x1d, 0xb3, 0x14, 0x86, 0xea, 0xc0, 0x7c, 0x4b, 0xd6, 0x5b, 0xcc, 
+    0x20, 0x40, 0x3a, 0xe8, 0x58, 0x0e, 0xaf, 0x35, 0xde, 0xdb, 0x9f, 0x45, 0xde, 0xcd, 0x82, 0xb8, 
+    0xec, 0xaf, 0x20, 0x92, 0x81, 0x16, 0x78, 0xe2, 0xcd, 0xe0, 0x8b, 0xe2, 0xf3, 0x05, 0xd8, 0x95, 
+    0x4e, 0x60, 0x97, 0x2c, 0xd7, 0xcd, 0x7d, 0x16, 0xfd, 0xa6, 0x4b, 0x88, 0x40, 0x84, 0xeb, 0xf4, 
+    0x9e, 0x3d, 0xc8, 0xf9, 0xc8, 0x0f, 0xd9, 0x37, 0xf9, 0x42, 0x4a, 0x01, 0xb5, 0xa0, 0x9a, 0x13, 
+    0x5e, 0x88, 0x60, 0x2a, 0x7c, 0x89, 0x78, 0x2b, 0x7a, 0x21, 0x77, 0xff, 0x90, 0x8e, 0x81, 0x37, 
+    0x69, 0x5e, 0x0c, 0x84, 0xe0, 0x8b, 0xe1, 0x61, 0x12, 0x09, 0x4c, 0x0f, 0xf9, 0xfa, 0x31, 0x27, 
+    0x9a, 0x6c, 0x80, 0xf0, 0xab, 0x13, 0xf1, 0x76, 0xe0, 0x1c, 0x6f, 0x60, 0xde, 0xf4, 0x5f, 0x61, 
+    0x1b, 0xf8, 0xb5, 0xa0, 0x5d, 0xe3, 0x0d, 0x5d, 0x76, 0x1c, 0xe4, 0x38, 0x89, 0xd2, 0xd8, 0xf4, 
+    0xad, 0x5b, 0x99, 0x01, 0x59, 0xaf, 0xcb, 0x10, 0x25, 0x26, 0xd3, 0xba, 0x93, 0xbc, 0xc0, 0xa3, 
+    0xed, 0xd4, 0xa4, 0x1f, 0x31, 0xd2, 0x69, 0x70, 0x91, 0x24, 0x98, 0x89, 0x57, 0xf1, 0x39, 0xcf, 
+    0xe1, 0x75, 0x89, 0x6a, 0x96, 0x96, 0xa4, 0xad, 0x71, 0x8b, 0x32, 0x58, 0x89, 0x33, 0x3a, 0xa0, 
+    0xbd, 0xb5, 0x50, 0x70, 0x9a, 0x2e, 0x60, 0x70, 0x58, 0x37, 0x20, 0xa5, 0xb8, 0x8a, 0x2d, 0x30, 
+    0x0f, 0xf1, 0xdd, 0x3a, 0x18, 0x4d, 0x8f, 0x61, 0xf4, 0x78, 0x41, 0x2a, 0xcf, 0xc8, 0x4a, 0xf9, 
+    0x75, 0x45, 0x20, 0xca, 0xad, 0xca, 0xe7, 0xaa, 0x85, 0x3f, 0x46, 0x78, 0x61, 0xed, 0x6f, 0x3e, 
+    0x89, 0x8e, 0x03, 0x57, 0xf4, 0xe8, 0xd4, 0xc9, 0x99, 0x65, 0x77, 0x77, 0xd2, 0x31, 0x68, 0x8b, 
+    0xe4, 0xe9, 0x59, 0x69, 0x23, 0x75, 0x7d, 0xcb, 0xe2, 0xb8, 0x3e, 0x4f, 0x2c, 0xfb, 0x25, 0x96, 
+    0xa0, 0x82, 0xca, 0x89, 0xa6, 0xab, 0x56, 0x89, 0xdf, 0xfc, 0xf4, 0xa9, 0x24, 0x48, 0xd5, 0x22, 
+    0xde, 0x1a, 0xbb, 0xd6, 0x4f, 0x6e, 0x29, 0x82, 0xfb, 0xd6, 0x2c, 0x32, 0x71, 0x35, 0x22, 0x3a, 
+    0xb5, 0x28, 0x3c, 0x1d, 0x71, 0xaf, 0x85, 0x11, 0xfd, 0x46, 0x52, 0xca, 0x48, 0x7a, 0xa2, 0x8b, 
+    0x53, 0x47, 0x03, 0xd5, 0xa1, 0xb1, 0xf0, 0x66, 0x63, 0x43, 0x5d, 0x0b, 0xc7, 0xfc, 0xaa, 0x23, 
+    0x95, 0xf5, 0x0f, 0xe8, 0xee, 0xb6, 0xf8, 0xe9, 0x52, 0xf9, 0x56, 0x9e, 0x73, 0xbd, 0x2d, 0x09, 
+    0x76, 0x96, 0xc4, 0x89, 0x57, 0x75, 0xa2, 0x34, 0xad, 0x14, 0x4c, 0xad, 0x43, 0x2c, 0x75, 0x06, 
+    0x3f, 0x4b, 0x74, 0xf1, 0x6e, 0x2e, 0x42, 0x80, 0x2f, 0x6d, 0x9f, 0xee, 0x36, 0xce, 0x3f, 0xfc, 
+    0xd7, 0x7f, 0x98, 0x81, 0x0a, 0x13, 0x48, 0x9b, 0x04, 0xe0, 0x13, 0x5a, 0xad, 0x3c, 0x80, 0x0d, 
+    0x84, 0x2f, 0x64, 0x97, 0x47, 0x54, 0xf1, 0x2f, 0xb1, 0x64, 0xe9, 0x76, 0xcb, 0x0a, 0xc2, 0xcc, 
+    0x2e, 0x65, 0x4d, 0xb8, 0x2d, 0xc9, 0x07, 0x51, 0x38, 0x6a, 0x23, 0x8a, 0x46, 0x6d, 0x47, 0x4b, 
+    0x11, 0x19, 0xe5, 0xf9, 0x35, 0x0d, 0x1b, 0x5d, 0xd9, 0x63, 0xd4, 0x43, 0x0f, 0x7e, 0xba, 0x27, 
+    0xd7, 0xf8, 0x43, 0x92, 0x0c, 0xc9, 0xce, 0xb6, 0xce, 0x46, 0x1d, 0x20, 0x85, 0x73, 0x6d, 0xe2, 
+    0xd8, 0x99, 0x75, 0x17, 0x71, 0x8b, 0xff, 0xfd, 0x2a, 0xcf, 0x34, 0xea, 0xb1, 0xa8, 0x91, 0x24, 
+    0x2c, 0x29, 0x79, 0x3c, 0x50, 0xd3, 0xc8, 0x15, 0x07, 0xca, 0xc5, 0x8e, 0x0d, 0x23, 0xdd, 0x99, 
+    0xa0, 0xab, 0x27, 0x1a, 0x01, 0xd1, 0x6f, 0x4d, 0x5d, 0xc0, 0x9b, 0xd4, 0x17, 0xea, 0x40, 0x81, 
+    0x16, 0xee, 0x24, 0x44, 0x18, 0x75, 0xd9, 0x39, 0xa8, 0x2a, 0x8c, 0xe9, 0x00, 0xed, 0x44, 0x74, 
+    0x08, 0x6f, 0xc3, 0x34, 0xc5, 0x30, 0x45, 0xe3, 0xe0, 0x39, 0x74, 0xf6, 0xf3, 0x54, 0x42, 0xb6, 
+    0x57, 0xa6, 0x4f, 0x25, 0x58, 0x28, 0xf5, 0x50, 0xa2, 0x3e, 0xad, 0xcc, 0x08, 0x2c, 0xd5, 0xee, 
+    0xa0, 0x8f, 0x71, 0xff, 0x6b, 0x62, 0x20, 0xcc, 0x71, 0x91, 0xeb, 0x7b, 0xb0, 0xe7, 0xe8, 0x2e, 
+    0x40, 0x7e, 0x93, 0x6b, 0x02, 0x4c, 0x5c, 0xc1, 0x8a, 0x49, 0xd3, 0x6f, 0x38, 0xa8, 0x38, 0x93, 
+    0xfe, 0xd3, 0x7d, 0x50, 0x12, 0x4f, 0xe4, 0x21, 0xf6, 0x09, 0xc3, 0x71, 0x9e, 0xeb, 0x64, 0x2f, 
+    0x30, 0x6a, 0x03, 0x53, 0xf0, 0xcf, 0x20, 0x84, 0xaa, 0x75, 0x86, 0x3f, 0x5e, 0xe3, 0xbb, 0x21, 
+    0x66, 0x4c, 0x9d, 0xa7, 0xd9, 0x23, 0x82, 0x54, 0xad, 0xa6, 0xd1, 0xd5, 0x71, 0x3d, 0x98, 0x8c, 
+    0x83, 0x12, 0x7f, 0xc7, 0xca, 0x6c, 0xbd, 0x92, 0x7f, 0xe8, 0x33, 0x24, 0x4e, 0x3c, 0xfa, 0x19, 
+    0x1e, 0x3d, 0x04, 0x3f, 0x4c, 0xe6, 0x31, 0xde, 0xf9, 0xf2, 0x76, 0xef, 0x6c, 0x1e, 0x42, 0xc1, 
+    0x3a, 0x1f, 0x2a, 0x32, 0x81, 0x38, 0xfc, 0xcd, 0x30, 0x5b, 0x67, 0x6d, 0x2d, 0xaf, 0xbc, 0x52, 
+    0xd5, 0xfc, 0x03, 0x7b, 0xb9, 0xff, 0xc3, 0x74, 0xd1, 0x55, 0xe6, 0x97, 0x4e, 0x77, 0x60, 0xb9, 
+    0xf3, 0x90, 0xe6, 0x07, 0x81, 0xa3, 0xc9, 0x0d, 0xfe, 0x7c, 0x60, 0xed, 0xfd, 0xbe, 0x41, 0x07, 
+    0xe9, 0x24, 0x4a, 0x80, 0x7b, 0xec, 0xf9, 0x3c, 0xae, 0x23, 0xa7, 0x64, 0x2c, 0x9e, 0x83, 0xd2, 
+    0xeb, 0xc3, 0xfa, 0xd0, 0x16, 0xd2, 0x1b, 0xe4, 0x6e, 0xaa, 0x05, 0x76, 0x53, 0xd3, 0x23, 0x0e, 
+    0x86, 0x55, 0x18, 0x12, 0x37, 0xd5, 0x28, 0x3c, 0xf8, 0x5f, 0xdd, 0x94, 0x0b, 0x3c, 0x31, 0x09, 
+    0x77, 0x8f, 0x97, 0xe0, 0x6b, 0xdf, 0x1a, 0xe6, 0x78, 0x4e, 0x0e, 0x2d, 0xa4, 0x63, 0x88, 0x59, 
+    0x5c, 0x6f, 0x6a, 0x0b, 0x95, 0x54, 0xd9, 0x64, 0x1d, 0x9e, 0x4d, 0xd6, 0x61, 0xcf, 0x58, 0x1d, 
+    0x3e, 0x12, 0xc9, 0x64, 0xd1, 0x6b, 0x58, 0xfd, 0xec, 0x50, 0x7a, 0x0d, 0x98, 0x38, 0x9a, 0xf8, 
+    0xbb, 0x26, 0x7f, 0x47, 0x6b, 0x11, 0x0b, 0xca, 0x37, 0xa5, 0x93, 0x19, 0x13, 0xd7, 0x6b, 0x6f, 
+    0x76, 0xb5, 0x37, 0x55, 0xe9, 0x42, 0x15, 0xbf, 0x2b, 0x69, 0x67, 0x6a, 0x62, 0x3c, 0x15, 0x2a, 
+    0x4e, 0xf0, 0x2e, 0x7d, 0xe1, 0x90, 0x58, 0x26, 0xca, 0x5b, 0x86, 0xc0, 0xd0, 0x2e, 0xe9, 0x37, 
+    0x13, 0xdb, 0x43, 0x2f, 0x98, 0x7d, 0x77, 0x75, 0x19, 0x13, 0xea, 0x04, 0x2a, 0x6e, 0x8f, 0x54, 
+    0xbf, 0x5f, 0xf2, 0xae, 0xcd, 0x5d, 0xd0, 0xa9, 0x27, 0x69, 0x8c, 0x23, 0x18, 0x80, 0x4b, 0x90, 
+    0x2f, 0xad, 0xaa, 0xd0, 0xea, 0xfe, 0x55, 0x06, 0xd7, 0xcb, 0x48, 0x53, 0x53, 0x44, 0xcc, 0x66, 
+    0x17, 0x4c, 0x34, 0x79, 0xe0, 0x77, 0x25, 0xbe, 0xc1, 0x22, 0x44, 0x6f, 0x7a, 0x7c, 0x8f, 0xae, 
+    0x15, 0xb5, 0x7c, 0x22, 0x40, 0x80, 0x2a, 0xae, 0x7b, 0x18, 0xd4, 0x43, 0x43, 0x75, 0x9b, 0xb4, 
+    0x69, 0xe7, 0x24, 0x18, 0xfb, 0x1a, 0xdd, 0xf4, 0x04, 0x73, 0x3f, 0x36, 0x15, 0x67, 0xd9, 0xbf, 
+    0x8e, 0x7c, 0xf7, 0x61, 0xe2, 0xe5, 0xd9, 0x7c, 0x52, 0x29, 0x36, 0xad, 0x76, 0x97, 0x54, 0xa6, 
+    0xd1, 0xd4, 0x07, 0xa6, 0xd9, 0x7e, 0xd6, 0xee, 0xd7, 0x14, 0xdf, 0x85, 0xb1, 0x00, 0x29, 0xff, 
+    0x99, 0x9d, 0x76, 0x07, 0xb8, 0x5a, 0x20, 0x23, 0x12, 0x77, 0x22, 0x38, 0x7e, 0x2e, 0x57, 0x98, 
+    0xb1, 0x8e, 0x67, 0x21, 0x86, 0x25, 0xea, 0x9f, 0xcb, 0x13, 0x52, 0x12, 0xf2, 0x75, 0x91, 0xf2, 
+    0x58, 0xd3, 0xba, 0xb6, 0xa5, 0xdf, 0xc0, 0x20, 0x43, 0xcb, 0x5b, 0x25, 0xf5, 0x18, 0xcc, 0xe9, 
+    0x3d, 0x5c, 0x7f, 0x94, 0x9c, 0x80, 0x3e, 0xb5, 0x77, 0xea, 0xd4, 0x59, 0xfc, 0x52, 0x8d, 0x08, 
+    0x24, 0x11, 0x77, 0x99, 0x76, 0xff, 0x46, 0x94, 0x9c, 0x8f, 0x28, 0x52, 0xf3, 0xb9, 0x22, 0xc6, 
+    0x58, 0xb2, 0xc4, 0xa9, 0x51, 0x2f, 0x15, 0x39, 0xfa, 0x5d, 0x1e, 0xda, 0xfb, 0xb4, 0x18, 0xd0, 
+    0x57, 0x76, 0xd7, 0x6a, 0x8d, 0xc5, 0x7e, 0x5a, 0xa2, 0xf0, 0x67, 0x2d, 0x5e, 0xa0, 0x25, 0x97, 
+    0x0c, 0x91, 0x1c, 0xa5, 0x9e, 0xae, 0xdd, 0x62, 0x0a, 0xb2, 0xa4, 0xce, 0xaa, 0xe8, 0x0f, 0xe5, 
+    0xd1, 0x15, 0xe3, 0xd9, 0xe4, 0xb3, 0xb8, 0x0f, 0x1a, 0x05, 0xea, 0x36, 0x16, 0xe4, 0x83, 0xf6, 
+    0xb3, 0x24, 0x8a, 0xce, 0x41, 0x5a, 0x54, 0xc6, 0x20, 0x2e, 0x7a, 0xac, 0x93, 0xa7, 0x3d, 0x9d, 
+    0x45, 0x20, 0x3a, 0x7e, 0xe9, 0x98, 0xbd, 0x3c, 0xb6, 0x10, 0x09, 0x16, 0x6d, 0x96, 0xe9, 0x9d, 
+    0x2a, 0x9a, 0x63, 0x6c, 0x23, 0xa4, 0x9f, 0x77, 0x8b, 0x9a, 0xa1, 0x12, 0xe4, 0xfd, 0xb5, 0xc0, 
+    0x1c, 0xf2, 0x1f, 0xcc, 0x7f, 0x48, 0x19, 0x48, 0xd5, 0x4f, 0x3c, 0xea, 0xb2, 0x16, 0xb9, 0xf4, 
+    0x22, 0xc9, 0x8f, 0x42, 0xdd, 0xd3, 0x64, 0x5f, 0xbd, 0x8d, 0xa4, 0x5f, 0xbf, 0x26, 0x46, 0x87, 
+    0x48, 0x0a, 0x7f, 0xfc, 0x42, 0x99, 0x38, 0x35, 0x46, 0xfc, 0x70, 0x44, 0x91, 0x71, 0xe5, 0x4c, 
+    0x1a, 0x51, 0x3a, 0x40, 0x44, 0x57, 0xec, 0xa6, 0x9a, 0x18, 0x5c, 0x6c, 0x0d, 0x6d, 0xbe, 0xe5, 
+    0x9b, 0xe5, 0x6d, 0x2e, 0x67, 0xfa, 0x8b, 0x7d, 0x2d, 0x3a, 0x3c, 0x1a, 0x3f, 0x01, 0x18, 0xf8, 
+    0xae, 0x3d, 0x2b, 0x6c, 0x1b, 0x1b, 0x7d, 0x6f, 0x38, 0x31, 0xb7, 0x62, 0xd8, 0x4f, 0xb4, 0x48, 
+    0x1a, 0xd3, 0x6f, 0x99, 0xa4, 0xc2, 0x84, 0xe2, 0x31, 0x2f, 0x71, 0xb8, 0x63, 0x2d, 0x12, 0x86, 
+    0x0b, 0xc0, 0x97, 0x64, 0xa7, 0xa4, 0x5c, 0xe8, 0x13, 0xf5, 0x8b, 0x58, 0x3b, 0x44, 0xf7, 0x14, 
+    0xc8, 0x4e, 0x91, 0x07, 0x13, 0x67, 0x79, 0x09, 0x70, 0xe9, 0x57, 0x1c, 0x0d, 0x1c, 0x7d, 0x13, 
+    0x54, 0x95, 0x2e, 0xe1, 0x0b, 0x22, 0xaf, 0x33, 0x2b, 0xc8, 0x81, 0xd6, 0x4e, 0x45, 0xb4, 0x6a, 
+    0x53, 0x11, 0xd1, 0x6b, 0x0a, 0xe5, 0x9a, 0x15, 0x91, 0x66, 0x5c, 0x05, 0x91, 0x44, 0xa4, 0x5d, 
+    0x2d, 0x01, 0xd8, 0x36, 0xe7, 0xc7, 0x96, 0x7a, 0x33, 0x44, 0x6e, 0x32, 0xe2, 0xbc, 0xbc, 0x27, 
+    0x22, 0x36, 0x08, 0xd0, 0x63, 0x7b, 0x2c, 0x96, 0xe7, 0x92, 0xed, 0x2b, 0x5a, 0xb4, 0x85, 0x7a, 
+    0x39, 0xdd, 0x22, 0x40, 0xc8, 0xa2, 0x5c, 0xe6, 0x47, 0xe7, 0xf5, 0x4d, 0x04, 0xba, 0x97, 0x38, 
+    0x7a, 0xaa, 0xee, 0x7f, 0x40, 0xbe, 0x18, 0xe4, 0x60, 0xa2, 0x14, 0xed, 0x1e, 0x24, 0x91, 0xc6, 
+    0x89, 0x36, 0xf8, 0x41, 0x25, 0xea, 0x3e, 0x48, 0xa1, 0x9c, 0x0e, 0x6d, 0x7e, 0x19, 0x95, 0x23, 
+    0xcd, 0x27, 0xa3, 0xa9, 0xda, 0xcd, 0x11, 0x9a, 0x7c, 0x2d, 0x76, 0x13, 0x86, 0x4e, 0xeb, 0x40, 
+    0x26, 0xf9, 0x97, 0xc3, 0x37, 0xa2, 0x77, 0x36, 0x5e, 0x71, 0xb1, 0x84, 0x26, 0x12, 0x0a, 0xdd, 
+    0x25, 0xbe, 0x3a, 0xc1, 0x9b, 0x1b, 0x8c, 0x4c, 0x31, 0xec, 0x97, 0x74, 0xa0, 0x2d, 0x56, 0xab, 
+    0xcd, 0x51, 0x21, 0x5d, 0x48, 0x91, 0x56, 0xdd, 0xd1, 0xa0, 0x3d, 0xab, 0x32, 0x09, 0xb2, 0xc5, 
+    0x36, 0xb6, 0x17, 0xb9, 0xbe, 0x24, 0xbd, 0xc2, 0x7d, 0x43, 0x34, 0x6b, 0x95, 0xed, 0x1f, 0xbe, 
+    0x11, 0x25, 0x37, 0x05, 0xbb, 0x26, 0xf8, 0x3f, 0x78, 0x59, 0x49, 0x6e, 0x5a, 0x97, 0xe7, 0x53, 
+    0xaf, 0x2f, 0x91, 0xc1, 0xd7, 0xda, 0xdd, 0x5e, 0xf9, 0x64, 0x24, 0x0a, 0x89, 0xe8, 0xeb, 0x81, 
+    0xba, 0xd4, 0x8b, 0x59, 0x1d, 0x4a, 0x8b, 0x8c, 0xda, 0xaa, 0x25, 0x8a, 0x05, 0x86, 0x89, 0xa9, 
+    0xbb, 0xd1, 0x17, 0xf1, 0x7b, 0x43, 0x85, 0x38, 0xb8, 0xc3, 0x3b, 0x0c, 0x9c, 0x72, 0x2f, 0xb1, 
+    0x81, 0xe8, 0x3c, 0xfd, 0x53, 0xa5, 0xc2, 0xf3, 0x95, 0xcb, 0x37, 0x6f, 0xed, 0x56, 0x88, 0x3e, 
+    0x3e, 0x3c, 0x75, 0xbe, 0xc6, 0xff, 0xa8, 0x90, 0x9d, 0xe7, 0xd1, 0xd5, 0x66, 0x7c, 0xdd, 0x52, 
+    0xc4, 0x7d, 0xca, 0x8e, 0xed, 0xc7, 0x7d, 0xe8, 0x53, 0xdc, 0xe2, 0x49, 0x67, 0xf8, 0x54, 0xf7, 
+    0x78, 0xf2, 0xe5, 0xe7, 0xca, 0x97, 0x09, 0xae, 0x66, 0x1d, 0x24, 0xc5, 0x71, 0x1d, 0x77, 0x58, 
+    0xff, 0x90, 0x03, 0x5b, 0xcd, 0xfd, 0x09, 0x86, 0xae, 0xaf, 0xaf, 0xcb, 0x9b, 0x52, 0xf0, 0x9d, 
+    0xc7, 0x93, 0xc2, 0x57, 0xd7, 0xf1, 0x5e, 0x42, 0x6b, 0x10, 0x80, 0x98, 0xf9, 0x4e, 0x47, 0x83, 
+    0x40, 0x79, 0xde, 0xc3, 0xcb, 0x11, 0x29, 0x83, 0x30, 0x1d, 0xfd, 0xd2, 0xcb, 0x03, 0xee, 0x2b, 
+    0xba, 0x8c, 0xec, 0xdc, 0x33, 0x78, 0x9f, 0x2d, 0xb0, 0x6a, 0xad, 0x42, 0x7f, 0xd2, 0x8f, 0x87, 
+    0xf1, 0xa4, 0x80, 0xb7, 0x51, 0xb6, 0x31, 0x19, 0x6e, 0x27, 0xae, 0x7b, 0xa3, 0x64, 0x64, 0x2b, 
+    0x7c, 0x5f, 0x46, 0x4c, 0xf6, 0x63, 0x32, 0xe4, 0x72, 0xc6, 0xbd, 0x77, 0x05, 0x76, 0x1b, 0x73, 
+    0x46, 0x60, 0x81, 0x03, 0xc3, 0x6f, 0x98, 0x13, 0xec, 0x48, 0x32, 0xa3, 0x6a, 0x55, 0xad, 0x9a, 
+    0x3d, 0x87, 0x80, 0x4d, 0xe7, 0x45, 0x9a, 0xd8, 0xe2, 0xad, 0xbd, 0xd1, 0x4b, 0xc1, 0xe6, 0xa6, 
+    0xe7, 0xb6, 0x59, 0x75, 0x2d, 0xc9, 0x6b, 0x83, 0x97, 0x91, 0x23, 0x5c, 0x30, 0xb1, 0xd6, 0xc8, 
+    0xc7, 0x31, 0xad, 0x57, 0x66, 0x22, 0xd1, 0xfd, 0xfc, 0xb2, 0x37, 0x2a, 0x51, 0x63, 0x4c, 0x82, 
+    0x3b, 0x93, 0xa8, 0x5d, 0xdb, 0x9c, 0x51, 0xd1, 0xcc, 0xad, 0x01, 0x54, 0x73, 0xff, 0xf5, 0x1f, 
+    0x94, 0x40, 0xac, 0x4f, 0x22, 0xc1, 0xb2, 0xac, 0x04, 0x09, 0x69, 0x72, 0x39, 0xa1, 0x99, 0x6a, 
+    0x37, 0x41, 0x56, 0xb4, 0x99, 0xe4, 0x5a, 0xb5, 0x36, 0x03, 0x5d, 0xf6, 0x83, 0x33, 0x68, 0xf3, 
+    0x70, 0xcb, 0xd4, 0x76, 0xdd, 0xc2, 0xeb, 0xcb, 0xa1, 0x8d, 0x4b, 0x2c, 0x95, 0x4d, 0xd8, 0x7c, 
+    0xfb, 0x4e, 0x5a, 0x72, 0xfd, 0x61, 0x2f, 0x9b, 0x97, 0x1d, 0x58, 0xad, 0x68, 0x2e, 0xad, 0x81, 
+    0x47, 0x9a, 0xc7, 0xbe, 0xc5, 0x6b, 0x29, 0xed, 0xdc, 0x04, 0x76, 0xc8, 0x81, 0x6a, 0xd0, 0x07, 
+    0x45, 0x4b, 0xa1, 0x87, 0x8e, 0x70, 0xd7, 0xc6, 0xed, 0xf0, 0x4b, 0x9e, 0xd3, 0xf7, 0xf3, 0x97, 
+    0x02, 0x1e, 0x79, 0x84, 0x99, 0x10, 0x68, 0xaf, 0x15, 0xdb, 0x4e, 0x17, 0xec, 0xcc, 0x02, 0xeb, 
+    0x3b, 0x83, 0x51, 0x68, 0x6b, 0x8f, 0x60, 0x05, 0x24, 0x29, 0xaa, 0xd7, 0xf2, 0x29, 0x9b, 0x03, 
+    0x29, 0x27, 0x5c, 0x0d, 0xc3, 0x67, 0x7e, 0x43, 0xeb, 0x17, 0x65, 0x91, 0x68, 0xc6, 0x87, 0xc8, 
+    0xa2, 0x43, 0x69, 0xef, 0x42, 0x2f, 0xb4, 0x5c, 0x15, 0x6c, 0x12, 0xa9, 0x81, 0xb8, 0x1f, 0x82, 
+    0x0e, 0xf5, 0x23, 0x6c, 0x64, 0x9a, 0x57, 0xb6, 0x7f, 0x24, 0xfc, 0xcc, 0x40, 0xb6, 0xba, 0x63, 
+    0x36, 0xf0, 0x17, 0x56, 0x87, 0x59, 0xb2, 0xba, 0xad, 0x87, 0xa8, 0xe1, 0xc9, 0x77, 0x0c, 0xa0, 
+    0xad, 0x6a, 0x2b, 0x32, 0x71, 0x86, 0x3c, 0x8e, 0x8b, 0x17, 0x54, 0x91, 0x5e, 0xd1, 0x9d, 0x06, 
+    0x78, 0x48, 0x3d, 0x5a, 0x10, 0x3d, 0x44, 0x37, 0xff, 0x18, 0x2d, 0x4b, 0x21, 0x10, 0x71, 0xae, 
+    0x44, 0xfb, 0x24, 0xea, 0xb6, 0x4f, 0x53, 0x0d, 0xca, 0xfd, 0x10, 0xbd, 0xa8, 0xac, 0x42, 0xdf, 
+    0xee, 0x88, 0x56, 0x6c, 0x89, 0xc9, 0x52, 0x64, 0x17, 0xc0, 0x99, 0x5b, 0x65, 0x7f, 0xd1, 0x67, 
+    0xc8, 0x04, 0x32, 0x73, 0x8a, 0x9c, 0xba, 0x25, 0x24, 0x66, 0xca, 0x54, 0x98, 0xc4, 0x84, 0xc9, 
+    0x27, 0xb7, 0x49, 0xb0, 0x89, 0xc8, 0x26, 0x1d, 0x50, 0x9b, 0x3a, 0x53, 0x1e, 0xcf, 0xaa, 0x46, 
+    0x9b, 0x4a, 0x75, 0x7f, 0x0b, 0xcc, 0x1e, 0x73, 0x4d, 0x42, 0xf1, 0x90, 0xe6, 0x64, 0x21, 0xde, 
+    0xff, 0x74, 0x54, 0x4e, 0x86, 0x18, 0xfc, 0xae, 0x03, 0xed, 0xcc, 0x1a, 0xca, 0xe9, 0x94, 0x27, 
+    0xe5, 0xc7, 0xbd, 0x37, 0x7d, 0x7c, 0x89, 0xe1, 0xe5, 0x44, 0xdb, 0xf0, 0x69, 0xae, 0xf3, 0x34, 
+    0x0f, 0x4d, 0x8a, 0x37, 0x3d, 0x3d, 0xe4, 0xfa, 0xcb, 0xb4, 0x3c, 0xff, 0x51, 0xe8, 0xd9, 0xab, 
+    0x28, 0x65, 0xa7, 0xd2, 0x09, 0x92, 0xc9, 0x78, 0xaa, 0x59, 0xb0, 0xa5, 0x5a, 0xac, 0x6b, 0xbf, 
+    0xd6, 0x8a, 0xeb, 0x79, 0x1c, 0x62, 0x14, 0x92, 0x56, 0x35, 0xc3, 0xf1, 0x39, 0x0e, 0xe0, 0xe7, 
+    0x2b, 0x8a, 0x29, 0x4d, 0x1d, 0xe4, 0x9a, 0x7b, 0x58, 0x75, 0x0d, 0xb4, 0xd7, 0xa1, 0xfd, 0x45, 
+    0x03, 0x43, 0x32, 0x0a, 0x31, 0x18, 0x35, 0xd5, 0x58, 0x8c, 0x0a, 0x17, 0xf5, 0x6c, 0xbb, 0x5a, 
+    0x54, 0xab, 0xc8, 0xc4, 0x6b, 0x44, 0xaa, 0x45, 0x60, 0xb1, 0xe1, 0x88, 0x7d, 0x40, 0xe1, 0xed, 
+    0xae, 0x19, 0x23, 0x1b, 0x8d, 0x49, 0x01, 0x19, 0x61, 0x88, 0x0d, 0x84, 0x89, 0x83, 0x6d, 0xf2, 
+    0x28, 0xe4, 0x44, 0x7e, 0xd1, 0x1b, 0x3a, 0x6d, 0x20, 0x0a, 0xf0, 0x88, 0x82, 0x07, 0x83, 0x16, 
+    0x8d, 0x3b, 0xbc, 0xab, 0x53, 0xad, 0xb2, 0xa8, 0x34, 0x8d, 0x66, 0x84, 0x91, 0x7d, 0xa4, 0x42, 
+    0x71, 0x0a, 0x1a, 0xa7, 0x8b, 0x5a, 0xbe, 0x7e, 0xf3, 0x14, 0x7d, 0x54, 0x3f, 0x75, 0xde, 0x8e, 
+    0xd9, 0x7b, 0x73, 0x5c, 0xa6, 0x10, 0x49, 0xe2, 0x41, 0x74, 0x44, 0xba, 0xaa, 0xbb, 0xb0, 0xe2, 
+    0x72, 0x82, 0x25, 0x9d, 0xb4, 0xec, 0xc9, 0x73, 0x46, 0xf4, 0x46, 0x31, 0xbd, 0xc4, 0x1b, 0x09, 
+    0x2f, 0x1b, 0x6e, 0x84, 0xea, 0x4e, 0x6d, 0x6a, 0x75, 0x8e, 0x9b, 0x0a, 0xb4, 0xe6, 0x89, 0xf3, 
+    0xdd, 0x4b, 0xb6, 0x6d, 0x81, 0x08, 0x5e, 0x3d, 0x86, 0x97, 0x77, 0x3f, 0x16, 0x52, 0xed, 0x33, 
+    0x63, 0x72, 0x7f, 0xa8, 0x85, 0x75, 0xa3, 0x85, 0x22, 0xdc, 0x76, 0xf1, 0x26, 0x22, 0x91, 0xa2, 
+    0xb0, 0xa4, 0xf2, 0xb1, 0x28, 0x5c, 0x33, 0x28, 0x3c, 0xe5, 0x07, 0xe3, 0x97, 0xeb, 0x82, 0xf9, 
+    0x43, 0x6a, 0x79, 0x8b, 0xa8, 0x32, 0xd9, 0x1e, 0x8c, 0xb0, 0x5d, 0xb0, 0x49, 0x62, 0x4b, 0x13, 
+    0xaf, 0xfb, 0xb6, 0x5c, 0x57, 0x06, 0x98, 0xc9, 0xd5, 0x9a, 0xd0, 0x0e, 0x62, 0xa1, 0x16, 0x1f, 
+    0xe1, 0x2a, 0x8e, 0x2e, 0x3e, 0x2f, 0xa6, 0x0c, 0x73, 0xa9, 0xd5, 0x2f, 0xed, 0xf0, 0x77, 0x5d, 
+    0xae, 0xf1, 0xb6, 0x70, 0x0f, 0xf3, 0x22, 0x6b, 0xb7, 0xd4, 0xb5, 0xc3, 0x54, 0x7b, 0xde, 0xa8, 
+    0xdf, 0xb5, 0x3b, 0xe1, 0xef, 0x64, 0xcf, 0xf3, 0x0c, 0x7c, 0xa9, 0xb5, 0x92, 0xcb, 0x69, 0xc2, 
+    0x1a, 0x75, 0x73, 0x73, 0x33, 0x65, 0x01, 0x24, 0x7b, 0x26, 0x8b, 0x6b, 0x04, 0x89, 0x79, 0x85, 
+    0xc5, 0x8e, 0x6c, 0x3c, 0xe2, 0x6a, 0x78, 0x7d, 0xd1, 0xd5, 0xf0, 0x5a, 0x43, 0x51, 0xa4, 0x66, 
+    0xf4, 0xb6, 0x35, 0x0e, 0xcc, 0x4b, 0x74, 0x0f, 0xc9, 0x33, 0xa6, 0x09, 0x15, 0xfb, 0x33, 0xab, 
+    0xeb, 0x97, 0x9e, 0x8d, 0xd1, 0xb6, 0x4e, 0x84, 0x8f, 0xc9, 0xb2, 0x85, 0x08, 0xcb, 0x2a, 0xe8, 
+    0x17, 0x9e, 0xa2, 0x1b, 0xca, 0x44, 0x1b, 0x50, 0x6d, 0xb9, 0x01, 0xa5, 0xdb, 0x40, 0x58, 0xe7, 
+    0x46, 0x05, 0x8a, 0x38, 0x50, 0x5d, 0xa3, 0xb1, 0x9d, 0xee, 0x84, 0xf1, 0xbb, 0x4d, 0x2b, 0x57, 
+    0x6b, 0x34, 0x0a, 0xf2, 0x5f, 0xa5, 0x54, 0x69, 0xe4, 0x63, 0x6e, 0x15, 0x92, 0x6c, 0x6c, 0xef, 
+    0x98, 0x02, 0x9b, 0xa1, 0xdd, 0x9b, 0x32, 0x85, 0xe5, 0xe4, 0xbe, 0x9c, 0x2d, 0xb2, 0xd3, 0x44, 
+    0x33, 0xc6, 0x79, 0x8a, 0x7d, 0xc3, 0x2c, 0xa8, 0x40, 0x03, 0x2e, 0x30, 0xcc, 0xfa, 0x45, 0x1d, 
+    0xb5, 0xb5, 0x49, 0x75, 0x68, 0x78, 0xb8, 0x0b, 0x42, 0x22, 0x5a, 0xab, 0x4d, 0x6e, 0x88, 0xf4, 
+    0x43, 0xa4, 0x48, 0xca, 0xe4, 0x9a, 0x26, 0x88, 0xfc, 0x64, 0x47, 0x45, 0x14, 0x89, 0xa7, 0x9c, 
+    0x13, 0xb5, 0xaa, 0xa0, 0xae, 0xde, 0xd0, 0xaf, 0x18, 0xa0, 0x93, 0x80, 0x14, 0xc1, 0x8f, 0x6a, 
+    0x0b, 0xbf, 0xe6, 0x74, 0x99, 0x5a, 0xc5, 0xc3, 0x32, 0xf5, 0x34, 0x0f, 0x54, 0xca, 0x7c, 0xfe, 
+    0x2f, 0x5a, 0xed, 0x9f, 0x4d, 0xab, 0xe9, 0x79, 0x7f, 0xe2, 0x6a, 0xed, 0xb4, 0xc5, 0x55, 0x1a, 
+    0x9f, 0x5d, 0x17, 0xb9, 0x0d, 0x4b, 0x67, 0xe4, 0x24, 0x3f, 0xd9, 0x2c, 0x2d, 0x49, 0xf4, 0x69, 
+    0x2e, 0xba, 0xcd, 0x48, 0xbb, 0x5d, 0x61, 0x66, 0x88, 0xc5, 0xbc, 0x75, 0xb5, 0x59, 0x6e, 0xc1, 
+    0xb9, 0x2e, 0xed, 0xa2, 0x9c, 0xc5, 0x91, 0x07, 0x37, 0xa2, 0xe8, 0x40, 0x5e, 0xc7, 0x65, 0x2a, 
+    0x5c, 0x1e, 0xf8, 0x82, 0x62, 0x02, 0x84, 0xe0, 0x72, 0x95, 0xee, 0x36, 0xa1, 0xe8, 0xa6, 0xb6, 
+    0x7e, 0x51, 0xa5, 0xc7, 0x73, 0xf4, 0x99, 0x32, 0x45, 0x4f, 0xf1, 0x8a, 0x17, 0xdc, 0xc8, 0x09, 
+    0x84, 0xd4, 0xe3, 0xff, 0xf5, 0x2b, 0x2a, 0x9d, 0x4e, 0x07, 0x05, 0x09, 0x93, 0xed, 0xa8, 0xba, 
+    0x70, 0x61, 0x8c, 0x0f, 0x73, 0x78, 0xbd, 0x17, 0xc7, 0xa2, 0x9e, 0x98, 0x45, 0x0f, 0xb9, 0xb2, 
+    0x27, 0x05, 0xd0, 0xb2, 0x1d, 0x37, 0xa7, 0xf0, 0x95, 0x59, 0xae, 0x5a, 0xa9, 0x54, 0x40, 0x59, 
+    0xaf, 0xab, 0x3f, 0xb5, 0xb5, 0xbc, 0x38, 0x2e, 0x14, 0xe7, 0x6e, 0x7d, 0xca, 0x5c, 0x35, 0x79, 
+    0xa4, 0x29, 0x35, 0x28, 0x29, 0x41, 0xcf, 0x21, 0xf2, 0x4f, 0x71, 0x78, 0x23, 0xe2, 0xf0, 0x21, 
+    0xf7, 0x7a, 0x1b, 0x43, 0x74, 0x6d, 0x9e, 0x5a, 0x95, 0xdc, 0xcb, 0xe9, 0x0d, 0x4f, 0x8a, 0xd3, 
+    0x3e, 0x76, 0xf6, 0x72, 0x44, 0x49, 0xab, 0xce, 0x78, 0xa2, 0xac, 0xab, 0x11, 0xe5, 0x95, 0xfa, 
+    0x40, 0x57, 0x30, 0x64, 0xaf, 0x7a, 0x23, 0x3a, 0xf6, 0xe2, 0x3b, 0xf8, 0x71, 0x69, 0x85, 0xd9, 
+    0x2f, 0x49, 0xc2, 0x05, 0xb2, 0xcf, 0x26, 0xef, 0xa1, 0x2d, 0xb9, 0xfc, 0x97, 0x28, 0x99, 0xad, 
+    0x7e, 0xff, 0x9a, 0x09, 0x79, 0x86, 0xe9, 0x49, 0x04, 0x2c, 0x81, 0xc6, 0x11, 0xa1, 0x2c, 0x48, 
+    0xc7, 0x24, 0xb9, 0xa8, 0x93, 0x0e, 0xfd, 0xc4, 0xda, 0xe1, 0x47, 0xb5, 0xe9, 0xbf, 0x68, 0xcc, 
+    0x98, 0xe4, 0xc8, 0xd5, 0x9a, 0xc8, 0xfb, 0x10, 0xdf, 0x42, 0xe2, 0x8a, 0xf4, 0x1f, 0xff, 0xfd, 
+    0xbf, 0xa1, 0x1e, 0xd4, 0x00, 0x75, 0x8d, 0x1a, 0x6d, 0xee, 0xec, 0xcb, 0xf4, 0x80, 0x0b, 0x5b, 
+    0x8b, 0x4a, 0xb9, 0xa9, 0xb4, 0x88, 0xaf, 0xa4, 0xc7, 0x73, 0x62, 0x12, 0x12, 0x4a, 0xaf, 0x25, 
+    0x20, 0x9f, 0xed, 0xd0, 0x05, 0x77, 0xf7, 0xe9, 0x56, 0x44, 0x35, 0x45, 0x4f, 0x6b, 0xcb, 0x36, 
+    0x0d, 0xc9, 0xe6, 0x14, 0x24, 0x6b, 0x13, 0x91, 0xdc, 0xcf, 0x65, 0x85, 0xa9, 0x5b, 0x68, 0x1d, 
+    0xdc, 0x44, 0x65, 0xb7, 0x9e, 0xdf, 0x66, 0x98, 0x36, 0x43, 0x35, 0x1b, 0x9f, 0x04, 0xe9, 0x37, 
+    0xf9, 0xf1, 0xb0, 0x57, 0x96, 0x55, 0x79, 0x66, 0x5d, 0x67, 0x60, 0x47, 0x11, 0x2b, 0xf8, 0x44, 
+    0xac, 0xce, 0x5e, 0xe1, 0x8d, 0xaf, 0x32, 0x71, 0x06, 0x61, 0x54, 0xe6, 0x2b, 0xd5, 0x18, 0xbf, 
+    0x34, 0xc6, 0x0e, 0x64, 0x11, 0x1d, 0xc1, 0x2f, 0xc6, 0x2f, 0x39, 0x84, 0x09, 0xc1, 0x16, 0x7d, 
+    0x68, 0xc1, 0x71, 0xd0, 0xec, 0xbe, 0x6d, 0x05, 0x23, 0xdf, 0x26, 0x71, 0x91, 0x18, 0xf3, 0xa5, 
+    0x5b, 0xa7, 0x4d, 0x7e, 0x60, 0x1c, 0xde, 0x6a, 0x49, 0xab, 0x1d, 0x2a, 0x22, 0x28, 0xde, 0x12, 
+    0x79, 0x66, 0x37, 0x7a, 0xbe, 0x6d, 0x1e, 0x22, 0x12, 0x34, 0x46, 0x55, 0xc7, 0x6e, 0x84, 0x34, 
+    0xc1, 0x24, 0x0d, 0x66, 0xae, 0xfb, 0x45, 0x2a, 0xd7, 0xae, 0x18, 0x1a, 0xd8, 0x27, 0x36, 0x05, 
+    0x6b, 0xec, 0x30, 0x43, 0xdc, 0x80, 0x49, 0xb5, 0x4d, 0xbc, 0xe7, 0xce, 0x90, 0x1f, 0x7c, 0x5a, 
+    0x43, 0x4f, 0xe3, 0xa6, 0x36, 0x21, 0xd1, 0xba, 0xe2, 0x13, 0x25, 0xad, 0xad, 0xc0, 0xc4, 0x95, 
+    0xe3, 0xd5, 0x0a, 0x47, 0x39, 0x7a, 0xb8, 0x60, 0x0a, 0xd2, 0x2a, 0x2a, 0xb3, 0x1a, 0xbf, 0x8a, 
+    0x16, 0xa1, 0xd4, 0xe2, 0x03, 0x7f, 0xc6, 0xd6, 0x1f, 0xfa, 0x30, 0xe5, 0xaf, 0x49, 0x9f, 0x8a, 
+    0xea, 0xf8, 0x8a, 0x24, 0xc2, 0x1b, 0xb3, 0x71, 0x79, 0x80, 0x94, 0xae, 0x04, 0x78, 0x20, 0xd5, 
+    0xc4, 0x7d, 0xe4, 0xe9, 0x4b, 0x18, 0x2d, 0x15, 0xe9, 0x07, 0xea, 0xf8, 0x1d, 0x16, 0x17, 0x0d, 
+    0xbd, 0x12, 0x21, 0x1d, 0xab, 0x22, 0xe4, 0x22, 0xa6, 0xb9, 0x39, 0x9f, 0x74, 0x6c, 0x65, 0x3c, 
+    0xa9, 0x5d, 0xab, 0x34, 0x0a, 0xfa, 0x53, 0xb5, 0x4d, 0x3a, 0x43, 0x97, 0xcf, 0xbb, 0x44, 0x8a, 
+    0x4c, 0xa6, 0x88, 0x52, 0x39, 0x47, 0xd5, 0x6a, 0x13, 0xfc, 0xfd, 0x71, 0xf7, 0xd1, 0x63, 0x4e, 
+    0x52, 0x68, 0xe5, 0xa0, 0xcd, 0x82, 0x07, 0x4d, 0x61, 0x12, 0xf9, 0x9f, 0x6b, 0xce, 0x5a, 0x31, 
+    0x4e, 0xca, 0xbb, 0x5e, 0xd7, 0x2b, 0x52, 0x94, 0x0b, 0xa3, 0x10, 0x17, 0x71, 0x41, 0x59, 0x8e, 
+    0xcf, 0x1b, 0x76, 0x1b, 0xe3, 0x55, 0xc1, 0x82, 0xf0, 0xf3, 0xda, 0x4d, 0x46, 0x5d, 0xef, 0x23, 
+    0x1f, 0x54, 0x05, 0xfa, 0x81, 0x23, 0x8c, 0x2f, 0xc0, 0x29, 0x27, 0x47, 0x9b, 0xd1, 0xca, 0x0f, 
+    0x3f, 0x81, 0xd1, 0x16, 0x85, 0x29, 0xa2, 0x2f, 0xab, 0x4b, 0x8f, 0x53, 0x79, 0x79, 0x7c, 0x5c, 
+    0xd1, 0xa3, 0x4f, 0x9a, 0x76, 0xd7, 0x19, 0x5c, 0x58, 0x68, 0xc8, 0xc8, 0x47, 0x54, 0x96, 0x3a, 
+    0x8e, 0x57, 0x5f, 0x04, 0x25, 0x20, 0x6b, 0x87, 0x91, 0x0c, 0xdf, 0x1b, 0xeb, 0xb0, 0x3c, 0x84, 
+    0x7f, 0x9b, 0xc6, 0x26, 0x2f, 0xc7, 0x00, 0x74, 0x7d, 0xe8, 0x39, 0xa1, 0x68, 0x22, 0x30, 0x8f, 
+    0xa8, 0x9a, 0x69, 0xef, 0xa7, 0xd0, 0x81, 0x39, 0x6a, 0xae, 0x3c, 0x45, 0x44, 0xb5, 0xa2, 0x11, 
+    0x51, 0x53, 0x50, 0x38, 0xf8, 0x15, 0x14, 0x2c, 0x5c, 0xd7, 0x04, 0x54, 0x3a, 0x80, 0x8e, 0x66, 
+    0x55, 0x47, 0x43, 0xa9, 0x61, 0xcd, 0xfa, 0x65, 0x9b, 0xc4, 0x22, 0x41, 0xe4, 0x3b, 0xa5, 0xe4, 
+    0x85, 0x4d, 0xdb, 0xf5, 0x6e, 0x09, 0xcd, 0xf2, 0x76, 0xc0, 0x5c, 0x01, 0x14, 0xdc, 0x3d, 0xad, 
+    0x5d, 0x1a, 0xfb, 0x18, 0xf7, 0xc9, 0xca, 0xb6, 0xa4, 0xac, 0xa3, 0x22, 0x74, 0x46, 0x6c, 0x85, 
+    0x98, 0xd6, 0xd5, 0xc5, 0xb1, 0x7c, 0x23, 0x00, 0xb4, 0x3c, 0xca, 0x6b, 0x81, 0x0d, 0xf1, 0x60, 
+    0x37, 0xde, 0x5a, 0x92, 0x5f, 0xd8, 0x51, 0xb6, 0x36, 0x71, 0x0c, 0xe3, 0x35, 0xb5, 0x93, 0x2e, 
+    0xbb, 0x9d, 0xeb, 0xa6, 0x5b, 0x8c, 0x0b, 0xab, 0x24, 0xdb, 0x88, 0x20, 0xb2, 0x71, 0x8d, 0x4a, 
+    0x32, 0x98, 0xa2, 0xbe, 0xd0, 0xba, 0xc4, 0x30, 0x23, 0xb5, 0xda, 0xa3, 0xc0, 0x90, 0x4d, 0xc5, 
+    0xbf, 0xf7, 0xa0, 0x3c, 0x03, 0xca, 0x80, 0xf3, 0xde, 0x69, 0xdb, 0x5e, 0xc0, 0xf0, 0x62, 0x1d, 
+    0xd6, 0x1c, 0x33, 0x71, 0xc1, 0xce, 0x22, 0xd3, 0xd1, 0xcc, 0xb1, 0xcb, 0x83, 0x45, 0xe0, 0xcf, 
+    0xd3, 0x06, 0x3a, 0x17, 0x0b, 0x6c, 0x3d, 0x65, 0xb0, 0xce, 0xc4, 0x02, 0xcb, 0xe4, 0x99, 0x68, 
+    0xb4, 0xc6, 0x2d, 0x28, 0xf1, 0xeb, 0x93, 0xfa, 0xfe, 0x86, 0x38, 0xb5, 0x68, 0xe7, 0x53, 0xa9, 
+    0x49, 0xdd, 0x4e, 0x2f, 0x81, 0xfc, 0x0d, 0xb9, 0x18, 0x8b, 0x75, 0x7b, 0x65, 0xf9, 0x6e, 0x27, 
+    0xd4, 0x59, 0x81, 0xbb, 0xda, 0xd0, 0x58, 0x82, 0xbd, 0xfc, 0x78, 0x3c, 0x21, 0x99, 0x59, 0x9c, 
+    0x29, 0x58, 0x6c, 0x32, 0x57, 0xf0, 0x2d, 0x2e, 0xd6, 0x6b, 0xbf, 0x07, 0x5f, 0x10, 0x79, 0x56, 
+    0x62, 0x27, 0xce, 0xc4, 0x4d, 0x8b, 0xc4, 0x3e, 0xce, 0x23, 0xdb, 0x16, 0x94, 0x53, 0x0a, 0xd6, 
+    0x11, 0x46, 0xf0, 0x3e, 0xa3, 0x49, 0xf8, 0x5f, 0x96, 0xc7, 0x89, 0x1e, 0x93, 0xf9, 0xb9, 0x6b, 
+    0x31, 0x0b, 0x06, 0xa3, 0x9f, 0xc9, 0x89, 0xb8, 0x10, 0xcf, 0x66, 0x45, 0x04, 0xe2, 0xb2, 0x3b, 
+    0xee, 0xb9, 0x9c, 0xea, 0x0b, 0x16, 0xd9, 0x74, 0x64, 0x5a, 0x47, 0x99, 0x8c, 0x50, 0x8b, 0xff, 
+    0xa1, 0x14, 0x87, 0x3c, 0xb5, 0x21, 0x1d, 0xac, 0xec, 0xc1, 0x98, 0x02, 0x39, 0xa0, 0xd4, 0x43, 
+    0x12, 0x7c, 0xc9, 0xdd, 0x8b, 0x98, 0x9e, 0x8c, 0x6b, 0xca, 0x7a, 0x85, 0xeb, 0x47, 0x52, 0x96, 
+    0xd5, 0xf5, 0x8a, 0xb4, 0x8e, 0x12, 0xba, 0x52, 0xcb, 0x49, 0x24, 0x38, 0x3a, 0xdb, 0xe5, 0x1a, 
+    0x67, 0xdc, 0x7f, 0xff, 0x8f, 0x7f, 0xff, 0x5f, 0xfe, 0xdb, 0x7f, 0xfe, 0x77, 0x66, 0x38, 0xaa, 
+    0xc4, 0x7d, 0x3c, 0xb5, 0x9d, 0x13, 0xf6, 0x22, 0xaa, 0xe9, 0xdb, 0x10, 0xcb, 0x24, 0x81, 0x34, 
+    0x67, 0x5b, 0x59, 0x56, 0xcd, 0x87, 0x0d, 0x8d, 0xd4, 0x4b, 0xbc, 0x5f, 0x5d, 0x4f, 0xfd, 0xa1, 
+    0xe7, 0xa2, 0x14, 0x79, 0x1f, 0xd5, 0xfa, 0x77, 0xca, 0xf6, 0x50, 0xac, 0x2d, 0xd5, 0xb4, 0xb6, 
+    0xc4, 0x08, 0x4b, 0x4d, 0x32, 0x19, 0x0b, 0xb2, 0x94, 0x47, 0x15, 0xcd, 0x53, 0x75, 0xe7, 0x1e, 
+    0x97, 0xb0, 0x85, 0x36, 0xad, 0x96, 0xee, 0xd5, 0x39, 0x3b, 0x2a, 0x1e, 0xb5, 0x2c, 0x47, 0xb2, 
+    0x11, 0x9d, 0x6a, 0xae, 0xec, 0xe2, 0x2e, 0x6d, 0xfd, 0x3a, 0xd7, 0x14, 0xa5, 0x86, 0x1e, 0x98, 
+    0xb1, 0x6d, 0xe1, 0xa9, 0x5d, 0x54, 0x5c, 0x50, 0xfa, 0x78, 0xe4, 0xba, 0x9f, 0xe0, 0x49, 0xf2, 
+    0x8a, 0x21, 0x95, 0xbc, 0xb9, 0xc8, 0x37, 0xdc, 0xa3, 0x7b, 0x83, 0x78, 0x56, 0x66, 0xa9, 0x57, 
+    0xf8, 0x85, 0x3d, 0xac, 0x25, 0x1c, 0xf0, 0x7c, 0x17, 0x96, 0x07, 0x90, 0xa4, 0x04, 0xb2, 0x70, 
+    0xda, 0x6c, 0x5e, 0x66, 0x47, 0x95, 0xb2, 0x39, 0x96, 0x1c, 0x12, 0x27, 0x18, 0x26, 0xe9, 0xe0, 
+    0xb0, 0x9c, 0x16, 0x79, 0xd5, 0xdb, 0x38, 0x7a, 0x4e, 0x94, 0x68, 0x79, 0x48, 0xda, 0xdc, 0xd7, 
+    0xaf, 0xda, 0x8d, 0x18, 0xf5, 0x4b, 0x5b, 0xe4, 0x02, 0xe7, 0xb4, 0xc3, 0x41, 0x31, 0xf5, 0xd9, 
+    0xd0, 0x0a, 0x02, 0x5c, 0xba, 0x8d, 0x40, 0x44, 0x06, 0x78, 0x9f, 0x02, 0x16, 0x8a, 0x42, 0xef, 
+    0x6d, 0xf6, 0x0c, 0xd9, 0x25, 0x9b, 0x80, 0x2f, 0x57, 0x57, 0x35, 0xd7, 0x52, 0x3b, 0x35, 0x60, 
+    0x67, 0xfe, 0x96, 0x4e, 0x6b, 0x6b, 0x7a, 0x6b, 0x65, 0x48, 0xc4, 0x5c, 0x8d, 0xd5, 0x8e, 0x7d, 
+    0x23, 0x7c, 0x2c, 0xb6, 0x36, 0x8d, 0x2c, 0x4d, 0x8a, 0xf0, 0x54, 0x04, 0x49, 0xcc, 0xcf, 0xac, 
+    0xfa, 0x54, 0xf3, 0x7d, 0xca, 0x4d, 0x0b, 0x9e, 0xe1, 0x80, 0x20, 0xca, 0x51, 0x10, 0x37, 0x5f, 
+    0xf2, 0x68, 0x45, 0x2b, 0x15, 0x6d, 0x07, 0xc0, 0x2c, 0xdb, 0x84, 0x82, 0x6b, 0x5a, 0x31, 0xba, 
+    0x1d, 0x1a, 0xca, 0xac, 0x69, 0x57, 0xc7, 0x98, 0x25, 0xa0, 0xc8, 0x2a, 0x68, 0x66, 0x74, 0xb6, 
+    0x34, 0xb4, 0x82, 0xdd, 0x04, 0x54, 0x11, 0x4a, 0x52, 0xf8, 0x69, 0x99, 0x76, 0x42, 0xd5, 0xcd, 
+    0x38, 0xe8, 0xbd, 0xac, 0x3e, 0x65, 0x7f, 0x86, 0xd6, 0xad, 0x32, 0x04, 0x6b, 0xc3, 0xbf, 0x2e, 
+    0x82, 0x36, 0x30, 0x54, 0xb5, 0xae, 0x11, 0xeb, 0x98, 0x48, 0x5b, 0x31, 0x62, 0xaf, 0xb1, 0x67, 
+    0x4d, 0x62, 0xf1, 0xcc, 0x57, 0xae, 0x5e, 0x43, 0x9f, 0x11, 0xd4, 0x60, 0x8b, 0x4f, 0x07, 0x6a, 
+    0xc0, 0xa1, 0x74, 0x8d, 0x15, 0x6c, 0x44, 0xd0, 0xfd, 0x18, 0xd1, 0x48, 0x51, 0xb5, 0x0a, 0x05, 
+    0xc8, 0xe9, 0x84, 0x25, 0x5d, 0x24, 0x7f, 0xad, 0x51, 0xd5, 0x6a, 0x95, 0xe2, 0xa2, 0x17, 0x44, 
+    0x78, 0x17, 0x2a, 0xd8, 0x80, 0x22, 0x7d, 0x42, 0xb2, 0x46, 0xed, 0xae, 0xe6, 0xe5, 0x00, 0x56, 
+    0xfb, 0x2f, 0x48, 0x60, 0x3a, 0xfc, 0xcf, 0x04, 0xbf, 0xca, 0xe1, 0x85, 0xcc, 0xdc, 0x6b, 0xf2, 
+    0x84, 0xc9, 0xe2, 0xe2, 0xd6, 0x1f, 0xed, 0x3c, 0xab, 0x78, 0x48, 0x0a, 0xf3, 0x35, 0x6e, 0xba, 
+    0xf6, 0xc2, 0xcb, 0xa1, 0xd5, 0xc2, 0xfc, 0x2a, 0x74, 0x1b, 0x96, 0xe9, 0x6d, 0xfc, 0x18, 0x79, 
+    0x1b, 0x79, 0xd4, 0xb5, 0x70, 0x33, 0x6a, 0xa5, 0x84, 0x9b, 0x31, 0x2d, 0xfc, 0x93, 0x8a, 0x98, 
+    0xf1, 0x9e, 0x93, 0x26, 0x79, 0xcb, 0x6f, 0xe5, 0x44, 0x8d, 0xdc, 0xe1, 0x18, 0xd5, 0x40, 0x21, 
+    0xe7, 0x05, 0x4c, 0x55, 0x08, 0x6a, 0x96, 0x58, 0x7a, 0x71, 0x8a, 0x9b, 0x6d, 0x13, 0x5c, 0x76, 
+    0x0e, 0x0d, 0x74, 0x19, 0x65, 0xf4, 0x8b, 0x98, 0x8d, 0xd1, 0x36, 0xff, 0xd3, 0xda, 0xda, 0x5a, 
+    0x36, 0x69, 0x2f, 0x24, 0x13, 0x0a, 0x77, 0x7c, 0x3b, 0xe8, 0x99, 0x9e, 0xb8, 0xb9, 0x73, 0xa8, 
+    0xf1, 0x67, 0xda, 0x61, 0xa6, 0xf4, 0xeb, 0x51, 0xad, 0x1b, 0x5b, 0x26, 0x95, 0x79, 0x84, 0x48, 
+    0x5e, 0x19, 0xc8, 0xbb, 0x9d, 0x9e, 0xaa, 0x50, 0x9c, 0xf7, 0xda, 0x52, 0xba, 0x0f, 0x0f, 0x8d, 
+    0x6e, 0x2d, 0x70, 0xe2, 0x54, 0x9e, 0x91, 0xa5, 0x48, 0xff, 0xad, 0x39, 0x2e, 0xa6, 0x4b, 0x9e, 
+    0x35, 0x55, 0xa9, 0xde, 0xa2, 0x73, 0x6f, 0xf3, 0x20, 0x4a, 0x1e, 0xbc, 0x13, 0xc9, 0x06, 0x0b, 
+    0x89, 0x63, 0x97, 0x5b, 0xc6, 0x2f, 0xfe, 0x3e, 0x7e, 0xb8, 0x6d, 0x6b, 0xb9, 0xb3, 0x91, 0x31, 
+    0x64, 0xea, 0xa0, 0xe2, 0x3c, 0x2d, 0x48, 0x39, 0x1b, 0x99, 0x4f, 0x10, 0xd7, 0x5e, 0x0c, 0x9b, 
+    0x76, 0xf0, 0x31, 0x8e, 0x6b, 0x7f, 0x21, 0xf6, 0x4e, 0x3a, 0xdd, 0x98, 0x97, 0xb7, 0x05, 0x2d, 
+    0x9a, 0x77, 0x32, 0x9e, 0x71, 0x72, 0xe1, 0x5c, 0x93, 0x53, 0xb2, 0x4c, 0x2e, 0x9b, 0x61, 0x52, 
+    0x88, 0xff, 0xa3, 0x24, 0x98, 0x9c, 0x75, 0x38, 0xd7, 0x48, 0xb9, 0x31, 0x95, 0x88, 0x29, 0x99, 
+    0x23, 0xd3, 0x93, 0x6f, 0xa4, 0xd5, 0x29, 0x13, 0x71, 0x80, 0x35, 0x8a, 0x99, 0xab, 0xc1, 0x92, 
+    0x19, 0xd8, 0x36, 0xfa, 0xaa, 0x61, 0xce, 0x8c, 0xe0, 0x30, 0xb7, 0x07, 0x9a, 0x9b, 0x58, 0xb7, 
+    0xd3, 0x4a, 0x51, 0x47, 0x42, 0xe5, 0xc9, 0xe8, 0xcb, 0x39, 0x73, 0xc9, 0xe8, 0xca, 0xb0, 0x2c, 
+    0x50, 0x64, 0xe7, 0xef, 0x22, 0xf2, 0xae, 0x53, 0x21, 0xe6, 0x8f, 0x06, 0x81, 0xcc, 0x65, 0x1d, 
+    0xf9, 0xd6, 0x71, 0xbf, 0x02, 0x9f, 0xf0, 0x54, 0x59, 0xd0, 0x24, 0x9e, 0xaf, 0x13, 0xaf, 0xd2, 
+    0xc5, 0x44, 0xd8, 0x64, 0x1a, 0xba, 0x16, 0xba, 0xe6, 0xe7, 0xc9, 0xfd, 0x29, 0x53, 0x6c, 0xd2, 
+    0xe5, 0xdc, 0x29, 0xc9, 0x3e, 0x63, 0xf7, 0xc6, 0x46, 0x5d, 0xe7, 0xb4, 0x0b, 0xf2, 0x6a, 0xc1, 
+    0xa0, 0xab, 0x2b, 0x6b, 0x7b, 0xda, 0xf1, 0x71, 0x87, 0xc7, 0xaf, 0xd8, 0x2e, 0xcf, 0x64, 0x2f, 
+    0x96, 0x76, 0x59, 0x91, 0xc7, 0x4f, 0xde, 0x24, 0x25, 0x40, 0xcc, 0xa3, 0xbf, 0x50, 0xcd, 0x36, 
+    0x5d, 0xf8, 0x1e, 0xcb, 0x5b, 0x9a, 0x00, 0xcc, 0x82, 0xf4, 0x34, 0x2a, 0x32, 0xec, 0x01, 0xf9, 
+    0xf9, 0x7c, 0xbf, 0xb1, 0xde, 0x40, 0xf2, 0x44, 0x7e, 0x1a, 0xd5, 0xc5, 0xc1, 0x0a, 0x4f, 0xa4, 
+    0x06, 0xda, 0x5b, 0x26, 0x24, 0x00, 0x61, 0x0a, 0x64, 0x09, 0xbe, 0x52, 0x63, 0xb9, 0xb7, 0xd8, 
+    0x0b, 0x3d, 0xd0, 0x06, 0xac, 0xe9, 0x84, 0x01, 0x18, 0x1d, 0xc5, 0x2a, 0xac, 0xb7, 0xf7, 0xf1, 
+    0x29, 0x7a, 0xe3, 0xe9, 0x61, 0xa5, 0xb8, 0x96, 0xd7, 0x66, 0xcb, 0x6e, 0x13, 0x10, 0x5c, 0x79, 
+    0x27, 0xf6, 0x5d, 0xee, 0xc6, 0x34, 0x2d, 0x7c, 0x32, 0x64, 0xe0, 0x21, 0xdb, 0xdd, 0x05, 0x54, 
+    0x79, 0xf6, 0x37, 0xac, 0x72, 0x57, 0x3d, 0xce, 0xb3, 0x67, 0xcf, 0xf4, 0x80, 0xca, 0xae, 0x0e, 
+    0xd6, 0xe0, 0x50, 0x75, 0x0e, 0x55, 0x33, 0x2d, 0x5a, 0x02, 0x8a, 0x23, 0x11, 0x66, 0x50, 0xf6, 
+    0x4f, 0xc8, 0xd3, 0xcf, 0x60, 0x5e, 0x83, 0xc1, 0xd0, 0xfc, 0x42, 0x89, 0x9d, 0xee, 0x90, 0x6b, 
+    0x77, 0xa5, 0xd0, 0x13, 0x5e, 0x9f, 0xea, 0x3a, 0x2c, 0xa2, 0xad, 0x36, 0xa9, 0xef, 0x1c, 0x98, 
+    0x14, 0xd9, 0x4a, 0x16, 0x26, 0xec, 0x6f, 0x9e, 0x33, 0xc8, 0x65, 0xe3, 0x97, 0xcd, 0xf6, 0xec, 
+    0xbb, 0x2b, 0xef, 0x2d, 0x35, 0x2e, 0x07, 0xdf, 0xe3, 0xed, 0x52, 0xaa, 0x15, 0xde, 0x89, 0x00, 
+    0x50, 0x8a, 0xe7, 0xc3, 0x85, 0x60, 0xcc, 0xe6, 0x4d, 0x01, 0xad, 0x63, 0xaa, 0xc1, 0x18, 0x68, 
+    0x33, 0x1d, 0x14, 0xd8, 0xbf, 0x11, 0x81, 0xca, 0x4b, 0x76, 0xc1, 0xe8, 0x00, 0x66, 0xd5, 0x89, 
+    0x0b, 0xc8, 0xd9, 0xbf, 0x83, 0x47, 0x5d, 0x7c, 0x54, 0xa3, 0x47, 0x0d, 0x7a, 0xd2, 0xe4, 0x30, 
+    0x52, 0x38, 0x28, 0x77, 0x29, 0x7b, 0x77, 0x0a, 0xe3, 0x06, 0x77, 0x2b, 0xfc, 0x60, 0x85, 0x57, 
+    0x7c, 0xf0, 0xfa, 0xd5, 0xeb, 0xb7, 0x7f, 0x3d, 0x3e, 0x3d, 0x7a, 0x75, 0x78, 0x49, 0x51, 0x3f, 
+    0x4d, 0xd4, 0xe4, 0x98, 0xeb, 0x96, 0xe2, 0x7c, 0xe8, 0xa2, 0x46, 0xf1, 0xf9, 0x7a, 0x70, 0x20, 
+    0x9e, 0xb6, 0xc6, 0xd6, 0x40, 0x7e, 0x46, 0x4f, 0x3d, 0x1f, 0x6f, 0x8e, 0x88, 0xbe, 0x45, 0x6f, 
+    0x9a, 0x2e, 0x0f, 0x1e, 0xc2, 0xcf, 0xe8, 0x69, 0xd7, 0xb7, 0xc6, 0xf2, 0x53, 0x3c, 0xc5, 0x0c, 
+    0xf1, 0x31, 0xcd, 0x27, 0x92, 0xae, 0x46, 0x87, 0xc2, 0x29, 0xfd, 0xaa, 0x7e, 0x24, 0x7c, 0x45, 
+    0xbb, 0x10, 0x1d, 0x77, 0x61, 0x70, 0x68, 0x79, 0x1d, 0x7e, 0xcc, 0x99, 0xdf, 0x1c, 0xc1, 0x1b, 
+    0x8f, 0x96, 0x61, 0x56, 0x25, 0x04, 0xc8, 0x1a, 0xb7, 0x3f, 0x44, 0x97, 0x48, 0x12, 0x7a, 0x71, 
+    0xe9, 0x85, 0xe7, 0xeb, 0x87, 0xec, 0xe9, 0xc2, 0xf8, 0x4b, 0xf1, 0x62, 0x0f, 0xcc, 0xc7, 0x6c, 
+    0x89, 0x80, 0x8b, 0xcd, 0x10, 0xef, 0x13, 0x90, 0x9b, 0xec, 0xf0, 0x2b, 0xda, 0x5e, 0x87, 0x1f, 
+    0xda, 0x65, 0x16, 0xa1, 0xd7, 0xed, 0xba, 0xd1, 0x0d, 0x5f, 0x85, 0xa8, 0xcb, 0x11, 0x0e, 0x09, 
+    0x86, 0x61, 0xcf, 0x91, 0xe6, 0x89, 0xdc, 0x78, 0x1b, 0x62, 0xdb, 0xef, 0x82, 0x64, 0x91, 0x01, 
+    0x62, 0x2e, 0x8a, 0xc9, 0xc4, 0x79, 0x64, 0x82, 0x11, 0xa7, 0x46, 0x2f, 0xd1, 0x8f, 0xd6, 0x48, 
+    0x8c, 0x5a, 0x74, 0x1d, 0x96, 0x7b, 0xb8, 0x23, 0x23, 0x7c, 0xc5, 0x2d, 0xcf, 0xc5, 0x54, 0x54, 
+    0x81, 0xdd, 0x92, 0xe1, 0xe1, 0xea, 0xb0, 0x88, 0xd7, 0xbf, 0xe4, 0x4f, 0xa7, 0xd9, 0xc1, 0x1c, 
+    0xb0, 0xc8, 0xd1, 0x88, 0xfb, 0xfc, 0xf4, 0xb2, 0x29, 0x0d, 0x81, 0xea, 0xdb, 0x74, 0x17, 0x63, 
+    0x42, 0x3a, 0x9e, 0xd0, 0x91, 0x97, 0xed, 0x94, 0x7c, 0x3a, 0x5c, 0x22, 0x04, 0xb1, 0xce, 0x00, 
+    0xd3, 0xe4, 0x3a, 0x60, 0x17, 0xfa, 0x81, 0x9e, 0x16, 0x97, 0x27, 0x05, 0x56, 0x87, 0xef, 0xf9, 
+    0xcf, 0xcf, 0xb5, 0x2f, 0x51, 0x52, 0x29, 0xab, 0x7d, 0x80, 0x28, 0x9e, 0xc3, 0xec, 0x36, 0x04, 
+    0x8b, 0xc0, 0xf2, 0xaf, 0x25, 0x19, 0x0a, 0xb8, 0x84, 0x4f, 0xc5, 0x04, 0x19, 0x2f, 0xe0, 0x92, 
+    0xaf, 0x39, 0x51, 0xc2, 0x8d, 0xa2, 0x32, 0x0c, 0x0d, 0x16, 0x2b, 0x8e, 0x5d, 0x54, 0x10, 0x6d, 
+    0x30, 0x6e, 0x47, 0xe1, 0x0f, 0xa2, 0x13, 0x1d, 0xba, 0x3e, 0x50, 0x12, 0xd2, 0xc1, 0x9b, 0xbc, 
+    0xe2, 0x61, 0x3f, 0x9c, 0x09, 0x53, 0xfa, 0xe7, 0xeb, 0x4f, 0xf7, 0x58, 0xed, 0x43, 0xf1, 0xa7, 
+    0x7b, 0x42, 0xf0, 0xf0, 0xd5, 0x30, 0x0f, 0x40, 0xcb, 0x2d, 0x52, 0xb8, 0x08, 0xf0, 0x5f, 0xb5, 
+    0xd4, 0x73, 0xa2, 0x7a, 0x60, 0x38, 0x22, 0xc2, 0x44, 0x43, 0xd4, 0x96, 0xcf, 0x04, 0xfd, 0xc5, 
+    0x4c, 0xfe, 0x11, 0xf7, 0xfb, 0x40, 0x89, 0xf7, 0x16, 0xce, 0xdf, 0xfa, 0xfc, 0x65, 0x94, 0x57, 
+    0xce, 0x1f, 0x5e, 0x8d, 0xca, 0xfa, 0xc1, 0x4b, 0x6e, 0xab, 0x2c, 0x44, 0x77, 0xa9, 0x6f, 0x64, 
+    0xb4, 0x90, 0x96, 0xff, 0x5b, 0x88, 0x0f, 0x25, 0xb3, 0xb2, 0x18, 0x5e, 0xf5, 0x11, 0x16, 0xb9, 
+    0xcd, 0x03, 0xb2, 0x95, 0xab, 0xec, 0x1c, 0xa0, 0xa8, 0x3a, 0x2d, 0xd0, 0xf5, 0x3b, 0x67, 0x40, 
+    0x72, 0xcb, 0xb7, 0x3a, 0x61, 0xde, 0xec, 0x4e, 0x92, 0x53, 0xea, 0x53, 0x91, 0x83, 0x9a, 0x8e, 
+    0xed, 0x68, 0xbd, 0x19, 0x69, 0x46, 0xcc, 0xc2, 0xaa, 0x7e, 0x49, 0xd9, 0x4c, 0x7b, 0xf8, 0x39, 
+    0x42, 0xf4, 0x25, 0x2d, 0xe7, 0x39, 0x57, 0x70, 0x29, 0x66, 0x2b, 0x1f, 0x34, 0xa4, 0x72, 0xf1, 
+    0x1e, 0x14, 0xe5, 0x5f, 0x4e, 0xbf, 0x1b, 0x46, 0x04, 0x8a, 0x71, 0x35, 0xcc, 0xa6, 0x11, 0x41, 
+    0xce, 0xcc, 0xf4, 0xb1, 0x42, 0x50, 0xd1, 0x10, 0x99, 0x34, 0x40, 0x38, 0x58, 0x34, 0x2e, 0xa6, 
+    0x35, 0x47, 0x5a, 0xfe, 0x05, 0xf6, 0x15, 0x7b, 0x09, 0x4c, 0xe7, 0x9f, 0xee, 0x79, 0x79, 0x74, 
+    0xbf, 0x3f, 0x88, 0x5e, 0xfb, 0xaa, 0xba, 0xf2, 0xc0, 0x45, 0x97, 0x19, 0x66, 0xcc, 0x4e, 0xd3, 
+    0x0d, 0xa0, 0x19, 0x9a, 0x2e, 0x18, 0xb0, 0x9a, 0x03, 0x0f, 0xe1, 0x79, 0x10, 0x2a, 0x31, 0x2c, 
+    0x97, 0x76, 0x33, 0x51, 0x02, 0x69, 0x0c, 0x9d, 0x71, 0x53, 0x91, 0x32, 0x18, 0xf0, 0x8d, 0x4c, 
+    0x75, 0x22, 0xe3, 0x4d, 0xe6, 0x19, 0xbc, 0x9f, 0x25, 0x3b, 0x05, 0xc3, 0xbe, 0x28, 0x40, 0x9a, 
+    0x46, 0x14, 0xdc, 0x8f, 0x0f, 0xf3, 0x47, 0x18, 0xe8, 0x29, 0x43, 0x5d, 0x3f, 0xd9, 0x16, 0x1b, 
+    0x9c, 0xc4, 0x93, 0xe8, 0x98, 0x9a, 0x3e, 0x3a, 0x8d, 0x57, 0x0f, 0xda, 0x8d, 0x05, 0x0f, 0x0b, 
+    0xc8, 0x48, 0x96, 0x0f, 0x3e, 0xde, 0xab, 0xfc, 0x1a, 0x24, 0xdd, 0xb8, 0x92, 0x33, 0x30, 0xbc, 
+    0x07, 0xba, 0x22, 0x43, 0xeb, 0x07, 0x0c, 0x08, 0x9c, 0x65, 0x61, 0xc1, 0x43, 0xf8, 0x76, 0xc4, 
+    0x1d, 0x44, 0xb1, 0x84, 0x61, 0xf3, 0x22, 0xc5, 0xa2, 0xcd, 0x29, 0xb7, 0x8d, 0x0a, 0x8e, 0x9b, 
+    0xf3, 0x7f, 0xe2, 0xf6, 0xad, 0xc7, 0x98, 0xa3, 0x17, 0x98, 0xa5, 0x13, 0x66, 0x11, 0xe9, 0xf5, 
+    0x6c, 0x4d, 0x5c, 0xb0, 0x00, 0xfc, 0xc7, 0x19, 0x9b, 0x5f, 0x24, 0xbd, 0x5c, 0x07, 0x4c, 0xb7, 
+    0x87, 0x96, 0xe3, 0x7f, 0x1a, 0xce, 0xc7, 0x61, 0xbf, 0xd6, 0x62, 0x92, 0x45, 0x39, 0x3a, 0x69, 
+    0x41, 0xcf, 0x67, 0x30, 0xb0, 0x50, 0x86, 0xa3, 0x90, 0x3d, 0x2b, 0xee, 0xd2, 0xc0, 0xa3, 0x5f, 
+    0xf9, 0x95, 0xd9, 0x9a, 0x61, 0x5e, 0xbd, 0xf0, 0xc7, 0x9b, 0xfc, 0x23, 0x8d, 0x20, 0xf4, 0x81, 
+    0x37, 0xe0, 0x3c, 0x50, 0x3d, 0x66, 0xa8, 0x02, 0x5d, 0x69, 0x6c, 0x73, 0x3f, 0x97, 0xd4, 0x16, 
+    0x89, 0x82, 0xc6, 0x91, 0xe4, 0xf2, 0xbf, 0xfa, 0xd3, 0xe7, 0x4a, 0xf1, 0xe9, 0x5e, 0xf1, 0xd8, 
+    0x2a, 0x76, 0xbe, 0xdc, 0xaf, 0x3f, 0xfc, 0x54, 0x2e, 0x61, 0x94, 0x70, 0x4e, 0x61, 0xcf, 0x9b, 
+    0xc7, 0xe0, 0x93, 0xb6, 0x83, 0xa8, 0x35, 0x71, 0xfa, 0xfd, 0x21, 0x66, 0x37, 0x60, 0x1f, 0xa7, 
+    0x38, 0x8d, 0xf5, 0x39, 0x44, 0xec, 0x00, 0xe9, 0xeb, 0x9b, 0x14, 0x97, 0x9f, 0x21, 0x9d, 0xba, 
+    0x6a, 0x28, 0x49, 0xb1, 0xfa, 0x25, 0x36, 0xc0, 0x30, 0x8c, 0xad, 0xa2, 0x5f, 0x8e, 0xad, 0xcc, 
+    0xf9, 0xb9, 0x2a, 0x90, 0xb2, 0x9f, 0x82, 0x9f, 0xe4, 0x48, 0xa1, 0x4f, 0x77, 0x56, 0x6b, 0xed, 
+    0xe1, 0xae, 0x4d, 0x55, 0xbb, 0xba, 0x0c, 0x07, 0xb7, 0x07, 0xc5, 0x7d, 0x68, 0xe6, 0x7c, 0x09, 
+    0x7d, 0x64, 0xcc, 0xca, 0x4e, 0x20, 0x34, 0x02, 0xb9, 0x88, 0x28, 0xed, 0x72, 0x6c, 0x35, 0xa8, 
+    0x8e, 0xb8, 0x93, 0x51, 0xdd, 0x92, 0x19, 0x57, 0xee, 0xd5, 0xe6, 0x9e, 0x7f, 0xbd, 0xc5, 0xee, 
+    0xd5, 0x15, 0x38, 0x34, 0x30, 0xf0, 0xc1, 0x8a, 0xd6, 0x67, 0xf3, 0xcc, 0xb9, 0x51, 0x53, 0xfd, 
+    0xeb, 0x93, 0xe9, 0x92, 0x8f, 0x20, 0x31, 0xb1, 0xff, 0xc5, 0x94, 0x1a, 0x19, 0x53, 0x0e, 0xb4, 
+    0xcc, 0xc0, 0x45, 0x30, 0xd3, 0x91, 0xf1, 0xf5, 0x0b, 0xa7, 0x0a, 0x46, 0xd3, 0x44, 0x11, 0x17, 
+    0x30, 0x86, 0x80, 0x6b, 0x4c, 0x23, 0xab, 0x4c, 0x9a, 0xde, 0x3b, 0x86, 0xfb, 0x44, 0x96, 0x4c, 
+    0x1c, 0x17, 0xc7, 0xcb, 0xd8, 0x64, 0x23, 0xa6, 0x55, 0x2d, 0x81, 0x26, 0xd6, 0x4d, 0x00, 0xe9, 
+    0x95, 0xab, 0xb2, 0xa9, 0x53, 0xff, 0xfc, 0x57, 0x2b, 0x89, 0x5b, 0x69, 0xfe, 0x87, 0xba, 0x5a, 
+    0x29, 0x66, 0xc7, 0x2c, 0xed, 0xf6, 0x9e, 0x7e, 0x29, 0xd2, 0xc4, 0x05, 0x82, 0xe9, 0xd7, 0xe6, 
+    0x43, 0x52, 0xbb, 0x17, 0x29, 0xe1, 0x83, 0x0e, 0xf0, 0xa2, 0xc8, 0xe9, 0x86, 0xf2, 0x5b, 0x04, 
+    0x32, 0xc7, 0x38, 0xa0, 0x17, 0x2b, 0x27, 0x99, 0x38, 0x38, 0x88, 0x99, 0xcb, 0x7f, 0xd8, 0x0e, 
+    0xbe, 0xd7, 0x1b, 0xad, 0x92, 0x22, 0x2f, 0xda, 0xe3, 0x69, 0x7e, 0x6f, 0x2d, 0x65, 0xc4, 0x5b, 
+    0xee, 0x34, 0x0f, 0xd5, 0x6a, 0xcd, 0x50, 0x22, 0x62, 0x61, 0x38, 0x85, 0x21, 0xa9, 0xbb, 0x9c, 
+    0x72, 0x30, 0x4d, 0xbe, 0x15, 0x69, 0x7e, 0x8b, 0x5a, 0xef, 0x4c, 0xe2, 0x47, 0x36, 0x9f, 0x7a, 
+    0x38, 0x67, 0x1e, 0x99, 0x4b, 0xdd, 0xb3, 0x79, 0x78, 0x0c, 0x11, 0x26, 0xca, 0x12, 0x32, 0xac, 
+    0x9d, 0x3c, 0x88, 0x3c, 0xed, 0x29, 0x77, 0x7b, 0x09, 0xa0, 0x85, 0x76, 0x56, 0xd4, 0x0d, 0xd2, 
+    0x73, 0x66, 0xd5, 0xd7, 0x22, 0x52, 0x27, 0x5d, 0x11, 0x25, 0x33, 0x38, 0x89, 0xcd, 0x28, 0x6d, 
+    0x47, 0x4b, 0x10, 0xf8, 0xee, 0x94, 0x6b, 0x1d, 0x2d, 0xf5, 0xd2, 0xfc, 0x79, 0x3e, 0x8b, 0x89, 
+    0x54, 0x9f, 0xa9, 0x8c, 0x37, 0x6f, 0xc2, 0xd2, 0x58, 0x4c, 0x72, 0x2a, 0xd9, 0x89, 0x64, 0x6c, 
+    0x41, 0x17, 0xd8, 0x13, 0x15, 0x06, 0x2a, 0x15, 0x93, 0xaf, 0xc2, 0x20, 0x1a, 0x3a, 0x2f, 0xed, 
+    0xf1, 0xb4, 0x15, 0xc9, 0x38, 0x2c, 0x02, 0x50, 0xf1, 0xda, 0x56, 0x17, 0xa8, 0x97, 0x60, 0x4c, 
+    0xf6, 0xf5, 0xc3, 0xbf, 0x22, 0x4a, 0x7f, 0x06, 0x16, 0x01, 0x15, 0xc3, 0xa2, 0xdd, 0x38, 0xf1, 
+    0xb7, 0xfc, 0xc6, 0x09, 0x15, 0x59, 0xf9, 0x44, 0x10, 0x87, 0x8e, 0x18, 0x51, 0x38, 0x4d, 0x1e, 
+    0x45, 0x57, 0xa6, 0x49, 0xe4, 0x05, 0xdd, 0xc4, 0xc0, 0x28, 0x62, 0x93, 0xed, 0x5d, 0x9c, 0x32, 
+    0x68, 0x05, 0xc5, 0xbb, 0x4b, 0x8a, 0xf9, 0x9a, 0x27, 0x3b, 0x31, 0x77, 0x26, 0xbf, 0x98, 0x96, 
+    0x36, 0x6c, 0x19, 0x28, 0xd5, 0x20, 0x5c, 0x58, 0x20, 0xff, 0x69, 0x55, 0x24, 0xe7, 0x58, 0x81, 
+    0x19, 0x47, 0x2d, 0xb6, 0xe4, 0xcf, 0x64, 0x4e, 0xf9, 0x65, 0xd4, 0xe7, 0x93, 0x49, 0xfa, 0x73, 
+    0xbe, 0x4e, 0x31, 0xb5, 0x0e, 0x19, 0xb8, 0x69, 0xb7, 0x01, 0xc6, 0x13, 0xe7, 0xcc, 0xd6, 0x4b, 
+    0x53, 0xe4, 0x20, 0x36, 0xb9, 0xca, 0x6b, 0xf7, 0x26, 0xf5, 0xfa, 0x5e, 0xbb, 0x6d, 0xe4, 0x70, 
+    0xe3, 0x97, 0x0a, 0x77, 0xc8, 0x73, 0x87, 0x17, 0x98, 0x63, 0x24, 0x4f, 0x4e, 0x8e, 0x3d, 0xcb, 
+    0xf5, 0xa1, 0x0b, 0xf1, 0xd2, 0x61, 0x55, 0x20, 0x2f, 0x05, 0x58, 0x00, 0x63, 0x8e, 0x36, 0x6c, 
+    0xa8, 0xf6, 0x93, 0x47, 0xd9, 0x3d, 0xd1, 0xb3, 0x2a, 0x89, 0x95, 0x9e, 0x15, 0x7c, 0xe2, 0x0d, 
+    0x89, 0x27, 0x79, 0x2b, 0x05, 0x1e, 0x4c, 0xf4, 0x32, 0xf3, 0x62, 0x3c, 0x35, 0x93, 0xd6, 0x3f, 
+    0x11, 0x0a, 0xcd, 0x91, 0x3b, 0x39, 0x7d, 0xff, 0xc4, 0x6b, 0x4d, 0x25, 0x47, 0xe8, 0x28, 0x12, 
+    0xdd, 0x53, 0xae, 0x98, 0x9c, 0x15, 0x1b, 0x6c, 0xf1, 0x2b, 0xb5, 0x99, 0x90, 0x1a, 0x43, 0x8d, 
+    0x6f, 0x1b, 0xdb, 0xd7, 0x34, 0xab, 0x26, 0x77, 0xec, 0x63, 0x3a, 0x35, 0x32, 0x67, 0xf8, 0xcf, 
+    0xd4, 0xbd, 0x27, 0xdc, 0x88, 0x65, 0x64, 0xc8, 0xd2, 0x86, 0x38, 0xdd, 0x89, 0x1e, 0xd3, 0x6c, 
+    0xc7, 0x7c, 0x65, 0x31, 0x9f, 0x7a, 0x4b, 0x68, 0xb4, 0x79, 0x4a, 0x2b, 0xb5, 0x26, 0x37, 0xd6, 
+    0xb4, 0x8a, 0xf3, 0x3a, 0x15, 0x6a, 0x61, 0xcb, 0xf7, 0x52, 0x94, 0x6e, 0xcb, 0x46, 0xc7, 0xc2, 
+    0xb5, 0x5a, 0xf3, 0x06, 0x0d, 0x66, 0xd9, 0xe4, 0x41, 0xaa, 0x6c, 0x8c, 0x33, 0x38, 0x06, 0x02, 
+    0x39, 0x73, 0x25, 0x79, 0x43, 0xaf, 0x0f, 0x9d, 0x9b, 0xa9, 0x4d, 0xd3, 0x86, 0x53, 0x10, 0xb5, 
+    0xee, 0x89, 0x2c, 0x6b, 0xf4, 0x89, 0xda, 0xd7, 0x31, 0x72, 0x3f, 0x4a, 0xd0, 0x94, 0x1b, 0xbb, 
+    0x16, 0xbe, 0x7c, 0x49, 0x1c, 0x11, 0x9b, 0x7d, 0x55, 0x96, 0x1d, 0xb4, 0xac, 0xa1, 0x7d, 0x12, 
+    0xf6, 0xdd, 0x9c, 0xce, 0x2c, 0x79, 0x22, 0x2d, 0xc9, 0xc0, 0x7c, 0xca, 0xc5, 0x5a, 0x0b, 0x93, 
+    0x17, 0x1d, 0x45, 0x9b, 0xe3, 0x36, 0x2f, 0xe3, 0x6c, 0x4c, 0x3b, 0x7e, 0x4c, 0xec, 0x31, 0xc8, 
+    0xa1, 0xc3, 0x4f, 0xcb, 0x10, 0xc2, 0x8f, 0x2c, 0x3d, 0x0e, 0x09, 0x78, 0xd8, 0x66, 0x39, 0x1a, 
+    0xe8, 0x84, 0x50, 0x0a, 0x11, 0x5f, 0xd3, 0x6e, 0xa2, 0x74, 0xf1, 0x16, 0x01, 0xd4, 0xf4, 0xbf, 
+    0x87, 0xd8, 0xf1, 0xc9, 0x65, 0xd6, 0x75, 0x5f, 0x74, 0x7c, 0x67, 0x27, 0x43, 0x8e, 0x95, 0xad, 
+    0x3f, 0x75, 0xd6, 0xd7, 0xd3, 0x04, 0x31, 0xa2, 0x73, 0x8e, 0x96, 0x3d, 0x89, 0x29, 0x89, 0x27, 
+    0x29, 0x72, 0x3b, 0xad, 0xb9, 0xd9, 0x64, 0xb2, 0x84, 0x7f, 0x6e, 0xb6, 0x6c, 0x6e, 0x6e, 0xc2, 
+    0x30, 0x26, 0xdf, 0xf0, 0x95, 0x4d, 0x79, 0x6a, 0xf0, 0x62, 0x28, 0xb0, 0x5b, 0x26, 0x71, 0xc3, 
+    0x98, 0x25, 0x0c, 0x31, 0x19, 0x8c, 0xfa, 0xda, 0x0c, 0x01, 0xbf, 0xd0, 0x23, 0x82, 0x1f, 0x4f, 
+    0x78, 0x1a, 0x4c, 0x19, 0xe6, 0xc2, 0xb7, 0x79, 0xf0, 0x85, 0xe6, 0x8b, 0xc3, 0xc2, 0x52, 0x9b, 
+    0xe1, 0xab, 0xdd, 0x1d, 0x0c, 0xe9, 0xc6, 0xff, 0x54, 0x41, 0x7a, 0x5e, 0x56, 0x8f, 0xb5, 0x8b, 
+    0xe4, 0x30, 0x31, 0xc3, 0x59, 0x36, 0xa5, 0x78, 0x5a, 0xd9, 0x78, 0xc1, 0x97, 0x59, 0x2d, 0x2c, 
+    0x05, 0xc0, 0xa2, 0x60, 0x9b, 0x58, 0x3c, 0x0d, 0x6f, 0x2c, 0x06, 0x34, 0xed, 0x75, 0xbd, 0x1c, 
+    0x46, 0x86, 0x42, 0xe7, 0xf5, 0x87, 0xfa, 0xde, 0x65, 0xf4, 0x4c, 0x36, 0xf6, 0xdc, 0xbe, 0x91, 
+    0x87, 0x7c, 0xb5, 0x33, 0x13, 0x94, 0xfd, 0x05, 0xbe, 0xc6, 0x93, 0xf5, 0xf0, 0x53, 0x13, 0xe2, 
+    0xb0, 0x3b, 0x61, 0xd2, 0x42, 0xb2, 0x9d, 0x41, 0x60, 0x46, 0x64, 0x53, 0x09, 0xbc, 0xf1, 0x4f, 
+    0x46, 0x83, 0x21, 0x11, 0x04, 0xf6, 0x0c, 0x63, 0x9c, 0x25, 0x09, 0x2f, 0x46, 0xbc, 0xde, 0x6c, 
+    0x0c, 0x64, 0x3d, 0x62, 0x0f, 0x3d, 0x01, 0x5e, 0xf4, 0x99, 0xd5, 0xf5, 0x34, 0x6a, 0xf1, 0x78, 
+    0x59, 0xac, 0x52, 0x02, 0xa5, 0x6b, 0x06, 0x25, 0x3a, 0x0e, 0xf4, 0x0c, 0x73, 0x07, 0x49, 0x7c, 
+    0xfc, 0x11, 0x20, 0xec, 0x29, 0x84, 0xe2, 0x8d, 0x86, 0x89, 0x03, 0x95, 0xa9, 0x1c, 0x80, 0xb6, 
+    0x05, 0x68, 0x72, 0x99, 0x84, 0x1e, 0xb4, 0x7f, 0x59, 0x26, 0xc5, 0x97, 0x49, 0x13, 0x2c, 0xe5, 
+    0xe9, 0xd8, 0x35, 0xaf, 0x05, 0x0e, 0x77, 0xb4, 0x99, 0x81, 0x0d, 0x03, 0xb1, 0x89, 0x55, 0x2a, 
+    0x89, 0x16, 0x44, 0xab, 0xa9, 0x09, 0xcb, 0x2d, 0xf6, 0x3f, 0xfe, 0xe2, 0x4a, 0x36, 0xef, 0xaa, 
+    0x67, 0xab, 0xf0, 0x51, 0xba, 0xc5, 0xc6, 0x16, 0x2d, 0x9c, 0x63, 0x21, 0xb9, 0x44, 0xcc, 0xe8, 
+    0xd4, 0xfe, 0x79, 0xe4, 0x7b, 0xe3, 0xd5, 0x1a, 0xd0, 0x8c, 0x21, 0x15, 0x63, 0x89, 0x22, 0x2f, 
+    0xf3, 0x8f, 0xb0, 0x90, 0x3b, 0x50, 0x12, 0x44, 0xcc, 0x63, 0x1d, 0x5a, 0xd8, 0x99, 0x3e, 0x26, 
+    0x7e, 0x94, 0x71, 0xaa, 0x87, 0x89, 0x40, 0x82, 0x85, 0x1c, 0x4c, 0x74, 0xc2, 0x2e, 0x98, 0xdb, 
+    0xbf, 0xa4, 0x27, 0x8e, 0x95, 0x66, 0x3b, 0x47, 0x81, 0xe3, 0x54, 0xbf, 0xe9, 0xee, 0x9f, 0xda, 
+    0x67, 0xc4, 0xa9, 0x88, 0x79, 0x8b, 0x14, 0x77, 0xc8, 0x7e, 0x87, 0x29, 0xc3, 0x38, 0x06, 0xad, 
+    0x6b, 0x42, 0x3c, 0x6b, 0x79, 0x2a, 0x76, 0xfd, 0x26, 0xaa, 0x31, 0xaa, 0xa3, 0x88, 0xa0, 0xfa, 
+    0xa2, 0x4a, 0xa4, 0xbd, 0xff, 0xe0, 0x5b, 0xc3, 0xd9, 0x85, 0x05, 0x70, 0x11, 0xd3, 0x35, 0xa5, 
+    0x20, 0x39, 0xa5, 0xf4, 0xbc, 0xf3, 0xe1, 0xd0, 0x8b, 0xe3, 0xa9, 0xca, 0x19, 0x0b, 0x1f, 0x5e, 
+    0x16, 0x01, 0xf5, 0x82, 0xa3, 0x21, 0x72, 0x6f, 0x3f, 0x9c, 0xba, 0x7b, 0xdf, 0x0c, 0x07, 0x45, 
+    0x51, 0x5c, 0x38, 0x32, 0xa4, 0x8e, 0x56, 0x6c, 0xa3, 0xc3, 0xaa, 0x3c, 0xb8, 0x28, 0xf6, 0xec, 
+    0x73, 0x45, 0x85, 0x14, 0x69, 0x9c, 0x4a, 0xdc, 0x42, 0x24, 0xaf, 0x16, 0xe2, 0xee, 0x48, 0x41, 
+    0x14, 0xbe, 0xe7, 0x17, 0x12, 0xed, 0x90, 0xf6, 0x49, 0xd5, 0xd7, 0x51, 0x07, 0x62, 0xca, 0xd6, 
+    0x44, 0xe5, 0x51, 0x62, 0x11, 0xbc, 0xe1, 0x92, 0xc0, 0xd0, 0x41, 0xa0, 0xb7, 0x80, 0x1c, 0x0e, 
+    0x25, 0x3a, 0xc2, 0x9e, 0xe3, 0x23, 0xe2, 0x2f, 0xe5, 0x6f, 0x43, 0xfb, 0x97, 0x6e, 0x39, 0x9f, 
+    0x36, 0x90, 0x05, 0x2b, 0x92, 0xc3, 0x98, 0xe4, 0xf9, 0xc5, 0xc5, 0x73, 0xc6, 0x99, 0x61, 0xf9, 
+    0xb0, 0x62, 0x1d, 0x0d, 0x87, 0x9e, 0x1f, 0xca, 0xc1, 0xfc, 0x7b, 0xf1, 0xc0, 0x6c, 0x1f, 0x76, 
+    0x32, 0xa5, 0x26, 0x7c, 0xb9, 0xcf, 0xfa, 0xd6, 0x9d, 0xf4, 0xdb, 0x50, 0x53, 0xe9, 0xdd, 0x2e, 
+    0xdd, 0x24, 0x1c, 0x25, 0xd3, 0x9a, 0xab, 0x75, 0xc7, 0xc4, 0x3a, 0xcf, 0xe3, 0xd9, 0x73, 0xc0, 
+    0x08, 0xb2, 0xee, 0x18, 0xd5, 0x91, 0x2f, 0x31, 0x91, 0xba, 0x99, 0xdf, 0x7d, 0xa2, 0x1f, 0xf9, 
+    0x55, 0x75, 0xe6, 0x7f, 0xef, 0xf6, 0xd3, 0x91, 0xf4, 0xe8, 0x0a, 0x0a, 0x39, 0x91, 0x50, 0x7e, 
+    0x02, 0x7e, 0xfc, 0x12, 0x1b, 0xf0, 0x96, 0x1e, 0xe4, 0x84, 0x9f, 0x07, 0xbf, 0x97, 0xbc, 0x01, 
+    0x29, 0x90, 0x1d, 0xa5, 0x4b, 0x23, 0x95, 0x13, 0x8d, 0xca, 0x52, 0xe0, 0xe3, 0x59, 0x49, 0x10, 
+    0x15, 0x4a, 0x3e, 0x58, 0xe2, 0x13, 0xc5, 0x1c, 0x4d, 0xe2, 0x77, 0x67, 0x89, 0x99, 0x8b, 0x8f, 
+    0xd2, 0x58, 0x04, 0x7f, 0x3a, 0xbb, 0xb6, 0xe5, 0xe9, 0x1b, 0x41, 0x25, 0x7e, 0xec, 0x05, 0xe8, 
+    0xd8, 0x7f, 0xf7, 0xf6, 0x15, 0xc1, 0xf1, 0x61, 0x38, 0xad, 0xeb, 0x34, 0x5b, 0xe5, 0x2d, 0x39, 
+    0xf3, 0x40, 0x59, 0x72, 0xbe, 0x72, 0x69, 0x4c, 0xe5, 0xb1, 0xb8, 0x03, 0x22, 0x69, 0x44, 0x72, 
+    0x68, 0xd2, 0xa0, 0x8f, 0xa5, 0x3a, 0x7b, 0xb2, 0x7b, 0x66, 0x94, 0xe3, 0x70, 0x13, 0x2d, 0xd0, 
+    0x9e, 0x15, 0x1c, 0xa7, 0x0e, 0x7f, 0x5c, 0x3f, 0xa5, 0x69, 0x04, 0x75, 0x72, 0x34, 0x38, 0x12, 
+    0x7e, 0xcf, 0x1d, 0xdd, 0x8b, 0x89, 0xc5, 0x12, 0x4e, 0x4d, 0x4a, 0xc4, 0xae, 0xa5, 0x8e, 0x26, 
+    0x91, 0xe2, 0xb3, 0x0e, 0x1a, 0x14, 0xbf, 0x8d, 0x1c, 0x18, 0xee, 0x16, 0x55, 0x27, 0x75, 0x4b, 
+    0x84, 0x1e, 0x10, 0x3e, 0x11, 0x54, 0x2e, 0x34, 0xe6, 0xce, 0x3d, 0x31, 0xa2, 0x45, 0x04, 0xc3, 
+    0x1c, 0x26, 0xeb, 0x64, 0x21, 0x48, 0x25, 0x07, 0x4d, 0x24, 0xb0, 0x4f, 0xe1, 0x29, 0x1a, 0xaf, 
+    0x68, 0x24, 0xbd, 0xa3, 0x7e, 0x16, 0x0f, 0xf2, 0x53, 0x2f, 0x98, 0x8b, 0x4f, 0x0c, 0xc9, 0xb1, 
+    0x1a, 0x37, 0x85, 0x4f, 0x3b, 0xca, 0xd5, 0x8c, 0xc9, 0x22, 0xc0, 0x24, 0x02, 0x9e, 0x21, 0x27, 
+    0xb1, 0x99, 0x05, 0x7e, 0x17, 0xc7, 0x48, 0x85, 0xe0, 0x0b, 0x01, 0x89, 0x8c, 0x8a, 0x69, 0x0c, 
+    0x9d, 0xc7, 0xd0, 0x29, 0x73, 0xdc, 0x9a, 0x85, 0x3d, 0xc9, 0xc6, 0x5e, 0xda, 0xca, 0x9e, 0x68, 
+    0x67, 0x3b, 0xdc, 0x13, 0xad, 0x0b, 0x96, 0x72, 0x50, 0x17, 0xd4, 0x55, 0xa6, 0x62, 0x48, 0x08, 
+    0x33, 0x3b, 0xda, 0xc5, 0x98, 0xcb, 0x34, 0x9e, 0x6e, 0xc4, 0x9a, 0x2e, 0x6f, 0x62, 0x48, 0x56, 
+    0xcb, 0xe7, 0x1f, 0xb9, 0xb8, 0xa5, 0x1d, 0xa9, 0xe7, 0xfa, 0x4f, 0xba, 0xc4, 0x93, 0xbb, 0x23, 
+    0xd2, 0x1b, 0x9f, 0xae, 0x82, 0xb8, 0x01, 0x2b, 0xda, 0xc7, 0xfb, 0xa1, 0xfd, 0x24, 0x22, 0x20, 
+    0xb6, 0xd3, 0x3b, 0xdf, 0x00, 0x49, 0xd9, 0x75, 0x91, 0x4e, 0x74, 0xcd, 0x84, 0x16, 0xc1, 0x22, 
+    0xcb, 0x48, 0xb1, 0xba, 0xf7, 0x52, 0x0f, 0x5a, 0x31, 0x37, 0x70, 0xa4, 0x68, 0xf3, 0x71, 0xa3, 
+    0x84, 0x59, 0xcf, 0x65, 0x38, 0xd9, 0x36, 0xd1, 0x13, 0x1e, 0xfa, 0x7d, 0xb1, 0x6f, 0x4b, 0x93, 
+    0x95, 0xf8, 0x29, 0x79, 0x2d, 0x5f, 0x97, 0x40, 0xf4, 0xa0, 0x33, 0x72, 0x59, 0xd2, 0xa5, 0x05, 
+    0x26, 0x66, 0x82, 0x54, 0x10, 0xa1, 0x36, 0xa5, 0x70, 0xe9, 0x79, 0x51, 0xd4, 0x30, 0x2c, 0xb0, 
+    0x60, 0x68, 0xb7, 0x40, 0x42, 0xd9, 0x6d, 0xcf, 0x01, 0x7b, 0x5b, 0x5d, 0xf5, 0x23, 0x56, 0xe6, 
+    0xc9, 0xb1, 0x17, 0x09, 0x54, 0xa2, 0x42, 0x51, 0x86, 0x44, 0x1a, 0x2d, 0xf1, 0x34, 0x51, 0xcf, 
+    0x1b, 0x7c, 0x9b, 0x36, 0x64, 0xf9, 0x84, 0xc3, 0x47, 0xee, 0xcc, 0x35, 0x31, 0x1f, 0x74, 0x92, 
+    0xa2, 0x45, 0x36, 0x00, 0xe7, 0x09, 0xa0, 0x20, 0xcb, 0xce, 0x8a, 0xed, 0x9f, 0x41, 0x19, 0xba, 
+    0x68, 0x07, 0xfe, 0x6f, 0x45, 0xb3, 0x01, 0xcb, 0x69, 0xfb, 0x69, 0x79, 0x6d, 0x58, 0x3e, 0x49, 
+    0xe1, 0xe0, 0xd4, 0x1d, 0xac, 0x35, 0x63, 0x07, 0x4b, 0x50, 0xc7, 0xfb, 0xe7, 0x21, 0x11, 0x48, 
+    0x35, 0x65, 0x68, 0xa7, 0x0c, 0x6c, 0x63, 0xeb, 0x8a, 0x93, 0xed, 0x3a, 0x62, 0xd5, 0x3e, 0x79, 
+    0xb4, 0x0b, 0x37, 0x5a, 0x40, 0x57, 0x88, 0x28, 0x55, 0xfc, 0x8b, 0x1c, 0xda, 0xa2, 0xf7, 0x61, 
+    0x50, 0xe3, 0x34, 0xc2, 0x9f, 0xf1, 0x3e, 0x84, 0x67, 0x50, 0x5b, 0xdf, 0x46, 0x2f, 0x67, 0xb4, 
+    0x5d, 0x29, 0xf0, 0x97, 0xb2, 0x69, 0xd1, 0x22, 0x53, 0x75, 0x09, 0x1e, 0xc2, 0x9c, 0x19, 0x1f, 
+    0xb2, 0x90, 0xce, 0xa0, 0xa1, 0x1b, 0xd7, 0x19, 0x3f, 0xaa, 0x31, 0x66, 0xfb, 0x04, 0x26, 0x4e, 
+    0xfc, 0x06, 0x45, 0xdc, 0xac, 0xb6, 0x63, 0xfe, 0x8a, 0x1f, 0xa3, 0x2e, 0x2d, 0x9a, 0xa2, 0x6d, 
+    0xe3, 0x6a, 0x9d, 0x5b, 0x78, 0x4e, 0xec, 0x54, 0x89, 0x0a, 0xbf, 0x3a, 0x24, 0x20, 0x21, 0xf9, 
+    0x08, 0x6a, 0x44, 0x5a, 0xa5, 0x38, 0x1e, 0x16, 0x55, 0x6c, 0x8e, 0xd0, 0x1e, 0x8e, 0xd0, 0x16, 
+    0x73, 0xfa, 0x30, 0xca, 0x9c, 0xfa, 0x7f, 0x66, 0x45, 0xf1, 0x96, 0x02, 0xba, 0xf9, 0x01, 0x1f, 
+    0x29, 0xc2, 0x69, 0x7b, 0xd5, 0x89, 0x5d, 0x70, 0xd0, 0xe3, 0x98, 0xdb, 0x45, 0xee, 0x83, 0x3f, 
+    0x89, 0x5f, 0x01, 0x44, 0xc9, 0xb8, 0x0c, 0x45, 0xca, 0x2f, 0xf9, 0x21, 0x26, 0x29, 0x89, 0xa5, 
+    0x5d, 0x7e, 0x32, 0xa2, 0x22, 0x30, 0x8c, 0xfa, 0xf1, 0xed, 0xbe, 0xe5, 0x0c, 0x70, 0xb4, 0xf2, 
+    0xc1, 0x2e, 0xaf, 0x47, 0x4c, 0x6a, 0xa0, 0xf4, 0xab, 0x10, 0xd3, 0x2f, 0x61, 0x4b, 0x23, 0x6a, 
+    0x97, 0x69, 0x92, 0xa3, 0x8a, 0x1a, 0x30, 0xc5, 0x62, 0x4a, 0xe8, 0xf3, 0x34, 0x6d, 0x35, 0x55, 
+    0x2d, 0xc5, 0x34, 0x80, 0xe5, 0xda, 0x7e, 0x98, 0x4b, 0x19, 0xe3, 0x42, 0x6e, 0xcd, 0x31, 0x9e, 
+    0x3e, 0x42, 0x39, 0x0e, 0xb3, 0x44, 0xda, 0x18, 0x4c, 0xdb, 0xca, 0xe1, 0xeb, 0xb8, 0x26, 0xfe, 
+    0x8d, 0x46, 0x0f, 0xfd, 0x94, 0x97, 0x99, 0xa9, 0x5d, 0x1c, 0xb6, 0x9f, 0x35, 0xb3, 0xd4, 0xe0, 
+    0xa2, 0xdc, 0xf4, 0xe9, 0xf0, 0x14, 0xfc, 0xfb, 0xa8, 0x11, 0x5e, 0xd2, 0xdf, 0xb3, 0xfd, 0xec, 
+    0x97, 0x89, 0x99, 0x6f, 0xe8, 0xab, 0xeb, 0x75, 0x65, 0xf5, 0x65, 0xa6, 0x9e, 0x5c, 0xe7, 0xf5, 
+    0xb3, 0xc3, 0xb4, 0x69, 0x74, 0x0c, 0x3c, 0x0e, 0x73, 0x82, 0x36, 0x01, 0x3a, 0xf4, 0x6e, 0x73, 
+    0xd7, 0x98, 0x1a, 0x5a, 0xdf, 0xe3, 0x89, 0x6e, 0x2b, 0x25, 0x92, 0xe8, 0x56, 0x3e, 0xee, 0x93, 
+    0xa4, 0x35, 0x37, 0xee, 0xcf, 0x8c, 0x41, 0x1d, 0x80, 0x70, 0x91, 0xd8, 0xc3, 0x1a, 0x9e, 0xd1, 
+    0xb8, 0x6c, 0x7a, 0x5e, 0x08, 0x06, 0xb0, 0x35, 0xc4, 0x21, 0x35, 0x04, 0x82, 0xed, 0x34, 0xa7, 
+    0xe5, 0xbe, 0x84, 0x32, 0x16, 0x95, 0x86, 0x0f, 0x52, 0x1f, 0xec, 0x0a, 0xe9, 0xe4, 0xa0, 0x44, 
+    0x6e, 0x5b, 0x8a, 0x44, 0x06, 0x32, 0xc3, 0x0a, 0xb9, 0x2a, 0xa3, 0x2b, 0xa5, 0x24, 0xd4, 0x21, 
+    0xe5, 0x15, 0x38, 0x1d, 0x74, 0x3c, 0xb1, 0x63, 0x4d, 0xaa, 0x58, 0x03, 0x38, 0x20, 0xb7, 0xbd, 
+    0xd8, 0x73, 0xe7, 0x2e, 0x7c, 0x90, 0xa6, 0xfb, 0x07, 0x0d, 0x44, 0x3b, 0x9b, 0xac, 0x1d, 0xb2, 
+    0x13, 0x20, 0xf1, 0x2b, 0xad, 0x0d, 0x1a, 0x92, 0xe1, 0x7a, 0x25, 0xf1, 0x28, 0xc2, 0x6e, 0x46, 
+    0x90, 0xc8, 0xf7, 0x7c, 0xef, 0xc8, 0xf4, 0xc6, 0xe6, 0x74, 0x77, 0xac, 0x3c, 0x82, 0xca, 0x7f, 
+    0x8a, 0x8f, 0xbc, 0xf4, 0xd2, 0x0a, 0x97, 0xf2, 0x00, 0x66, 0x70, 0xcb, 0x45, 0x8f, 0x10, 0x9e, 
+    0x3b, 0x23, 0x9e, 0x37, 0x6d, 0x4c, 0x29, 0x23, 0xc6, 0x1a, 0xf4, 0x69, 0xbc, 0xcb, 0xd0, 0x3d, 
+    0x9b, 0xf0, 0x30, 0x93, 0x85, 0x64, 0xd3, 0x2a, 0xd8, 0xe6, 0x1a, 0x9f, 0x56, 0x6f, 0xb4, 0xd7, 
+    0x01, 0xc2, 0xe6, 0x0c, 0xc2, 0x6d, 0x9c, 0x79, 0x5c, 0x26, 0x2f, 0x00, 0x43, 0x19, 0x19, 0xe2, 
+    0x89, 0x15, 0x75, 0xe8, 0x57, 0x1f, 0xf8, 0x9a, 0x48, 0x94, 0x68, 0x6c, 0xe6, 0x12, 0x27, 0xd2, 
+    0x34, 0x47, 0xb0, 0x82, 0x96, 0x23, 0x55, 0xf9, 0x80, 0x23, 0x5b, 0x9d, 0x5d, 0x60, 0xea, 0xdc, 
+    0xc0, 0x2e, 0x01, 0x11, 0xb9, 0xcf, 0x32, 0x0d, 0x04, 0x5e, 0x1b, 0x61, 0x84, 0xf4, 0x14, 0x0c, 
+    0xbd, 0x23, 0x8f, 0x7f, 0x3e, 0x44, 0xc9, 0x2a, 0xce, 0x2c, 0xff, 0xda, 0xbc, 0xc0, 0x9c, 0x36, 
+    0x94, 0x84, 0x03, 0xdb, 0x50, 0xf8, 0xba, 0x03, 0x3c, 0xe6, 0xba, 0x4a, 0xaa, 0xb1, 0x99, 0xde, 
+    0x6e, 0xec, 0x2a, 0x46, 0xdf, 0xf5, 0xe6, 0xa5, 0xd5, 0x21, 0xe2, 0x3d, 0x1d, 0xe0, 0x36, 0x34, 
+    0x16, 0xc6, 0xa7, 0xea, 0x4a, 0xcc, 0xa5, 0x41, 0x28, 0xb4, 0x5d, 0x85, 0x57, 0xce, 0x0d, 0x0f, 
+    0xab, 0x19, 0x05, 0x6a, 0x23, 0xaf, 0xa8, 0x67, 0xdc, 0x40, 0x8b, 0xd4, 0xe6, 0xef, 0x50, 0xac, 
+    0x60, 0x72, 0xf3, 0xc1, 0xda, 0xfd, 0x60, 0x37, 0x2f, 0xbd, 0xd6, 0xb5, 0x1d, 0x02, 0x4e, 0x44, 
+    0x83, 0x3e, 0x4e, 0xb6, 0x59, 0xdd, 0xa6, 0x92, 0xeb, 0x15, 0x16, 0xc0, 0x13, 0x57, 0x44, 0x98, 
+    0x51, 0x62, 0x0f, 0x58, 0x5c, 0xb8, 0x94, 0xb0, 0xc3, 0x09, 0x06, 0xd9, 0x50, 0x6e, 0x99, 0xd9, 
+    0xed, 0x15, 0x4c, 0x17, 0x85, 0xb0, 0xb8, 0xbd, 0xe2, 0xab, 0x0b, 0x63, 0xf9, 0xc5, 0x04, 0x37, 
+    0x36, 0x0f, 0x5c, 0x36, 0xdf, 0x69, 0x09, 0x3a, 0x30, 0x89, 0xc3, 0x05, 0x14, 0xa6, 0xbd, 0xe6, 
+    0xc8, 0x56, 0x51, 0xf8, 0xf2, 0x06, 0xea, 0xc0, 0x0e, 0x4f, 0x71, 0x2f, 0xf0, 0x06, 0x6c, 0xe4, 
+    0x28, 0x13, 0x88, 0xdc, 0xfc, 0x35, 0x32, 0x7f, 0x84, 0xde, 0xd0, 0xc4, 0x4b, 0x87, 0xfd, 0x54, 
+    0xe9, 0xa8, 0x02, 0xec, 0x87, 0x24, 0xf9, 0x46, 0xf6, 0x36, 0xde, 0x54, 0x64, 0xb4, 0x4e, 0x63, 
+    0x2e, 0xab, 0x78, 0x98, 0xc5, 0x48, 0x26, 0xbc, 0xfd, 0xd9, 0xbb, 0xcd, 0x53, 0xca, 0x18, 0xa3, 
+    0x59, 0xdb, 0xd2, 0xb6, 0xd2, 0x8e, 0xd0, 0x52, 0xd2, 0x5e, 0x34, 0xa6, 0x14, 0x8e, 0xdc, 0xd7, 
+    0xdb, 0x60, 0xab, 0x5c, 0xfe, 0xe9, 0x5e, 0x5e, 0x77, 0x56, 0xea, 0x79, 0x41, 0x48, 0xc7, 0x57, 
+    0xb7, 0x36, 0xab, 0x65, 0x7e, 0x6a, 0xea, 0x36, 0x28, 0x79, 0x03, 0x6f, 0xc8, 0xef, 0xc3, 0xa0, 
+    0xa3, 0x4d, 0x46, 0x43, 0x15, 0x88, 0x9c, 0x36, 0x77, 0x98, 0x36, 0xee, 0x68, 0xb4, 0x8b, 0xc8, 
+    0x52, 0x6c, 0x0c, 0xe5, 0x34, 0xcc, 0x91, 0x97, 0x83, 0xa6, 0x93, 0x9c, 0x4d, 0x33, 0x7c, 0x1e, 
+    0x53, 0xd7, 0x28, 0x69, 0xf6, 0x31, 0x7a, 0x25, 0x26, 0xcb, 0xf8, 0x90, 0x37, 0xe6, 0x41, 0xd5, 
+    0x48, 0xab, 0x97, 0xd8, 0x81, 0xab, 0x18, 0x1b, 0x56, 0x62, 0xfb, 0x70, 0x1a, 0x5f, 0x0b, 0x3c, 
+    0xa4, 0x41, 0x9d, 0x8d, 0x8b, 0xe5, 0x70, 0x41, 0x10, 0x61, 0x70, 0x2f, 0x9e, 0xc3, 0x25, 0x8b, 
+    0x62, 0x28, 0x2d, 0xf4, 0x1f, 0x4b, 0xe7, 0x62, 0xa4, 0x16, 0x89, 0xf1, 0xd1, 0xbe, 0x89, 0x64, 
+    0xc3, 0xbe, 0x89, 0x4c, 0x2c, 0x5c, 0xc3, 0xc3, 0x54, 0x67, 0x18, 0xd4, 0xa3, 0x61, 0xc8, 0x6f, 
+    0x33, 0x9a, 0x48, 0x33, 0x87, 0x28, 0x62, 0xd0, 0x4a, 0x56, 0x0f, 0xa1, 0xe4, 0xcf, 0xf3, 0x86, 
+    0x03, 0x83, 0x3f, 0x8b, 0xd1, 0xfb, 0xf5, 0xa7, 0x7b, 0xcd, 0xae, 0x00, 0x82, 0x44, 0x9d, 0x14, 
+    0xb6, 0xf0, 0xd0, 0x67, 0x3f, 0xdd, 0x47, 0xcf, 0x7e, 0x86, 0x67, 0x0f, 0xc1, 0xd7, 0x19, 0x8b, 
+    0x12, 0x6c, 0x87, 0x20, 0x28, 0x59, 0x17, 0xd6, 0x00, 0x6b, 0x51, 0x9b, 0x02, 0x4c, 0x6a, 0x6b, 
+    0xba, 0xf1, 0xf1, 0xc0, 0x5e, 0xee, 0xcf, 0xc2, 0xed, 0x07, 0x81, 0x33, 0x11, 0x37, 0xa0, 0xc6, 
+    0xf7, 0x0f, 0xac, 0xbd, 0xdf, 0x8f, 0x87, 0x23, 0x19, 0x9c, 0xe6, 0x2a, 0xae, 0x9d, 0xd5, 0xd2, 
+    0xdc, 0xee, 0xa9, 0x6d, 0x6d, 0xa9, 0xff, 0xe4, 0x2d, 0xbb, 0x94, 0x7f, 0x08, 0x67, 0x30, 0x39, 
+    0xe7, 0x25, 0x32, 0x13, 0x81, 0xa8, 0x86, 0xae, 0x1d, 0x28, 0xe6, 0x43, 0x5d, 0x2d, 0x49, 0x17, 
+    0x56, 0xa7, 0x42, 0x4e, 0xd5, 0xbc, 0x66, 0x46, 0x97, 0xa6, 0xde, 0x4d, 0x82, 0x5a, 0x48, 0x6d, 
+    0x44, 0x9b, 0xfa, 0x51, 0xcd, 0x78, 0x49, 0xbd, 0x99, 0x9a, 0x01, 0x29, 0xbe, 0x75, 0x9d, 0xce, 
+    0x14, 0x32, 0xbd, 0x14, 0x8d, 0xe2, 0x35, 0x4a, 0xbc, 0x78, 0xef, 0x50, 0x9c, 0xb9, 0xb1, 0xfe, 
+    0xd6, 0x86, 0x1b, 0xc0, 0x7a, 0xd7, 0x93, 0x36, 0xe1, 0xd5, 0x4b, 0x61, 0xa9, 0x49, 0x9f, 0x20, 
+    0x01, 0x99, 0xcf, 0xe2, 0x56, 0x7b, 0x72, 0xd1, 0xaf, 0x55, 0xaa, 0xfb, 0x1c, 0xc9, 0x19, 0x48, 
+    0xce, 0x66, 0x8e, 0x4f, 0x58, 0xf1, 0xa2, 0x09, 0x73, 0xb4, 0x9f, 0x27, 0xb2, 0x56, 0x2d, 0x1c, 
+    0xc0, 0xd2, 0x1d, 0x6a, 0x13, 0x3b, 0x06, 0xd0, 0xa3, 0x62, 0x16, 0xdf, 0x9e, 0x79, 0x1a, 0x58, 
+    0xf9, 0x33, 0x70, 0x2d, 0xa4, 0x1d, 0x09, 0x46, 0xe5, 0x13, 0x99, 0x36, 0x52, 0xb7, 0x18, 0xe7, 
+    0xa0, 0xa1, 0xd2, 0x62, 0xc0, 0x6b, 0x85, 0x36, 0x89, 0x58, 0x31, 0x80, 0x94, 0x27, 0x2a, 0xc5, 
+    0x82, 0x0b, 0xe9, 0x8d, 0xe8, 0x33, 0x6c, 0x97, 0x49, 0xad, 0xf3, 0x42, 0x6b, 0x4a, 0xdf, 0x0e, 
+    0x7d, 0xaf, 0xeb, 0x53, 0x42, 0xb8, 0x39, 0x58, 0xfd, 0xf5, 0xd8, 0xf1, 0xfb, 0xb7, 0xb8, 0xe5, 
+    0xc9, 0xbb, 0x6c, 0x8b, 0x09, 0x15, 0xc2, 0xef, 0x4c, 0x04, 0xcc, 0xb7, 0xbe, 0x13, 0x82, 0xf8, 
+    0xcb, 0x31, 0x8e, 0x03, 0x9b, 0x89, 0x67, 0x5f, 0xf3, 0x89, 0x1b, 0x70, 0x4d, 0x52, 0xb8, 0xcc, 
+    0x4c, 0xa6, 0x43, 0xdb, 0xa4, 0x34, 0xa8, 0x58, 0x56, 0x70, 0x62, 0xb5, 0x0f, 0x40, 0x28, 0x7f, 
+    0x49, 0x20, 0x6f, 0xa3, 0x2f, 0x09, 0xd7, 0x23, 0xda, 0xe6, 0x49, 0xbc, 0x7e, 0x9a, 0xc4, 0x62, 
+    0xeb, 0x4d, 0x9c, 0x08, 0xb8, 0x19, 0xbd, 0x4d, 0x9f, 0xf2, 0x66, 0xd4, 0x4b, 0x18, 0xdc, 0x2d, 
+    0xca, 0x88, 0x69, 0xd8, 0x0c, 0xdb, 0x2b, 0xcf, 0xca, 0x3c, 0x8d, 0xdb, 0x2e, 0x7c, 0x43, 0xf7, 
+    0x05, 0x7e, 0xf6, 0xc2, 0xbe, 0xbb, 0xbb, 0xf2, 0xff, 0x03, 0x53, 0xd3, 0x9e, 0x2f, 0x83, 0x73, 
     0x01, 0x00
 };
 
@@ -70,11 +70,18 @@
 #define OPENMETEO_PORT 443  // HTTPS
 #define OPENMETEO_FORECAST_PATH "/v1/forecast"
 
+// Open-Meteo geocoding (city search in the admin UI)
+#define GEOCODING_API_HOST "geocoding-api.open-meteo.com"
+#define GEOCODING_API_PORT 80
+
 // Default update intervals (minutes)
 #define WEATHER_UPDATE_INTERVAL_DEFAULT 20
 #define WEATHER_UPDATE_INTERVAL_MIN 5
 #define WEATHER_UPDATE_INTERVAL_MAX 60
 
+// YouTube Data API (HTTPS)
+#define YOUTUBE_API_HOST "www.googleapis.com"
+
 // YouTube API update interval (30 minutes to conserve API quota)
 #define YOUTUBE_UPDATE_INTERVAL_MS (30 * 60 * 1000)
 
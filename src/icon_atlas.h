@@ -0,0 +1,201 @@
+/**
+ * Auto-generated weather icon atlas
+ * DO NOT EDIT - this file is generated by scripts/generate_icon_atlas.py
+ *
+ * Sizes: 32, 64
+ * Run data: 1864 bytes
+ */
+
+#ifndef ICON_ATLAS_H
+#define ICON_ATLAS_H
+
+#include <Arduino.h>
+
+// Palette indices, mapped to theme colours when drawn
+#define ICON_PAL_TRANSPARENT 0
+#define ICON_PAL_SUN 1
+#define ICON_PAL_CLOUD 2
+#define ICON_PAL_CLOUD_DARK 3
+#define ICON_PAL_RAIN 4
+#define ICON_PAL_SNOW 5
+#define ICON_PAL_LIGHTNING 6
+#define ICON_PAL_GRAY 7
+#define ICON_PAL_COUNT 8
+
+// Each run byte: palette index << 5 | (length - 1)
+#define ICON_RUN_PAL(b) ((b) >> 5)
+#define ICON_RUN_LEN(b) (((b) & 0x1F) + 1)
+
+enum IconId : uint8_t {
+    ICON_ID_CLEAR_DAY,
+    ICON_ID_CLEAR_NIGHT,
+    ICON_ID_PARTLY_CLOUDY_DAY,
+    ICON_ID_PARTLY_CLOUDY_NIGHT,
+    ICON_ID_CLOUDY,
+    ICON_ID_FOG,
+    ICON_ID_RAIN,
+    ICON_ID_FREEZING_RAIN,
+    ICON_ID_SNOW,
+    ICON_ID_THUNDERSTORM,
+    ICON_ID_UNKNOWN,
+    ICON_ID_COUNT
+};
+
+// Pre-rendered icon: runs cover a w x h box at (x + dx, y + dy)
+struct IconAtlasEntry {
+    uint8_t id;
+    uint8_t size;       // Size drawWeatherIcon() was asked for
+    int8_t dx, dy;
+    uint8_t w, h;
+    uint16_t offset;    // First run in icon_atlas_runs
+    uint16_t length;    // Run bytes
+};
+
+const uint8_t icon_atlas_count = 22;
+
+const IconAtlasEntry icon_atlas[] PROGMEM = {
+    {ICON_ID_CLEAR_DAY, 32, 4, 4, 24, 24, 0, 61},
+    {ICON_ID_CLEAR_DAY, 64, 8, 8, 48, 48, 61, 141},
+    {ICON_ID_CLEAR_NIGHT, 32, 14, 8, 8, 16, 202, 26},
+    {ICON_ID_CLEAR_NIGHT, 64, 28, 16, 16, 32, 228, 53},
+    {ICON_ID_PARTLY_CLOUDY_DAY, 32, -2, -2, 20, 22, 281, 51},
+    {ICON_ID_PARTLY_CLOUDY_DAY, 64, -2, -2, 52, 54, 332, 183},
+    {ICON_ID_PARTLY_CLOUDY_NIGHT, 32, 3, 0, 15, 20, 515, 34},
+    {ICON_ID_PARTLY_CLOUDY_NIGHT, 64, 13, 4, 37, 48, 549, 123},
+    {ICON_ID_CLOUDY, 32, 4, 8, 24, 16, 672, 27},
+    {ICON_ID_CLOUDY, 64, 8, 16, 48, 32, 699, 80},
+    {ICON_ID_FOG, 32, 6, 12, 20, 14, 779, 12},
+    {ICON_ID_FOG, 64, 12, 24, 40, 28, 791, 35},
+    {ICON_ID_RAIN, 32, 4, 4, 24, 26, 826, 55},
+    {ICON_ID_RAIN, 64, 8, 8, 48, 52, 881, 144},
+    {ICON_ID_FREEZING_RAIN, 32, 4, 4, 28, 26, 1025, 76},
+    {ICON_ID_FREEZING_RAIN, 64, 8, 8, 56, 52, 1101, 193},
+    {ICON_ID_SNOW, 32, 4, 4, 24, 26, 1294, 51},
+    {ICON_ID_SNOW, 64, 8, 8, 48, 52, 1345, 140},
+    {ICON_ID_THUNDERSTORM, 32, 4, 4, 30, 26, 1485, 79},
+    {ICON_ID_THUNDERSTORM, 64, 8, 8, 60, 52, 1564, 193},
+    {ICON_ID_UNKNOWN, 32, 4, 8, 24, 16, 1757, 27},
+    {ICON_ID_UNKNOWN, 64, 8, 16, 48, 32, 1784, 80},
+};
+
+const uint8_t icon_atlas_runs[] PROGMEM = {
+    0x09, 0x23, 0x13, 0x23, 0x13, 0x23, 0x13, 0x23, 0x0d, 0x21, 0x0b, 0x21, 0x07, 0x21, 0x0b, 0x21, 
+    0x1f, 0x1b, 0x27, 0x0f, 0x27, 0x07, 0x23, 0x03, 0x27, 0x03, 0x27, 0x03, 0x27, 0x03, 0x27, 0x03, 
+    0x27, 0x03, 0x27, 0x03, 0x27, 0x03, 0x23, 0x07, 0x27, 0x0f, 0x27, 0x1f, 0x1b, 0x21, 0x0b, 0x21, 
+    0x07, 0x21, 0x0b, 0x21, 0x0d, 0x23, 0x13, 0x23, 0x13, 0x23, 0x13, 0x23, 0x09, 0x13, 0x27, 0x1f, 
+    0x07, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 
+    0x27, 0x1f, 0x07, 0x27, 0x1b, 0x23, 0x17, 0x23, 0x0f, 0x23, 0x17, 0x23, 0x0f, 0x23, 0x17, 0x23, 
+    0x0f, 0x23, 0x17, 0x23, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x17, 0x2f, 0x1f, 0x2f, 0x1f, 0x2f, 
+    0x1f, 0x2f, 0x0f, 0x27, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 
+    0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 0x07, 0x2f, 
+    0x07, 0x2f, 0x07, 0x27, 0x0f, 0x2f, 0x1f, 0x2f, 0x1f, 0x2f, 0x1f, 0x2f, 0x1f, 0x1f, 0x1f, 0x1f, 
+    0x1f, 0x1f, 0x17, 0x23, 0x17, 0x23, 0x0f, 0x23, 0x17, 0x23, 0x0f, 0x23, 0x17, 0x23, 0x0f, 0x23, 
+    0x17, 0x23, 0x1b, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 
+    0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 0x1f, 0x07, 0x27, 0x13, 0x01, 0x21, 0x05, 0x21, 0x03, 0x2f, 
+    0x03, 0x23, 0x03, 0x23, 0x03, 0x23, 0x03, 0x23, 0x05, 0x21, 0x05, 0x21, 0x03, 0x23, 0x03, 0x23, 
+    0x03, 0x23, 0x03, 0x33, 0x03, 0x23, 0x0b, 0x23, 0x0b, 0x23, 0x0b, 0x23, 0x07, 0x3f, 0x3f, 0x07, 
+    0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x0b, 
+    0x23, 0x0b, 0x23, 0x0b, 0x23, 0x0b, 0x23, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 
+    0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x3f, 0x3f, 0x27, 0x04, 0x21, 0x11, 0x21, 0x0e, 0x20, 0x05, 
+    0x20, 0x1f, 0x01, 0x23, 0x0b, 0x21, 0x01, 0x23, 0x01, 0x21, 0x07, 0x21, 0x01, 0x23, 0x01, 0x21, 
+    0x0b, 0x23, 0x1f, 0x01, 0x20, 0x05, 0x20, 0x0e, 0x21, 0x11, 0x21, 0x1f, 0x1f, 0x43, 0x0d, 0x4a, 
+    0x08, 0x4a, 0x08, 0x4a, 0x08, 0x4a, 0x08, 0x4a, 0x07, 0x4b, 0x07, 0x4b, 0x0e, 0x25, 0x1f, 0x0d, 
+    0x25, 0x1f, 0x0d, 0x25, 0x1f, 0x0d, 0x25, 0x1f, 0x0d, 0x25, 0x1f, 0x0d, 0x25, 0x1f, 0x04, 0x22, 
+    0x11, 0x22, 0x1b, 0x22, 0x11, 0x22, 0x1b, 0x22, 0x11, 0x22, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 
+    0x2b, 0x1f, 0x07, 0x2b, 0x1f, 0x07, 0x2b, 0x1b, 0x25, 0x05, 0x2b, 0x05, 0x25, 0x0f, 0x25, 0x05, 
+    0x2b, 0x05, 0x25, 0x0f, 0x25, 0x05, 0x2b, 0x05, 0x25, 0x0f, 0x25, 0x05, 0x2b, 0x05, 0x25, 0x0f, 
+    0x25, 0x05, 0x2b, 0x05, 0x25, 0x0f, 0x25, 0x05, 0x2b, 0x05, 0x25, 0x1b, 0x2b, 0x1f, 0x07, 0x2b, 
+    0x1f, 0x07, 0x2b, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x22, 0x11, 0x22, 0x1b, 0x22, 0x11, 0x22, 
+    0x1b, 0x22, 0x11, 0x22, 0x1f, 0x04, 0x25, 0x03, 0x4b, 0x1d, 0x25, 0x03, 0x4b, 0x1d, 0x25, 0x03, 
+    0x4b, 0x1d, 0x23, 0x5f, 0x40, 0x0e, 0x23, 0x5f, 0x40, 0x0e, 0x23, 0x5f, 0x40, 0x12, 0x5f, 0x40, 
+    0x12, 0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 
+    0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 0x5f, 0x40, 0x12, 0x5f, 
+    0x40, 0x0f, 0x5f, 0x43, 0x0f, 0x5f, 0x43, 0x0f, 0x5f, 0x43, 0x0f, 0x5f, 0x43, 0x0f, 0x5f, 0x43, 
+    0x0f, 0x5f, 0x43, 0x00, 0x20, 0x0c, 0x23, 0x0c, 0x21, 0x0c, 0x21, 0x0d, 0x20, 0x0c, 0x21, 0x0c, 
+    0x21, 0x0a, 0x23, 0x1f, 0x1f, 0x0c, 0x43, 0x08, 0x4a, 0x03, 0x4a, 0x03, 0x4a, 0x03, 0x4a, 0x03, 
+    0x4a, 0x02, 0x4b, 0x02, 0x4b, 0x02, 0x22, 0x1f, 0x01, 0x22, 0x1f, 0x01, 0x22, 0x1e, 0x2b, 0x18, 
+    0x2b, 0x18, 0x2b, 0x1e, 0x25, 0x1e, 0x25, 0x1e, 0x25, 0x1e, 0x25, 0x1e, 0x25, 0x1e, 0x25, 0x1f, 
+    0x01, 0x22, 0x1f, 0x01, 0x22, 0x1f, 0x01, 0x22, 0x1e, 0x25, 0x1e, 0x25, 0x1e, 0x25, 0x1e, 0x25, 
+    0x1e, 0x25, 0x1e, 0x25, 0x18, 0x2b, 0x18, 0x2b, 0x18, 0x2b, 0x1f, 0x02, 0x4b, 0x18, 0x4b, 0x18, 
+    0x4b, 0x12, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 
+    0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 
+    0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x03, 0x5f, 0x40, 0x00, 0x5f, 
+    0x43, 0x00, 0x5f, 0x43, 0x00, 0x5f, 0x43, 0x00, 0x5f, 0x43, 0x00, 0x5f, 0x43, 0x00, 0x5f, 0x43, 
+    0x05, 0x47, 0x0f, 0x47, 0x0b, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 
+    0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x5f, 0x5f, 0x5f, 0x55, 0x0b, 0x4f, 0x1f, 0x4f, 0x1f, 
+    0x4f, 0x1f, 0x4f, 0x17, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 
+    0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 
+    0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 
+    0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x5f, 0x5f, 
+    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x4b, 0xff, 0xe7, 0x1f, 0x1f, 0x0f, 
+    0xff, 0xe7, 0x1f, 0x1f, 0x0f, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x47, 0x0f, 0x47, 0x0b, 0x55, 
+    0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 
+    0x01, 0x5f, 0x5f, 0x5f, 0x55, 0x1f, 0x1f, 0x1f, 0x03, 0x81, 0x0d, 0x81, 0x05, 0x81, 0x0d, 0x81, 
+    0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x0d, 0x81, 0x15, 0x81, 
+    0x09, 0x0b, 0x4f, 0x1f, 0x4f, 0x1f, 0x4f, 0x1f, 0x4f, 0x17, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 
+    0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 
+    0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 
+    0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 
+    0x5f, 0x4b, 0x03, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+    0x4b, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x07, 0x83, 0x1b, 
+    0x83, 0x0b, 0x83, 0x1b, 0x83, 0x0b, 0x83, 0x1b, 0x83, 0x0b, 0x83, 0x1b, 0x83, 0x0b, 0x83, 0x0b, 
+    0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 
+    0x83, 0x0b, 0x83, 0x0b, 0x83, 0x1b, 0x83, 0x1f, 0x0b, 0x83, 0x1f, 0x0b, 0x83, 0x1f, 0x0b, 0x83, 
+    0x13, 0x05, 0x67, 0x13, 0x67, 0x0f, 0x75, 0x05, 0x75, 0x05, 0x75, 0x05, 0x75, 0x05, 0x75, 0x05, 
+    0x75, 0x05, 0x75, 0x05, 0x75, 0x05, 0x75, 0x05, 0x75, 0x03, 0x77, 0x03, 0x77, 0x03, 0x77, 0x03, 
+    0x77, 0x1f, 0x1f, 0x1f, 0x17, 0x81, 0x05, 0xa1, 0x05, 0x81, 0x03, 0xa1, 0x03, 0x81, 0x05, 0xa1, 
+    0x05, 0x81, 0x03, 0xa1, 0x03, 0x81, 0x05, 0x81, 0x05, 0x81, 0xa1, 0x07, 0x81, 0x05, 0x81, 0x05, 
+    0x81, 0xa1, 0x0f, 0x81, 0xa1, 0x01, 0xa1, 0x13, 0x81, 0xa1, 0x01, 0xa1, 0x07, 0x0b, 0x6f, 0x1f, 
+    0x07, 0x6f, 0x1f, 0x07, 0x6f, 0x1f, 0x07, 0x6f, 0x1f, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 
+    0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 
+    0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 
+    0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 0x6b, 0x0b, 0x7f, 
+    0x6b, 0x0b, 0x7f, 0x6b, 0x07, 0x7f, 0x6f, 0x07, 0x7f, 0x6f, 0x07, 0x7f, 0x6f, 0x07, 0x7f, 0x6f, 
+    0x07, 0x7f, 0x6f, 0x07, 0x7f, 0x6f, 0x07, 0x7f, 0x6f, 0x07, 0x7f, 0x6f, 0x1f, 0x1f, 0x1f, 0x1f, 
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x83, 0x0b, 0xa3, 0x0b, 0x83, 
+    0x07, 0xa3, 0x07, 0x83, 0x0b, 0xa3, 0x0b, 0x83, 0x07, 0xa3, 0x07, 0x83, 0x0b, 0xa3, 0x0b, 0x83, 
+    0x07, 0xa3, 0x07, 0x83, 0x0b, 0xa3, 0x0b, 0x83, 0x07, 0xa3, 0x07, 0x83, 0x0b, 0x83, 0x0b, 0x83, 
+    0xa3, 0x0f, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0xa3, 0x0f, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0xa3, 0x0f, 
+    0x83, 0x0b, 0x83, 0x0b, 0x83, 0xa3, 0x1f, 0x83, 0xa3, 0x03, 0xa3, 0x1f, 0x07, 0x83, 0xa3, 0x03, 
+    0xa3, 0x1f, 0x07, 0x83, 0xa3, 0x03, 0xa3, 0x1f, 0x07, 0x83, 0xa3, 0x03, 0xa3, 0x0f, 0x05, 0x47, 
+    0x0f, 0x47, 0x0b, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 
+    0x01, 0x55, 0x01, 0x55, 0x01, 0x5f, 0x5f, 0x5f, 0x55, 0x1f, 0x1f, 0x1f, 0x03, 0xa1, 0x0b, 0xa1, 
+    0x07, 0xa1, 0x0b, 0xa1, 0x11, 0xa1, 0x15, 0xa1, 0x0d, 0xa1, 0x01, 0xa1, 0x11, 0xa1, 0x01, 0xa1, 
+    0x0b, 0x0b, 0x4f, 0x1f, 0x4f, 0x1f, 0x4f, 0x1f, 0x4f, 0x17, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 
+    0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 
+    0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 
+    0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 0x5f, 0x4b, 0x03, 
+    0x5f, 0x4b, 0x03, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+    0x4b, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x07, 0xa3, 0x17, 
+    0xa3, 0x0f, 0xa3, 0x17, 0xa3, 0x0f, 0xa3, 0x17, 0xa3, 0x0f, 0xa3, 0x17, 0xa3, 0x1f, 0x03, 0xa3, 
+    0x1f, 0x0b, 0xa3, 0x1f, 0x0b, 0xa3, 0x1f, 0x0b, 0xa3, 0x1b, 0xa3, 0x03, 0xa3, 0x1f, 0x03, 0xa3, 
+    0x03, 0xa3, 0x1f, 0x03, 0xa3, 0x03, 0xa3, 0x1f, 0x03, 0xa3, 0x03, 0xa3, 0x17, 0x05, 0x67, 0x15, 
+    0x67, 0x11, 0x75, 0x07, 0x75, 0x07, 0x75, 0x07, 0x75, 0x07, 0x75, 0x07, 0x75, 0x07, 0x75, 0x07, 
+    0x75, 0x07, 0x75, 0x07, 0x75, 0x05, 0x6b, 0xc1, 0x69, 0x05, 0x6b, 0xc1, 0x69, 0x05, 0x69, 0xc3, 
+    0x69, 0x05, 0x69, 0xc3, 0x69, 0x0d, 0xc7, 0x15, 0xc7, 0x17, 0xc3, 0x19, 0xc3, 0x17, 0xc3, 0x81, 
+    0x0d, 0x81, 0x07, 0xc3, 0x81, 0x0d, 0x81, 0x05, 0xc3, 0x01, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 
+    0xc3, 0x01, 0x81, 0x05, 0x81, 0x05, 0x81, 0x13, 0x81, 0x1b, 0x81, 0x07, 0x0b, 0x6f, 0x1f, 0x0b, 
+    0x6f, 0x1f, 0x0b, 0x6f, 0x1f, 0x0b, 0x6f, 0x1f, 0x03, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 
+    0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 
+    0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 
+    0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 0x6b, 0x0f, 0x7f, 
+    0x6b, 0x0f, 0x7f, 0x6b, 0x0b, 0x77, 0xc3, 0x73, 0x0b, 0x77, 0xc3, 0x73, 0x0b, 0x77, 0xc3, 0x73, 
+    0x0b, 0x77, 0xc3, 0x73, 0x0b, 0x73, 0xc7, 0x73, 0x0b, 0x73, 0xc7, 0x73, 0x0b, 0x73, 0xc7, 0x73, 
+    0x0b, 0x73, 0xc7, 0x73, 0x1b, 0xcf, 0x1f, 0x0b, 0xcf, 0x1f, 0x0b, 0xcf, 0x1f, 0x0b, 0xcf, 0x1f, 
+    0x0f, 0xc7, 0x1f, 0x13, 0xc7, 0x1f, 0x13, 0xc7, 0x1f, 0x13, 0xc7, 0x1f, 0x0f, 0xc7, 0x83, 0x1b, 
+    0x83, 0x0f, 0xc7, 0x83, 0x1b, 0x83, 0x0f, 0xc7, 0x83, 0x1b, 0x83, 0x0f, 0xc7, 0x83, 0x1b, 0x83, 
+    0x0b, 0xc7, 0x03, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 0xc7, 0x03, 0x83, 0x0b, 0x83, 0x0b, 0x83, 
+    0x0b, 0xc7, 0x03, 0x83, 0x0b, 0x83, 0x0b, 0x83, 0x0b, 0xc7, 0x03, 0x83, 0x0b, 0x83, 0x0b, 0x83, 
+    0x1f, 0x07, 0x83, 0x1f, 0x17, 0x83, 0x1f, 0x17, 0x83, 0x1f, 0x17, 0x83, 0x0f, 0x05, 0xe7, 0x0f, 
+    0xe7, 0x0b, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0xf5, 0x01, 
+    0xf5, 0x01, 0xf5, 0x01, 0xff, 0xff, 0xff, 0xf5, 0x0b, 0xef, 0x1f, 0xef, 0x1f, 0xef, 0x1f, 0xef, 
+    0x17, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 
+    0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 
+    0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 
+    0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xeb, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb
+};
+
+#endif // ICON_ATLAS_H
@@ -0,0 +1,149 @@
+/**
+ * EpicWeatherBox Firmware - Streaming JSON Writer Implementation
+ */
+
+#include "json_stream.h"
+
+JsonStream::JsonStream(Print& out) : out(out), depth(0) {
+    memset(hasMember, 0, sizeof(hasMember));
+}
+
+/**
+ * Write the separator and key that go before a value
+ */
+void JsonStream::beginValue(const char* key) {
+    if (depth > 0 && depth <= JSON_STREAM_MAX_DEPTH) {
+        if (hasMember[depth - 1]) out.write(',');
+        hasMember[depth - 1] = true;
+    }
+    if (key) {
+        writeString(key);
+        out.write(':');
+    }
+}
+
+void JsonStream::beginObject(const char* key) {
+    beginValue(key);
+    out.write('{');
+    if (depth < JSON_STREAM_MAX_DEPTH) hasMember[depth] = false;
+    depth++;
+}
+
+void JsonStream::endObject() {
+    if (depth > 0) depth--;
+    out.write('}');
+}
+
+void JsonStream::beginArray(const char* key) {
+    beginValue(key);
+    out.write('[');
+    if (depth < JSON_STREAM_MAX_DEPTH) hasMember[depth] = false;
+    depth++;
+}
+
+void JsonStream::endArray() {
+    if (depth > 0) depth--;
+    out.write(']');
+}
+
+void JsonStream::add(const char* key, const char* value) {
+    beginValue(key);
+    if (value) {
+        writeString(value);
+    } else {
+        out.print(F("null"));
+    }
+}
+
+void JsonStream::add(const char* key, const String& value) {
+    add(key, value.c_str());
+}
+
+void JsonStream::add(const char* key, bool value) {
+    beginValue(key);
+    out.print(value ? F("true") : F("false"));
+}
+
+void JsonStream::add(const char* key, int value) {
+    beginValue(key);
+    out.print(value);
+}
+
+void JsonStream::add(const char* key, unsigned int value) {
+    beginValue(key);
+    out.print(value);
+}
+
+void JsonStream::add(const char* key, long value) {
+    beginValue(key);
+    out.print(value);
+}
+
+void JsonStream::add(const char* key, unsigned long value) {
+    beginValue(key);
+    out.print(value);
+}
+
+void JsonStream::add(const char* key, float value, uint8_t decimals) {
+    beginValue(key);
+    writeNumber(value, decimals);
+}
+
+void JsonStream::add(const char* key, double value, uint8_t decimals) {
+    beginValue(key);
+    writeNumber(value, decimals);
+}
+
+void JsonStream::addNull(const char* key) {
+    beginValue(key);
+    out.print(F("null"));
+}
+
+/**
+ * Write a quoted string, escaping what JSON requires
+ */
+void JsonStream::writeString(const char* str) {
+    out.write('"');
+    for (const char* p = str; *p; p++) {
+        char c = *p;
+        switch (c) {
+            case '"':  out.print(F("\\\"")); break;
+            case '\\': out.print(F("\\\\")); break;
+            case '\n': out.print(F("\\n")); break;
+            case '\r': out.print(F("\\r")); break;
+            case '\t': out.print(F("\\t")); break;
+            default:
+                if ((uint8_t)c < 0x20) {
+                    char esc[7];
+                    snprintf(esc, sizeof(esc), "\\u%04x", c);
+                    out.print(esc);
+                } else {
+                    out.write(c);
+                }
+        }
+    }
+    out.write('"');
+}
+
+/**
+ * Write a number with up to decimals places, trailing zeros dropped
+ */
+void JsonStream::writeNumber(double value, uint8_t decimals) {
+    if (isnan(value) || isinf(value)) {
+        out.print(F("null"));
+        return;
+    }
+    char buf[24];
+    dtostrf(value, 1, decimals, buf);
+    char* dot = strchr(buf, '.');
+    if (dot) {
+        char* end = buf + strlen(buf) - 1;
+        while (end > dot && *end == '0') *end-- = '\0';
+        if (end == dot) *end = '\0';
+    }
+    if (strcmp(buf, "-0") == 0) {
+        out.write('0');
+    } else {
+        out.print(buf);
+    }
+}
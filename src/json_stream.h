@@ -0,0 +1,51 @@
+/**
+ * EpicWeatherBox Firmware - Streaming JSON Writer
+ *
+ * Writes JSON to a Print (e.g. a chunked HTTP response) one value at a time,
+ * so a large response never exists whole in RAM. Only the nesting state is
+ * kept: which containers are open and whether each has a member yet.
+ */
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <Arduino.h>
+
+// Deepest nesting of objects and arrays
+#define JSON_STREAM_MAX_DEPTH 8
+
+/**
+ * Streaming JSON writer
+ * Members of an object take a key; array elements pass key = nullptr.
+ */
+class JsonStream {
+public:
+    explicit JsonStream(Print& out);
+
+    void beginObject(const char* key = nullptr);
+    void endObject();
+    void beginArray(const char* key = nullptr);
+    void endArray();
+
+    void add(const char* key, const char* value);   // nullptr is written as null
+    void add(const char* key, const String& value);
+    void add(const char* key, bool value);
+    void add(const char* key, int value);
+    void add(const char* key, unsigned int value);
+    void add(const char* key, long value);
+    void add(const char* key, unsigned long value);
+    void add(const char* key, float value, uint8_t decimals = 2);  // NaN/inf are written as null
+    void add(const char* key, double value, uint8_t decimals = 6);
+    void addNull(const char* key);
+
+private:
+    void beginValue(const char* key);
+    void writeString(const char* str);
+    void writeNumber(double value, uint8_t decimals);
+
+    Print& out;
+    uint8_t depth;
+    bool hasMember[JSON_STREAM_MAX_DEPTH];
+};
+
+#endif // JSON_STREAM_H
@@ -0,0 +1,371 @@
+/**
+ * EpicWeatherBox Firmware - Live Status Channel Implementation
+ *
+ * Just enough of RFC 6455 for pushing events: the opening handshake,
+ * unfragmented server frames, and reading client frames to answer ping
+ * and close. Everything is stepped from updateLive() without blocking.
+ */
+
+#include "live.h"
+#include "config.h"
+#include <ESP8266WiFi.h>
+#include <bearssl/bearssl_hash.h>
+
+// =============================================================================
+// STATIC DATA
+// =============================================================================
+
+enum LiveClientState : uint8_t {
+    LIVE_FREE = 0,
+    LIVE_HANDSHAKE,     // Reading the HTTP upgrade request
+    LIVE_OPEN           // Upgraded - events are sent
+};
+
+enum LiveOpcode : uint8_t {
+    LIVE_OP_TEXT = 0x1,
+    LIVE_OP_CLOSE = 0x8,
+    LIVE_OP_PING = 0x9,
+    LIVE_OP_PONG = 0xA
+};
+
+/**
+ * A connection and its parser state
+ */
+struct LiveClient {
+    WiFiClient client;
+    uint8_t state;
+    unsigned long since;            // Accepted at (millis)
+    uint8_t dropped;                // Events missed in a row
+
+    // Shared: handshake header line, then control frame payload
+    uint8_t buf[LIVE_CLIENT_BUFFER];
+    uint8_t bufLen;
+
+    // Handshake
+    char key[25];                   // Sec-WebSocket-Key (base64 of 16 bytes)
+    bool requestSeen;               // Request line was a GET
+
+    // Incoming frame
+    uint8_t header[14];
+    uint8_t headerLen;
+    uint32_t payloadLeft;
+    uint8_t payloadPos;
+};
+
+static WiFiServer liveServer(WEBSOCKET_PORT);
+static bool started = false;
+static LiveClient clients[LIVE_MAX_CLIENTS];
+static LiveStats stats = {};
+static unsigned long lastHeapEvent = 0;
+
+static const char* const WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// =============================================================================
+// CONNECTIONS
+// =============================================================================
+
+void initLive() {
+    liveServer.begin();
+    liveServer.setNoDelay(true);
+    started = true;
+    Serial.printf("[LIVE] WebSocket channel on port %d (max %d clients)\n",
+                  WEBSOCKET_PORT, LIVE_MAX_CLIENTS);
+}
+
+static void closeClient(LiveClient& c) {
+    if (c.state == LIVE_OPEN && stats.clients > 0) stats.clients--;
+    c.client.stop();
+    c.client = WiFiClient();
+    c.state = LIVE_FREE;
+}
+
+/**
+ * Take a new connection, or turn it away if every slot is in use
+ */
+static void acceptClient(WiFiClient& incoming) {
+    for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        LiveClient& c = clients[i];
+        if (c.state != LIVE_FREE) continue;
+        c.client = incoming;
+        c.client.setNoDelay(true);
+        c.state = LIVE_HANDSHAKE;
+        c.since = millis();
+        c.dropped = 0;
+        c.bufLen = 0;
+        c.key[0] = '\0';
+        c.requestSeen = false;
+        c.headerLen = 0;
+        return;
+    }
+    incoming.print(F("HTTP/1.1 503 Service Unavailable\r\nConnection: close\r\nContent-Length: 0\r\n\r\n"));
+    incoming.stop();
+    stats.refused++;
+}
+
+bool liveHasClients() {
+    return stats.clients > 0;
+}
+
+LiveStats getLiveStats() {
+    return stats;
+}
+
+// =============================================================================
+// HANDSHAKE
+// =============================================================================
+
+/**
+ * Sec-WebSocket-Accept for a key: base64(SHA-1(key + GUID))
+ */
+static void makeAcceptKey(const char* key, char* out) {
+    static const char BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    uint8_t hash[21];
+    br_sha1_context sha;
+    br_sha1_init(&sha);
+    br_sha1_update(&sha, key, strlen(key));
+    br_sha1_update(&sha, WEBSOCKET_GUID, strlen(WEBSOCKET_GUID));
+    br_sha1_out(&sha, hash);
+    hash[20] = 0;
+
+    // 20 bytes -> 27 characters and one '=' of padding
+    char* p = out;
+    for (uint8_t i = 0; i < 21; i += 3) {
+        uint32_t v = ((uint32_t)hash[i] << 16) | ((uint32_t)hash[i + 1] << 8) | hash[i + 2];
+        *p++ = BASE64[(v >> 18) & 0x3F];
+        *p++ = BASE64[(v >> 12) & 0x3F];
+        *p++ = BASE64[(v >> 6) & 0x3F];
+        *p++ = (i + 2 < 20) ? BASE64[v & 0x3F] : '=';
+    }
+    *p = '\0';
+}
+
+/**
+ * Act on one request header line (CR/LF stripped, possibly truncated)
+ */
+static void handleRequestLine(LiveClient& c) {
+    const char* line = (const char*)c.buf;
+    if (!c.requestSeen) {
+        c.requestSeen = strncmp(line, "GET ", 4) == 0;
+        return;
+    }
+    if (strncasecmp(line, "Sec-WebSocket-Key:", 18) == 0) {
+        const char* value = line + 18;
+        while (*value == ' ') value++;
+        strncpy(c.key, value, sizeof(c.key) - 1);
+        c.key[sizeof(c.key) - 1] = '\0';
+    }
+}
+
+/**
+ * Read the upgrade request; answer it once the blank line arrives
+ */
+static void stepHandshake(LiveClient& c) {
+    if (millis() - c.since > LIVE_HANDSHAKE_TIMEOUT_MS) {
+        closeClient(c);
+        return;
+    }
+    while (c.client.available()) {
+        int ch = c.client.read();
+        if (ch < 0) break;
+        if (ch == '\r') continue;
+        if (ch != '\n') {
+            // Keep the start of long lines; only short headers matter
+            if (c.bufLen < sizeof(c.buf) - 1) c.buf[c.bufLen++] = ch;
+            continue;
+        }
+        c.buf[c.bufLen] = '\0';
+        if (c.bufLen > 0) {
+            handleRequestLine(c);
+            c.bufLen = 0;
+            continue;
+        }
+
+        // End of headers
+        if (!c.requestSeen || strlen(c.key) != 24) {
+            c.client.print(F("HTTP/1.1 400 Bad Request\r\nConnection: close\r\nContent-Length: 0\r\n\r\n"));
+            closeClient(c);
+            return;
+        }
+        char accept[29];
+        makeAcceptKey(c.key, accept);
+        c.client.printf("HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                        "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n", accept);
+        c.state = LIVE_OPEN;
+        c.bufLen = 0;
+        stats.clients++;
+        stats.accepted++;
+        lastHeapEvent = 0;  // Greet with current stats
+        return;
+    }
+}
+
+// =============================================================================
+// FRAMES
+// =============================================================================
+
+/**
+ * Write one unfragmented frame to a client
+ * @return false if the send window has no room for it
+ */
+static bool sendFrame(LiveClient& c, uint8_t opcode, const uint8_t* payload, uint8_t len) {
+    uint8_t frame[2 + LIVE_CLIENT_BUFFER];
+    if (len > LIVE_CLIENT_BUFFER) return false;
+    frame[0] = 0x80 | opcode;
+    frame[1] = len;
+    memcpy(frame + 2, payload, len);
+    if (c.client.availableForWrite() < (size_t)len + 2) return false;
+    return c.client.write(frame, len + 2) == (size_t)len + 2;
+}
+
+/**
+ * Header bytes needed so far: 2, then the full length once byte 1 is known
+ */
+static uint8_t frameHeaderLength(const LiveClient& c) {
+    if (c.headerLen < 2) return 2;
+    uint8_t lengthCode = c.header[1] & 0x7F;
+    uint8_t length = 2;
+    if (lengthCode == 126) length += 2;
+    else if (lengthCode == 127) length += 8;
+    if (c.header[1] & 0x80) length += 4;  // Masking key
+    return length;
+}
+
+/**
+ * Act on a complete client frame - only close and ping matter
+ */
+static void handleFrame(LiveClient& c) {
+    uint8_t opcode = c.header[0] & 0x0F;
+    if (opcode == LIVE_OP_CLOSE) {
+        // Echo the status code, then hang up
+        sendFrame(c, LIVE_OP_CLOSE, c.buf, c.bufLen >= 2 ? 2 : 0);
+        closeClient(c);
+    } else if (opcode == LIVE_OP_PING) {
+        sendFrame(c, LIVE_OP_PONG, c.buf, c.bufLen);
+    }
+    c.headerLen = 0;
+    c.bufLen = 0;
+}
+
+/**
+ * Parse whatever the client sent; data frame payloads are skipped
+ */
+static void readFrames(LiveClient& c) {
+    uint8_t chunk[32];
+    while (c.state == LIVE_OPEN && c.client.available()) {
+        int n = c.client.read(chunk, sizeof(chunk));
+        if (n <= 0) break;
+        for (int i = 0; i < n && c.state == LIVE_OPEN; i++) {
+            uint8_t b = chunk[i];
+
+            if (c.headerLen < frameHeaderLength(c)) {
+                c.header[c.headerLen++] = b;
+                if (c.headerLen < 2 || c.headerLen < frameHeaderLength(c)) continue;
+
+                // Header complete
+                uint8_t lengthCode = c.header[1] & 0x7F;
+                if (lengthCode == 126) {
+                    c.payloadLeft = ((uint32_t)c.header[2] << 8) | c.header[3];
+                } else if (lengthCode == 127) {
+                    c.payloadLeft = 0xFFFFFFFF;  // Far beyond anything accepted
+                } else {
+                    c.payloadLeft = lengthCode;
+                }
+                c.payloadPos = 0;
+                c.bufLen = 0;
+                bool control = c.header[0] & 0x08;
+                if (control && c.payloadLeft > sizeof(c.buf)) {
+                    closeClient(c);  // Control frames are at most 125 bytes; ours hold less
+                    break;
+                }
+                if (c.payloadLeft == 0) handleFrame(c);
+                continue;
+            }
+
+            // Payload byte
+            if (c.header[0] & 0x08) {
+                bool masked = c.header[1] & 0x80;
+                uint8_t maskAt = frameHeaderLength(c) - 4;
+                c.buf[c.bufLen++] = masked ? b ^ c.header[maskAt + (c.payloadPos & 3)] : b;
+            }
+            c.payloadPos++;
+            if (--c.payloadLeft == 0) handleFrame(c);
+        }
+    }
+}
+
+/**
+ * Send a prepared frame to every open client
+ */
+static void broadcast(const uint8_t* frame, size_t len) {
+    for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        LiveClient& c = clients[i];
+        if (c.state != LIVE_OPEN) continue;
+        if (c.client.availableForWrite() >= len && c.client.write(frame, len) == len) {
+            c.dropped = 0;
+            continue;
+        }
+        stats.dropped++;
+        if (++c.dropped >= LIVE_MAX_DROPPED) {
+            Serial.println(F("[LIVE] Client not keeping up, disconnecting"));
+            closeClient(c);
+        }
+    }
+}
+
+void liveSendf(const char* format, ...) {
+    if (!liveHasClients()) return;
+
+    // Payload goes after room for the longest header this size needs
+    uint8_t frame[4 + LIVE_EVENT_MAX + 1];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf((char*)frame + 4, LIVE_EVENT_MAX + 1, format, args);
+    va_end(args);
+    if (len < 0 || len > LIVE_EVENT_MAX) return;
+
+    uint8_t* start;
+    if (len < 126) {
+        start = frame + 2;
+        start[1] = len;
+    } else {
+        start = frame;
+        start[1] = 126;
+        start[2] = len >> 8;
+        start[3] = len & 0xFF;
+    }
+    start[0] = 0x80 | LIVE_OP_TEXT;
+    stats.events++;
+    broadcast(start, frame + 4 + len - start);
+}
+
+// =============================================================================
+// MAIN LOOP
+// =============================================================================
+
+void updateLive() {
+    if (!started) return;
+
+    WiFiClient incoming = liveServer.accept();
+    if (incoming) acceptClient(incoming);
+
+    for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        LiveClient& c = clients[i];
+        if (c.state == LIVE_FREE) continue;
+        if (!c.client.connected()) {
+            closeClient(c);
+        } else if (c.state == LIVE_HANDSHAKE) {
+            stepHandshake(c);
+        } else {
+            readFrames(c);
+        }
+    }
+
+    unsigned long now = millis();
+    if (liveHasClients() && (lastHeapEvent == 0 || now - lastHeapEvent >= LIVE_HEAP_INTERVAL_MS)) {
+        lastHeapEvent = now;
+        liveSendf("{\"type\":\"heap\",\"free\":%u,\"maxBlock\":%u,\"fragmentation\":%u,"
+                  "\"uptime\":%lu,\"rssi\":%d}",
+                  (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMaxFreeBlockSize(),
+                  (unsigned)ESP.getHeapFragmentation(), now / 1000, (int)WiFi.RSSI());
+    }
+}
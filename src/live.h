@@ -0,0 +1,90 @@
+/**
+ * EpicWeatherBox Firmware - Live Status Channel
+ *
+ * A small WebSocket server on WEBSOCKET_PORT that pushes events to open
+ * admin tabs: content changes, fetch progress, the screen on display, heap
+ * stats and OTA progress. Server-to-client text frames only; messages from
+ * the browser are read and discarded, apart from ping and close.
+ *
+ * Memory is bounded: at most LIVE_MAX_CLIENTS connections, each with a
+ * fixed LIVE_CLIENT_BUFFER for the handshake and control frames. An event
+ * is only written when it fits the connection's TCP send window, so nothing
+ * queues up behind a slow client - it misses the event instead.
+ */
+
+#ifndef LIVE_H
+#define LIVE_H
+
+#include <Arduino.h>
+
+// =============================================================================
+// LIVE CHANNEL CONFIGURATION
+// =============================================================================
+
+// Open connections at once; further connections are refused with a 503
+#define LIVE_MAX_CLIENTS 3
+
+// Per-client buffer: handshake header lines and incoming control frames
+#define LIVE_CLIENT_BUFFER 64
+
+// Largest event payload (bytes of JSON)
+#define LIVE_EVENT_MAX 192
+
+// Handshakes not completed within this are dropped (milliseconds)
+#define LIVE_HANDSHAKE_TIMEOUT_MS 3000
+
+// Heap event interval while any client is connected (milliseconds)
+#define LIVE_HEAP_INTERVAL_MS 5000
+
+// A client that misses this many events in a row is disconnected
+#define LIVE_MAX_DROPPED 8
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/**
+ * Channel counters (reported by /api/status)
+ */
+struct LiveStats {
+    uint8_t clients;        // Open connections
+    uint32_t accepted;      // Handshakes completed
+    uint32_t refused;       // Connections turned away at the client cap
+    uint32_t events;        // Events broadcast
+    uint32_t dropped;       // Frames skipped for a full send window
+};
+
+// =============================================================================
+// FUNCTION DECLARATIONS
+// =============================================================================
+
+/**
+ * Start listening on WEBSOCKET_PORT
+ * Call once in setup() after WiFi is connected
+ */
+void initLive();
+
+/**
+ * Accept connections, step handshakes, read incoming frames and send the
+ * periodic heap event
+ * Call in loop()
+ */
+void updateLive();
+
+/**
+ * Check if any client has an open channel (skip building events if not)
+ */
+bool liveHasClients();
+
+/**
+ * Send a printf-formatted JSON event to every open client
+ * Output longer than LIVE_EVENT_MAX is not sent.
+ */
+void liveSendf(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+/**
+ * Get channel counters
+ */
+LiveStats getLiveStats();
+
+#endif // LIVE_H
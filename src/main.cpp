@@ -19,12 +19,12 @@
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
 #include <ESP8266WebServer.h>
-#include <ESP8266HTTPClient.h>
 #include <WiFiManager.h>
 #include <ArduinoJson.h>
 #include <LittleFS.h>
 #include <NTPClient.h>
 #include <WiFiUdp.h>
+#include <new>
 
 // Enable hardware watchdog
 extern "C" {
@@ -35,8 +35,11 @@ extern "C" {
 #include "config.h"
 #include "ota.h"
 #include "weather.h"
+#include "net.h"
+#include "live.h"        // WebSocket live status channel
 #include "themes.h"      // Theme system with color management
 #include "admin_html.h"  // Generated gzipped admin HTML
+#include "icon_atlas.h"  // Generated weather icon atlas
 
 // ============================================================================
 // TFT DISPLAY - MINIMAL SAFE TEST
@@ -49,6 +52,7 @@ extern "C" {
 #include <TFT_eSPI.h>
 #include <NTPClient.h>
 #include <JPEGDecoder.h>  // For custom image screen support
+#include <picojpeg.h>     // JPEGDecoder's decoder, used directly for scaled decodes
 // AnimatedGIF disabled - uses too much RAM (~25KB) for ESP8266 with only 80KB total
 // The ESP8266 runs out of heap when GIF decoder is loaded alongside web server
 // JPEGDecoder is much more memory efficient (~4-8KB vs 25KB)
@@ -77,9 +81,40 @@ extern const GFXfont FreeSansBold24pt7b;
 #define FSSB24 &FreeSansBold24pt7b
 #define GFXFF 1  // GFX Free Font render mode
 
-static TFT_eSPI tft = TFT_eSPI();
+/**
+ * Panel driver that meters SPI traffic
+ * Every primitive that reaches the panel adds its pixels (2 bytes each) plus
+ * the 11-byte address window set-up. Compound shapes, lines and GFX font
+ * glyphs are built from these, so they are counted too.
+ */
+class MeteredTFT : public TFT_eSPI {
+public:
+    uint32_t spiBytes = 0;
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override {
+        spiBytes += 11 + 2;
+        TFT_eSPI::drawPixel(x, y, color);
+    }
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override {
+        if (w > 0) spiBytes += 11 + (uint32_t)w * 2;
+        TFT_eSPI::drawFastHLine(x, y, w, color);
+    }
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override {
+        if (h > 0) spiBytes += 11 + (uint32_t)h * 2;
+        TFT_eSPI::drawFastVLine(x, y, h, color);
+    }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override {
+        if (w > 0 && h > 0) spiBytes += 11 + (uint32_t)w * h * 2;
+        TFT_eSPI::fillRect(x, y, w, h, color);
+    }
+};
+
+static MeteredTFT tft;
 #define TFT_BL_PIN 5  // Backlight PWM pin
 
+// Where screens draw: the band sprite while renderScreen() runs, else the panel
+static TFT_eSPI* gfx = &tft;
+
 // GIF support disabled due to memory constraints
 // static AnimatedGIF gif;
 // static File gifFile;
@@ -116,214 +151,88 @@ void applyBrightness(int brightness) {
 }
 
 // Colors are now managed by themes.h/themes.cpp
-// Icon colors used as default values for drawing functions
+// Fixed icon colors (the rest come from the theme)
 #define ICON_SUN       0x07FF  // Yellow/cyan (used for sun icon rays)
-#define ICON_CLOUD     0xFFFF  // White cloud (dark mode default)
-#define ICON_RAIN      0xFD00  // Light blue rain (dark mode default)
-#define ICON_SNOW      0xFFFF  // White snow (dark mode default)
 #define ICON_LIGHTNING 0x07FF  // Yellow lightning bolt
 
 // ============================================================================
-// PROCEDURAL PIXEL-ART WEATHER ICONS
+// INDICATOR ICONS
 // ============================================================================
-// Based on reference: weather-line-icons-pixel-art-set
-// Each icon is drawn at specified x,y with given size (default 32x32)
-
-// Helper: Draw a pixel block (scaled pixel)
-inline void drawPixel(int x, int y, int px, int py, int scale, uint16_t color) {
-    tft.fillRect(x + px * scale, y + py * scale, scale, scale, color);
-}
-
-// Draw sun icon (golden circle with rays)
-void drawIconSun(int x, int y, int size = 32) {
-    int s = size / 16;  // Scale factor (2 for 32px icon)
-    uint16_t c = ICON_SUN;
-
-    // Center circle (4x4 at center)
-    for (int py = 6; py < 10; py++) {
-        for (int px = 6; px < 10; px++) {
-            drawPixel(x, y, px, py, s, c);
-        }
-    }
-
-    // Rays (extending outward)
-    // Top ray
-    drawPixel(x, y, 7, 2, s, c); drawPixel(x, y, 8, 2, s, c);
-    drawPixel(x, y, 7, 3, s, c); drawPixel(x, y, 8, 3, s, c);
-    // Bottom ray
-    drawPixel(x, y, 7, 12, s, c); drawPixel(x, y, 8, 12, s, c);
-    drawPixel(x, y, 7, 13, s, c); drawPixel(x, y, 8, 13, s, c);
-    // Left ray
-    drawPixel(x, y, 2, 7, s, c); drawPixel(x, y, 2, 8, s, c);
-    drawPixel(x, y, 3, 7, s, c); drawPixel(x, y, 3, 8, s, c);
-    // Right ray
-    drawPixel(x, y, 12, 7, s, c); drawPixel(x, y, 12, 8, s, c);
-    drawPixel(x, y, 13, 7, s, c); drawPixel(x, y, 13, 8, s, c);
-    // Diagonal rays (smaller)
-    drawPixel(x, y, 4, 4, s, c); drawPixel(x, y, 11, 4, s, c);
-    drawPixel(x, y, 4, 11, s, c); drawPixel(x, y, 11, 11, s, c);
-}
-
-// Draw cloud icon (fluffy white cloud)
-void drawIconCloud(int x, int y, int size = 32, uint16_t color = ICON_CLOUD) {
-    int s = size / 16;
-
-    // Main cloud body - rounded shape
-    // Top bumps
-    for (int px = 5; px < 9; px++) drawPixel(x, y, px, 4, s, color);
-    for (int px = 9; px < 13; px++) drawPixel(x, y, px, 5, s, color);
-    // Middle section
-    for (int py = 5; py < 10; py++) {
-        for (int px = 3; px < 14; px++) {
-            drawPixel(x, y, px, py, s, color);
-        }
-    }
-    // Bottom flat
-    for (int px = 2; px < 14; px++) {
-        drawPixel(x, y, px, 10, s, color);
-        drawPixel(x, y, px, 11, s, color);
-    }
-}
-
-// Draw rain drops below a position
-void drawRainDrops(int x, int y, int size = 32, uint16_t color = ICON_RAIN) {
-    int s = size / 16;
-
-    // 3 rain drops in a row
-    drawPixel(x, y, 4, 12, s, color); drawPixel(x, y, 4, 13, s, color);
-    drawPixel(x, y, 8, 13, s, color); drawPixel(x, y, 8, 14, s, color);
-    drawPixel(x, y, 12, 12, s, color); drawPixel(x, y, 12, 13, s, color);
-}
-
-// Draw snow flakes
-void drawSnowFlakes(int x, int y, int size = 32, uint16_t color = ICON_SNOW) {
-    int s = size / 16;
-
-    // Small dots for snow
-    drawPixel(x, y, 4, 12, s, color);
-    drawPixel(x, y, 7, 14, s, color);
-    drawPixel(x, y, 11, 12, s, color);
-    drawPixel(x, y, 9, 13, s, color);
-    drawPixel(x, y, 5, 14, s, color);
-}
-
-// Draw lightning bolt
-void drawLightning(int x, int y, int size = 32) {
-    int s = size / 16;
-    uint16_t c = ICON_LIGHTNING;
-
-    // Zigzag bolt shape
-    drawPixel(x, y, 8, 8, s, c);
-    drawPixel(x, y, 7, 9, s, c);
-    drawPixel(x, y, 8, 9, s, c);
-    drawPixel(x, y, 6, 10, s, c);
-    drawPixel(x, y, 7, 10, s, c);
-    drawPixel(x, y, 8, 10, s, c);
-    drawPixel(x, y, 9, 10, s, c);
-    drawPixel(x, y, 7, 11, s, c);
-    drawPixel(x, y, 8, 11, s, c);
-    drawPixel(x, y, 6, 12, s, c);
-    drawPixel(x, y, 7, 12, s, c);
-    drawPixel(x, y, 5, 13, s, c);
-    drawPixel(x, y, 6, 13, s, c);
-}
-
-// Draw moon (crescent)
-void drawIconMoon(int x, int y, int size = 32) {
-    int s = size / 16;
-    uint16_t c = ICON_SUN;  // Yellow moon
-
-    // Crescent shape
-    for (int py = 4; py < 12; py++) {
-        for (int px = 5; px < 11; px++) {
-            // Full circle minus inner offset circle
-            int dx = px - 8;
-            int dy = py - 8;
-            int dx2 = px - 6;  // Offset for crescent cutout
-            if (dx*dx + dy*dy <= 16 && dx2*dx2 + dy*dy > 9) {
-                drawPixel(x, y, px, py, s, c);
-            }
-        }
-    }
-}
-
-// Draw fog lines
-void drawIconFog(int x, int y, int size = 32) {
-    int s = size / 16;
-    uint16_t c = getThemeGray();
-
-    // Horizontal wavy lines
-    for (int px = 3; px < 13; px++) {
-        drawPixel(x, y, px, 6, s, c);
-        drawPixel(x, y, px, 9, s, c);
-        drawPixel(x, y, px, 12, s, c);
-    }
-}
+// Weather icons are pre-rendered at build time - see drawWeatherIcon()
 
 // Indicator icons for forecast cards (taller arrows to match font height)
 
 // Up arrow for high temp (10px wide, 16px tall)
 void drawArrowUp(int x, int y, uint16_t color) {
-    tft.fillTriangle(x+5, y, x, y+6, x+10, y+6, color);  // Arrow head
-    tft.fillRect(x+2, y+6, 7, 10, color);                 // Tall stem
+    gfx->fillTriangle(x+5, y, x, y+6, x+10, y+6, color);  // Arrow head
+    gfx->fillRect(x+2, y+6, 7, 10, color);                 // Tall stem
 }
 
 // Down arrow for low temp (10px wide, 16px tall)
 void drawArrowDown(int x, int y, uint16_t color) {
-    tft.fillRect(x+2, y, 7, 10, color);                   // Tall stem
-    tft.fillTriangle(x+5, y+16, x, y+10, x+10, y+10, color);  // Arrow head
+    gfx->fillRect(x+2, y, 7, 10, color);                   // Tall stem
+    gfx->fillTriangle(x+5, y+16, x, y+10, x+10, y+10, color);  // Arrow head
 }
 
 // Small raindrop for precipitation
 void drawRaindrop(int x, int y, uint16_t color) {
-    tft.fillTriangle(x+4, y, x+1, y+5, x+7, y+5, color);
-    tft.fillCircle(x+4, y+6, 3, color);
+    gfx->fillTriangle(x+4, y, x+1, y+5, x+7, y+5, color);
+    gfx->fillCircle(x+4, y+6, 3, color);
 }
 
 // Small percent symbol (8x10 pixels) - drawn as two circles with diagonal line
 void drawPercent(int x, int y, uint16_t color) {
-    tft.fillCircle(x+2, y+2, 2, color);      // Top-left circle
-    tft.fillCircle(x+8, y+8, 2, color);      // Bottom-right circle
+    gfx->fillCircle(x+2, y+2, 2, color);      // Top-left circle
+    gfx->fillCircle(x+8, y+8, 2, color);      // Bottom-right circle
     // Diagonal line (draw as small rectangles for thickness)
     for (int i = 0; i < 10; i++) {
-        tft.fillRect(x + 8 - i, y + i, 2, 1, color);
+        gfx->fillRect(x + 8 - i, y + i, 2, 1, color);
     }
 }
 
 // Small globe icon (12x12 pixels) for location
 void drawGlobe(int x, int y, uint16_t color) {
-    tft.drawCircle(x+6, y+6, 5, color);       // Outer circle
-    tft.drawFastHLine(x+1, y+6, 10, color);   // Horizontal line (equator)
-    tft.drawFastVLine(x+6, y+1, 10, color);   // Vertical line (meridian)
+    gfx->drawCircle(x+6, y+6, 5, color);       // Outer circle
+    gfx->drawFastHLine(x+1, y+6, 10, color);   // Horizontal line (equator)
+    gfx->drawFastVLine(x+6, y+1, 10, color);   // Vertical line (meridian)
     // Curved lines for globe effect
-    tft.drawPixel(x+3, y+3, color);
-    tft.drawPixel(x+9, y+3, color);
-    tft.drawPixel(x+3, y+9, color);
-    tft.drawPixel(x+9, y+9, color);
+    gfx->drawPixel(x+3, y+3, color);
+    gfx->drawPixel(x+9, y+3, color);
+    gfx->drawPixel(x+3, y+9, color);
+    gfx->drawPixel(x+9, y+9, color);
 }
 
 // Small calendar icon (12x12 pixels) for date
 void drawCalendar(int x, int y, uint16_t color) {
     // Calendar body
-    tft.drawRect(x, y+2, 12, 10, color);
+    gfx->drawRect(x, y+2, 12, 10, color);
     // Top bar (header)
-    tft.fillRect(x, y+2, 12, 3, color);
+    gfx->fillRect(x, y+2, 12, 3, color);
     // Calendar hooks
-    tft.fillRect(x+2, y, 2, 3, color);
-    tft.fillRect(x+8, y, 2, 3, color);
+    gfx->fillRect(x+2, y, 2, 3, color);
+    gfx->fillRect(x+8, y, 2, 3, color);
     // Date dots (grid)
-    tft.fillRect(x+2, y+7, 2, 2, color);
-    tft.fillRect(x+5, y+7, 2, 2, color);
-    tft.fillRect(x+8, y+7, 2, 2, color);
+    gfx->fillRect(x+2, y+7, 2, 2, color);
+    gfx->fillRect(x+5, y+7, 2, 2, color);
+    gfx->fillRect(x+8, y+7, 2, 2, color);
+}
+
+// Stale data badge (13x13): clock face - weather shown is from before the last reboot
+void drawStaleBadge(int x, int y, uint16_t color) {
+    gfx->drawCircle(x+6, y+6, 6, color);
+    gfx->drawCircle(x+6, y+6, 5, color);
+    // Hands at ten past
+    gfx->drawLine(x+6, y+6, x+6, y+2, color);
+    gfx->drawLine(x+6, y+6, x+9, y+6, color);
 }
 
 // =============================================================================
 // LARGE CUSTOM NUMBERS (scalable, smooth rounded segments)
 // =============================================================================
 
-// Draw a single large digit (0-9) or minus sign
+// Draw a single large digit (0-9) or minus sign from rounded segments
 // Returns the width of the drawn character
-int drawLargeDigit(int x, int y, char digit, int height, uint16_t color) {
+int drawLargeDigitShapes(int x, int y, char digit, int height, uint16_t color) {
     // Proportions based on height
     int w = height * 3 / 5;      // Width is 60% of height
     int t = height / 10;         // Segment thickness
@@ -342,80 +251,80 @@ int drawLargeDigit(int x, int y, char digit, int height, uint16_t color) {
     // Using rounded rectangles for smooth look
     switch (digit) {
         case '0':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
-            tft.fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
-            tft.fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
-            tft.fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
+            gfx->fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
+            gfx->fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
             break;
         case '1':
             // Draw '1' at left of its bounding box (not at 'right' position)
-            tft.fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color);
-            tft.fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color);
+            gfx->fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color);
+            gfx->fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color);
             return t + gap;  // Narrow width for 1
         case '2':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
-            tft.fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
-            tft.fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
-            tft.fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
+            gfx->fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
+            gfx->fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
+            gfx->fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
             break;
         case '3':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
-            tft.fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
-            tft.fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
+            gfx->fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
             break;
         case '4':
-            tft.fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
-            tft.fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
-            tft.fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
+            gfx->fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
+            gfx->fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
             break;
         case '5':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
-            tft.fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
-            tft.fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
+            gfx->fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
             break;
         case '6':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
-            tft.fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
-            tft.fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
-            tft.fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
+            gfx->fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
+            gfx->fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
             break;
         case '7':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
             break;
         case '8':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
-            tft.fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
-            tft.fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
-            tft.fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
-            tft.fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
+            gfx->fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
+            gfx->fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
+            gfx->fillRoundRect(left, mid + gap, t, height/2 - gap, t/2, color); // botL
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
             break;
         case '9':
-            tft.fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
-            tft.fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
-            tft.fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
-            tft.fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
-            tft.fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
-            tft.fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
+            gfx->fillRoundRect(left + gap, top, w - 2*gap, t, t/2, color);      // top
+            gfx->fillRoundRect(left, top + gap, t, height/2 - gap, t/2, color); // topL
+            gfx->fillRoundRect(right, top + gap, t, height/2 - gap, t/2, color);// topR
+            gfx->fillRoundRect(left + gap, mid, w - 2*gap, t, t/2, color);      // mid
+            gfx->fillRoundRect(right, mid + gap, t, height/2 - gap, t/2, color);// botR
+            gfx->fillRoundRect(left + gap, bot, w - 2*gap, t, t/2, color);      // bot
             break;
         case '-':
             // Narrower minus sign - half the width of a digit
             {
                 int minusW = w / 2;
-                tft.fillRoundRect(left, mid, minusW, t, t/2, color);
+                gfx->fillRoundRect(left, mid, minusW, t, t/2, color);
                 return minusW + gap;
             }
         default:
@@ -424,15 +333,197 @@ int drawLargeDigit(int x, int y, char digit, int height, uint16_t color) {
     return w;
 }
 
+// =============================================================================
+// LARGE DIGIT GLYPH CACHE
+// =============================================================================
+// Seven rounded segments per digit is a lot of fillRoundRect work, and the
+// banded renderer repeats it for every band the digit crosses. Each digit is
+// rasterized once per height into a 1-bit sprite and kept as run-length rows
+// (per row: run count, then start/length pairs). The runs carry no colour, so
+// one glyph serves every theme and a theme change can't leave a stale one.
+
+#define LARGE_DIGIT_CACHE_SIZE 11   // 0-9 and minus at one height (~300 bytes each at 70 px)
+
+struct LargeDigitGlyph {
+    char digit;             // 0 = empty slot
+    uint8_t height;
+    uint8_t w;              // Drawn width (tight - narrower than the advance for '1')
+    uint8_t advance;        // Width drawLargeDigitShapes() returns
+    uint8_t* runs;
+    uint16_t size;          // Bytes in runs
+    uint32_t lastUsed;
+};
+
+static LargeDigitGlyph largeDigitCache[LARGE_DIGIT_CACHE_SIZE];
+static uint32_t largeDigitClock = 0;    // LRU counter
+static uint32_t largeDigitHits = 0;
+static uint32_t largeDigitMisses = 0;
+
+// Encode the set pixels of a 1-bit sprite as runs; out = nullptr just counts
+// bytes. Also reports the drawn width.
+static uint16_t encodeDigitRuns(const uint8_t* bits, int w, int h, uint8_t* out, uint8_t* drawnW) {
+    int stride = (w + 7) / 8;
+    uint16_t size = 0;
+    uint8_t maxX = 0;
+    for (int row = 0; row < h; row++) {
+        const uint8_t* line = bits + row * stride;
+        uint16_t countAt = size++;
+        uint8_t count = 0;
+        int x = 0;
+        while (x < w) {
+            if (!(line[x >> 3] & (0x80 >> (x & 7)))) { x++; continue; }
+            int start = x;
+            while (x < w && (line[x >> 3] & (0x80 >> (x & 7)))) x++;
+            if (out) {
+                out[size] = start;
+                out[size + 1] = x - start;
+            }
+            size += 2;
+            count++;
+            if (x > maxX) maxX = x;
+        }
+        if (out) out[countAt] = count;
+    }
+    if (drawnW) *drawnW = maxX;
+    return size;
+}
+
+/**
+ * Get the cached glyph for a digit, rasterizing it on a miss
+ * @return nullptr if it can't be cached (unsupported size or out of memory)
+ */
+static LargeDigitGlyph* getLargeDigitGlyph(char digit, int height) {
+    if (height <= 0 || height > DISPLAY_HEIGHT) return nullptr;
+
+    LargeDigitGlyph* victim = &largeDigitCache[0];
+    for (uint8_t i = 0; i < LARGE_DIGIT_CACHE_SIZE; i++) {
+        LargeDigitGlyph& glyph = largeDigitCache[i];
+        if (glyph.digit == digit && glyph.height == height) {
+            glyph.lastUsed = ++largeDigitClock;
+            largeDigitHits++;
+            return &glyph;
+        }
+        if (glyph.lastUsed < victim->lastUsed) victim = &glyph;
+    }
+    largeDigitMisses++;
+
+    // Rasterize through the normal shape code into a 1-bit sprite
+    int cellW = height * 3 / 5;
+    TFT_eSprite mask(&tft);
+    mask.setColorDepth(1);
+    if (!mask.createSprite(cellW, height)) return nullptr;
+    TFT_eSPI* target = gfx;
+    gfx = &mask;
+    int advance = drawLargeDigitShapes(0, 0, digit, height, 1);
+    gfx = target;
+
+    const uint8_t* bits = (const uint8_t*)mask.getPointer();
+    uint8_t drawnW = 0;
+    uint16_t size = encodeDigitRuns(bits, cellW, height, nullptr, &drawnW);
+    uint8_t* runs = (uint8_t*)malloc(size);
+    if (!runs) return nullptr;
+    encodeDigitRuns(bits, cellW, height, runs, nullptr);
+
+    free(victim->runs);
+    victim->digit = digit;
+    victim->height = height;
+    victim->w = drawnW;
+    victim->advance = advance;
+    victim->runs = runs;
+    victim->size = size;
+    victim->lastUsed = ++largeDigitClock;
+    return victim;
+}
+
+/**
+ * Draw a cached glyph
+ * On the panel the glyph's whole cell goes out in one address window, gaps
+ * filled with bg. Into a sprite only the runs are drawn over what's there.
+ */
+static void blitLargeDigit(const LargeDigitGlyph& glyph, int x, int y, uint16_t color, uint16_t bg) {
+    const uint8_t* p = glyph.runs;
+    if (glyph.w == 0) return;
+
+    if (gfx == &tft && x >= 0 && y >= 0 &&
+        x + glyph.w <= DISPLAY_WIDTH && y + glyph.height <= DISPLAY_HEIGHT) {
+        tft.startWrite();
+        tft.setAddrWindow(x, y, glyph.w, glyph.height);
+        for (int row = 0; row < glyph.height; row++) {
+            uint8_t count = *p++;
+            int filled = 0;
+            while (count--) {
+                uint8_t start = *p++;
+                uint8_t len = *p++;
+                if (start > filled) tft.pushBlock(bg, start - filled);
+                tft.pushBlock(color, len);
+                filled = start + len;
+            }
+            if (filled < glyph.w) tft.pushBlock(bg, glyph.w - filled);
+        }
+        tft.endWrite();
+        tft.spiBytes += 11 + (uint32_t)glyph.w * glyph.height * 2;
+        return;
+    }
+
+    for (int row = 0; row < glyph.height; row++) {
+        uint8_t count = *p++;
+        while (count--) {
+            uint8_t start = *p++;
+            uint8_t len = *p++;
+            gfx->drawFastHLine(x + start, y + row, len, color);
+        }
+    }
+}
+
+// Draw a single large digit (0-9) or minus sign, from the glyph cache
+// bg is the colour behind the digit. Returns the width of the drawn character
+int drawLargeDigit(int x, int y, char digit, int height, uint16_t color, uint16_t bg) {
+    if (digit != '-' && (digit < '0' || digit > '9')) {
+        return drawLargeDigitShapes(x, y, digit, height, color);
+    }
+    LargeDigitGlyph* glyph = getLargeDigitGlyph(digit, height);
+    if (!glyph) {
+        return drawLargeDigitShapes(x, y, digit, height, color);
+    }
+    blitLargeDigit(*glyph, x, y, color, bg);
+    return glyph->advance;
+}
+
+/**
+ * Time drawing "0123456789" with shapes and with cached glyphs
+ * Warms the cache first, so the cached figure is the steady state.
+ *
+ * @param target Panel or sprite to draw on (contents are overwritten)
+ */
+static void benchLargeDigits(TFT_eSPI* target, int y, int height, uint16_t color, uint16_t bg,
+                             uint32_t* shapesUs, uint32_t* cachedUs) {
+    static const char digits[] = "0123456789";
+    TFT_eSPI* saved = gfx;
+    gfx = target;
+
+    for (int i = 0; digits[i]; i++) getLargeDigitGlyph(digits[i], height);
+
+    uint32_t start = micros();
+    for (int i = 0; digits[i]; i++) drawLargeDigitShapes(10, y, digits[i], height, color);
+    *shapesUs = micros() - start;
+    yield();
+
+    start = micros();
+    for (int i = 0; digits[i]; i++) drawLargeDigit(10, y, digits[i], height, color, bg);
+    *cachedUs = micros() - start;
+
+    gfx = saved;
+}
+
 // Draw a number string with large custom digits
-// Returns total width drawn
-int drawLargeNumber(int x, int y, const char* numStr, int height, uint16_t color) {
+// bg is the colour behind the number. Returns total width drawn
+int drawLargeNumber(int x, int y, const char* numStr, int height, uint16_t color, uint16_t bg) {
     int curX = x;
     int spacing = height / 8;  // Space between digits
     if (spacing < 2) spacing = 2;
 
     for (int i = 0; numStr[i] != '\0'; i++) {
-        int charW = drawLargeDigit(curX, y, numStr[i], height, color);
+        int charW = drawLargeDigit(curX, y, numStr[i], height, color, bg);
         curX += charW + spacing;
     }
     return curX - x - spacing;  // Total width (minus last spacing)
@@ -461,6 +552,271 @@ int getLargeNumberWidth(const char* numStr, int height) {
     return total - spacing;  // Remove last spacing
 }
 
+// =============================================================================
+// BATCHED TEXT
+// =============================================================================
+// drawString() with a GFX free font draws each glyph run by run, which on the
+// panel is an address window per run. drawText() can instead rasterize the
+// whole string into a 1-bit buffer first and send it in one go: on the panel
+// one address window over the ink with the background fill included, into a
+// sprite just the ink runs. Bands the text doesn't touch skip it entirely.
+//
+// A banded frame runs the screen's draw function once per band, so text that
+// spans several bands would be rasterized again for each. While a frame
+// renders, the masks stay in a few slots keyed by what shapes the raster
+// (string, font, datum and position - colours are applied when pushing) and
+// the following bands reuse them. They are freed when the frame is done.
+
+#define TEXT_BATCHED 1          // Default path for drawText() (0 = drawString)
+#define TEXT_CACHE_SLOTS 4      // Masks kept during a frame
+#define TEXT_CACHE_MAX_CHARS 47 // Longer strings are rasterized every time
+
+struct TextMask {
+    TFT_eSprite* sprite;        // 1-bit raster (nullptr = slot free)
+    const GFXfont* font;
+    int32_t x, y;
+    uint8_t datum;
+    uint32_t lastUsed;          // textCacheTick when last drawn
+    char str[TEXT_CACHE_MAX_CHARS + 1];
+};
+
+static TextMask textCache[TEXT_CACHE_SLOTS];
+static bool textCacheActive = false;
+static uint32_t textCacheTick = 0;
+static uint32_t textCacheHits = 0;      // Masks reused by a later band
+static uint32_t textCacheMisses = 0;    // Masks rasterized
+
+/**
+ * Keep text masks until endTextCache() - call before rendering a frame
+ */
+static void beginTextCache() {
+    textCacheActive = true;
+}
+
+/**
+ * Free the masks kept for the frame
+ */
+static void endTextCache() {
+    for (TextMask& slot : textCache) {
+        if (slot.sprite) {
+            slot.sprite->deleteSprite();
+            delete slot.sprite;
+            slot.sprite = nullptr;
+        }
+    }
+    textCacheActive = false;
+}
+
+/**
+ * Find the mask for a string drawn earlier in the frame
+ */
+static TFT_eSprite* findTextMask(const char* str, int32_t x, int32_t y,
+                                 const GFXfont* font, uint8_t datum) {
+    if (!textCacheActive) return nullptr;
+    for (TextMask& slot : textCache) {
+        if (slot.sprite && slot.font == font && slot.x == x && slot.y == y &&
+            slot.datum == datum && strcmp(slot.str, str) == 0) {
+            slot.lastUsed = ++textCacheTick;
+            textCacheHits++;
+            return slot.sprite;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Get a sprite to rasterize a string into, kept for the rest of the frame
+ * The least recently drawn mask makes room when every slot is taken.
+ * @return nullptr outside a frame, for long strings, or without memory
+ */
+static TFT_eSprite* claimTextMask(const char* str, int32_t x, int32_t y,
+                                  const GFXfont* font, uint8_t datum) {
+    if (!textCacheActive || strlen(str) > TEXT_CACHE_MAX_CHARS) return nullptr;
+
+    TextMask* slot = &textCache[0];
+    for (TextMask& candidate : textCache) {
+        if (!candidate.sprite) {
+            slot = &candidate;
+            break;
+        }
+        if (candidate.lastUsed < slot->lastUsed) slot = &candidate;
+    }
+    if (slot->sprite) {
+        slot->sprite->deleteSprite();
+    } else {
+        slot->sprite = new (std::nothrow) TFT_eSprite(&tft);
+        if (!slot->sprite) return nullptr;
+    }
+    strcpy(slot->str, str);
+    slot->font = font;
+    slot->x = x;
+    slot->y = y;
+    slot->datum = datum;
+    slot->lastUsed = ++textCacheTick;
+    return slot->sprite;
+}
+
+/**
+ * Give back a claimed mask that couldn't be allocated
+ */
+static void dropTextMask(TFT_eSprite* mask) {
+    for (TextMask& slot : textCache) {
+        if (slot.sprite == mask) {
+            delete slot.sprite;
+            slot.sprite = nullptr;
+        }
+    }
+}
+
+/**
+ * Push the set pixels of a 1-bit buffer in fg, cropped to the ink
+ * On the panel the crop goes out as one address window with gaps in bg.
+ */
+static void pushTextMask(const uint8_t* bits, int w, int h, int x, int y, uint16_t fg, uint16_t bg) {
+    int stride = (w + 7) / 8;
+    auto isSet = [&](int px, int py) {
+        return (bits[py * stride + (px >> 3)] & (0x80 >> (px & 7))) != 0;
+    };
+
+    // Crop to the ink so the bg fill never reaches neighbouring content
+    int x0 = w, x1 = -1, y0 = h, y1 = -1;
+    for (int py = 0; py < h; py++) {
+        for (int px = 0; px < w; px++) {
+            if (!isSet(px, py)) continue;
+            if (px < x0) x0 = px;
+            if (px > x1) x1 = px;
+            if (py < y0) y0 = py;
+            y1 = py;
+        }
+    }
+    if (x1 < 0) return;
+    int cw = x1 - x0 + 1;
+    int ch = y1 - y0 + 1;
+
+    if (gfx == &tft) {
+        tft.startWrite();
+        tft.setAddrWindow(x + x0, y + y0, cw, ch);
+        for (int py = y0; py <= y1; py++) {
+            int px = x0;
+            while (px <= x1) {
+                bool set = isSet(px, py);
+                int start = px;
+                while (px <= x1 && isSet(px, py) == set) px++;
+                tft.pushBlock(set ? fg : bg, px - start);
+            }
+        }
+        tft.endWrite();
+        tft.spiBytes += 11 + (uint32_t)cw * ch * 2;
+        return;
+    }
+
+    for (int py = y0; py <= y1; py++) {
+        int px = x0;
+        while (px <= x1) {
+            if (!isSet(px, py)) { px++; continue; }
+            int start = px;
+            while (px <= x1 && isSet(px, py)) px++;
+            gfx->drawFastHLine(x + start, y + py, px - start, fg);
+        }
+    }
+}
+
+/**
+ * Draw a string in a GFX free font at the current text datum
+ * Leaves font and text colour set, as drawString() would.
+ *
+ * @param bg      Colour behind the text (filled around the glyphs on the panel)
+ * @param batched Rasterize the whole string first (see above), or drawString()
+ * @return Text width
+ */
+int16_t drawText(const char* str, int32_t x, int32_t y, const GFXfont* font,
+                 uint16_t fg, uint16_t bg, bool batched = TEXT_BATCHED) {
+    gfx->setFreeFont(font);
+    gfx->setTextColor(fg);
+    if (!batched) {
+        return gfx->drawString(str, x, y, GFXFF);
+    }
+
+    int16_t textW = gfx->textWidth(str, GFXFF);
+    int16_t textH = gfx->fontHeight(GFXFF);
+    if (textW <= 0) return 0;
+
+    // Box around the text for the datum, padded for glyph overhang and
+    // descenders, clipped to the screen
+    uint8_t datum = gfx->getTextDatum();
+    int padX = 4;
+    int padY = textH / 4;
+    int bx = x - padX - (datum % 3) * textW / 2;
+    int by;
+    switch (datum / 3) {
+        case 0:  by = y; break;                 // Top
+        case 1:  by = y - textH / 2; break;     // Middle
+        default: by = y - textH; break;         // Bottom and baseline
+    }
+    by -= padY;
+    int bw = textW + 2 * padX;
+    int bh = textH + 2 * padY;
+    if (bx < 0) { bw += bx; bx = 0; }
+    if (by < 0) { bh += by; by = 0; }
+    bw = min(bw, DISPLAY_WIDTH - bx);
+    bh = min(bh, DISPLAY_HEIGHT - by);
+    if (bw <= 0 || bh <= 0) return textW;
+
+    // Band rendering: nothing to do in bands the text doesn't reach
+    if (gfx != &tft && !gfx->checkViewport(bx, by, bw, bh)) return textW;
+
+    // Rasterize, unless an earlier band of this frame already did
+    TFT_eSprite local(&tft);
+    TFT_eSprite* mask = findTextMask(str, x, y, font, datum);
+    if (!mask) {
+        TFT_eSprite* kept = claimTextMask(str, x, y, font, datum);
+        mask = kept ? kept : &local;
+        mask->setColorDepth(1);
+        if (!mask->createSprite(bw, bh)) {
+            if (kept) dropTextMask(kept);
+            return gfx->drawString(str, x, y, GFXFF);
+        }
+        mask->setFreeFont(font);
+        mask->setTextDatum(datum);
+        mask->setTextColor(1);
+        mask->drawString(str, x - bx, y - by, GFXFF);
+        textCacheMisses++;
+    }
+
+    pushTextMask((const uint8_t*)mask->getPointer(), bw, bh, bx, by, fg, bg);
+    return textW;
+}
+
+/**
+ * Time drawing a sample string with drawString() and batched drawText()
+ * Inside beginTextCache() the batched repeats reuse the first raster, as the
+ * bands of a frame do.
+ * @param target Panel or sprite to draw on (contents are overwritten)
+ * @return Glyphs per second on each path
+ */
+static void benchText(TFT_eSPI* target, int y, const GFXfont* font, uint16_t fg, uint16_t bg,
+                      uint32_t* plainGps, uint32_t* batchedGps) {
+    static const char sample[] = "Partly Cloudy 72F";
+    static const int REPEAT = 5;
+    uint32_t glyphs = REPEAT * (sizeof(sample) - 1);
+    TFT_eSPI* saved = gfx;
+    gfx = target;
+    gfx->setTextDatum(TL_DATUM);
+
+    uint32_t start = micros();
+    for (int i = 0; i < REPEAT; i++) drawText(sample, 4, y, font, fg, bg, false);
+    uint32_t elapsed = micros() - start;
+    *plainGps = elapsed ? (uint64_t)glyphs * 1000000 / elapsed : 0;
+    yield();
+
+    start = micros();
+    for (int i = 0; i < REPEAT; i++) drawText(sample, 4, y, font, fg, bg, true);
+    elapsed = micros() - start;
+    *batchedGps = elapsed ? (uint64_t)glyphs * 1000000 / elapsed : 0;
+
+    gfx = saved;
+}
+
 // Forward declarations for theme-aware functions (defined later)
 bool shouldUseDarkTheme();
 uint16_t getThemeBg();
@@ -480,68 +836,95 @@ uint16_t getIconCloudDark();
 uint16_t getIconSnow();
 uint16_t getIconRain();
 
-// Main icon dispatcher - draws weather icon based on condition
-void drawWeatherIcon(int x, int y, WeatherCondition condition, bool isDay = true, int size = 32) {
-    // Get theme-aware icon colors
-    uint16_t cloudColor = getIconCloud();
-    uint16_t cloudDarkColor = getIconCloudDark();
-    uint16_t rainColor = getIconRain();
-    uint16_t snowColor = getIconSnow();
+// ============================================================================
+// WEATHER ICONS
+// ============================================================================
+// The pixel-art icons are rendered at build time by
+// scripts/generate_icon_atlas.py, at the sizes the screens use, into
+// palette-indexed runs in flash (icon_atlas.h). Palette entries are filled
+// with theme colours when an icon is drawn.
+
+// Find an icon at a size in the atlas
+static bool findAtlasIcon(uint8_t id, int size, IconAtlasEntry& entry) {
+    for (uint8_t i = 0; i < icon_atlas_count; i++) {
+        memcpy_P(&entry, &icon_atlas[i], sizeof(entry));
+        if (entry.id == id && entry.size == size) return true;
+    }
+    return false;
+}
 
+static uint8_t iconForCondition(WeatherCondition condition, bool isDay) {
     switch (condition) {
-        case WEATHER_CLEAR:
-            if (isDay) {
-                drawIconSun(x, y, size);
-            } else {
-                drawIconMoon(x, y, size);
-            }
-            break;
-
-        case WEATHER_PARTLY_CLOUDY:
-            // Sun/moon peeking behind cloud
-            if (isDay) {
-                drawIconSun(x - size/8, y - size/8, size * 3/4);
-            } else {
-                drawIconMoon(x - size/8, y - size/8, size * 3/4);
-            }
-            drawIconCloud(x + size/8, y + size/4, size * 3/4, cloudColor);
-            break;
-
-        case WEATHER_CLOUDY:
-            drawIconCloud(x, y, size, cloudColor);
-            break;
-
-        case WEATHER_FOG:
-            drawIconFog(x, y, size);
-            break;
-
+        case WEATHER_CLEAR:          return isDay ? ICON_ID_CLEAR_DAY : ICON_ID_CLEAR_NIGHT;
+        case WEATHER_PARTLY_CLOUDY:  return isDay ? ICON_ID_PARTLY_CLOUDY_DAY : ICON_ID_PARTLY_CLOUDY_NIGHT;
+        case WEATHER_CLOUDY:         return ICON_ID_CLOUDY;
+        case WEATHER_FOG:            return ICON_ID_FOG;
         case WEATHER_DRIZZLE:
-        case WEATHER_RAIN:
-            drawIconCloud(x, y - size/8, size, cloudColor);
-            drawRainDrops(x, y, size, rainColor);
-            break;
-
-        case WEATHER_FREEZING_RAIN:
-            drawIconCloud(x, y - size/8, size, cloudDarkColor);
-            drawRainDrops(x, y, size, rainColor);
-            drawSnowFlakes(x + size/4, y, size, snowColor);
-            break;
+        case WEATHER_RAIN:           return ICON_ID_RAIN;
+        case WEATHER_FREEZING_RAIN:  return ICON_ID_FREEZING_RAIN;
+        case WEATHER_SNOW:           return ICON_ID_SNOW;
+        case WEATHER_THUNDERSTORM:   return ICON_ID_THUNDERSTORM;
+        default:                     return ICON_ID_UNKNOWN;
+    }
+}
 
-        case WEATHER_SNOW:
-            drawIconCloud(x, y - size/8, size, cloudColor);
-            drawSnowFlakes(x, y, size, snowColor);
-            break;
+/**
+ * Draw a weather icon from the atlas
+ * On the panel the icon's box goes out in one address window, transparent
+ * pixels filled with bg. Into a sprite only the coloured runs are drawn.
+ *
+ * @param size Icon size - one of the atlas sizes (32, 64)
+ * @param bg   Colour behind the icon
+ */
+void drawWeatherIcon(int x, int y, WeatherCondition condition, bool isDay, int size, uint16_t bg) {
+    IconAtlasEntry icon;
+    if (!findAtlasIcon(iconForCondition(condition, isDay), size, icon)) {
+        Serial.printf("[TFT] No %d px icon in the atlas\n", size);
+        return;
+    }
 
-        case WEATHER_THUNDERSTORM:
-            drawIconCloud(x, y - size/8, size, cloudDarkColor);
-            drawLightning(x, y, size);
-            drawRainDrops(x + size/4, y, size, rainColor);
-            break;
+    // Theme-aware icon colors, in ICON_PAL_* order
+    const ThemePalette& theme = getThemePalette();
+    uint16_t palette[ICON_PAL_COUNT] = {
+        bg, ICON_SUN, theme.iconCloud, theme.iconCloudDark,
+        theme.iconRain, theme.iconSnow, ICON_LIGHTNING, theme.colors.gray
+    };
+
+    x += icon.dx;
+    y += icon.dy;
+    const uint8_t* runs = icon_atlas_runs + icon.offset;
+
+    if (gfx == &tft && x >= 0 && y >= 0 &&
+        x + icon.w <= DISPLAY_WIDTH && y + icon.h <= DISPLAY_HEIGHT) {
+        tft.startWrite();
+        tft.setAddrWindow(x, y, icon.w, icon.h);
+        for (uint16_t i = 0; i < icon.length; i++) {
+            uint8_t run = pgm_read_byte(runs + i);
+            tft.pushBlock(palette[ICON_RUN_PAL(run)], ICON_RUN_LEN(run));
+        }
+        tft.endWrite();
+        tft.spiBytes += 11 + (uint32_t)icon.w * icon.h * 2;
+        return;
+    }
 
-        default:  // WEATHER_UNKNOWN
-            // Question mark or generic cloud
-            drawIconCloud(x, y, size, getThemeGray());
-            break;
+    // Runs carry on across row ends - split them back into rows
+    int px = 0, py = 0;
+    for (uint16_t i = 0; i < icon.length; i++) {
+        uint8_t run = pgm_read_byte(runs + i);
+        uint8_t pal = ICON_RUN_PAL(run);
+        int len = ICON_RUN_LEN(run);
+        while (len > 0) {
+            int n = min(len, icon.w - px);
+            if (pal != ICON_PAL_TRANSPARENT) {
+                gfx->drawFastHLine(x + px, y + py, n, palette[pal]);
+            }
+            len -= n;
+            px += n;
+            if (px == icon.w) {
+                px = 0;
+                py++;
+            }
+        }
     }
 }
 
@@ -664,6 +1047,245 @@ void showBootScreenIP(const char* ip) {
 // getThemeCyan(), getThemeOrange(), getThemeBlue(), getThemeGray()
 // getIconCloud(), getIconCloudDark(), getIconSnow(), getIconRain()
 
+// ============================================================================
+// BANDED RENDERER
+// ============================================================================
+// A full 240x240 frame (115 KB) doesn't fit in RAM, so screens are composed one
+// horizontal band at a time in a sprite. The screen's draw function runs once
+// per band with the sprite's viewport shifted so everything outside the band is
+// clipped, then the band is sent to the panel in one push. Each pixel crosses
+// SPI exactly once per frame and nothing is painted over on the panel, so the
+// old fillScreen-then-draw flicker is gone.
+
+#define RENDER_BANDED 1         // 0 = draw straight to the panel (old path, for comparison)
+#define RENDER_BAND_HEIGHT 30   // 240 x 30 x 2 bytes = 14 KB sprite, allocated per frame
+
+enum ScreenType : uint8_t {
+    SCREEN_CURRENT = 0,
+    SCREEN_FORECAST,
+    SCREEN_COUNTDOWN,
+    SCREEN_CUSTOM,
+    SCREEN_YOUTUBE,
+    SCREEN_IMAGE,
+    SCREEN_TYPE_COUNT
+};
+
+static const char* const SCREEN_TYPE_NAMES[SCREEN_TYPE_COUNT] = {
+    "current", "forecast", "countdown", "custom", "youtube", "image"
+};
+
+// Render cost per screen type (reported by /api/status)
+struct RenderStats {
+    uint32_t frames;
+    uint32_t lastUs;        // Time to render the most recent frame
+    uint32_t maxUs;
+    uint32_t lastSpiBytes;  // SPI bytes sent for the most recent frame
+    bool banded;            // Most recent frame went through the band sprite
+    uint32_t liveUpdates;   // Minute ticks that redrew only the live regions
+    uint32_t lastLiveUs;
+    uint32_t lastLiveSpiBytes;
+    uint32_t maxLoopUs;     // Longest loop() pass while the screen was up, frame renders aside
+};
+static RenderStats renderStats[SCREEN_TYPE_COUNT];
+
+// Screen rectangle (w = 0 means none)
+struct RenderRect {
+    int16_t x, y, w, h;
+};
+
+// Live regions: rectangles that change on their own while a screen is up (the
+// header clock, a countdown's days). Screens mark them while drawing; at each
+// minute boundary only those are redrawn, each in a sprite of its own size,
+// instead of waiting for the carousel to repaint the whole frame.
+#define LIVE_REGION_MAX 2
+
+static RenderRect liveRegions[LIVE_REGION_MAX];
+static uint8_t liveRegionCount = 0;
+static std::function<void()> liveRedraw;    // Draw function of the screen on the panel
+static uint8_t liveScreen = 0;
+static RenderRect liveHole = {0, 0, 0, 0};
+static uint32_t liveThemeGeneration = 0;   // Palette the screen was drawn with
+static uint32_t liveMinute = 0;             // Epoch minute the live regions show
+
+/**
+ * Mark a rectangle of the screen being drawn as live
+ * Call from the screen's draw function. The rectangle must cover anything the
+ * minute tick can change there, e.g. the widest possible time.
+ */
+static void addLiveRegion(int x, int y, int w, int h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    w = min(w, DISPLAY_WIDTH - x);
+    h = min(h, DISPLAY_HEIGHT - y);
+    if (w <= 0 || h <= 0 || liveRegionCount >= LIVE_REGION_MAX) return;
+    liveRegions[liveRegionCount++] = RenderRect{(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+}
+
+/**
+ * Mark a header clock as live - time in timeFont, AM/PM in FSS9 after it
+ * Sized for the widest time ("12:00 AM"). Leaves FSS9 selected.
+ *
+ * @param centered Clock is centered on the screen (x ignored)
+ */
+static void addClockRegion(int x, int y, const GFXfont* timeFont, bool centered = false) {
+    gfx->setFreeFont(timeFont);
+    int w = gfx->textWidth("12:00", GFXFF);
+    int h = gfx->fontHeight(GFXFF);
+    gfx->setFreeFont(FSS9);
+    w += 4 + gfx->textWidth("AM", GFXFF);
+    if (centered) x = 120 - w / 2;
+    addLiveRegion(x - 2, y, w + 4, h);
+}
+
+// Push part of the band sprite (sprite rows sy.. map to panel row y)
+static void pushBandPart(TFT_eSprite& band, int32_t x, int32_t y, int32_t sy, int32_t w, int32_t h) {
+    if (w <= 0 || h <= 0) return;
+    band.pushSprite(x, y, x, sy, w, h);
+    tft.spiBytes += 11 + (uint32_t)w * h * 2;
+}
+
+// Fill the whole screen through gfx
+// fillScreen() works in the sprite's own 240x30 coordinates, so it would
+// only clear one band
+static void clearScreen(uint16_t color) {
+    gfx->fillRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, color);
+}
+
+static void cancelImageJob();  // Image screens push their image after the frame (see below)
+
+/**
+ * Render a screen band by band
+ * draw() must paint the whole screen through gfx; it runs once per band, and
+ * again for each live region at minute boundaries, so it must not capture
+ * locals by reference. fillHole() then paints the hole straight on the panel,
+ * or starts the image job that will; the bands skip it so those pixels are
+ * only sent once. Falls
+ * back to drawing straight to the panel if the band sprite can't be allocated.
+ */
+template <typename DrawFn, typename FillFn>
+void renderScreen(uint8_t screen, DrawFn draw, RenderRect hole, FillFn fillHole) {
+    cancelImageJob();
+    uint32_t start = micros();
+    uint32_t spiStart = tft.spiBytes;
+    bool banded = false;
+
+#if RENDER_BANDED
+    TFT_eSprite band(&tft);
+    band.setColorDepth(16);
+    if (band.createSprite(DISPLAY_WIDTH, RENDER_BAND_HEIGHT)) {
+        banded = true;
+        gfx = &band;
+        beginTextCache();
+        for (int y0 = 0; y0 < DISPLAY_HEIGHT; y0 += RENDER_BAND_HEIGHT) {
+            int h = min(RENDER_BAND_HEIGHT, DISPLAY_HEIGHT - y0);
+            band.setViewport(0, -y0, DISPLAY_WIDTH, DISPLAY_HEIGHT, true);
+            liveRegionCount = 0;
+            draw();
+            band.resetViewport();
+
+            int holeTop = max(y0, (int)hole.y);
+            int holeBottom = min(y0 + h, hole.y + hole.h);
+            if (hole.w <= 0 || holeTop >= holeBottom) {
+                pushBandPart(band, 0, y0, 0, DISPLAY_WIDTH, h);
+            } else {
+                // Band rows around the hole: above, left, right, below
+                int holeRight = hole.x + hole.w;
+                int holeRows = holeBottom - holeTop;
+                pushBandPart(band, 0, y0, 0, DISPLAY_WIDTH, holeTop - y0);
+                pushBandPart(band, 0, holeTop, holeTop - y0, hole.x, holeRows);
+                pushBandPart(band, holeRight, holeTop, holeTop - y0, DISPLAY_WIDTH - holeRight, holeRows);
+                pushBandPart(band, 0, holeBottom, holeBottom - y0, DISPLAY_WIDTH, y0 + h - holeBottom);
+            }
+            yield();
+        }
+        endTextCache();
+        gfx = &tft;
+    }
+#endif
+
+    if (!banded) {
+        liveRegionCount = 0;
+        draw();
+    }
+    if (hole.w > 0) {
+        fillHole();
+    }
+
+    liveRedraw = draw;
+    liveScreen = screen;
+    liveHole = hole;
+    liveThemeGeneration = getThemePalette().generation;
+    liveMinute = timeClient.getEpochTime() / 60;
+
+    RenderStats& stats = renderStats[screen];
+    stats.frames++;
+    stats.lastUs = micros() - start;
+    if (stats.lastUs > stats.maxUs) stats.maxUs = stats.lastUs;
+    stats.lastSpiBytes = tft.spiBytes - spiStart;
+    stats.banded = banded;
+    Serial.printf("[TFT] Render %s: %u us, %u SPI bytes (%s)\n", SCREEN_TYPE_NAMES[screen],
+                  stats.lastUs, stats.lastSpiBytes, banded ? "banded" : "direct");
+}
+
+template <typename DrawFn>
+void renderScreen(uint8_t screen, DrawFn draw) {
+    renderScreen(screen, draw, RenderRect{0, 0, 0, 0}, []() {});
+}
+
+/**
+ * Redraw the live regions of the screen on the panel
+ * Runs the screen's draw function once per region, clipped to a sprite the
+ * size of the region, and pushes just that. Call when the minute changes.
+ */
+static void renderLiveRegions() {
+    if (!liveRedraw || liveRegionCount == 0) return;
+
+    // Theme or day/night changed since the frame was drawn - a repainted
+    // region would stand out, so leave it to the next carousel step
+    if (getThemePalette().generation != liveThemeGeneration) return;
+
+    uint32_t start = micros();
+    uint32_t spiStart = tft.spiBytes;
+    RenderRect regions[LIVE_REGION_MAX];
+    uint8_t count = liveRegionCount;
+    memcpy(regions, liveRegions, sizeof(regions));
+
+    for (uint8_t i = 0; i < count; i++) {
+        const RenderRect& r = regions[i];
+
+        // Never paint over what the screen filled straight on the panel
+        if (liveHole.w > 0 && r.x < liveHole.x + liveHole.w && liveHole.x < r.x + r.w &&
+            r.y < liveHole.y + liveHole.h && liveHole.y < r.y + r.h) {
+            continue;
+        }
+
+        TFT_eSprite sprite(&tft);
+        sprite.setColorDepth(16);
+        if (!sprite.createSprite(r.w, r.h)) {
+            Serial.printf("[TFT] No memory for %dx%d live region\n", r.w, r.h);
+            continue;
+        }
+        gfx = &sprite;
+        sprite.setViewport(-r.x, -r.y, DISPLAY_WIDTH, DISPLAY_HEIGHT, true);
+        liveRegionCount = 0;
+        liveRedraw();
+        sprite.resetViewport();
+        gfx = &tft;
+
+        sprite.pushSprite(r.x, r.y);
+        tft.spiBytes += 11 + (uint32_t)r.w * r.h * 2;
+        yield();
+    }
+    liveRegionCount = count;
+
+    RenderStats& stats = renderStats[liveScreen];
+    stats.liveUpdates++;
+    stats.lastLiveUs = micros() - start;
+    stats.lastLiveSpiBytes = tft.spiBytes - spiStart;
+    Serial.printf("[TFT] Live regions %s: %u us, %u SPI bytes\n", SCREEN_TYPE_NAMES[liveScreen],
+                  stats.lastLiveUs, stats.lastLiveSpiBytes);
+}
+
 // ============================================================================
 // ANIMATED GIF SUPPORT - DISABLED
 // ============================================================================
@@ -729,7 +1351,7 @@ void drawSafeModeScreen() {
     tft.drawString("or go to /update", 120, 190, GFXFF);
 }
 
-// Draw current weather screen (no sprites - direct to TFT)
+// Draw current weather screen (through gfx - see renderScreen)
 void drawCurrentWeather(int currentScreen, int totalScreens) {
     const WeatherData& weather = getWeather(currentDisplayLocation);
     const WeatherLocation& location = getLocation(currentDisplayLocation);
@@ -739,9 +1361,10 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
     int yOff = -getUiNudgeY();  // Negate because we subtract from Y coords
 
     // Background - use theme color based on day/night
-    uint16_t bgColor = getThemeBg();
-    uint16_t textColor = getThemeText();
-    tft.fillScreen(bgColor);
+    const ThemeColors& theme = getThemePalette().colors;
+    uint16_t bgColor = theme.bg;
+    uint16_t textColor = theme.text;
+    clearScreen(bgColor);
 
     // Get time from NTP and apply timezone offset from primary location
     // Note: Uses location 0's timezone, assuming that's where the device is located
@@ -778,51 +1401,53 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
     const char* ampm = (hours < 12) ? "AM" : "PM";
 
     // Get theme-aware colors
-    uint16_t cyanColor = getThemeCyan();
-    uint16_t grayColor = getThemeGray();
+    uint16_t cyanColor = theme.cyan;
+    uint16_t grayColor = theme.gray;
 
     // ========== Header: Time (large, centered) with smaller AM/PM ==========
     char timeNumStr[16];
     snprintf(timeNumStr, sizeof(timeNumStr), "%d:%02d", h12, minutes);
-    tft.setTextDatum(TC_DATUM);
-    tft.setFreeFont(FSSB18);
-    tft.setTextColor(cyanColor);
+    addClockRegion(0, 6 + yOff, FSSB18, true);
+    gfx->setTextDatum(TC_DATUM);
+    gfx->setFreeFont(FSSB18);
+    gfx->setTextColor(cyanColor);
 
     // Calculate widths to center time + AM/PM together
-    int16_t timeNumW = tft.textWidth(timeNumStr, GFXFF);
-    tft.setFreeFont(FSS9);  // Smaller font for AM/PM
-    int16_t ampmW = tft.textWidth(ampm, GFXFF);
+    int16_t timeNumW = gfx->textWidth(timeNumStr, GFXFF);
+    gfx->setFreeFont(FSS9);  // Smaller font for AM/PM
+    int16_t ampmW = gfx->textWidth(ampm, GFXFF);
     int timeSpacing = 4;
     int totalTimeW = timeNumW + timeSpacing + ampmW;
     int timeStartX = 120 - totalTimeW / 2;
 
     // Draw time numbers
-    tft.setFreeFont(FSSB18);
-    tft.setTextDatum(TL_DATUM);
-    tft.drawString(timeNumStr, timeStartX, 6 + yOff, GFXFF);
+    gfx->setTextDatum(TL_DATUM);
+    drawText(timeNumStr, timeStartX, 6 + yOff, FSSB18, cyanColor, bgColor);
 
     // Draw AM/PM smaller, vertically centered with time
-    tft.setFreeFont(FSS9);
-    tft.drawString(ampm, timeStartX + timeNumW + timeSpacing, 12 + yOff, GFXFF);
+    drawText(ampm, timeStartX + timeNumW + timeSpacing, 12 + yOff, FSS9, cyanColor, bgColor);
 
     // ========== Info row: Globe + Location | Calendar + Date ==========
     int infoY = 42 + yOff;  // More space below time
 
     // Globe icon + Location name (left side)
     drawGlobe(15, infoY, grayColor);
-    tft.setFreeFont(FSS9);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(grayColor);
-    tft.drawString(location.name, 32, infoY, GFXFF);
+    gfx->setTextDatum(TL_DATUM);
+    drawText(location.name, 32, infoY, FSS9, grayColor, bgColor);
 
     // Calendar icon + Date (right side)
     char dateStr[12];
     snprintf(dateStr, sizeof(dateStr), "%s %d", monthNames[month], day);
-    int16_t dateW = tft.textWidth(dateStr, GFXFF);
+    int16_t dateW = gfx->textWidth(dateStr, GFXFF);
     int dateX = 225 - dateW;
     drawCalendar(dateX - 16, infoY, grayColor);
-    tft.setTextDatum(TL_DATUM);
-    tft.drawString(dateStr, dateX, infoY, GFXFF);
+    gfx->setTextDatum(TL_DATUM);
+    drawText(dateStr, dateX, infoY, FSS9, grayColor, bgColor);
+
+    // Restored from flash after a reboot - flag it until a fresh fetch lands
+    if (weather.stale) {
+        drawStaleBadge(220, 10 + yOff, theme.orange);
+    }
 
     // ========== Main content: Two columns ==========
     // Left column (0-119): Weather icon + condition text
@@ -834,24 +1459,18 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
 
     // Weather icon (64x64) centered in left column
     int iconX = leftColCenter - 32;
-    drawWeatherIcon(iconX, mainY, weather.current.condition, weather.current.isDay, 64);
+    drawWeatherIcon(iconX, mainY, weather.current.condition(), weather.current.isDay, 64, bgColor);
 
     // Condition text under icon - centered in left column
     // Use short string version for better fit (e.g., "P.Cloudy" instead of "Partly Cloudy")
-    tft.setTextDatum(TC_DATUM);
-    tft.setFreeFont(FSS12);
-    tft.setTextColor(textColor);
-    tft.drawString(conditionToShortString(weather.current.condition), leftColCenter, mainY + 70, GFXFF);
+    gfx->setTextDatum(TC_DATUM);
+    drawText(conditionToShortString(weather.current.condition()), leftColCenter, mainY + 70,
+             FSS12, textColor, bgColor);
 
     // Current temperature - very large custom numbers, centered in right column
-    float temp = weather.current.temperature;
-    if (!useCelsius) {
-        temp = temp * 9.0 / 5.0 + 32.0;
-    }
-
-    // Build temperature string
+    // (already converted to the display unit when the data was fetched)
     char tempStr[8];
-    snprintf(tempStr, sizeof(tempStr), "%.0f", temp);
+    snprintf(tempStr, sizeof(tempStr), "%d", weather.current.displayTemperature);
 
     // Use custom large numbers - 70px height for prominent display
     int tempHeight = 70;
@@ -860,8 +1479,8 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
     // Unit string (just C or F, no degree symbol)
     char unitStr[2];
     snprintf(unitStr, sizeof(unitStr), "%c", useCelsius ? 'C' : 'F');
-    tft.setFreeFont(FSSB18);
-    int16_t unitW = tft.textWidth(unitStr, GFXFF);
+    gfx->setFreeFont(FSSB18);
+    int16_t unitW = gfx->textWidth(unitStr, GFXFF);
 
     // Add spacing between number and unit
     int tempSpacing = 8;
@@ -870,36 +1489,30 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
     int tempY = mainY + 15;
 
     // Draw temperature number using custom large digits
-    drawLargeNumber(tempStartX, tempY, tempStr, tempHeight, textColor);
+    drawLargeNumber(tempStartX, tempY, tempStr, tempHeight, textColor, bgColor);
 
     // Draw unit (smaller, top-aligned)
-    tft.setFreeFont(FSSB18);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(textColor);
-    tft.drawString(unitStr, tempStartX + tempW + tempSpacing, tempY + 5, GFXFF);
+    gfx->setTextDatum(TL_DATUM);
+    drawText(unitStr, tempStartX + tempW + tempSpacing, tempY + 5, FSSB18, textColor, bgColor);
 
     // ========== Detail bar at bottom with rounded rectangle background ==========
     int barY = 175 + yOff;
     int barH = 36;
     int barMargin = 8;
-    uint16_t cardColor = getThemeCard();
+    uint16_t cardColor = theme.card;
 
     // Draw rounded rectangle background (same style as forecast cards)
-    tft.fillRoundRect(barMargin, barY, 240 - 2*barMargin, barH, 4, cardColor);
+    gfx->fillRoundRect(barMargin, barY, 240 - 2*barMargin, barH, 4, cardColor);
 
     // Get theme-aware accent colors for the bar (use OnCard variants since inside card)
-    uint16_t orangeOnCard = getThemeOrangeOnCard();
-    uint16_t blueOnCard = getThemeBlueOnCard();
-    uint16_t cyanOnCard = getThemeCyanOnCard();
-    uint16_t grayOnCard = getThemeGrayOnCard();
+    uint16_t orangeOnCard = theme.orangeOnCard;
+    uint16_t blueOnCard = theme.blueOnCard;
+    uint16_t cyanOnCard = theme.cyanOnCard;
+    uint16_t grayOnCard = theme.grayOnCard;
 
     if (weather.forecastDays > 0) {
-        float hi = weather.forecast[0].tempMax;
-        float lo = weather.forecast[0].tempMin;
-        if (!useCelsius) {
-            hi = hi * 9.0 / 5.0 + 32.0;
-            lo = lo * 9.0 / 5.0 + 32.0;
-        }
+        int hi = weather.forecast[0].displayMax;
+        int lo = weather.forecast[0].displayMin;
 
         // Three sections within the bar, evenly spaced
         int sectionW = (240 - 2*barMargin) / 3;
@@ -908,33 +1521,30 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
         int section3X = barMargin + 2*sectionW;
         int contentY = barY + 10;
 
-        tft.setFreeFont(FSSB12);
+        gfx->setFreeFont(FSSB12);
 
         // High temp section
         drawArrowUp(section1X + 12, contentY, orangeOnCard);
-        tft.setTextDatum(TL_DATUM);
-        tft.setTextColor(orangeOnCard);
+        gfx->setTextDatum(TL_DATUM);
         char hiStr[8];
-        snprintf(hiStr, sizeof(hiStr), "%.0f", hi);
-        tft.drawString(hiStr, section1X + 28, contentY - 2, GFXFF);
+        snprintf(hiStr, sizeof(hiStr), "%d", hi);
+        drawText(hiStr, section1X + 28, contentY - 2, FSSB12, orangeOnCard, cardColor);
 
         // Low temp section
         drawArrowDown(section2X + 12, contentY, blueOnCard);
-        tft.setTextColor(blueOnCard);
         char loStr[8];
-        snprintf(loStr, sizeof(loStr), "%.0f", lo);
-        tft.drawString(loStr, section2X + 28, contentY - 2, GFXFF);
+        snprintf(loStr, sizeof(loStr), "%d", lo);
+        drawText(loStr, section2X + 28, contentY - 2, FSSB12, blueOnCard, cardColor);
 
         // Precipitation section with % symbol
-        int precipVal = (int)weather.forecast[0].precipitationProb;
+        int precipVal = weather.forecast[0].precipitationProb;
         uint16_t precipColor = precipVal > 30 ? cyanOnCard : grayOnCard;
         drawRaindrop(section3X + 12, contentY - 2, precipColor);
-        tft.setTextColor(precipColor);
         char precip[8];
         snprintf(precip, sizeof(precip), "%d", precipVal);
-        tft.drawString(precip, section3X + 28, contentY - 2, GFXFF);
+        drawText(precip, section3X + 28, contentY - 2, FSSB12, precipColor, cardColor);
         // Draw % after the number
-        int16_t numW = tft.textWidth(precip, GFXFF);
+        int16_t numW = gfx->textWidth(precip, GFXFF);
         drawPercent(section3X + 30 + numW, contentY, precipColor);
     }
 
@@ -946,7 +1556,7 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
         if (dotY > 236) dotY = 236;  // Don't go off screen
         for (int i = 0; i < totalScreens; i++) {
             uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
-            tft.fillCircle(startX + i * dotSpacing, dotY, 3, dotColor);
+            gfx->fillCircle(startX + i * dotSpacing, dotY, 3, dotColor);
         }
     }
 }
@@ -955,23 +1565,23 @@ void drawCurrentWeather(int currentScreen, int totalScreens) {
 void drawForecast(int startDay, int currentScreen, int totalScreens) {
     const WeatherData& weather = getWeather(currentDisplayLocation);
     const WeatherLocation& location = getLocation(currentDisplayLocation);
-    bool useCelsius = getUseCelsius();
 
     // UI nudge - positive moves content up, negative moves down
     int yOff = -getUiNudgeY();
 
     // Background - use theme color based on day/night
-    uint16_t bgColor = getThemeBg();
-    uint16_t cardColor = getThemeCard();
+    const ThemeColors& theme = getThemePalette().colors;
+    uint16_t bgColor = theme.bg;
+    uint16_t cardColor = theme.card;
     // Colors for text on background
-    uint16_t cyanColor = getThemeCyan();
-    uint16_t grayColor = getThemeGray();
+    uint16_t cyanColor = theme.cyan;
+    uint16_t grayColor = theme.gray;
     // Colors for text inside cards
-    uint16_t cyanOnCard = getThemeCyanOnCard();
-    uint16_t grayOnCard = getThemeGrayOnCard();
-    uint16_t orangeOnCard = getThemeOrangeOnCard();
-    uint16_t blueOnCard = getThemeBlueOnCard();
-    tft.fillScreen(bgColor);
+    uint16_t cyanOnCard = theme.cyanOnCard;
+    uint16_t grayOnCard = theme.grayOnCard;
+    uint16_t orangeOnCard = theme.orangeOnCard;
+    uint16_t blueOnCard = theme.blueOnCard;
+    clearScreen(bgColor);
 
     // Header: Time left (blue) with smaller AM/PM, Globe + Location right (grey)
     // Matches main screen style for consistency
@@ -988,24 +1598,29 @@ void drawForecast(int startDay, int currentScreen, int totalScreens) {
     // Draw time numbers
     char timeNumStr[16];
     snprintf(timeNumStr, sizeof(timeNumStr), "%d:%02d", h12, minutes);
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(cyanColor);
-    tft.drawString(timeNumStr, 8, 8 + yOff, GFXFF);
+    addClockRegion(8, 8 + yOff, FSSB12);
+    gfx->setFreeFont(FSSB12);
+    gfx->setTextDatum(TL_DATUM);
+    gfx->setTextColor(cyanColor);
+    gfx->drawString(timeNumStr, 8, 8 + yOff, GFXFF);
 
     // Draw AM/PM smaller, top-aligned with time
-    int16_t timeNumW = tft.textWidth(timeNumStr, GFXFF);
-    tft.setFreeFont(FSS9);
-    tft.drawString(ampm, 8 + timeNumW + 4, 8 + yOff, GFXFF);
+    int16_t timeNumW = gfx->textWidth(timeNumStr, GFXFF);
+    gfx->setFreeFont(FSS9);
+    gfx->drawString(ampm, 8 + timeNumW + 4, 8 + yOff, GFXFF);
 
     // Globe icon + Location name (right aligned, grey)
-    tft.setFreeFont(FSS9);
-    int16_t locW = tft.textWidth(location.name, GFXFF);
+    gfx->setFreeFont(FSS9);
+    int16_t locW = gfx->textWidth(location.name, GFXFF);
     int locX = 232 - locW;
     drawGlobe(locX - 16, 8 + yOff, grayColor);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(grayColor);
-    tft.drawString(location.name, locX, 8 + yOff, GFXFF);
+    gfx->setTextDatum(TL_DATUM);
+    gfx->setTextColor(grayColor);
+    gfx->drawString(location.name, locX, 8 + yOff, GFXFF);
+
+    if (weather.stale) {
+        drawStaleBadge(locX - 34, 8 + yOff, theme.orange);
+    }
 
     // Draw 3 forecast cards
     int cardW = 75;
@@ -1022,28 +1637,21 @@ void drawForecast(int startDay, int currentScreen, int totalScreens) {
         int y = 35 + yOff;
 
         // Card background - use theme color
-        tft.fillRoundRect(x, y, cardW, cardH, 4, cardColor);
+        gfx->fillRoundRect(x, y, cardW, cardH, 4, cardColor);
 
         // Day name - smooth font at top of card (use OnCard color)
-        tft.setTextDatum(TC_DATUM);
-        tft.setFreeFont(FSSB9);
-        tft.setTextColor(cyanOnCard);
-        tft.drawString(day.dayName, x + cardW/2, y + 10, GFXFF);
+        gfx->setTextDatum(TC_DATUM);
+        gfx->setFreeFont(FSSB9);
+        gfx->setTextColor(cyanOnCard);
+        gfx->drawString(day.dayName(), x + cardW/2, y + 10, GFXFF);
 
         // Weather icon (32x32 centered, pushed down more from day name)
-        drawWeatherIcon(x + (cardW - 32)/2, y + 42, day.condition, true, 32);
+        drawWeatherIcon(x + (cardW - 32)/2, y + 42, day.condition(), true, 32, cardColor);
 
         // Temperature high/low
-        float hi = day.tempMax;
-        float lo = day.tempMin;
-        if (!useCelsius) {
-            hi = hi * 9.0 / 5.0 + 32.0;
-            lo = lo * 9.0 / 5.0 + 32.0;
-        }
-
         char hiStr[8], loStr[8];
-        snprintf(hiStr, sizeof(hiStr), "%.0f", hi);
-        snprintf(loStr, sizeof(loStr), "%.0f", lo);
+        snprintf(hiStr, sizeof(hiStr), "%d", day.displayMax);
+        snprintf(loStr, sizeof(loStr), "%d", day.displayMin);
 
         // Layout: arrow (12px) + gap (4px) + number (centered in remaining ~45px)
         int arrowX = x + 8;
@@ -1052,29 +1660,29 @@ void drawForecast(int startDay, int currentScreen, int totalScreens) {
 
         // High temp with up arrow icon (use OnCard colors)
         drawArrowUp(arrowX, y + 95, orangeOnCard);
-        tft.setFreeFont(FSSB12);
-        tft.setTextColor(orangeOnCard);
-        tft.setTextDatum(TC_DATUM);
-        tft.drawString(hiStr, numAreaX + numAreaW/2, y + 93, GFXFF);
+        gfx->setFreeFont(FSSB12);
+        gfx->setTextColor(orangeOnCard);
+        gfx->setTextDatum(TC_DATUM);
+        gfx->drawString(hiStr, numAreaX + numAreaW/2, y + 93, GFXFF);
 
         // Low temp with down arrow icon (use OnCard colors)
         drawArrowDown(arrowX, y + 120, blueOnCard);
-        tft.setTextColor(blueOnCard);
-        tft.drawString(loStr, numAreaX + numAreaW/2, y + 118, GFXFF);
+        gfx->setTextColor(blueOnCard);
+        gfx->drawString(loStr, numAreaX + numAreaW/2, y + 118, GFXFF);
 
         // Precipitation with raindrop icon and % symbol (use OnCard colors)
-        int precipVal = (int)day.precipitationProb;
+        int precipVal = day.precipitationProb;
         uint16_t precipColor = precipVal > 30 ? cyanOnCard : grayOnCard;
         drawRaindrop(arrowX + 2, y + 148, precipColor);
-        tft.setFreeFont(FSSB12);
-        tft.setTextColor(precipColor);
+        gfx->setFreeFont(FSSB12);
+        gfx->setTextColor(precipColor);
         char precip[8];
         snprintf(precip, sizeof(precip), "%d", precipVal);
         // Draw number centered, then % symbol after
-        int16_t numW = tft.textWidth(precip, GFXFF);
+        int16_t numW = gfx->textWidth(precip, GFXFF);
         int numX = numAreaX + (numAreaW - numW - 12) / 2;  // Center number + % together
-        tft.setTextDatum(TL_DATUM);
-        tft.drawString(precip, numX, y + 148, GFXFF);
+        gfx->setTextDatum(TL_DATUM);
+        gfx->drawString(precip, numX, y + 148, GFXFF);
         drawPercent(numX + numW + 2, y + 150, precipColor);
     }
 
@@ -1086,7 +1694,7 @@ void drawForecast(int startDay, int currentScreen, int totalScreens) {
         if (dotY > 236) dotY = 236;  // Don't go off screen
         for (int i = 0; i < totalScreens; i++) {
             uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
-            tft.fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
+            gfx->fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
         }
     }
 }
@@ -1095,16 +1703,17 @@ void drawForecast(int startDay, int currentScreen, int totalScreens) {
 void drawCustomScreen() {
     // Get theme-aware colors
     int yOff = -getUiNudgeY();
-    uint16_t bgColor = getThemeBg();
-    uint16_t cardColor = getThemeCard();
+    const ThemeColors& theme = getThemePalette().colors;
+    uint16_t bgColor = theme.bg;
+    uint16_t cardColor = theme.card;
     // Colors for text on background
-    uint16_t cyanColor = getThemeCyan();
-    uint16_t grayColor = getThemeGray();
-    uint16_t textColor = getThemeText();
+    uint16_t cyanColor = theme.cyan;
+    uint16_t grayColor = theme.gray;
+    uint16_t textColor = theme.text;
     // Colors for text on cards
-    uint16_t cyanOnCard = getThemeCyanOnCard();
+    uint16_t cyanOnCard = theme.cyanOnCard;
 
-    tft.fillScreen(bgColor);
+    clearScreen(bgColor);
 
     // ========== Header: Time (left) + Custom header text (right) ==========
     // Get time from NTP
@@ -1119,22 +1728,23 @@ void drawCustomScreen() {
     // Draw time (left aligned, matches forecast header style)
     char timeNumStr[16];
     snprintf(timeNumStr, sizeof(timeNumStr), "%d:%02d", h12, minutes);
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(cyanColor);
-    tft.drawString(timeNumStr, 8, 8 + yOff, GFXFF);
+    addClockRegion(8, 8 + yOff, FSSB12);
+    gfx->setFreeFont(FSSB12);
+    gfx->setTextDatum(TL_DATUM);
+    gfx->setTextColor(cyanColor);
+    gfx->drawString(timeNumStr, 8, 8 + yOff, GFXFF);
 
-    int16_t timeNumW = tft.textWidth(timeNumStr, GFXFF);
-    tft.setFreeFont(FSS9);
-    tft.drawString(ampm, 8 + timeNumW + 4, 8 + yOff, GFXFF);
+    int16_t timeNumW = gfx->textWidth(timeNumStr, GFXFF);
+    gfx->setFreeFont(FSS9);
+    gfx->drawString(ampm, 8 + timeNumW + 4, 8 + yOff, GFXFF);
 
     // Custom header text (right aligned, gray) with star icon
     const char* headerText = getCustomScreenHeader();
     if (strlen(headerText) > 0) {
-        tft.setFreeFont(FSS9);
-        int16_t headerW = tft.textWidth(headerText, GFXFF);
-        tft.setTextDatum(TL_DATUM);
-        tft.setTextColor(grayColor);
+        gfx->setFreeFont(FSS9);
+        int16_t headerW = gfx->textWidth(headerText, GFXFF);
+        gfx->setTextDatum(TL_DATUM);
+        gfx->setTextColor(grayColor);
 
         // Draw star icon to the left of the header text (same gray color as text)
         int textX = 232 - headerW;  // Right edge of text
@@ -1142,10 +1752,10 @@ void drawCustomScreen() {
         int starY = 14 + yOff;      // Center vertically with text
         int starSize = 4;           // Slightly smaller star
         // Draw a simple 5-pointed star using two overlapping triangles (gray to match text)
-        tft.fillTriangle(starX, starY - starSize, starX - 3, starY + 2, starX + 3, starY + 2, grayColor);  // Top triangle
-        tft.fillTriangle(starX - starSize, starY - 1, starX + starSize, starY - 1, starX, starY + 3, grayColor);  // Bottom triangle
+        gfx->fillTriangle(starX, starY - starSize, starX - 3, starY + 2, starX + 3, starY + 2, grayColor);  // Top triangle
+        gfx->fillTriangle(starX - starSize, starY - 1, starX + starSize, starY - 1, starX, starY + 3, grayColor);  // Bottom triangle
 
-        tft.drawString(headerText, textX, 8 + yOff, GFXFF);
+        gfx->drawString(headerText, textX, 8 + yOff, GFXFF);
     }
 
     // ========== Body: Dynamic text sizing ==========
@@ -1172,9 +1782,9 @@ void drawCustomScreen() {
             lineHeight = 26;  // Readable spacing for small text
         }
 
-        tft.setFreeFont(font);
-        tft.setTextColor(textColor);
-        tft.setTextDatum(TL_DATUM);
+        gfx->setFreeFont(font);
+        gfx->setTextColor(textColor);
+        gfx->setTextDatum(TL_DATUM);
 
         // First pass: count lines needed for vertical centering
         char buffer[161];
@@ -1192,7 +1802,7 @@ void drawCustomScreen() {
 
             char saved = *(p + 1);
             *(p + 1) = '\0';
-            int16_t lineW = tft.textWidth(lineStart, GFXFF);
+            int16_t lineW = gfx->textWidth(lineStart, GFXFF);
             *(p + 1) = saved;
 
             if (lineW > bodyW || *p == '\n') {
@@ -1231,7 +1841,7 @@ void drawCustomScreen() {
             // Check line width
             char saved = *(p + 1);
             *(p + 1) = '\0';
-            int16_t lineW = tft.textWidth(lineStart, GFXFF);
+            int16_t lineW = gfx->textWidth(lineStart, GFXFF);
             *(p + 1) = saved;
 
             if (lineW > bodyW || *p == '\n') {
@@ -1241,9 +1851,9 @@ void drawCustomScreen() {
                 *breakPoint = '\0';
 
                 // Center the line
-                int16_t actualW = tft.textWidth(lineStart, GFXFF);
+                int16_t actualW = gfx->textWidth(lineStart, GFXFF);
                 int centeredX = 120 - actualW / 2;
-                tft.drawString(lineStart, centeredX, y, GFXFF);
+                gfx->drawString(lineStart, centeredX, y, GFXFF);
 
                 *breakPoint = savedChar;
                 y += lineHeight;
@@ -1255,9 +1865,9 @@ void drawCustomScreen() {
 
         // Draw remaining text
         if (*lineStart && y < maxY) {
-            int16_t actualW = tft.textWidth(lineStart, GFXFF);
+            int16_t actualW = gfx->textWidth(lineStart, GFXFF);
             int centeredX = 120 - actualW / 2;
-            tft.drawString(lineStart, centeredX, y, GFXFF);
+            gfx->drawString(lineStart, centeredX, y, GFXFF);
         }
     }
 
@@ -1267,13 +1877,13 @@ void drawCustomScreen() {
     int barH = 36;
     int barMargin = 8;
 
-    tft.fillRoundRect(barMargin, barY, 240 - 2*barMargin, barH, 4, cardColor);
+    gfx->fillRoundRect(barMargin, barY, 240 - 2*barMargin, barH, 4, cardColor);
 
     if (strlen(footerText) > 0) {
-        tft.setFreeFont(FSSB12);
-        tft.setTextDatum(TC_DATUM);
-        tft.setTextColor(cyanOnCard);  // Use OnCard color since inside card
-        tft.drawString(footerText, 120, barY + 10, GFXFF);
+        gfx->setFreeFont(FSSB12);
+        gfx->setTextDatum(TC_DATUM);
+        gfx->setTextColor(cyanOnCard);  // Use OnCard color since inside card
+        gfx->drawString(footerText, 120, barY + 10, GFXFF);
     }
 
     // ========== Screen dots ==========
@@ -1292,7 +1902,7 @@ void drawCustomScreen() {
         if (dotY > 236) dotY = 236;
         for (int i = 0; i < totalScreens; i++) {
             uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
-            tft.fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
+            gfx->fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
         }
     }
 }
@@ -1422,63 +2032,63 @@ void drawCountdownIcon(int cx, int cy, uint8_t type, uint16_t color, uint8_t day
     switch (type) {
         case COUNTDOWN_BIRTHDAY:
             // Large cake icon
-            tft.fillRect(cx - 2, cy - 22, 4, 8, TFT_YELLOW);  // Candle flame
-            tft.fillRect(cx - 1, cy - 14, 2, 8, color);       // Candle
-            tft.fillRoundRect(cx - 18, cy - 6, 36, 14, 4, color);  // Cake top
-            tft.fillRoundRect(cx - 20, cy + 6, 40, 16, 4, color);  // Cake bottom
+            gfx->fillRect(cx - 2, cy - 22, 4, 8, TFT_YELLOW);  // Candle flame
+            gfx->fillRect(cx - 1, cy - 14, 2, 8, color);       // Candle
+            gfx->fillRoundRect(cx - 18, cy - 6, 36, 14, 4, color);  // Cake top
+            gfx->fillRoundRect(cx - 20, cy + 6, 40, 16, 4, color);  // Cake bottom
             break;
 
         case COUNTDOWN_EASTER:
             // Large bunny icon
-            tft.fillRoundRect(cx - 10, cy - 24, 8, 20, 4, color);  // Left ear
-            tft.fillRoundRect(cx + 2, cy - 24, 8, 20, 4, color);   // Right ear
-            tft.fillCircle(cx, cy + 4, 18, color);  // Head/body
-            tft.fillCircle(cx - 6, cy - 2, 3, TFT_BLACK);  // Left eye
-            tft.fillCircle(cx + 6, cy - 2, 3, TFT_BLACK);  // Right eye
+            gfx->fillRoundRect(cx - 10, cy - 24, 8, 20, 4, color);  // Left ear
+            gfx->fillRoundRect(cx + 2, cy - 24, 8, 20, 4, color);   // Right ear
+            gfx->fillCircle(cx, cy + 4, 18, color);  // Head/body
+            gfx->fillCircle(cx - 6, cy - 2, 3, TFT_BLACK);  // Left eye
+            gfx->fillCircle(cx + 6, cy - 2, 3, TFT_BLACK);  // Right eye
             break;
 
         case COUNTDOWN_HALLOWEEN:
             // Large pumpkin icon
-            tft.fillRect(cx - 3, cy - 24, 6, 8, TFT_GREEN);  // Stem
-            tft.fillCircle(cx, cy + 2, 22, TFT_ORANGE);  // Main pumpkin
-            tft.fillTriangle(cx - 8, cy - 4, cx - 4, cy + 4, cx - 12, cy + 4, TFT_BLACK);  // Left eye
-            tft.fillTriangle(cx + 8, cy - 4, cx + 4, cy + 4, cx + 12, cy + 4, TFT_BLACK);  // Right eye
-            tft.fillTriangle(cx, cy + 6, cx - 8, cy + 14, cx + 8, cy + 14, TFT_BLACK);  // Mouth
+            gfx->fillRect(cx - 3, cy - 24, 6, 8, TFT_GREEN);  // Stem
+            gfx->fillCircle(cx, cy + 2, 22, TFT_ORANGE);  // Main pumpkin
+            gfx->fillTriangle(cx - 8, cy - 4, cx - 4, cy + 4, cx - 12, cy + 4, TFT_BLACK);  // Left eye
+            gfx->fillTriangle(cx + 8, cy - 4, cx + 4, cy + 4, cx + 12, cy + 4, TFT_BLACK);  // Right eye
+            gfx->fillTriangle(cx, cy + 6, cx - 8, cy + 14, cx + 8, cy + 14, TFT_BLACK);  // Mouth
             break;
 
         case COUNTDOWN_VALENTINE:
             // Large heart icon
-            tft.fillCircle(cx - 10, cy - 6, 14, TFT_RED);   // Left lobe
-            tft.fillCircle(cx + 10, cy - 6, 14, TFT_RED);  // Right lobe
-            tft.fillTriangle(cx - 24, cy - 2, cx + 24, cy - 2, cx, cy + 24, TFT_RED);  // Bottom
+            gfx->fillCircle(cx - 10, cy - 6, 14, TFT_RED);   // Left lobe
+            gfx->fillCircle(cx + 10, cy - 6, 14, TFT_RED);  // Right lobe
+            gfx->fillTriangle(cx - 24, cy - 2, cx + 24, cy - 2, cx, cy + 24, TFT_RED);  // Bottom
             break;
 
         case COUNTDOWN_CHRISTMAS:
             // Large tree icon
-            tft.fillTriangle(cx, cy - 22, cx - 16, cy - 6, cx + 16, cy - 6, TFT_GREEN);   // Top
-            tft.fillTriangle(cx, cy - 12, cx - 22, cy + 6, cx + 22, cy + 6, TFT_GREEN);  // Middle
-            tft.fillTriangle(cx, cy - 2, cx - 26, cy + 18, cx + 26, cy + 18, TFT_GREEN); // Bottom
-            tft.fillRect(cx - 5, cy + 16, 10, 10, 0x8420);  // Trunk (brown)
-            tft.fillCircle(cx, cy - 16, 3, TFT_YELLOW);  // Star
+            gfx->fillTriangle(cx, cy - 22, cx - 16, cy - 6, cx + 16, cy - 6, TFT_GREEN);   // Top
+            gfx->fillTriangle(cx, cy - 12, cx - 22, cy + 6, cx + 22, cy + 6, TFT_GREEN);  // Middle
+            gfx->fillTriangle(cx, cy - 2, cx - 26, cy + 18, cx + 26, cy + 18, TFT_GREEN); // Bottom
+            gfx->fillRect(cx - 5, cy + 16, 10, 10, 0x8420);  // Trunk (brown)
+            gfx->fillCircle(cx, cy - 16, 3, TFT_YELLOW);  // Star
             break;
 
         case COUNTDOWN_CUSTOM:
         default:
             // Large calendar icon
-            tft.fillRoundRect(cx - 20, cy - 16, 40, 38, 4, color);  // Box
-            tft.fillRect(cx - 20, cy - 16, 40, 12, color);  // Header
-            tft.drawLine(cx - 18, cy - 4, cx + 18, cy - 4, getThemeBg());  // Divider
+            gfx->fillRoundRect(cx - 20, cy - 16, 40, 38, 4, color);  // Box
+            gfx->fillRect(cx - 20, cy - 16, 40, 12, color);  // Header
+            gfx->drawLine(cx - 18, cy - 4, cx + 18, cy - 4, getThemeBg());  // Divider
             // Calendar rings
-            tft.fillRoundRect(cx - 12, cy - 22, 6, 10, 2, color);
-            tft.fillRoundRect(cx + 6, cy - 22, 6, 10, 2, color);
+            gfx->fillRoundRect(cx - 12, cy - 22, 6, 10, 2, color);
+            gfx->fillRoundRect(cx + 6, cy - 22, 6, 10, 2, color);
             // Date number in calendar (use provided dayNum, default to 25)
             {
                 char dayStr[4];
                 snprintf(dayStr, sizeof(dayStr), "%d", dayNum > 0 ? dayNum : 25);
-                tft.setFreeFont(FSSB12);
-                tft.setTextDatum(MC_DATUM);
-                tft.setTextColor(getThemeBg());
-                tft.drawString(dayStr, cx, cy + 8, GFXFF);
+                gfx->setFreeFont(FSSB12);
+                gfx->setTextDatum(MC_DATUM);
+                gfx->setTextColor(getThemeBg());
+                gfx->drawString(dayStr, cx, cy + 8, GFXFF);
             }
             break;
     }
@@ -1490,12 +2100,13 @@ void drawCountdownScreen(uint8_t countdownIndex, int currentScreen, int totalScr
 
     // Get theme colors
     int yOff = -getUiNudgeY();
-    uint16_t bgColor = getThemeBg();
-    uint16_t cyanColor = getThemeCyan();
-    uint16_t grayColor = getThemeGray();
-    uint16_t textColor = getThemeText();
+    const ThemeColors& theme = getThemePalette().colors;
+    uint16_t bgColor = theme.bg;
+    uint16_t cyanColor = theme.cyan;
+    uint16_t grayColor = theme.gray;
+    uint16_t textColor = theme.text;
 
-    tft.fillScreen(bgColor);
+    clearScreen(bgColor);
 
     // Get current time from primary location
     const WeatherData& primaryWeather = getWeather(0);
@@ -1525,18 +2136,19 @@ void drawCountdownScreen(uint8_t countdownIndex, int currentScreen, int totalScr
     // HEADER: Time (left) + "Countdown" (right)
     char timeStr[16];
     snprintf(timeStr, sizeof(timeStr), "%d:%02d", h12, minutes);
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(cyanColor);
-    tft.drawString(timeStr, 8, 8 + yOff, GFXFF);
+    addClockRegion(8, 8 + yOff, FSSB12);
+    gfx->setFreeFont(FSSB12);
+    gfx->setTextDatum(TL_DATUM);
+    gfx->setTextColor(cyanColor);
+    gfx->drawString(timeStr, 8, 8 + yOff, GFXFF);
 
-    int16_t timeW = tft.textWidth(timeStr, GFXFF);
-    tft.setFreeFont(FSS9);
-    tft.drawString(ampm, 8 + timeW + 4, 10 + yOff, GFXFF);
+    int16_t timeW = gfx->textWidth(timeStr, GFXFF);
+    gfx->setFreeFont(FSS9);
+    gfx->drawString(ampm, 8 + timeW + 4, 10 + yOff, GFXFF);
 
-    tft.setTextDatum(TR_DATUM);
-    tft.setTextColor(grayColor);
-    tft.drawString("Countdown", 232, 10 + yOff, GFXFF);
+    gfx->setTextDatum(TR_DATUM);
+    gfx->setTextColor(grayColor);
+    gfx->drawString("Countdown", 232, 10 + yOff, GFXFF);
 
     // Get target date and days until
     int targetYear, targetMonth, targetDay;
@@ -1549,28 +2161,33 @@ void drawCountdownScreen(uint8_t countdownIndex, int currentScreen, int totalScr
 
     // Event title (smaller, below icon)
     const char* title = (strlen(event.title) > 0) ? event.title : getEventTypeName(event.type);
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(MC_DATUM);
-    tft.setTextColor(textColor);
-    tft.drawString(title, 120, 120 + yOff, GFXFF);
+    gfx->setFreeFont(FSSB12);
+    gfx->setTextDatum(MC_DATUM);
+    gfx->setTextColor(textColor);
+    gfx->drawString(title, 120, 120 + yOff, GFXFF);
 
     // Days remaining (large number)
     char daysStr[32];
     if (daysLeft == 0) {
         snprintf(daysStr, sizeof(daysStr), "TODAY!");
-        tft.setTextColor(cyanColor);
+        gfx->setTextColor(cyanColor);
     } else if (daysLeft == 1) {
         snprintf(daysStr, sizeof(daysStr), "1 day");
-        tft.setTextColor(cyanColor);
+        gfx->setTextColor(cyanColor);
     } else if (daysLeft <= 7) {
         snprintf(daysStr, sizeof(daysStr), "%d days", daysLeft);
-        tft.setTextColor(cyanColor);
+        gfx->setTextColor(cyanColor);
     } else {
         snprintf(daysStr, sizeof(daysStr), "%d days", daysLeft);
-        tft.setTextColor(textColor);
+        gfx->setTextColor(textColor);
     }
-    tft.setFreeFont(FSSB18);
-    tft.drawString(daysStr, 120, 155 + yOff, GFXFF);
+    gfx->setFreeFont(FSSB18);
+    gfx->drawString(daysStr, 120, 155 + yOff, GFXFF);
+
+    // The days value changes at midnight - keep it live, sized for the widest value
+    int16_t daysW = max(gfx->textWidth("TODAY!", GFXFF), gfx->textWidth("8888 days", GFXFF));
+    int16_t daysH = gfx->fontHeight(GFXFF);
+    addLiveRegion(120 - daysW / 2 - 2, 155 + yOff - daysH / 2 - 2, daysW + 4, daysH + 4);
 
     // Target date with day of week
     const char* dayNames[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
@@ -1585,9 +2202,9 @@ void drawCountdownScreen(uint8_t countdownIndex, int currentScreen, int totalScr
 
     char dateStr[32];
     snprintf(dateStr, sizeof(dateStr), "%s, %s %d", dayNames[dow], monthNames[targetMonth-1], targetDay);
-    tft.setFreeFont(FSS9);
-    tft.setTextColor(grayColor);
-    tft.drawString(dateStr, 120, 185 + yOff, GFXFF);
+    gfx->setFreeFont(FSS9);
+    gfx->setTextColor(grayColor);
+    gfx->drawString(dateStr, 120, 185 + yOff, GFXFF);
 
     // Draw navigation dots at bottom
     if (totalScreens > 1) {
@@ -1597,26 +2214,162 @@ void drawCountdownScreen(uint8_t countdownIndex, int currentScreen, int totalScr
         if (dotY > 236) dotY = 236;
         for (int i = 0; i < totalScreens; i++) {
             uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
-            tft.fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
+            gfx->fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
         }
     }
 }
 
+// =============================================================================
+// CUSTOM SCREEN LAYOUT CACHE
+// =============================================================================
+// Custom screen text only changes when /api/config is POSTed, so the body's
+// font and word wrap are worked out once per change rather than measured word
+// by word on every show. A layout is line offsets into the screen's body plus
+// where each line goes; drawing it is straight glyph output.
+
+#define CUSTOM_BODY_MAX_LINES 4
+#define CUSTOM_BODY_MAX_WIDTH 220   // 10px margin each side
+
+struct CustomScreenLayout {
+    bool valid;
+    uint32_t screenGeneration;      // getCustomScreenGeneration() when built
+    uint32_t themeGeneration;       // ThemePalette::generation when built
+    int nudge;                      // getUiNudgeY() when built
+    const GFXfont* font;
+    uint8_t lineCount;
+    uint8_t lineStart[CUSTOM_BODY_MAX_LINES];   // Offsets into config.body
+    uint8_t lineLen[CUSTOM_BODY_MAX_LINES];
+    int16_t lineX[CUSTOM_BODY_MAX_LINES];       // Left edge, ML_DATUM
+    int16_t lineY[CUSTOM_BODY_MAX_LINES];       // Vertical centre
+};
+
+static CustomScreenLayout customLayouts[MAX_CUSTOM_SCREENS];
+static uint32_t customLayoutBuilds = 0;
+
+/**
+ * Copy part of a body into buf as one line of text
+ * Newlines act as word breaks, so they are drawn as spaces.
+ */
+static void copyBodyLine(char* buf, const char* body, int start, int len) {
+    for (int i = 0; i < len; i++) {
+        buf[i] = (body[start + i] == '\n') ? ' ' : body[start + i];
+    }
+    buf[len] = '\0';
+}
+
+/**
+ * Choose the body font and line breaks for one custom screen
+ * Short bodies get the large font. Words break at spaces and newlines, and a
+ * line ends when the next word would take it past CUSTOM_BODY_MAX_WIDTH.
+ */
+static void buildCustomScreenLayout(uint8_t index, CustomScreenLayout& layout) {
+    const CustomScreenConfig& config = getCustomScreenConfig(index);
+    const char* body = config.body;
+    int bodyLen = strlen(body);
+    int lineHeight;
+    if (bodyLen <= 40) {
+        layout.font = FSSB18;
+        lineHeight = 38;
+    } else {
+        layout.font = FSSB12;
+        lineHeight = 30;
+    }
+
+    // Measured on the panel - widths don't depend on the draw target
+    tft.setFreeFont(layout.font);
+    char scratch[sizeof(config.body)];
+    auto widthOf = [&](int start, int end) {
+        copyBodyLine(scratch, body, start, end - start);
+        return tft.textWidth(scratch, GFXFF);
+    };
+    auto addLine = [&](int start, int end) {
+        uint8_t n = layout.lineCount++;
+        layout.lineStart[n] = start;
+        layout.lineLen[n] = end - start;
+        layout.lineX[n] = 120 - widthOf(start, end) / 2;
+    };
+
+    layout.lineCount = 0;
+    int lineStart = -1;     // No words on the current line yet
+    int lineEnd = 0;
+    int wordStart = 0;
+    for (int i = 0; i <= bodyLen && layout.lineCount < CUSTOM_BODY_MAX_LINES; i++) {
+        if (i < bodyLen && body[i] != ' ' && body[i] != '\n') continue;
+        if (lineStart < 0) {
+            if (i > wordStart) {
+                lineStart = wordStart;
+                lineEnd = i;
+            }
+        } else if (widthOf(lineStart, i) <= CUSTOM_BODY_MAX_WIDTH) {
+            lineEnd = i;
+        } else {
+            addLine(lineStart, lineEnd);
+            lineStart = (i > wordStart) ? wordStart : -1;
+            lineEnd = i;
+        }
+        wordStart = i + 1;
+    }
+    if (lineStart >= 0 && layout.lineCount < CUSTOM_BODY_MAX_LINES) {
+        addLine(lineStart, lineEnd);
+    }
+
+    // Centre the block of lines on y=100
+    int yOff = -getUiNudgeY();
+    int firstY = 100 + yOff - layout.lineCount * lineHeight / 2 + lineHeight / 2;
+    for (uint8_t i = 0; i < layout.lineCount; i++) {
+        layout.lineY[i] = firstY + i * lineHeight;
+    }
+
+    layout.screenGeneration = getCustomScreenGeneration();
+    layout.themeGeneration = getThemePalette().generation;
+    layout.nudge = getUiNudgeY();
+    layout.valid = true;
+    customLayoutBuilds++;
+}
+
+/**
+ * Get the body layout of a custom screen, rebuilding it if the screen text,
+ * theme or UI nudge changed since it was built
+ */
+static const CustomScreenLayout& getCustomScreenLayout(uint8_t index) {
+    CustomScreenLayout& layout = customLayouts[index];
+    if (!layout.valid ||
+        layout.screenGeneration != getCustomScreenGeneration() ||
+        layout.themeGeneration != getThemePalette().generation ||
+        layout.nudge != getUiNudgeY()) {
+        buildCustomScreenLayout(index, layout);
+    }
+    return layout;
+}
+
+/**
+ * Lay out every custom screen now, so the first show after a config change
+ * doesn't pay for it
+ */
+void buildCustomScreenLayouts() {
+    for (uint8_t i = 0; i < getCustomScreenCount(); i++) {
+        getCustomScreenLayout(i);
+    }
+    Serial.printf("[CUSTOM] Laid out %d screens (%u bytes cached)\n",
+                  getCustomScreenCount(), (unsigned)sizeof(customLayouts));
+}
+
 // Draw custom screen for a specific custom screen config (carousel version)
 void drawCustomScreenByIndex(uint8_t customIndex, int currentScreen, int totalScreens) {
     const CustomScreenConfig& config = getCustomScreenConfig(customIndex);
 
     // Get theme colors
     int yOff = -getUiNudgeY();
-    uint16_t bgColor = getThemeBg();
-    uint16_t cardColor = getThemeCard();
-    uint16_t cyanColor = getThemeCyan();
-    uint16_t grayColor = getThemeGray();
-    uint16_t textColor = getThemeText();
+    const ThemeColors& theme = getThemePalette().colors;
+    uint16_t bgColor = theme.bg;
+    uint16_t cardColor = theme.card;
+    uint16_t cyanColor = theme.cyan;
+    uint16_t grayColor = theme.gray;
+    uint16_t textColor = theme.text;
     // OnCard variant for footer bar text
-    uint16_t cyanOnCard = getThemeCyanOnCard();
+    uint16_t cyanOnCard = theme.cyanOnCard;
 
-    tft.fillScreen(bgColor);
+    clearScreen(bgColor);
 
     // Get current time
     const WeatherData& primaryWeather = getWeather(0);
@@ -1630,92 +2383,48 @@ void drawCustomScreenByIndex(uint8_t customIndex, int currentScreen, int totalSc
     // HEADER
     char timeStr[16];
     snprintf(timeStr, sizeof(timeStr), "%d:%02d", h12, minutes);
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(cyanColor);
-    tft.drawString(timeStr, 8, 8 + yOff, GFXFF);
+    addClockRegion(8, 8 + yOff, FSSB12);
+    gfx->setFreeFont(FSSB12);
+    gfx->setTextDatum(TL_DATUM);
+    gfx->setTextColor(cyanColor);
+    gfx->drawString(timeStr, 8, 8 + yOff, GFXFF);
 
-    int16_t timeW = tft.textWidth(timeStr, GFXFF);
-    tft.setFreeFont(FSS9);
-    tft.drawString(ampm, 8 + timeW + 4, 10 + yOff, GFXFF);
+    int16_t timeW = gfx->textWidth(timeStr, GFXFF);
+    gfx->setFreeFont(FSS9);
+    gfx->drawString(ampm, 8 + timeW + 4, 10 + yOff, GFXFF);
 
     // Header text (right side) with star icon
     if (strlen(config.header) > 0) {
-        tft.setFreeFont(FSS9);
-        int16_t headerW = tft.textWidth(config.header, GFXFF);
+        gfx->setFreeFont(FSS9);
+        int16_t headerW = gfx->textWidth(config.header, GFXFF);
         int textX = 232 - headerW;
-        tft.setTextDatum(TL_DATUM);
-        tft.setTextColor(grayColor);
-        tft.drawString(config.header, textX, 10 + yOff, GFXFF);
+        gfx->setTextDatum(TL_DATUM);
+        gfx->setTextColor(grayColor);
+        gfx->drawString(config.header, textX, 10 + yOff, GFXFF);
 
         // Draw star icon to the left of header text
         int starX = textX - 12;
         int starY = 14 + yOff;
         int starSize = 4;
-        tft.fillTriangle(starX, starY - starSize, starX - 3, starY + 2, starX + 3, starY + 2, grayColor);
-        tft.fillTriangle(starX - starSize, starY - 1, starX + starSize, starY - 1, starX, starY + 3, grayColor);
+        gfx->fillTriangle(starX, starY - starSize, starX - 3, starY + 2, starX + 3, starY + 2, grayColor);
+        gfx->fillTriangle(starX - starSize, starY - 1, starX + starSize, starY - 1, starX, starY + 3, grayColor);
     } else {
         // No header, just draw star in corner
         int starX = 224;
         int starY = 14 + yOff;
         int starSize = 4;
-        tft.fillTriangle(starX, starY - starSize, starX - 3, starY + 2, starX + 3, starY + 2, grayColor);
-        tft.fillTriangle(starX - starSize, starY - 1, starX + starSize, starY - 1, starX, starY + 3, grayColor);
+        gfx->fillTriangle(starX, starY - starSize, starX - 3, starY + 2, starX + 3, starY + 2, grayColor);
+        gfx->fillTriangle(starX - starSize, starY - 1, starX + starSize, starY - 1, starX, starY + 3, grayColor);
     }
 
-    // BODY - centered text with word wrap
+    // BODY - centered text, laid out when the screen last changed
     if (strlen(config.body) > 0) {
-        int bodyLen = strlen(config.body);
-        int fontSize;
-        int lineHeight;
-
-        if (bodyLen <= 40) {
-            tft.setFreeFont(FSSB18);
-            fontSize = 18;
-            lineHeight = 38;
-        } else {
-            tft.setFreeFont(FSSB12);
-            fontSize = 12;
-            lineHeight = 30;
-        }
-
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextColor(textColor);
-
-        // Simple word wrap
-        String text = config.body;
-        int maxWidth = 220;
-        int startY = 100 + yOff;
-        int lineCount = 0;
-        String lines[4];
-
-        String currentLine = "";
-        int wordStart = 0;
-        for (int i = 0; i <= text.length() && lineCount < 4; i++) {
-            if (i == text.length() || text[i] == ' ' || text[i] == '\n') {
-                String word = text.substring(wordStart, i);
-                String testLine = currentLine + (currentLine.length() > 0 ? " " : "") + word;
-                if (tft.textWidth(testLine.c_str(), GFXFF) <= maxWidth) {
-                    currentLine = testLine;
-                } else {
-                    if (currentLine.length() > 0 && lineCount < 4) {
-                        lines[lineCount++] = currentLine;
-                    }
-                    currentLine = word;
-                }
-                wordStart = i + 1;
-            }
-        }
-        if (currentLine.length() > 0 && lineCount < 4) {
-            lines[lineCount++] = currentLine;
-        }
-
-        // Calculate vertical center
-        int totalHeight = lineCount * lineHeight;
-        int bodyStartY = 100 + yOff - totalHeight / 2 + lineHeight / 2;
-
-        for (int i = 0; i < lineCount; i++) {
-            tft.drawString(lines[i].c_str(), 120, bodyStartY + i * lineHeight, GFXFF);
+        const CustomScreenLayout& layout = getCustomScreenLayout(customIndex);
+        char line[sizeof(config.body)];
+        gfx->setTextDatum(ML_DATUM);
+        for (uint8_t i = 0; i < layout.lineCount; i++) {
+            copyBodyLine(line, config.body, layout.lineStart[i], layout.lineLen[i]);
+            drawText(line, layout.lineX[i], layout.lineY[i], layout.font, textColor, bgColor);
         }
     }
 
@@ -1724,11 +2433,10 @@ void drawCustomScreenByIndex(uint8_t customIndex, int currentScreen, int totalSc
         int barY = 175 + yOff;
         int barH = 36;
         int barMargin = 8;
-        tft.fillRoundRect(barMargin, barY, 240 - 2*barMargin, barH, 4, cardColor);
-        tft.setFreeFont(FSSB12);
-        tft.setTextDatum(TC_DATUM);
-        tft.setTextColor(cyanOnCard);  // Use OnCard variant for text inside footer bar
-        tft.drawString(config.footer, 120, barY + 10, GFXFF);  // Text centered in bar
+        gfx->fillRoundRect(barMargin, barY, 240 - 2*barMargin, barH, 4, cardColor);
+        gfx->setTextDatum(TC_DATUM);
+        // OnCard variant for text inside footer bar, centered in bar
+        drawText(config.footer, 120, barY + 10, FSSB12, cyanOnCard, cardColor);
     }
 
     // Navigation dots
@@ -1739,7 +2447,7 @@ void drawCustomScreenByIndex(uint8_t customIndex, int currentScreen, int totalSc
         if (dotY > 236) dotY = 236;
         for (int i = 0; i < totalScreens; i++) {
             uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
-            tft.fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
+            gfx->fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
         }
     }
 }
@@ -1750,13 +2458,14 @@ void drawYouTubeScreen(int currentScreen, int totalScreens) {
 
     // Get theme colors
     int yOff = -getUiNudgeY();
-    uint16_t bgColor = getThemeBg();
-    uint16_t cardColor = getThemeCard();
-    uint16_t cyanColor = getThemeCyan();
-    uint16_t grayColor = getThemeGray();
-    uint16_t textColor = getThemeText();
+    const ThemeColors& theme = getThemePalette().colors;
+    uint16_t bgColor = theme.bg;
+    uint16_t cardColor = theme.card;
+    uint16_t cyanColor = theme.cyan;
+    uint16_t grayColor = theme.gray;
+    uint16_t textColor = theme.text;
 
-    tft.fillScreen(bgColor);
+    clearScreen(bgColor);
 
     // Get current time
     const WeatherData& primaryWeather = getWeather(0);
@@ -1770,14 +2479,15 @@ void drawYouTubeScreen(int currentScreen, int totalScreens) {
     // HEADER: Time (left)
     char timeStr[16];
     snprintf(timeStr, sizeof(timeStr), "%d:%02d", h12, minutes);
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(cyanColor);
-    tft.drawString(timeStr, 8, 8 + yOff, GFXFF);
+    addClockRegion(8, 8 + yOff, FSSB12);
+    gfx->setFreeFont(FSSB12);
+    gfx->setTextDatum(TL_DATUM);
+    gfx->setTextColor(cyanColor);
+    gfx->drawString(timeStr, 8, 8 + yOff, GFXFF);
 
-    int16_t timeW = tft.textWidth(timeStr, GFXFF);
-    tft.setFreeFont(FSS9);
-    tft.drawString(ampm, 8 + timeW + 4, 10 + yOff, GFXFF);
+    int16_t timeW = gfx->textWidth(timeStr, GFXFF);
+    gfx->setFreeFont(FSS9);
+    gfx->drawString(ampm, 8 + timeW + 4, 10 + yOff, GFXFF);
 
     // Large centered YouTube logo (red rounded rect with play button)
     int logoX = 120;  // Center
@@ -1785,39 +2495,39 @@ void drawYouTubeScreen(int currentScreen, int totalScreens) {
     int logoW = 56;
     int logoH = 38;
     // Red rounded rectangle background
-    tft.fillRoundRect(logoX - logoW/2, logoY - logoH/2, logoW, logoH, 8, 0xF800);  // YouTube red
+    gfx->fillRoundRect(logoX - logoW/2, logoY - logoH/2, logoW, logoH, 8, 0xF800);  // YouTube red
     // White play triangle (centered in logo)
     int triX = logoX - 8;
     int triY = logoY;
-    tft.fillTriangle(triX, triY - 10, triX, triY + 10, triX + 18, triY, TFT_WHITE);
+    gfx->fillTriangle(triX, triY - 10, triX, triY + 10, triX + 18, triY, TFT_WHITE);
 
     // Channel name below logo
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(MC_DATUM);
-    tft.setTextColor(textColor);
+    gfx->setFreeFont(FSSB12);
+    gfx->setTextDatum(MC_DATUM);
+    gfx->setTextColor(textColor);
     String channelName = data.valid ? data.channelName : (strlen(data.lastError) > 0 ? "Error" : "Not configured");
     if (channelName.length() > 20) {
         channelName = channelName.substring(0, 19) + "...";
     }
-    tft.drawString(channelName.c_str(), 120, 88 + yOff, GFXFF);
+    gfx->drawString(channelName.c_str(), 120, 88 + yOff, GFXFF);
 
     if (!data.valid) {
         // Show error or "not configured" message
-        tft.setFreeFont(FSS9);
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextColor(grayColor);
+        gfx->setFreeFont(FSS9);
+        gfx->setTextDatum(MC_DATUM);
+        gfx->setTextColor(grayColor);
         if (strlen(data.lastError) > 0) {
-            tft.drawString(data.lastError, 120, 140 + yOff, GFXFF);
+            gfx->drawString(data.lastError, 120, 140 + yOff, GFXFF);
         } else {
-            tft.drawString("Configure in Admin panel", 120, 140 + yOff, GFXFF);
+            gfx->drawString("Configure in Admin panel", 120, 140 + yOff, GFXFF);
         }
     } else {
         // MAIN STATS DISPLAY
 
         // Subscribers - large, centered, prominent
-        tft.setFreeFont(FSSB24);
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextColor(cyanColor);
+        gfx->setFreeFont(FSSB24);
+        gfx->setTextDatum(MC_DATUM);
+        gfx->setTextColor(cyanColor);
 
         // Format subscriber count
         char subsStr[16];
@@ -1828,12 +2538,12 @@ void drawYouTubeScreen(int currentScreen, int totalScreens) {
         } else {
             snprintf(subsStr, sizeof(subsStr), "%u", data.subscribers);
         }
-        tft.drawString(subsStr, 120, 130 + yOff, GFXFF);
+        gfx->drawString(subsStr, 120, 130 + yOff, GFXFF);
 
         // "subscribers" label
-        tft.setFreeFont(FSS9);
-        tft.setTextColor(grayColor);
-        tft.drawString("subscribers", 120, 155 + yOff, GFXFF);
+        gfx->setFreeFont(FSS9);
+        gfx->setTextColor(grayColor);
+        gfx->drawString("subscribers", 120, 155 + yOff, GFXFF);
 
         // Stats cards - Views and Videos side by side
         int cardY = 170 + yOff;
@@ -1842,10 +2552,10 @@ void drawYouTubeScreen(int currentScreen, int totalScreens) {
         int cardMargin = 12;
 
         // Views card (left)
-        tft.fillRoundRect(cardMargin, cardY, cardW, cardH, 6, cardColor);
-        tft.setFreeFont(FSSB12);
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextColor(textColor);
+        gfx->fillRoundRect(cardMargin, cardY, cardW, cardH, 6, cardColor);
+        gfx->setFreeFont(FSSB12);
+        gfx->setTextDatum(MC_DATUM);
+        gfx->setTextColor(textColor);
 
         char viewsStr[16];
         if (data.views >= 1000000) {
@@ -1855,26 +2565,26 @@ void drawYouTubeScreen(int currentScreen, int totalScreens) {
         } else {
             snprintf(viewsStr, sizeof(viewsStr), "%u", data.views);
         }
-        tft.drawString(viewsStr, cardMargin + cardW/2, cardY + 14, GFXFF);
+        gfx->drawString(viewsStr, cardMargin + cardW/2, cardY + 14, GFXFF);
 
-        tft.setFreeFont(FSS9);
-        tft.setTextColor(grayColor);
-        tft.drawString("views", cardMargin + cardW/2, cardY + 32, GFXFF);
+        gfx->setFreeFont(FSS9);
+        gfx->setTextColor(grayColor);
+        gfx->drawString("views", cardMargin + cardW/2, cardY + 32, GFXFF);
 
         // Videos card (right)
         int card2X = 240 - cardMargin - cardW;
-        tft.fillRoundRect(card2X, cardY, cardW, cardH, 6, cardColor);
-        tft.setFreeFont(FSSB12);
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextColor(textColor);
+        gfx->fillRoundRect(card2X, cardY, cardW, cardH, 6, cardColor);
+        gfx->setFreeFont(FSSB12);
+        gfx->setTextDatum(MC_DATUM);
+        gfx->setTextColor(textColor);
 
         char videosStr[16];
         snprintf(videosStr, sizeof(videosStr), "%u", data.videos);
-        tft.drawString(videosStr, card2X + cardW/2, cardY + 14, GFXFF);
+        gfx->drawString(videosStr, card2X + cardW/2, cardY + 14, GFXFF);
 
-        tft.setFreeFont(FSS9);
-        tft.setTextColor(grayColor);
-        tft.drawString("videos", card2X + cardW/2, cardY + 32, GFXFF);
+        gfx->setFreeFont(FSS9);
+        gfx->setTextColor(grayColor);
+        gfx->drawString("videos", card2X + cardW/2, cardY + 32, GFXFF);
     }
 
     // Navigation dots
@@ -1885,165 +2595,519 @@ void drawYouTubeScreen(int currentScreen, int totalScreens) {
         if (dotY > 236) dotY = 236;
         for (int i = 0; i < totalScreens; i++) {
             uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
-            tft.fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
+            gfx->fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
         }
     }
 }
 
+// =============================================================================
+// DECODED IMAGE CACHE
+// =============================================================================
+// Decoding a JPEG takes hundreds of ms each time the carousel reaches it. An
+// upload is decoded once instead, into a raw RGB565 file next to the JPEG:
+// scaled to fit the content area, rows top to bottom, so showing it is large
+// sequential reads into one address window. The JPEG stays as the fallback.
+
+#define IMAGE_CONTENT_HEIGHT 185    // Between the header and the dots
+#define RAW_IMAGE_MAGIC 0x35363552  // "R565"
+#define RAW_IMAGE_BAND_ROWS 16      // Rows read per LittleFS read (240 x 16 x 2 = 7.5 KB)
+#define IMAGE_MAX_BOX 16            // Largest box filter (R, G, B sums must fit 16 bits)
+
+struct RawImageHeader {
+    uint32_t magic;
+    uint16_t width;                 // Stored size, within the content area
+    uint16_t height;
+};
+
+// Time-to-pixels of the last showing of each image screen
+struct ImageRenderStats {
+    uint32_t lastUs;
+    uint32_t slices;                // loop() passes the image was pushed over
+    bool raw;                       // Shown from the raw file (else the JPEG)
+    bool transcodeFailed;           // Don't retry on every showing
+};
+static ImageRenderStats imageRenderStats[MAX_IMAGE_SCREENS];
+
+// Source file for transcodeImage()'s decoder
+static File transcodeSource;
+
+static unsigned char transcodeNeedBytes(unsigned char* buf, unsigned char size,
+                                        unsigned char* bytesRead, void* data) {
+    *bytesRead = (unsigned char)transcodeSource.read(buf, size);
+    return 0;
+}
+
 /**
- * Render JPEG blocks to TFT display
- * Called by JPEGDecoder after decoding each MCU (minimum coded unit)
+ * Decode an uploaded JPEG into its raw RGB565 file
+ * Images bigger than the content area are scaled down to fit it: by 8 in the
+ * decoder itself (each 8x8 block's DC coefficient is its average, so no IDCT
+ * runs), then by a whole-number box filter for whatever is left. Any old raw
+ * file is removed first, so a failure leaves the JPEG path in use.
+ * @return true if the raw file was written
  */
-void jpegRender(int xpos, int ypos) {
-    uint16_t *pImg;
-    uint16_t mcu_w = JpegDec.MCUWidth;
-    uint16_t mcu_h = JpegDec.MCUHeight;
-    uint32_t max_x = JpegDec.width;
-    uint32_t max_y = JpegDec.height;
+bool transcodeImage(const char* filename) {
+    cancelImageJob();
+    char rawPath[sizeof(ImageScreenConfig::filename)];
+    getImageRawPath(filename, rawPath, sizeof(rawPath));
+    if (LittleFS.exists(rawPath)) {
+        LittleFS.remove(rawPath);
+    }
 
-    // Read each MCU block until done
-    while (JpegDec.read()) {
-        // Feed watchdog every few blocks to prevent reset
-        static int blockCount = 0;
+    uint32_t start = millis();
+    uint16_t srcW, srcH;
+    bool progressive;
+    if (!getJpegInfo(filename, &srcW, &srcH, &progressive) || progressive) {
+        Serial.printf("[IMAGE] Transcode: can't decode %s\n", filename);
+        return false;
+    }
+
+    // Scale that fits the content area: DC-only decode at 1/8 once that is
+    // needed, then the box filter
+    int fit = max((srcW + DISPLAY_WIDTH - 1) / DISPLAY_WIDTH,
+                  (srcH + IMAGE_CONTENT_HEIGHT - 1) / IMAGE_CONTENT_HEIGHT);
+    uint8_t reduce = (fit >= 8) ? 1 : 0;
+    int decW = reduce ? (srcW + 7) / 8 : srcW;
+    int decH = reduce ? (srcH + 7) / 8 : srcH;
+    int box = max((decW + DISPLAY_WIDTH - 1) / DISPLAY_WIDTH,
+                  (decH + IMAGE_CONTENT_HEIGHT - 1) / IMAGE_CONTENT_HEIGHT);
+    if (box > IMAGE_MAX_BOX) {
+        Serial.printf("[IMAGE] Transcode: %ux%u is too large\n", srcW, srcH);
+        return false;
+    }
+    RawImageHeader header = {RAW_IMAGE_MAGIC, (uint16_t)(decW / box), (uint16_t)(decH / box)};
+    int outW = header.width;
+    int outH = header.height;
+
+    transcodeSource = LittleFS.open(filename, "r");
+    pjpeg_image_info_t info;
+    if (!transcodeSource || pjpeg_decode_init(&info, transcodeNeedBytes, nullptr, reduce) != 0) {
+        Serial.printf("[IMAGE] Transcode: can't decode %s\n", filename);
+        transcodeSource.close();
+        return false;
+    }
+    int mcuW = reduce ? info.m_MCUWidth / 8 : info.m_MCUWidth;     // Decoded pixels per MCU
+    int mcuH = reduce ? info.m_MCUHeight / 8 : info.m_MCUHeight;
+
+    // Output rows an MCU row can reach: RGB565 at full scale, else R, G, B
+    // sums for the box filter
+    int channels = (box == 1) ? 1 : 3;
+    int rowsHeld = (box == 1) ? mcuH : (mcuH - 1) / box + 2;
+    size_t heldWords = (size_t)outW * channels * rowsHeld;
+    uint16_t* rows = (uint16_t*)calloc(heldWords, sizeof(uint16_t));
+    File out = rows ? LittleFS.open(rawPath, "w") : File();
+    if (!rows || !out) {
+        Serial.printf("[IMAGE] Transcode: no %s for %s\n", rows ? "file" : "memory", rawPath);
+        free(rows);
+        transcodeSource.close();
+        return false;
+    }
+
+    bool ok = out.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    int rowBase = 0;    // Output row held in rows[0]
+
+    // Write the output rows that decoded rows up to decEnd have completed
+    auto flushRows = [&](int decEnd) {
+        int done = min(decEnd / box, outH);
+        for (int y = rowBase; ok && y < done; y++) {
+            uint16_t* row = rows + (size_t)(y - rowBase) * outW * channels;
+            if (box > 1) {
+                // Average each box into RGB565, in place
+                int area = box * box;
+                for (int x = 0; x < outW; x++) {
+                    uint8_t r = row[x * 3] / area;
+                    uint8_t g = row[x * 3 + 1] / area;
+                    uint8_t b = row[x * 3 + 2] / area;
+                    row[x] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+                }
+            }
+            size_t bytes = (size_t)outW * 2;
+            ok = out.write((const uint8_t*)row, bytes) == bytes;
+        }
+        if (done <= rowBase) return;
+        size_t doneWords = (size_t)(done - rowBase) * outW * channels;
+        memmove(rows, rows + doneWords, (heldWords - doneWords) * sizeof(uint16_t));
+        memset(rows + heldWords - doneWords, 0, doneWords * sizeof(uint16_t));
+        rowBase = done;
+    };
+
+    int mcuX = 0, mcuY = 0;
+    int blockCount = 0;
+    while (ok && rowBase < outH) {
+        unsigned char status = pjpeg_decode_mcu();
+        if (status == PJPG_NO_MORE_BLOCKS) break;
+        if (status != 0) {
+            ok = false;
+            break;
+        }
         if (++blockCount % 20 == 0) {
             ESP.wdtFeed();
             yield();
         }
 
-        pImg = JpegDec.pImage;
-        int mcu_x = JpegDec.MCUx * mcu_w + xpos;
-        int mcu_y = JpegDec.MCUy * mcu_h + ypos;
+        // Grayscale images only fill the R buffer
+        const uint8_t* bufR = info.m_pMCUBufR;
+        const uint8_t* bufG = (info.m_comps == 1) ? bufR : info.m_pMCUBufG;
+        const uint8_t* bufB = (info.m_comps == 1) ? bufR : info.m_pMCUBufB;
+        for (int py = 0; py < mcuH; py++) {
+            int oy = (mcuY * mcuH + py) / box;
+            if (oy >= outH) break;
+            for (int px = 0; px < mcuW; px++) {
+                int ox = (mcuX * mcuW + px) / box;
+                if (ox >= outW) break;
+                // 8x8 blocks sit on a 16-pixel pitch; at 1/8 each block is its first pixel
+                int ofs = reduce ? px * 64 + py * 128
+                                 : (px >> 3) * 64 + (py >> 3) * 128 + (py & 7) * 8 + (px & 7);
+                uint16_t* dst = rows + ((size_t)(oy - rowBase) * outW + ox) * channels;
+                if (box == 1) {
+                    *dst = ((bufR[ofs] & 0xF8) << 8) | ((bufG[ofs] & 0xFC) << 3) | (bufB[ofs] >> 3);
+                } else {
+                    dst[0] += bufR[ofs];
+                    dst[1] += bufG[ofs];
+                    dst[2] += bufB[ofs];
+                }
+            }
+        }
 
-        // Check bounds
+        if (++mcuX == info.m_MCUSPerRow) {
+            mcuX = 0;
+            mcuY++;
+            flushRows(mcuY * mcuH);
+        }
+    }
+    if (ok) flushRows(decH);
+
+    out.close();
+    transcodeSource.close();
+    free(rows);
+    if (!ok || rowBase < outH) {
+        LittleFS.remove(rawPath);
+        Serial.printf("[IMAGE] Transcode: failed for %s\n", rawPath);
+        return false;
+    }
+    Serial.printf("[IMAGE] Transcoded %s (%ux%u) to %dx%d raw (1/%d) in %lu ms\n",
+                  filename, srcW, srcH, outW, outH, (reduce ? 8 : 1) * box, millis() - start);
+    return true;
+}
+
+/**
+ * Open an image's raw file and check it's complete
+ * @return Open file positioned at the first pixel, or a closed File
+ */
+static File openRawImage(const char* filename, RawImageHeader& header) {
+    char rawPath[sizeof(ImageScreenConfig::filename)];
+    getImageRawPath(filename, rawPath, sizeof(rawPath));
+    if (!LittleFS.exists(rawPath)) return File();
+
+    File f = LittleFS.open(rawPath, "r");
+    if (!f) return f;
+    if (f.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != RAW_IMAGE_MAGIC ||
+        header.width == 0 || header.width > DISPLAY_WIDTH ||
+        header.height == 0 || header.height > IMAGE_CONTENT_HEIGHT ||
+        f.size() != sizeof(header) + (size_t)header.width * header.height * 2) {
+        Serial.printf("[IMAGE] Ignoring bad raw file %s\n", rawPath);
+        f.close();
+    }
+    return f;
+}
+
+// =============================================================================
+// IMAGE RENDER JOB
+// =============================================================================
+// The image in an image screen's hole is pushed from loop() a slice at a time,
+// so the web server and OTA keep running while a JPEG decodes. Each
+// updateImageJob() call does at most IMAGE_SLICE_BUDGET_US of work (always at
+// least one MCU or band). A new frame cancels a job still in progress.
+
+#define IMAGE_SLICE_BUDGET_US 8000
+
+struct ImageJob {
+    bool active;
+    bool raw;                       // Reading the raw file (else decoding the JPEG)
+    File file;                      // Raw file
+    RawImageHeader header;          // Image size (raw file, or the JPEG's)
+    int x, y;
+    int row;                        // Next raw row to push
+    uint8_t imageIndex;
+    uint32_t start;                 // drawImageScreen() began
+    uint32_t slices;
+};
+static ImageJob imageJob;
+
+static void cancelImageJob() {
+    if (!imageJob.active) return;
+    if (imageJob.raw) {
+        imageJob.file.close();
+    } else {
+        JpegDec.abort();
+    }
+    imageJob.active = false;
+    Serial.println(F("[IMAGE] Render cancelled"));
+}
+
+/**
+ * Start pushing an image into the hole at x, y
+ * @param rawFile Open raw file from openRawImage(), or a closed File to decode
+ *                the JPEG already opened with JpegDec.decodeFsFile()
+ */
+static void startImageJob(uint8_t imageIndex, File& rawFile, const RawImageHeader& header,
+                          int x, int y, uint32_t start) {
+    cancelImageJob();
+    imageJob.active = true;
+    imageJob.raw = (bool)rawFile;
+    imageJob.file = rawFile;
+    imageJob.header = header;
+    imageJob.x = x;
+    imageJob.y = y;
+    imageJob.row = 0;
+    imageJob.imageIndex = imageIndex;
+    imageJob.start = start;
+    imageJob.slices = 0;
+}
+
+/**
+ * Push the next bands of a raw image through one address window
+ * @return true when the image is done
+ */
+static bool rawImageSlice(ImageJob& job, uint32_t sliceStart) {
+    int w = job.header.width;
+    int h = min((int)job.header.height, DISPLAY_HEIGHT - job.y);
+    if (job.row >= h) return true;
+
+    int bandRows = RAW_IMAGE_BAND_ROWS;
+    uint16_t* band = (uint16_t*)malloc(w * bandRows * 2);
+    while (!band && bandRows > 1) {
+        bandRows /= 2;
+        band = (uint16_t*)malloc(w * bandRows * 2);
+    }
+    if (!band) {
+        Serial.println(F("[IMAGE] No memory for raw band"));
+        return true;
+    }
+
+    tft.startWrite();
+    tft.setAddrWindow(job.x, job.y + job.row, w, h - job.row);
+    do {
+        int rows = min(bandRows, h - job.row);
+        size_t bytes = (size_t)w * rows * 2;
+        if (job.file.read((uint8_t*)band, bytes) != bytes) {
+            job.row = h;    // Truncated since it was checked - stop here
+            break;
+        }
+        tft.pushPixels(band, w * rows);
+        tft.spiBytes += bytes;
+        job.row += rows;
+    } while (job.row < h && micros() - sliceStart < IMAGE_SLICE_BUDGET_US);
+    tft.endWrite();
+    tft.spiBytes += 11;
+    free(band);
+    return job.row >= h;
+}
+
+/**
+ * Decode and push the next MCUs (minimum coded units) of the JPEG
+ * @return true when the image is done
+ */
+static bool jpegImageSlice(ImageJob& job, uint32_t sliceStart) {
+    uint16_t mcu_w = JpegDec.MCUWidth;
+    uint16_t mcu_h = JpegDec.MCUHeight;
+
+    do {
+        if (!JpegDec.read()) return true;
+
+        uint16_t* pImg = JpegDec.pImage;
+        int mcu_x = JpegDec.MCUx * mcu_w + job.x;
+        int mcu_y = JpegDec.MCUy * mcu_h + job.y;
+
+        if (mcu_y >= DISPLAY_HEIGHT) {
+            // Rest of the image is below the screen
+            JpegDec.abort();
+            return true;
+        }
         if (mcu_x + mcu_w <= 240 && mcu_y + mcu_h <= 240) {
             // Block fits entirely on screen
             tft.pushImage(mcu_x, mcu_y, mcu_w, mcu_h, pImg);
-        } else if (mcu_x < 240 && mcu_y < 240) {
+            tft.spiBytes += 11 + mcu_w * mcu_h * 2;
+        } else if (mcu_x < 240) {
             // Partial block - clip to screen
             uint16_t draw_w = min((uint16_t)(240 - mcu_x), mcu_w);
             uint16_t draw_h = min((uint16_t)(240 - mcu_y), mcu_h);
             tft.pushImage(mcu_x, mcu_y, draw_w, draw_h, pImg);
+            tft.spiBytes += 11 + draw_w * draw_h * 2;
         }
-    }
+    } while (micros() - sliceStart < IMAGE_SLICE_BUDGET_US);
+    return false;
 }
 
 /**
- * Draw custom image screen
- * Shows uploaded JPG image with header bar matching custom screen style
- */
-void drawImageScreen(uint8_t imageIndex, int currentScreen, int totalScreens) {
-    // Get theme colors
-    uint16_t bgColor = getThemeBg();
-    uint16_t textColor = getThemeText();
-    uint16_t cyanColor = getThemeCyan();
-    uint16_t grayColor = getThemeGray();
-    uint16_t cardColor = getThemeCard();
-    int yOff = getUiNudgeY();
-
-    // Fill background
-    tft.fillScreen(bgColor);
-
-    // ===== HEADER BAR =====
-    // Get current time
-    const WeatherData& primaryWeather = getWeather(0);
-    long localEpoch = timeClient.getEpochTime() + primaryWeather.utcOffsetSeconds;
-    int hours = (localEpoch % 86400L) / 3600;
-    int minutes = (localEpoch % 3600) / 60;
-    int h12 = hours % 12;
-    if (h12 == 0) h12 = 12;
-    const char* ampm = (hours < 12) ? "AM" : "PM";
+ * Advance the image render job
+ * Call in loop()
+ */
+void updateImageJob() {
+    if (!imageJob.active) return;
+
+    uint32_t sliceStart = micros();
+    imageJob.slices++;
+    bool done = imageJob.raw ? rawImageSlice(imageJob, sliceStart) : jpegImageSlice(imageJob, sliceStart);
+    if (!done) return;
+
+    if (imageJob.raw) imageJob.file.close();
+    imageJob.active = false;
+
+    uint32_t elapsed = micros() - imageJob.start;
+    if (imageJob.imageIndex < MAX_IMAGE_SCREENS) {
+        ImageRenderStats& stats = imageRenderStats[imageJob.imageIndex];
+        stats.lastUs = elapsed;
+        stats.slices = imageJob.slices;
+        stats.raw = imageJob.raw;
+    }
+    Serial.printf("[IMAGE] Rendered %dx%d %s at (%d,%d): %u us, %u slices\n",
+                  imageJob.header.width, imageJob.header.height, imageJob.raw ? "raw" : "JPEG",
+                  imageJob.x, imageJob.y, elapsed, imageJob.slices);
+}
 
-    // Time on left (12-hour format with AM/PM)
-    char timeStr[16];
-    snprintf(timeStr, sizeof(timeStr), "%d:%02d", h12, minutes);
-    tft.setFreeFont(FSSB12);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextColor(cyanColor);
-    tft.drawString(timeStr, 8, 8 + yOff, GFXFF);
+/**
+ * Draw custom image screen
+ * Shows uploaded JPG image with header bar matching custom screen style.
+ * The frame is rendered in bands around the image; the JPEG then goes
+ * straight to the panel, so no pixel is sent twice.
+ */
+void drawImageScreen(uint8_t imageIndex, int currentScreen, int totalScreens) {
+    uint32_t start = micros();
+    cancelImageJob();  // Frees JpegDec for this image
 
-    int16_t timeW = tft.textWidth(timeStr, GFXFF);
-    tft.setFreeFont(FSS9);
-    tft.drawString(ampm, 10 + timeW, 12 + yOff, GFXFF);
+    // Get theme colors
+    const ThemeColors& theme = getThemePalette().colors;
+    uint16_t bgColor = theme.bg;
+    uint16_t cyanColor = theme.cyan;
+    uint16_t grayColor = theme.gray;
+    int yOff = getUiNudgeY();
 
     // Get image config for header text
     const ImageScreenConfig& config = getImageScreenConfig(imageIndex);
 
-    // Header label on right - use custom header or "Image" as fallback
-    tft.setTextDatum(TR_DATUM);
-    tft.setTextColor(grayColor);
-    const char* headerText = (config.header[0] != '\0') ? config.header : "Image";
-    tft.drawString(headerText, 210, 8 + yOff, GFXFF);
-
-    // Star icon in top-right corner
-    tft.setTextColor(cyanColor);
-    tft.drawString("*", 228, 6 + yOff, GFXFF);
-
     // ===== IMAGE CONTENT =====
     // Content area starts below header (y ~35) and ends above dots (y ~220)
     int contentY = 35 + yOff;
-    int contentH = 185;  // Available height for image
+    int contentH = IMAGE_CONTENT_HEIGHT;  // Available height for image
+
+    // Decode the header first so the frame knows where the image goes
+    const char* message = nullptr;
+    RenderRect hole = {0, 0, 0, 0};
+    int imgX = 0, imgY = 0;
+
+    File rawFile;
+    RawImageHeader raw = {0, 0, 0};
 
     if (config.valid && config.filename[0] != '\0') {
-        // Try to decode and display the JPEG
         Serial.printf("[IMAGE] Rendering %s\n", config.filename);
 
-        // Open file
-        File imgFile = LittleFS.open(config.filename, "r");
-        if (imgFile) {
-            // Decode JPEG
-            if (JpegDec.decodeFsFile(config.filename)) {
-                // Calculate position to center image in content area
-                int imgW = JpegDec.width;
-                int imgH = JpegDec.height;
+        // Decoded copy first; images uploaded before it existed get one now
+        rawFile = openRawImage(config.filename, raw);
+        if (!rawFile && imageIndex < MAX_IMAGE_SCREENS &&
+            !imageRenderStats[imageIndex].transcodeFailed && LittleFS.exists(config.filename)) {
+            if (transcodeImage(config.filename)) {
+                rawFile = openRawImage(config.filename, raw);
+            } else {
+                imageRenderStats[imageIndex].transcodeFailed = true;
+            }
+        }
 
-                // Center horizontally
-                int imgX = (240 - imgW) / 2;
-                if (imgX < 0) imgX = 0;
+        int imgW = 0, imgH = 0;
+        if (rawFile) {
+            imgW = raw.width;
+            imgH = raw.height;
+        } else if (!LittleFS.exists(config.filename)) {
+            message = "File Not Found";
+            Serial.printf("[IMAGE] File not found: %s\n", config.filename);
+        } else if (JpegDec.decodeFsFile(config.filename)) {
+            // Fallback: decode the JPEG straight to the panel
+            imgW = JpegDec.width;
+            imgH = JpegDec.height;
+            raw.width = imgW;
+            raw.height = imgH;
+        } else {
+            message = "Decode Error";
+            Serial.println("[IMAGE] JPEG decode failed");
+        }
 
-                // Center vertically in content area
-                int imgY = contentY + (contentH - imgH) / 2;
-                if (imgY < contentY) imgY = contentY;
+        if (!message) {
+            // Center horizontally
+            imgX = (240 - imgW) / 2;
+            if (imgX < 0) imgX = 0;
 
-                // Render the image
-                jpegRender(imgX, imgY);
+            // Center vertically in content area
+            imgY = contentY + (contentH - imgH) / 2;
+            if (imgY < contentY) imgY = contentY;
 
-                Serial.printf("[IMAGE] Rendered %dx%d at (%d,%d)\n", imgW, imgH, imgX, imgY);
-            } else {
-                // Decode failed
-                tft.setFreeFont(FSS9);
-                tft.setTextDatum(MC_DATUM);
-                tft.setTextColor(grayColor);
-                tft.drawString("Decode Error", 120, 120 + yOff, GFXFF);
-                Serial.println("[IMAGE] JPEG decode failed");
-            }
-            imgFile.close();
-        } else {
-            // File not found
-            tft.setFreeFont(FSS9);
-            tft.setTextDatum(MC_DATUM);
-            tft.setTextColor(grayColor);
-            tft.drawString("File Not Found", 120, 120 + yOff, GFXFF);
-            Serial.printf("[IMAGE] File not found: %s\n", config.filename);
+            hole = {(int16_t)imgX, (int16_t)imgY,
+                    (int16_t)min(imgW, 240 - imgX), (int16_t)min(imgH, 240 - imgY)};
         }
     } else {
-        // No image configured
-        tft.setFreeFont(FSS9);
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextColor(grayColor);
-        tft.drawString("No Image", 120, 120 + yOff, GFXFF);
+        message = "No Image";
     }
 
-    // ===== NAVIGATION DOTS =====
-    if (totalScreens > 1) {
-        int dotSpacing = 12;
-        int dotStartX = 120 - (totalScreens - 1) * dotSpacing / 2;
-        int dotY = 230 + yOff;
-        if (dotY > 236) dotY = 236;
-        for (int i = 0; i < totalScreens; i++) {
-            uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
-            tft.fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
+    renderScreen(SCREEN_IMAGE, [=, &config]() {
+        // Fill background
+        clearScreen(bgColor);
+
+        // ===== HEADER BAR =====
+        // Get current time
+        const WeatherData& primaryWeather = getWeather(0);
+        long localEpoch = timeClient.getEpochTime() + primaryWeather.utcOffsetSeconds;
+        int hours = (localEpoch % 86400L) / 3600;
+        int minutes = (localEpoch % 3600) / 60;
+        int h12 = hours % 12;
+        if (h12 == 0) h12 = 12;
+        const char* ampm = (hours < 12) ? "AM" : "PM";
+
+        // Time on left (12-hour format with AM/PM)
+        char timeStr[16];
+        snprintf(timeStr, sizeof(timeStr), "%d:%02d", h12, minutes);
+        addClockRegion(8, 8 + yOff, FSSB12);
+        gfx->setFreeFont(FSSB12);
+        gfx->setTextDatum(TL_DATUM);
+        gfx->setTextColor(cyanColor);
+        gfx->drawString(timeStr, 8, 8 + yOff, GFXFF);
+
+        int16_t timeW = gfx->textWidth(timeStr, GFXFF);
+        gfx->setFreeFont(FSS9);
+        gfx->drawString(ampm, 10 + timeW, 12 + yOff, GFXFF);
+
+        // Header label on right - use custom header or "Image" as fallback
+        gfx->setTextDatum(TR_DATUM);
+        gfx->setTextColor(grayColor);
+        const char* headerText = (config.header[0] != '\0') ? config.header : "Image";
+        gfx->drawString(headerText, 210, 8 + yOff, GFXFF);
+
+        // Star icon in top-right corner
+        gfx->setTextColor(cyanColor);
+        gfx->drawString("*", 228, 6 + yOff, GFXFF);
+
+        // No image to show - say why
+        if (message) {
+            gfx->setFreeFont(FSS9);
+            gfx->setTextDatum(MC_DATUM);
+            gfx->setTextColor(grayColor);
+            gfx->drawString(message, 120, 120 + yOff, GFXFF);
         }
-    }
+
+        // ===== NAVIGATION DOTS =====
+        if (totalScreens > 1) {
+            int dotSpacing = 12;
+            int dotStartX = 120 - (totalScreens - 1) * dotSpacing / 2;
+            int dotY = 230 + yOff;
+            if (dotY > 236) dotY = 236;
+            for (int i = 0; i < totalScreens; i++) {
+                uint16_t dotColor = (i == currentScreen) ? cyanColor : grayColor;
+                gfx->fillCircle(dotStartX + i * dotSpacing, dotY, 3, dotColor);
+            }
+        }
+    }, hole, [&]() {
+        // The image goes straight to the panel, into the hole the bands left,
+        // a slice per loop() pass
+        startImageJob(imageIndex, rawFile, raw, imgX, imgY, start);
+    });
 }
 
 // Track carousel position
@@ -2111,7 +3175,7 @@ void updateTftDisplay() {
         uint8_t carouselCount = getCarouselCount();
         if (carouselCount == 0) {
             // Fallback: if no carousel items, show current weather for location 0
-            drawCurrentWeather(0, 1);  // Single screen, no dots
+            renderScreen(SCREEN_CURRENT, []() { drawCurrentWeather(0, 1); });  // Single screen, no dots
             return;
         }
 
@@ -2123,6 +3187,8 @@ void updateTftDisplay() {
         int totalScreens = calculateTotalScreens();
         int currentScreenIdx = calculateCurrentScreenIndex();
         bool showForecast = getShowForecast();
+        liveSendf("{\"type\":\"screen\",\"carousel\":%u,\"subScreen\":%u,\"index\":%d,\"total\":%d}",
+                  currentCarouselIndex, currentSubScreen, currentScreenIdx, totalScreens);
 
         switch (item.type) {
             case CAROUSEL_LOCATION: {
@@ -2133,13 +3199,13 @@ void updateTftDisplay() {
                 if (showForecast) {
                     switch (currentSubScreen) {
                         case 0:
-                            drawCurrentWeather(currentScreenIdx, totalScreens);
+                            renderScreen(SCREEN_CURRENT, [=]() { drawCurrentWeather(currentScreenIdx, totalScreens); });
                             break;
                         case 1:
-                            drawForecast(0, currentScreenIdx, totalScreens);  // Days 1-3
+                            renderScreen(SCREEN_FORECAST, [=]() { drawForecast(0, currentScreenIdx, totalScreens); });  // Days 1-3
                             break;
                         case 2:
-                            drawForecast(3, currentScreenIdx, totalScreens);  // Days 4-6
+                            renderScreen(SCREEN_FORECAST, [=]() { drawForecast(3, currentScreenIdx, totalScreens); });  // Days 4-6
                             break;
                     }
                     currentSubScreen++;
@@ -2149,24 +3215,24 @@ void updateTftDisplay() {
                     }
                 } else {
                     // Only show current weather
-                    drawCurrentWeather(currentScreenIdx, totalScreens);
+                    renderScreen(SCREEN_CURRENT, [=]() { drawCurrentWeather(currentScreenIdx, totalScreens); });
                     currentCarouselIndex = (currentCarouselIndex + 1) % carouselCount;
                 }
                 break;
             }
 
             case CAROUSEL_COUNTDOWN:
-                drawCountdownScreen(item.dataIndex, currentScreenIdx, totalScreens);
+                renderScreen(SCREEN_COUNTDOWN, [=]() { drawCountdownScreen(item.dataIndex, currentScreenIdx, totalScreens); });
                 currentCarouselIndex = (currentCarouselIndex + 1) % carouselCount;
                 break;
 
             case CAROUSEL_CUSTOM:
-                drawCustomScreenByIndex(item.dataIndex, currentScreenIdx, totalScreens);
+                renderScreen(SCREEN_CUSTOM, [=]() { drawCustomScreenByIndex(item.dataIndex, currentScreenIdx, totalScreens); });
                 currentCarouselIndex = (currentCarouselIndex + 1) % carouselCount;
                 break;
 
             case CAROUSEL_YOUTUBE:
-                drawYouTubeScreen(currentScreenIdx, totalScreens);
+                renderScreen(SCREEN_YOUTUBE, [=]() { drawYouTubeScreen(currentScreenIdx, totalScreens); });
                 currentCarouselIndex = (currentCarouselIndex + 1) % carouselCount;
                 break;
 
@@ -2178,6 +3244,10 @@ void updateTftDisplay() {
 
         Serial.printf("[TFT] Carousel %d/%d, SubScreen %d, Total %d\n",
                       currentCarouselIndex, carouselCount, currentSubScreen, totalScreens);
+    } else if (liveRegionCount > 0 && timeClient.getEpochTime() / 60 != liveMinute) {
+        // Minute ticked over mid-screen - repaint just the clock (and countdown days)
+        liveMinute = timeClient.getEpochTime() / 60;
+        renderLiveRegions();
     }
 }
 #endif
@@ -2200,59 +3270,87 @@ void handleAdmin();
 void handleNotFound();
 void feedWatchdog();
 
-/**
- * Provision admin.html.gz to LittleFS from PROGMEM
- * Called on boot to ensure the latest admin UI is available.
- * Only writes if version has changed (avoids unnecessary flash wear).
- */
-void provisionAdminHtml() {
-    const char* ADMIN_VER_PATH = "/admin.version";
-    const char* ADMIN_GZ_PATH = "/admin.html.gz";
-
-    // Check if current version matches
-    if (LittleFS.exists(ADMIN_VER_PATH)) {
-        File vf = LittleFS.open(ADMIN_VER_PATH, "r");
-        if (vf) {
-            String currentVersion = vf.readString();
-            vf.close();
-            currentVersion.trim();
-            if (currentVersion == admin_html_version) {
-                Serial.println(F("[ADMIN] HTML up to date"));
-                return;  // Already up to date
-            }
-            Serial.printf("[ADMIN] Version mismatch: %s != %s\n",
-                         currentVersion.c_str(), admin_html_version);
-        }
-    }
+// =============================================================================
+// LIVE EVENTS
+// =============================================================================
+// loop() compares content generations and the fetch engine state against
+// what was last pushed on the live channel, and sends an event per change.
+// Screen changes are sent from updateTftDisplay() and OTA progress from ota.cpp.
 
-    Serial.printf("[ADMIN] Provisioning admin.html.gz (%u bytes)...\n", admin_html_gz_len);
+static const char* const CONTENT_TYPE_NAMES[CONTENT_TYPE_COUNT] = {
+    "weather", "config", "themes", "youtube"
+};
 
-    // Write gzipped HTML from PROGMEM to LittleFS
-    File f = LittleFS.open(ADMIN_GZ_PATH, "w");
-    if (!f) {
-        Serial.println(F("[ADMIN] Failed to open file for writing"));
-        return;
+/**
+ * Push an event for each change since the last call
+ */
+static void updateLiveEvents() {
+    static uint32_t sentGenerations[CONTENT_TYPE_COUNT] = {0};
+    static uint8_t sentFetchState = FETCH_IDLE;
+
+    for (uint8_t i = 0; i < CONTENT_TYPE_COUNT; i++) {
+        uint32_t generation = getContentGeneration(i);
+        if (generation == sentGenerations[i]) continue;
+        sentGenerations[i] = generation;
+        liveSendf("{\"type\":\"changed\",\"content\":\"%s\",\"generation\":%u}",
+                  CONTENT_TYPE_NAMES[i], (unsigned)generation);
     }
 
-    // Copy from PROGMEM to file (byte by byte to avoid RAM buffer)
-    for (size_t i = 0; i < admin_html_gz_len; i++) {
-        f.write(pgm_read_byte(&admin_html_gz[i]));
-        // Feed watchdog every 1KB to prevent reset during long write
-        if (i % 1024 == 0) {
-            ESP.wdtFeed();
-            yield();
+    const WeatherEngineStats& engine = getWeatherEngineStats();
+    if (engine.state != sentFetchState) {
+        sentFetchState = engine.state;
+        if (engine.state == FETCH_IDLE) {
+            liveSendf("{\"type\":\"fetch\",\"state\":\"idle\",\"ok\":%s}",
+                      engine.lastRefreshOk ? "true" : "false");
+        } else {
+            liveSendf("{\"type\":\"fetch\",\"state\":\"%s\"}", weatherFetchStateName(engine.state));
         }
     }
-    f.close();
+}
 
-    // Update version file
-    File vf = LittleFS.open(ADMIN_VER_PATH, "w");
-    if (vf) {
-        vf.print(admin_html_version);
-        vf.close();
-    }
+// =============================================================================
+// ADMIN PAGE
+// =============================================================================
+// The gzipped admin UI is streamed to the client straight from the PROGMEM
+// array in admin_html.h. A /admin.html.gz on LittleFS (e.g. uploaded while
+// working on the UI) overrides it. Older firmware copied the page there on
+// every version change, marked by /admin.version; such copies are deleted at
+// boot so they don't override the built-in page.
+
+#define ADMIN_OVERRIDE_PATH "/admin.html.gz"
+#define ADMIN_LEGACY_VERSION_PATH "/admin.version"
+
+// Bytes copied out of flash per write (a multiple of 4, for word reads)
+#define ADMIN_CHUNK_SIZE 1024
+
+static bool adminOverride = false;  // Serve ADMIN_OVERRIDE_PATH instead
+
+// Boot and /admin timings (reported by /api/status)
+struct AdminPageStats {
+    uint32_t bootMs;        // setup() start to end
+    uint32_t initUs;        // initAdminPage() at boot
+    uint32_t requests;      // Page bodies sent
+    uint32_t firstByteUs;   // Handler start to headers sent, latest request
+    uint32_t totalUs;       // Handler start to last byte written, latest request
+};
+static AdminPageStats adminPageStats = {};
 
-    Serial.println(F("[ADMIN] Provisioning complete"));
+/**
+ * Check for an admin page override, removing copies left by older firmware
+ * Call once at boot, after LittleFS is mounted.
+ */
+void initAdminPage() {
+    uint32_t start = micros();
+    if (LittleFS.exists(ADMIN_LEGACY_VERSION_PATH)) {
+        LittleFS.remove(ADMIN_LEGACY_VERSION_PATH);
+        LittleFS.remove(ADMIN_OVERRIDE_PATH);
+        Serial.println(F("[ADMIN] Removed provisioned copy, serving built-in page"));
+    }
+    adminOverride = LittleFS.exists(ADMIN_OVERRIDE_PATH);
+    if (adminOverride) {
+        Serial.println(F("[ADMIN] Serving " ADMIN_OVERRIDE_PATH " from LittleFS"));
+    }
+    adminPageStats.initUs = micros() - start;
 }
 
 void setup() {
@@ -2265,6 +3363,7 @@ void setup() {
     Serial.printf_P(PSTR("%s Custom Firmware v%s\n"), DEVICE_NAME, FIRMWARE_VERSION);
     Serial.println(F("================================================"));
     Serial.println(F("[BOOT] Starting initialization..."));
+    unsigned long bootStart = millis();
 
     // Initialize hardware watchdog
     setupWatchdog();
@@ -2282,8 +3381,8 @@ void setup() {
         Serial.printf_P(PSTR("[BOOT] LittleFS: %u/%u bytes used\n"),
                        fs_info.usedBytes, fs_info.totalBytes);
 
-        // Provision admin HTML from PROGMEM to LittleFS (if version changed)
-        provisionAdminHtml();
+        // Look for an admin page override
+        initAdminPage();
     }
 
     feedWatchdog();
@@ -2302,6 +3401,11 @@ void setup() {
     Serial.println(F("[BOOT] Display: DISABLED"));
 #endif
 
+    // Initialize weather system - restores the last known weather from flash,
+    // so screens have data before WiFi is up
+    Serial.println(F("[BOOT] Initializing weather..."));
+    initWeather();
+
     // Initialize WiFi (this can take a while)
     Serial.println(F("[BOOT] Starting WiFi..."));
     setupWiFi();
@@ -2326,24 +3430,30 @@ void setup() {
         // Initialize web OTA (add /update endpoint)
         initWebOTA(&server);
 
-        // Initialize weather system
-        Serial.println(F("[BOOT] Initializing weather..."));
-        initWeather();
+        // Push live status to admin tabs
+        initLive();
 
         // Initialize YouTube stats system
         Serial.println(F("[BOOT] Initializing YouTube..."));
         initYouTube();
 
-        // Fetch initial weather data
-        Serial.println(F("[BOOT] Fetching initial weather..."));
-        forceWeatherUpdate();
+        // Fetch initial weather data - only worth blocking boot for when there
+        // is no snapshot to show; otherwise loop() refreshes it in the background
+        if (!hasCachedWeather()) {
+            Serial.println(F("[BOOT] Fetching initial weather..."));
+            forceWeatherUpdate();
+        } else {
+            Serial.println(F("[BOOT] Showing cached weather, refreshing in background"));
+        }
     }
 
     feedWatchdog();
 
     // Print startup summary
     Serial.println(F("================================================"));
+    adminPageStats.bootMs = millis() - bootStart;
     Serial.println(F("[BOOT] Initialization complete!"));
+    Serial.printf_P(PSTR("[BOOT] Took %u ms\n"), adminPageStats.bootMs);
     Serial.printf_P(PSTR("[BOOT] Free heap: %u bytes\n"), ESP.getFreeHeap());
     Serial.printf_P(PSTR("[BOOT] Chip ID: %08X\n"), ESP.getChipId());
     Serial.printf_P(PSTR("[BOOT] Flash size: %u bytes\n"), ESP.getFlashChipRealSize());
@@ -2356,13 +3466,18 @@ void setup() {
         // Show IP address on boot screen and give user time to see it
 #if ENABLE_TFT_TEST
         showBootScreenIP(WiFi.localIP().toString().c_str());
-        delay(3000);  // Give user 3 seconds to see the IP address
+        // Give user time to see the IP address - shorter when cached weather is ready
+        delay(hasCachedWeather() ? 1000 : 3000);
 #endif
     }
     Serial.println(F("================================================"));
 }
 
 void loop() {
+    uint32_t loopStart = micros();
+    uint8_t loopScreen = liveScreen;
+    uint32_t loopFrames = renderStats[loopScreen].frames;
+
     // Feed watchdog at start of loop
     feedWatchdog();
 
@@ -2376,6 +3491,7 @@ void loop() {
 
     // Handle web server - ALWAYS process, even in safe mode
     server.handleClient();
+    updateLive();
 
     // In emergency safe mode, skip all other processing
     // This keeps web server responsive for firmware upload
@@ -2387,15 +3503,24 @@ void loop() {
     // Update NTP (library handles update interval internally)
     timeClient.update();
 
-    // Update weather data (checks interval internally)
+    // Advance weather fetch engine (checks interval internally, time-sliced)
     updateWeather();
 
+    // Close idle kept-alive API connections
+    updateNet();
+
     // Update YouTube stats (checks interval internally)
     updateYouTube();
 
+    // Tell admin tabs what changed
+    updateLiveEvents();
+
     // Update TFT display
 #if ENABLE_TFT_TEST
     updateTftDisplay();
+
+    // Push the next slice of an image screen's image
+    updateImageJob();
 #endif
 
     // Update brightness based on night mode
@@ -2411,6 +3536,14 @@ void loop() {
         applyBrightness(getBrightness());
     }
 
+    // Loop latency while the screen is up (a pass that drew a new frame is
+    // counted in the screen's render time instead)
+    if (liveScreen == loopScreen && renderStats[loopScreen].frames == loopFrames) {
+        uint32_t loopUs = micros() - loopStart;
+        RenderStats& stats = renderStats[loopScreen];
+        if (loopUs > stats.maxLoopUs) stats.maxLoopUs = loopUs;
+    }
+
     // Small yield to prevent watchdog issues
     yield();
 }
@@ -2508,6 +3641,564 @@ void setupWiFi() {
 #endif
 }
 
+// =============================================================================
+// CONDITIONAL GET
+// =============================================================================
+// Responses the admin page polls carry an ETag built from the generations of
+// the content they show (getContentGeneration), plus a nonce picked at boot
+// since generations restart at 0. Cache-Control: no-cache lets the browser
+// keep the body but ask every time; a request whose If-None-Match still
+// matches gets an empty 304 instead of the response being built again.
+
+#define ETAG_MAX_LENGTH 48
+
+enum TaggedResponse : uint8_t {
+    TAGGED_WEATHER = 0,
+    TAGGED_CONFIG,
+    TAGGED_THEMES,
+    TAGGED_YOUTUBE,
+    TAGGED_ADMIN,
+    TAGGED_RESPONSE_COUNT
+};
+
+static const char* const TAGGED_RESPONSE_NAMES[TAGGED_RESPONSE_COUNT] = {
+    "weather", "config", "themes", "youtube", "admin"
+};
+
+// Requests answered with and without a body (reported by /api/status)
+struct EtagStats {
+    uint32_t sent;          // Full responses
+    uint32_t notModified;   // 304s
+};
+static EtagStats etagStats[TAGGED_RESPONSE_COUNT];
+
+static uint32_t etagBootId = 0;
+
+/**
+ * Build the ETag of a response from the generations of its content
+ */
+static void makeContentEtag(char* etag, size_t len, uint8_t response,
+                            uint8_t content, uint8_t alsoContent = CONTENT_TYPE_COUNT) {
+    uint32_t also = alsoContent < CONTENT_TYPE_COUNT ? getContentGeneration(alsoContent) : 0;
+    snprintf(etag, len, "\"%s-%08x-%x-%x\"", TAGGED_RESPONSE_NAMES[response],
+             (unsigned)etagBootId, (unsigned)getContentGeneration(content), (unsigned)also);
+}
+
+/**
+ * Tag a response, answering with 304 if the client's copy is still current
+ * Call before anything is sent; the ETag and Cache-Control headers go out
+ * with the full response too.
+ * @return true if a 304 was sent and the handler is done
+ */
+static bool sendNotModified(uint8_t response, const char* etag) {
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "no-cache");
+    if (server.hasHeader("If-None-Match") && server.header("If-None-Match").indexOf(etag) >= 0) {
+        etagStats[response].notModified++;
+        server.send(304);
+        return true;
+    }
+    etagStats[response].sent++;
+    return false;
+}
+
+// =============================================================================
+// STREAMED RESPONSES
+// =============================================================================
+// Large JSON responses are written straight to the client with chunked
+// transfer encoding through a small fixed buffer, instead of being built as a
+// JsonDocument and serialized into a String first.
+
+#define RESPONSE_BUFFER_SIZE 256
+
+enum ApiResponse : uint8_t {
+    API_RESPONSE_WEATHER = 0,
+    API_RESPONSE_CONFIG,
+    API_RESPONSE_STATUS,
+    API_RESPONSE_THEMES,
+    API_RESPONSE_YOUTUBE,
+    API_RESPONSE_IMAGES,
+    API_RESPONSE_BOOTSTRAP,
+    API_RESPONSE_COUNT
+};
+
+static const char* const API_RESPONSE_NAMES[API_RESPONSE_COUNT] = {
+    "weather", "config", "status", "themes", "youtube", "images", "bootstrap"
+};
+
+// Cost of the most recent response of each streamed endpoint (reported by /api/status)
+struct ResponseStats {
+    uint32_t requests;
+    uint32_t bytes;         // Body bytes of the most recent response
+    uint32_t us;            // Time to write it
+    uint32_t peakHeapUsed;  // Largest drop in free heap while writing it
+};
+static ResponseStats responseStats[API_RESPONSE_COUNT];
+
+/**
+ * Chunked HTTP response body
+ * Sends the headers when constructed; call finish() after the last write.
+ */
+class ChunkedResponse : public Print {
+public:
+    ChunkedResponse(uint8_t endpoint, const char* contentType = "application/json")
+        : endpoint(endpoint), len(0), bytes(0), start(micros()) {
+        heapBefore = ESP.getFreeHeap();
+        heapLow = heapBefore;
+        server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        server.send(200, contentType, "");
+    }
+
+    size_t write(uint8_t c) override {
+        if (len == sizeof(buf)) sendBuffered();
+        buf[len++] = c;
+        return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t size) override {
+        for (size_t i = 0; i < size; i++) write(data[i]);
+        return size;
+    }
+
+    void finish() {
+        sendBuffered();
+        server.sendContent("");  // Last chunk
+        ResponseStats& stats = responseStats[endpoint];
+        stats.requests++;
+        stats.bytes = bytes;
+        stats.us = micros() - start;
+        stats.peakHeapUsed = heapBefore - heapLow;
+    }
+
+private:
+    void sendBuffered() {
+        if (len == 0) return;
+        server.sendContent(buf, len);
+        bytes += len;
+        len = 0;
+        uint32_t freeHeap = ESP.getFreeHeap();
+        if (freeHeap < heapLow) heapLow = freeHeap;
+    }
+
+    uint8_t endpoint;
+    char buf[RESPONSE_BUFFER_SIZE];
+    size_t len;
+    uint32_t bytes;
+    uint32_t start;
+    uint32_t heapBefore;
+    uint32_t heapLow;
+};
+
+// =============================================================================
+// API RESPONSE BODIES
+// =============================================================================
+// Each writes the members of one endpoint's top-level object, so the same
+// body serves the endpoint itself and its section of /api/bootstrap.
+
+/**
+ * Device status and performance counters (/api/status)
+ */
+static void writeStatusJson(JsonStream& json) {
+    json.add("version", FIRMWARE_VERSION);
+    json.add("device", DEVICE_NAME);
+    json.add("heap", ESP.getFreeHeap());
+    json.add("uptime", millis() / 1000);
+    json.add("ip", WiFi.localIP().toString());
+    json.add("rssi", WiFi.RSSI());
+    json.add("ssid", WiFi.SSID());
+    json.add("mac", WiFi.macAddress());
+    json.add("chipId", String(ESP.getChipId(), HEX));
+    json.add("flashSize", ESP.getFlashChipRealSize());
+    json.add("sketchSize", ESP.getSketchSize());
+    json.add("freeSketchSpace", ESP.getFreeSketchSpace());
+
+    // Render cost of the most recent frame of each screen type
+    json.beginObject("render");
+    for (uint8_t i = 0; i < SCREEN_TYPE_COUNT; i++) {
+        const RenderStats& stats = renderStats[i];
+        if (stats.frames == 0) continue;
+        json.beginObject(SCREEN_TYPE_NAMES[i]);
+        json.add("frames", stats.frames);
+        json.add("lastUs", stats.lastUs);
+        json.add("maxUs", stats.maxUs);
+        json.add("spiBytes", stats.lastSpiBytes);
+        json.add("banded", stats.banded);
+        json.add("liveUpdates", stats.liveUpdates);
+        json.add("liveUs", stats.lastLiveUs);
+        json.add("liveSpiBytes", stats.lastLiveSpiBytes);
+        json.add("maxLoopUs", stats.maxLoopUs);
+        json.endObject();
+    }
+    json.endObject();
+
+    // Custom screen body layouts
+    json.beginObject("customLayout");
+    json.add("bytes", sizeof(customLayouts));
+    json.add("builds", customLayoutBuilds);
+    json.endObject();
+
+    // Batched text rasters reused across the bands of a frame
+    json.beginObject("textCache");
+    json.add("hits", textCacheHits);
+    json.add("misses", textCacheMisses);
+    json.endObject();
+
+    // Streamed API responses: size, time and heap of the latest of each
+    json.beginObject("responses");
+    for (uint8_t i = 0; i < API_RESPONSE_COUNT; i++) {
+        const ResponseStats& stats = responseStats[i];
+        if (stats.requests == 0) continue;
+        json.beginObject(API_RESPONSE_NAMES[i]);
+        json.add("requests", stats.requests);
+        json.add("bytes", stats.bytes);
+        json.add("us", stats.us);
+        json.add("peakHeapUsed", stats.peakHeapUsed);
+        json.endObject();
+    }
+    json.endObject();
+
+    // Boot time and admin page delivery
+    json.beginObject("admin");
+    json.add("bootMs", adminPageStats.bootMs);
+    json.add("initUs", adminPageStats.initUs);
+    json.add("override", adminOverride);
+    json.add("size", adminOverride ? 0 : admin_html_gz_len);
+    json.add("requests", adminPageStats.requests);
+    json.add("firstByteUs", adminPageStats.firstByteUs);
+    json.add("totalUs", adminPageStats.totalUs);
+    json.endObject();
+
+    // Conditional GETs: full responses and 304s per tagged endpoint
+    json.beginObject("etags");
+    for (uint8_t i = 0; i < TAGGED_RESPONSE_COUNT; i++) {
+        const EtagStats& stats = etagStats[i];
+        if (stats.sent == 0 && stats.notModified == 0) continue;
+        json.beginObject(TAGGED_RESPONSE_NAMES[i]);
+        json.add("sent", stats.sent);
+        json.add("notModified", stats.notModified);
+        json.endObject();
+    }
+    json.endObject();
+
+    // WebSocket live channel
+    LiveStats live = getLiveStats();
+    json.beginObject("live");
+    json.add("clients", live.clients);
+    json.add("maxClients", LIVE_MAX_CLIENTS);
+    json.add("accepted", live.accepted);
+    json.add("refused", live.refused);
+    json.add("events", live.events);
+    json.add("dropped", live.dropped);
+    json.endObject();
+
+    // Outbound API requests per host, with the latest request's timings
+    json.beginArray("net");
+    for (uint8_t i = 0; i < getNetHostCount(); i++) {
+        NetHostStats hostStats = getNetHostStats(i);
+        json.beginObject();
+        json.add("host", hostStats.host);
+        json.add("requests", hostStats.requests);
+        json.add("reused", hostStats.reused);
+        json.add("dnsHits", hostStats.dnsHits);
+        json.add("failures", hostStats.failures);
+        json.add("blockingConnects", hostStats.blockingConnects);
+        json.add("maxBlockingUs", hostStats.maxBlockingUs);
+        json.add("dnsMs", hostStats.last.dnsMs);
+        json.add("connectMs", hostStats.last.connectMs);
+        json.add("ttfbMs", hostStats.last.ttfbMs);
+        json.add("totalMs", hostStats.last.totalMs);
+        json.endObject();
+    }
+    json.endArray();
+}
+
+/**
+ * Weather for every location plus fetch diagnostics (/api/weather)
+ */
+static void writeWeatherJson(JsonStream& json) {
+    // Return all locations as array
+    json.beginArray("locations");
+    for (int i = 0; i < getLocationCount(); i++) {
+        json.beginObject();
+        weatherToJson(getWeather(i), json);
+        // Refresh schedule
+        json.add("nextUpdateIn", getLocationNextUpdateIn(i) / 1000);  // seconds
+        json.add("errorCount", getWeather(i).errorCount);
+        json.add("retryDelay", getLocationRetryDelay(i) / 1000);  // seconds, 0 = healthy
+        json.endObject();
+    }
+    json.endArray();
+
+    // Add primary key for backward compatibility (first location)
+    if (getLocationCount() > 0) {
+        json.beginObject("primary");
+        weatherToJson(getWeather(0), json);
+        json.endObject();
+    }
+
+    // Add metadata
+    json.add("locationCount", getLocationCount());
+    json.add("maxLocations", MAX_WEATHER_LOCATIONS);
+    json.add("nextUpdateIn", getNextUpdateIn() / 1000);  // seconds
+    json.add("updateInterval", WEATHER_UPDATE_INTERVAL_MS / 1000);  // seconds
+
+    // Diagnostics for the most recent fetch
+    const WeatherFetchStats& stats = getWeatherFetchStats();
+    json.beginObject("lastFetch");
+    json.add("bytes", stats.bytes);
+    json.add("durationMs", stats.durationMs);
+    json.add("peakHeapUsed", stats.peakHeapUsed);
+    json.add("locations", stats.locations);
+    json.add("format", stats.flatbuffers ? "flatbuffers" : "json");
+    json.add("parseUs", stats.parseUs);
+    json.add("httpStatus", stats.httpStatus);
+    json.add("refreshMs", stats.refreshMs);
+    json.add("refreshNetworkMs", stats.refreshNetworkMs);
+    json.add("refreshRequests", stats.refreshRequests);
+    json.add("dnsMs", stats.dnsMs);
+    json.add("dnsCached", stats.dnsCached);
+    json.add("connectMs", stats.connectMs);
+    json.add("reused", stats.reused);
+    json.add("ttfbMs", stats.ttfbMs);
+    json.endObject();
+
+    // Fetch engine state and how long it held up loop()
+    const WeatherEngineStats& engine = getWeatherEngineStats();
+    json.beginObject("engine");
+    json.add("state", weatherFetchStateName(engine.state));
+    json.add("slices", engine.slices);
+    json.add("lastSliceUs", engine.lastSliceUs);
+    json.add("maxSliceUs", engine.maxSliceUs);
+    json.beginObject("stateMaxUs");
+    for (uint8_t i = FETCH_RESOLVE; i < FETCH_STATE_COUNT; i++) {
+        json.add(weatherFetchStateName(i), engine.stateMaxUs[i]);
+    }
+    json.endObject();
+    // TLS connects block in place and are kept out of the slice timing
+    json.add("blockingSlices", engine.blockingSlices);
+    json.add("lastBlockingUs", engine.lastBlockingUs);
+    json.add("maxBlockingUs", engine.maxBlockingUs);
+    json.endObject();
+}
+
+/**
+ * Location, carousel and display settings (/api/config)
+ */
+static void writeConfigJson(JsonStream& json) {
+    // Return all locations as array
+    json.beginArray("locations");
+    for (int i = 0; i < getLocationCount(); i++) {
+        const WeatherLocation& loc = getLocation(i);
+        json.beginObject();
+        json.add("name", loc.name);
+        json.add("lat", loc.latitude, 5);
+        json.add("lon", loc.longitude, 5);
+        json.add("enabled", loc.enabled);
+        json.endObject();
+    }
+    json.endArray();
+
+    // Carousel items
+    json.beginArray("carousel");
+    for (uint8_t i = 0; i < getCarouselCount(); i++) {
+        const CarouselItem& item = getCarouselItem(i);
+        json.beginObject();
+        json.add("type", item.type);
+        json.add("dataIndex", item.dataIndex);
+        json.endObject();
+    }
+    json.endArray();
+
+    // Countdown events
+    json.beginArray("countdowns");
+    for (uint8_t i = 0; i < getCountdownCount(); i++) {
+        const CountdownEvent& cd = getCountdown(i);
+        json.beginObject();
+        json.add("type", cd.type);
+        json.add("month", cd.month);
+        json.add("day", cd.day);
+        json.add("title", cd.title);
+        json.endObject();
+    }
+    json.endArray();
+
+    // Custom screens (multiple)
+    json.beginArray("customScreens");
+    for (uint8_t i = 0; i < getCustomScreenCount(); i++) {
+        const CustomScreenConfig& cs = getCustomScreenConfig(i);
+        json.beginObject();
+        json.add("header", cs.header);
+        json.add("body", cs.body);
+        json.add("footer", cs.footer);
+        json.endObject();
+    }
+    json.endArray();
+
+    // Metadata
+    json.add("locationCount", getLocationCount());
+    json.add("maxLocations", MAX_WEATHER_LOCATIONS);
+
+    // Display settings (both flat and nested for compatibility)
+    json.add("useCelsius", getUseCelsius());
+    json.add("brightness", getBrightness());
+    json.add("nightModeEnabled", getNightModeEnabled());
+    json.add("nightModeStartHour", getNightModeStartHour());
+    json.add("nightModeEndHour", getNightModeEndHour());
+    json.add("nightModeBrightness", getNightModeBrightness());
+    json.add("showForecast", getShowForecast());
+    json.add("screenCycleTime", getScreenCycleTime());
+    json.add("themeMode", getThemeMode());
+    json.add("uiNudgeY", getUiNudgeY());
+
+    // Display settings as nested object for new admin UI
+    json.beginObject("display");
+    json.add("unit", getUseCelsius() ? "c" : "f");
+    json.add("cycle", getScreenCycleTime());
+    json.add("brightness", getBrightness());
+    json.endObject();
+
+    // Custom screen settings (legacy - single screen)
+    json.add("customScreenEnabled", getCustomScreenEnabled());
+    json.add("customScreenHeader", getCustomScreenHeader());
+    json.add("customScreenBody", getCustomScreenBody());
+    json.add("customScreenFooter", getCustomScreenFooter());
+
+    // GIF support disabled
+    json.add("gifSupported", false);
+}
+
+/**
+ * Write a theme's colors as an object
+ */
+static void writeThemeColors(JsonStream& json, const char* key, const ThemeColors& c) {
+    json.beginObject(key);
+    json.add("bg", c.bg);
+    json.add("card", c.card);
+    json.add("text", c.text);
+    json.add("textOnCard", c.textOnCard);
+    json.add("cyan", c.cyan);
+    json.add("cyanOnCard", c.cyanOnCard);
+    json.add("orange", c.orange);
+    json.add("orangeOnCard", c.orangeOnCard);
+    json.add("blue", c.blue);
+    json.add("blueOnCard", c.blueOnCard);
+    json.add("gray", c.gray);
+    json.add("grayOnCard", c.grayOnCard);
+    json.endObject();
+}
+
+/**
+ * Theme selection and every theme's colors (/api/themes)
+ */
+static void writeThemesJson(JsonStream& json) {
+    json.add("activeTheme", getActiveTheme());
+    json.add("themeMode", getThemeMode());
+
+    // List all themes with their colors
+    json.beginArray("themes");
+
+    // Built-in themes (include colors for "Load from" feature)
+    static const uint8_t BUILT_IN[] = {THEME_CLASSIC, THEME_MINECRAFT};
+    for (uint8_t index : BUILT_IN) {
+        json.beginObject();
+        json.add("name", getThemeName(index));
+        json.add("index", index);
+        json.add("builtin", true);
+        const ThemeDefinition* def = getThemeDefinition(index);
+        if (def) {
+            writeThemeColors(json, "dark", def->dark);
+            writeThemeColors(json, "light", def->light);
+        }
+        json.endObject();
+    }
+
+    // User: Custom (colors for editing)
+    json.beginObject();
+    json.add("name", "Custom");
+    json.add("index", THEME_CUSTOM);
+    json.add("builtin", false);
+    writeThemeColors(json, "dark", getCustomThemeDark());
+    writeThemeColors(json, "light", getCustomThemeLight());
+    json.endObject();
+
+    json.endArray();
+}
+
+/**
+ * YouTube settings and the latest stats (/api/youtube)
+ */
+static void writeYouTubeJson(JsonStream& json) {
+    const YouTubeConfig& config = getYouTubeConfig();
+    const YouTubeData& data = getYouTubeData();
+
+    json.add("enabled", config.enabled);
+    json.add("configured", isYouTubeConfigured());
+    json.add("channelHandle", config.channelHandle);
+    json.add("apiKey", config.apiKey);  // Return key so admin UI can display it
+    json.add("hasApiKey", strlen(config.apiKey) > 0);
+
+    if (data.valid) {
+        json.add("channelName", data.channelName);
+        json.add("channelId", data.channelId);
+        json.add("subscribers", data.subscribers);
+        json.add("views", data.views);
+        json.add("videos", data.videos);
+        json.add("lastUpdate", data.lastUpdate);
+        json.add("valid", true);
+    } else {
+        json.add("valid", false);
+        if (strlen(data.lastError) > 0) {
+            json.add("error", data.lastError);
+        }
+    }
+}
+
+/**
+ * Uploaded images with their decoded copies and render times (/api/images)
+ */
+static void writeImagesJson(JsonStream& json) {
+    uint8_t count = getImageScreenCount();
+    json.beginArray("images");
+    for (uint8_t i = 0; i < count; i++) {
+        const ImageScreenConfig& img = getImageScreenConfig(i);
+        json.beginObject();
+        json.add("index", i);
+        json.add("filename", img.filename);
+        json.add("header", img.header);
+        json.add("valid", img.valid);
+
+        // Get file size if valid
+        if (img.valid && LittleFS.exists(img.filename)) {
+            File f = LittleFS.open(img.filename, "r");
+            if (f) {
+                json.add("size", f.size());
+                f.close();
+            }
+        }
+
+        // Decoded copy and the last showing's time-to-pixels
+        char rawPath[sizeof(img.filename)];
+        getImageRawPath(img.filename, rawPath, sizeof(rawPath));
+        if (img.valid && LittleFS.exists(rawPath)) {
+            File f = LittleFS.open(rawPath, "r");
+            if (f) {
+                json.add("rawSize", f.size());
+                f.close();
+            }
+        }
+        if (imageRenderStats[i].lastUs) {
+            json.add("renderUs", imageRenderStats[i].lastUs);
+            json.add("renderSlices", imageRenderStats[i].slices);
+            json.add("renderedRaw", imageRenderStats[i].raw);
+        }
+        json.endObject();
+    }
+    json.endArray();
+    json.add("count", count);
+    json.add("maxCount", MAX_IMAGE_SCREENS);
+    json.add("maxSize", MAX_IMAGE_FILE_SIZE);
+}
+
 /**
  * Setup web server routes
  */
@@ -2520,19 +4211,116 @@ void setupWebServer() {
 
     // API endpoints
     server.on("/api/status", HTTP_GET, []() {
+        ChunkedResponse response(API_RESPONSE_STATUS);
+        JsonStream json(response);
+        json.beginObject();
+        writeStatusJson(json);
+        json.endObject();
+        response.finish();
+    });
+
+    // Everything the admin page needs on load, in one response
+    server.on("/api/bootstrap", HTTP_GET, []() {
+        ChunkedResponse response(API_RESPONSE_BOOTSTRAP);
+        JsonStream json(response);
+        json.beginObject();
+        json.beginObject("status");
+        writeStatusJson(json);
+        json.endObject();
+        json.beginObject("weather");
+        writeWeatherJson(json);
+        json.endObject();
+        json.beginObject("config");
+        writeConfigJson(json);
+        json.endObject();
+        json.beginObject("themes");
+        writeThemesJson(json);
+        json.endObject();
+        json.beginObject("youtube");
+        writeYouTubeJson(json);
+        json.endObject();
+        json.beginObject("images");
+        writeImagesJson(json);
+        json.endObject();
+        json.endObject();
+        response.finish();
+    });
+
+    // Large-digit microbenchmark: segment shapes vs cached glyphs, drawing
+    // "0123456789" on the panel and into one band sprite. Paints over the
+    // screen, so the carousel redraws right after.
+    server.on("/api/bench/digits", HTTP_GET, []() {
+        int height = server.hasArg("height") ? constrain(server.arg("height").toInt(), 10, 120) : 70;
+        uint16_t color = getThemeText();
+        uint16_t bg = getThemeBg();
+        uint32_t shapesUs, cachedUs;
+
+        JsonDocument doc;
+        doc["height"] = height;
+        doc["digits"] = 10;
+
+        benchLargeDigits(&tft, 60, height, color, bg, &shapesUs, &cachedUs);
+        JsonObject panel = doc["panel"].to<JsonObject>();
+        panel["shapesUs"] = shapesUs;
+        panel["cachedUs"] = cachedUs;
+
+        // The digits straddle the band, as in the banded renderer
+        TFT_eSprite band(&tft);
+        band.setColorDepth(16);
+        if (band.createSprite(DISPLAY_WIDTH, RENDER_BAND_HEIGHT)) {
+            benchLargeDigits(&band, (RENDER_BAND_HEIGHT - height) / 2, height, color, bg, &shapesUs, &cachedUs);
+            band.deleteSprite();
+            JsonObject sprite = doc["band"].to<JsonObject>();
+            sprite["shapesUs"] = shapesUs;
+            sprite["cachedUs"] = cachedUs;
+        }
+
+        doc["cacheHits"] = largeDigitHits;
+        doc["cacheMisses"] = largeDigitMisses;
+        lastDisplayUpdate = 0;  // Redraw over the benchmark
+
+        String response;
+        serializeJson(doc, response);
+        server.send(200, "application/json", response);
+    });
+
+    // Text microbenchmark: glyphs per second with drawString() and with
+    // batched drawText(), per font, on the panel and into one band sprite,
+    // and with the per-frame raster cache (bandCached).
+    // Paints over the screen, so the carousel redraws right after.
+    server.on("/api/bench/text", HTTP_GET, []() {
+        static const struct { const char* name; const GFXfont* font; } fonts[] = {
+            {"FSS9", FSS9}, {"FSS12", FSS12}, {"FSSB18", FSSB18}
+        };
+        uint16_t fg = getThemeText();
+        uint16_t bg = getThemeBg();
+        uint32_t plainGps, batchedGps;
+
         JsonDocument doc;
-        doc["version"] = FIRMWARE_VERSION;
-        doc["device"] = DEVICE_NAME;
-        doc["heap"] = ESP.getFreeHeap();
-        doc["uptime"] = millis() / 1000;
-        doc["ip"] = WiFi.localIP().toString();
-        doc["rssi"] = WiFi.RSSI();
-        doc["ssid"] = WiFi.SSID();
-        doc["mac"] = WiFi.macAddress();
-        doc["chipId"] = String(ESP.getChipId(), HEX);
-        doc["flashSize"] = ESP.getFlashChipRealSize();
-        doc["sketchSize"] = ESP.getSketchSize();
-        doc["freeSketchSpace"] = ESP.getFreeSketchSpace();
+        TFT_eSprite band(&tft);
+        band.setColorDepth(16);
+        bool haveBand = band.createSprite(DISPLAY_WIDTH, RENDER_BAND_HEIGHT);
+
+        for (const auto& f : fonts) {
+            JsonObject font = doc[f.name].to<JsonObject>();
+            tft.fillScreen(bg);
+            benchText(&tft, 100, f.font, fg, bg, &plainGps, &batchedGps);
+            font["panelPlain"] = plainGps;
+            font["panelBatched"] = batchedGps;
+            if (haveBand) {
+                benchText(&band, 4, f.font, fg, bg, &plainGps, &batchedGps);
+                font["bandPlain"] = plainGps;
+                font["bandBatched"] = batchedGps;
+                // Same string in the following bands of a frame: raster reused
+                beginTextCache();
+                benchText(&band, 4, f.font, fg, bg, &plainGps, &batchedGps);
+                endTextCache();
+                font["bandCached"] = batchedGps;
+            }
+            ESP.wdtFeed();
+        }
+        band.deleteSprite();
+        lastDisplayUpdate = 0;  // Redraw over the benchmark
 
         String response;
         serializeJson(doc, response);
@@ -2551,128 +4339,47 @@ void setupWebServer() {
     });
 
     // Weather API endpoint - returns all locations
+    // Tagged with the weather and config generations; nextUpdateIn and the
+    // engine timings in a 304'd copy are as of the last change
     server.on("/api/weather", HTTP_GET, []() {
-        JsonDocument doc;
-
-        // Return all locations as array
-        JsonArray locations = doc["locations"].to<JsonArray>();
-        for (int i = 0; i < getLocationCount(); i++) {
-            JsonObject loc = locations.add<JsonObject>();
-            JsonDocument locDoc;
-            weatherToJson(getWeather(i), locDoc);
-            loc.set(locDoc.as<JsonObject>());
-        }
-
-        // Add primary key for backward compatibility (first location)
-        if (getLocationCount() > 0) {
-            JsonDocument primaryDoc;
-            weatherToJson(getWeather(0), primaryDoc);
-            doc["primary"] = primaryDoc;
-        }
-
-        // Add metadata
-        doc["locationCount"] = getLocationCount();
-        doc["maxLocations"] = MAX_WEATHER_LOCATIONS;
-        doc["nextUpdateIn"] = getNextUpdateIn() / 1000;  // seconds
-        doc["updateInterval"] = WEATHER_UPDATE_INTERVAL_MS / 1000;  // seconds
-
-        String response;
-        serializeJson(doc, response);
-        server.send(200, "application/json", response);
+        char etag[ETAG_MAX_LENGTH];
+        makeContentEtag(etag, sizeof(etag), TAGGED_WEATHER, CONTENT_WEATHER, CONTENT_CONFIG);
+        if (sendNotModified(TAGGED_WEATHER, etag)) return;
+
+        ChunkedResponse response(API_RESPONSE_WEATHER);
+        JsonStream json(response);
+        json.beginObject();
+        writeWeatherJson(json);
+        json.endObject();
+        response.finish();
     });
 
     // Force weather refresh endpoint
+    // Starts the refresh and returns; loop() runs the fetch in slices
     server.on("/api/weather/refresh", HTTP_GET, []() {
-        bool success = forceWeatherUpdate();
+        requestWeatherUpdate();
 
         JsonDocument doc;
-        doc["success"] = success;
-        doc["message"] = success ? "Weather updated" : "Update failed";
+        doc["success"] = true;
+        doc["message"] = "Weather update started";
 
         String response;
         serializeJson(doc, response);
-        server.send(success ? 200 : 500, "application/json", response);
+        server.send(200, "application/json", response);
     });
 
     // Config API - GET returns location settings, POST saves them
     server.on("/api/config", HTTP_GET, []() {
-        JsonDocument doc;
-
-        // Return all locations as array
-        JsonArray locArray = doc["locations"].to<JsonArray>();
-        for (int i = 0; i < getLocationCount(); i++) {
-            const WeatherLocation& loc = getLocation(i);
-            JsonObject l = locArray.add<JsonObject>();
-            l["name"] = loc.name;
-            l["lat"] = loc.latitude;
-            l["lon"] = loc.longitude;
-            l["enabled"] = loc.enabled;
-        }
-
-        // Carousel items
-        JsonArray carouselArray = doc["carousel"].to<JsonArray>();
-        for (uint8_t i = 0; i < getCarouselCount(); i++) {
-            const CarouselItem& item = getCarouselItem(i);
-            JsonObject c = carouselArray.add<JsonObject>();
-            c["type"] = item.type;
-            c["dataIndex"] = item.dataIndex;
-        }
-
-        // Countdown events
-        JsonArray countdownArray = doc["countdowns"].to<JsonArray>();
-        for (uint8_t i = 0; i < getCountdownCount(); i++) {
-            const CountdownEvent& cd = getCountdown(i);
-            JsonObject c = countdownArray.add<JsonObject>();
-            c["type"] = cd.type;
-            c["month"] = cd.month;
-            c["day"] = cd.day;
-            c["title"] = cd.title;
-        }
-
-        // Custom screens (multiple)
-        JsonArray customArray = doc["customScreens"].to<JsonArray>();
-        for (uint8_t i = 0; i < getCustomScreenCount(); i++) {
-            const CustomScreenConfig& cs = getCustomScreenConfig(i);
-            JsonObject c = customArray.add<JsonObject>();
-            c["header"] = cs.header;
-            c["body"] = cs.body;
-            c["footer"] = cs.footer;
-        }
-
-        // Metadata
-        doc["locationCount"] = getLocationCount();
-        doc["maxLocations"] = MAX_WEATHER_LOCATIONS;
-
-        // Display settings (both flat and nested for compatibility)
-        doc["useCelsius"] = getUseCelsius();
-        doc["brightness"] = getBrightness();
-        doc["nightModeEnabled"] = getNightModeEnabled();
-        doc["nightModeStartHour"] = getNightModeStartHour();
-        doc["nightModeEndHour"] = getNightModeEndHour();
-        doc["nightModeBrightness"] = getNightModeBrightness();
-        doc["showForecast"] = getShowForecast();
-        doc["screenCycleTime"] = getScreenCycleTime();
-        doc["themeMode"] = getThemeMode();
-        doc["uiNudgeY"] = getUiNudgeY();
-
-        // Display settings as nested object for new admin UI
-        JsonObject display = doc["display"].to<JsonObject>();
-        display["unit"] = getUseCelsius() ? "c" : "f";
-        display["cycle"] = getScreenCycleTime();
-        display["brightness"] = getBrightness();
-
-        // Custom screen settings (legacy - single screen)
-        doc["customScreenEnabled"] = getCustomScreenEnabled();
-        doc["customScreenHeader"] = getCustomScreenHeader();
-        doc["customScreenBody"] = getCustomScreenBody();
-        doc["customScreenFooter"] = getCustomScreenFooter();
-
-        // GIF support disabled
-        doc["gifSupported"] = false;
-
-        String response;
-        serializeJson(doc, response);
-        server.send(200, "application/json", response);
+        char etag[ETAG_MAX_LENGTH];
+        makeContentEtag(etag, sizeof(etag), TAGGED_CONFIG, CONTENT_CONFIG, CONTENT_THEMES);  // Includes themeMode
+        if (sendNotModified(TAGGED_CONFIG, etag)) return;
+
+        ChunkedResponse response(API_RESPONSE_CONFIG);
+        JsonStream json(response);
+        json.beginObject();
+        writeConfigJson(json);
+        json.endObject();
+        response.finish();
     });
 
     server.on("/api/config", HTTP_POST, []() {
@@ -2688,6 +4395,10 @@ void setupWebServer() {
             return;
         }
 
+        // Weather is only refetched when the locations actually change -
+        // display settings such as units apply to the data already held
+        bool locationsChanged = false;
+
         // Check if using new array format
         if (doc["locations"].is<JsonArray>()) {
             JsonArray locArray = doc["locations"].as<JsonArray>();
@@ -2699,28 +4410,45 @@ void setupWebServer() {
                 return;
             }
 
-            // Clear existing locations and add new ones
-            clearLocations();
-
-            bool first = true;
+            // Same list as before? Then keep the locations and their weather
+            int matched = 0;
+            int incoming = 0;
             for (JsonObject loc : locArray) {
                 const char* name = loc["name"];
                 float lat = loc["lat"] | 0.0f;
                 float lon = loc["lon"] | 0.0f;
-
                 if (name && strlen(name) > 0 && (lat != 0 || lon != 0)) {
-                    if (first) {
-                        // Update first location (can't remove it)
-                        updateLocation(0, name, lat, lon);
-                        first = false;
-                    } else {
-                        addLocation(name, lat, lon);
+                    if (isSameLocation(incoming, name, lat, lon)) matched++;
+                    incoming++;
+                }
+            }
+            locationsChanged = incoming == 0 || matched != incoming || incoming != getLocationCount();
+
+            // Clear existing locations and add new ones
+            if (locationsChanged) {
+                clearLocations();
+
+                bool first = true;
+                for (JsonObject loc : locArray) {
+                    const char* name = loc["name"];
+                    float lat = loc["lat"] | 0.0f;
+                    float lon = loc["lon"] | 0.0f;
+
+                    if (name && strlen(name) > 0 && (lat != 0 || lon != 0)) {
+                        if (first) {
+                            // Update first location (can't remove it)
+                            updateLocation(0, name, lat, lon);
+                            first = false;
+                        } else {
+                            addLocation(name, lat, lon);
+                        }
                     }
                 }
             }
         }
         // Fall back to old format for backward compatibility
         else if (doc["primary"].is<JsonObject>()) {
+            locationsChanged = true;
             JsonObject primary = doc["primary"];
             const char* name = primary["name"];
             float lat = primary["lat"] | 0.0f;
@@ -2847,6 +4575,7 @@ void setupWebServer() {
                 );
             }
             Serial.printf("[API] Updated %d custom screens\n", getCustomScreenCount());
+            buildCustomScreenLayouts();
         }
 
         // Carousel order (new carousel system)
@@ -2890,7 +4619,9 @@ void setupWebServer() {
             for (int i = imgCount - 1; i >= 0; i--) {
                 if (!usedImages[i]) {
                     Serial.printf("[API] Removing orphaned image at index %d\n", i);
+                    cancelImageJob();  // It may be reading this image
                     removeImageScreenConfig(i);
+                    memset(imageRenderStats, 0, sizeof(imageRenderStats));  // Indices shifted
                     yield();  // Let system breathe
                 }
             }
@@ -2926,80 +4657,24 @@ void setupWebServer() {
         server.send(200, "application/json", "{\"success\":true,\"message\":\"Config saved\"}");
 
         // Only refresh weather if we have location screens (saves memory/time)
-        if (hasLocationScreens) {
-            yield();
+        if (hasLocationScreens && locationsChanged) {
             Serial.printf("[API] Refreshing weather, free heap: %d\n", ESP.getFreeHeap());
-            forceWeatherUpdate();
+            requestWeatherUpdate();
         }
     });
 
     // Themes API - GET returns all themes, POST updates custom theme
     server.on("/api/themes", HTTP_GET, []() {
-        JsonDocument doc;
-
-        doc["activeTheme"] = getActiveTheme();
-        doc["themeMode"] = getThemeMode();
-
-        // Helper to serialize ThemeColors to JSON
-        auto serializeColors = [](JsonObject& obj, const ThemeColors& c) {
-            obj["bg"] = c.bg;
-            obj["card"] = c.card;
-            obj["text"] = c.text;
-            obj["textOnCard"] = c.textOnCard;
-            obj["cyan"] = c.cyan;
-            obj["cyanOnCard"] = c.cyanOnCard;
-            obj["orange"] = c.orange;
-            obj["orangeOnCard"] = c.orangeOnCard;
-            obj["blue"] = c.blue;
-            obj["blueOnCard"] = c.blueOnCard;
-            obj["gray"] = c.gray;
-            obj["grayOnCard"] = c.grayOnCard;
-        };
-
-        // List all themes with their colors
-        JsonArray themes = doc["themes"].to<JsonArray>();
-
-        // Built-in: Classic (include colors for "Load from" feature)
-        JsonObject classic = themes.add<JsonObject>();
-        classic["name"] = "Classic";
-        classic["index"] = THEME_CLASSIC;
-        classic["builtin"] = true;
-        const ThemeDefinition* classicDef = getThemeDefinition(THEME_CLASSIC);
-        if (classicDef) {
-            JsonObject cDark = classic["dark"].to<JsonObject>();
-            serializeColors(cDark, classicDef->dark);
-            JsonObject cLight = classic["light"].to<JsonObject>();
-            serializeColors(cLight, classicDef->light);
-        }
-
-        // Built-in: Minecraft (include colors for "Load from" feature)
-        JsonObject minecraft = themes.add<JsonObject>();
-        minecraft["name"] = "Minecraft";
-        minecraft["index"] = THEME_MINECRAFT;
-        minecraft["builtin"] = true;
-        const ThemeDefinition* minecraftDef = getThemeDefinition(THEME_MINECRAFT);
-        if (minecraftDef) {
-            JsonObject mDark = minecraft["dark"].to<JsonObject>();
-            serializeColors(mDark, minecraftDef->dark);
-            JsonObject mLight = minecraft["light"].to<JsonObject>();
-            serializeColors(mLight, minecraftDef->light);
-        }
-
-        // User: Custom
-        JsonObject custom = themes.add<JsonObject>();
-        custom["name"] = "Custom";
-        custom["index"] = THEME_CUSTOM;
-        custom["builtin"] = false;
-
-        // Include custom theme colors for editing
-        JsonObject customDark = custom["dark"].to<JsonObject>();
-        serializeColors(customDark, getCustomThemeDark());
-        JsonObject customLight = custom["light"].to<JsonObject>();
-        serializeColors(customLight, getCustomThemeLight());
-
-        String response;
-        serializeJson(doc, response);
-        server.send(200, "application/json", response);
+        char etag[ETAG_MAX_LENGTH];
+        makeContentEtag(etag, sizeof(etag), TAGGED_THEMES, CONTENT_THEMES);
+        if (sendNotModified(TAGGED_THEMES, etag)) return;
+
+        ChunkedResponse response(API_RESPONSE_THEMES);
+        JsonStream json(response);
+        json.beginObject();
+        writeThemesJson(json);
+        json.endObject();
+        response.finish();
     });
 
     server.on("/api/themes", HTTP_POST, []() {
@@ -3081,34 +4756,16 @@ void setupWebServer() {
 
     // YouTube API endpoints
     server.on("/api/youtube", HTTP_GET, []() {
-        JsonDocument doc;
-        const YouTubeConfig& config = getYouTubeConfig();
-        const YouTubeData& data = getYouTubeData();
-
-        doc["enabled"] = config.enabled;
-        doc["configured"] = isYouTubeConfigured();
-        doc["channelHandle"] = config.channelHandle;
-        doc["apiKey"] = config.apiKey;  // Return key so admin UI can display it
-        doc["hasApiKey"] = strlen(config.apiKey) > 0;
-
-        if (data.valid) {
-            doc["channelName"] = data.channelName;
-            doc["channelId"] = data.channelId;
-            doc["subscribers"] = data.subscribers;
-            doc["views"] = data.views;
-            doc["videos"] = data.videos;
-            doc["lastUpdate"] = data.lastUpdate;
-            doc["valid"] = true;
-        } else {
-            doc["valid"] = false;
-            if (strlen(data.lastError) > 0) {
-                doc["error"] = data.lastError;
-            }
-        }
-
-        String response;
-        serializeJson(doc, response);
-        server.send(200, "application/json", response);
+        char etag[ETAG_MAX_LENGTH];
+        makeContentEtag(etag, sizeof(etag), TAGGED_YOUTUBE, CONTENT_YOUTUBE);
+        if (sendNotModified(TAGGED_YOUTUBE, etag)) return;
+
+        ChunkedResponse response(API_RESPONSE_YOUTUBE);
+        JsonStream json(response);
+        json.beginObject();
+        writeYouTubeJson(json);
+        json.endObject();
+        response.finish();
     });
 
     server.on("/api/youtube", HTTP_POST, []() {
@@ -3174,34 +4831,12 @@ void setupWebServer() {
 
     // GET /api/images - list all image screens
     server.on("/api/images", HTTP_GET, []() {
-        JsonDocument doc;
-        JsonArray images = doc["images"].to<JsonArray>();
-
-        uint8_t count = getImageScreenCount();
-        for (uint8_t i = 0; i < count; i++) {
-            const ImageScreenConfig& img = getImageScreenConfig(i);
-            JsonObject imgObj = images.add<JsonObject>();
-            imgObj["index"] = i;
-            imgObj["filename"] = img.filename;
-            imgObj["header"] = img.header;
-            imgObj["valid"] = img.valid;
-
-            // Get file size if valid
-            if (img.valid && LittleFS.exists(img.filename)) {
-                File f = LittleFS.open(img.filename, "r");
-                if (f) {
-                    imgObj["size"] = f.size();
-                    f.close();
-                }
-            }
-        }
-        doc["count"] = count;
-        doc["maxCount"] = MAX_IMAGE_SCREENS;
-        doc["maxSize"] = MAX_IMAGE_FILE_SIZE;
-
-        String response;
-        serializeJson(doc, response);
-        server.send(200, "application/json", response);
+        ChunkedResponse response(API_RESPONSE_IMAGES);
+        JsonStream json(response);
+        json.beginObject();
+        writeImagesJson(json);
+        json.endObject();
+        response.finish();
     });
 
     // POST /api/images/delete - delete an image
@@ -3218,7 +4853,9 @@ void setupWebServer() {
         }
 
         // Remove from config (also deletes file)
+        cancelImageJob();  // It may be reading this image
         if (removeImageScreenConfig(index)) {
+            memset(imageRenderStats, 0, sizeof(imageRenderStats));  // Indices shifted
             saveWeatherConfig();
             server.send(200, "application/json", "{\"success\":true,\"message\":\"Image deleted\"}");
         } else {
@@ -3284,6 +4921,17 @@ void setupWebServer() {
                 return;
             }
 
+            // Pixel size from the SOF marker; the decoder can't do progressive JPGs
+            uint16_t imgW = 0, imgH = 0;
+            bool progressive = false;
+            if (!getJpegInfo(uploadFilename.c_str(), &imgW, &imgH, &progressive) || progressive) {
+                LittleFS.remove(uploadFilename);
+                server.send(400, "application/json", progressive
+                    ? "{\"success\":false,\"message\":\"Progressive JPG not supported\"}"
+                    : "{\"success\":false,\"message\":\"Invalid JPG file\"}");
+                return;
+            }
+
             int idx;
             if (replaceIndex >= 0) {
                 // Replacing existing - just use the same index, update header
@@ -3305,12 +4953,22 @@ void setupWebServer() {
 
             saveWeatherConfig();
 
+            // Decode once now, scaled to fit, so showing it is a plain file read
+            uint32_t transcodeStart = millis();
+            bool transcoded = transcodeImage(uploadFilename.c_str());
+            uint32_t transcodeMs = millis() - transcodeStart;
+            imageRenderStats[idx] = {0, 0, false, !transcoded};
+
             JsonDocument doc;
             doc["success"] = true;
             doc["message"] = replaceIndex >= 0 ? "Image replaced" : "Image uploaded";
             doc["index"] = idx;
             doc["filename"] = uploadFilename;
             doc["size"] = uploadSize;
+            doc["width"] = imgW;
+            doc["height"] = imgH;
+            doc["raw"] = transcoded;
+            doc["transcodeMs"] = transcodeMs;
 
             String response;
             serializeJson(doc, response);
@@ -3366,6 +5024,7 @@ void setupWebServer() {
                     uploadFilename = "/images/image_" + String(getImageScreenCount()) + ".jpg";
                 }
 
+                cancelImageJob();  // It may be reading the image being replaced
                 uploadFile = LittleFS.open(uploadFilename, "w");
                 if (!uploadFile) {
                     uploadError = true;
@@ -3459,33 +5118,22 @@ void setupWebServer() {
             }
         }
 
-        // Build Open-Meteo geocoding URL
+        // Build Open-Meteo geocoding path
         // Request 20 results from API to include international cities (Canada, etc.)
-        String url = "http://geocoding-api.open-meteo.com/v1/search?name=";
-        url += encodedQuery;
-        url += "&count=20&language=en&format=json";
+        String path = "/v1/search?name=";
+        path += encodedQuery;
+        path += "&count=20&language=en&format=json";
 
         Serial.printf("[GEOCODE] Searching: %s\n", query.c_str());
 
-        WiFiClient client;
-        HTTPClient http;
-        http.setTimeout(10000);
-
-        if (!http.begin(client, url)) {
-            server.send(500, "application/json", "{\"error\":\"HTTP begin failed\"}");
-            return;
-        }
-
-        int httpCode = http.GET();
-        if (httpCode != HTTP_CODE_OK) {
-            http.end();
+        // Searches typed back to back reuse the kept-alive connection
+        String payload;
+        int httpCode = netGet(GEOCODING_API_HOST, GEOCODING_API_PORT, path, payload);
+        if (httpCode != 200) {
             server.send(500, "application/json", "{\"error\":\"Geocoding request failed\"}");
             return;
         }
 
-        String payload = http.getString();
-        http.end();
-
         // Parse and simplify the response
         JsonDocument doc;
         DeserializationError error = deserializeJson(doc, payload);
@@ -3558,12 +5206,11 @@ void setupWebServer() {
         server.send(200, "application/json", response);
     });
 
-    // Force admin HTML reprovision - deletes version file to trigger refresh on reboot
+    // Reload admin UI - deletes any LittleFS override so the built-in page is served after reboot
     server.on("/api/reprovision", HTTP_GET, []() {
-        // Delete the version file to force reprovisioning
-        LittleFS.remove("/admin.version");
-        LittleFS.remove("/admin.html.gz");
-        Serial.println(F("[ADMIN] Admin files deleted, will reprovision on reboot"));
+        LittleFS.remove(ADMIN_LEGACY_VERSION_PATH);
+        LittleFS.remove(ADMIN_OVERRIDE_PATH);
+        Serial.println(F("[ADMIN] Override deleted, serving built-in page after reboot"));
 
         // Send a styled reconnect page that auto-reloads when device is back
         server.send(200, "text/html",
@@ -3660,64 +5307,65 @@ void setupWebServer() {
     // Not found handler
     server.onNotFound(handleNotFound);
 
+    // Conditional GET needs the client's If-None-Match
+    static const char* collectedHeaders[] = {"If-None-Match"};
+    server.collectHeaders(collectedHeaders, 1);
+    etagBootId = ESP.random();
+
     // Start server
     server.begin();
     Serial.println(F("[WEB] HTTP server started on port 80"));
 }
 
 /**
- * Handle admin page - serves new Carousel UI from LittleFS
- * Falls back to legacy embedded HTML if file not found
+ * Handle admin page - streams the gzipped UI built into the firmware
+ * A LittleFS override is sent untagged, so edits to it show on reload.
  */
 void handleAdmin() {
-    const char* HTML_FILE = "/admin.html.gz";
+    uint32_t start = micros();
 
-    // Try to serve from LittleFS first (gzipped)
-    // Note: streamFile() auto-adds Content-Encoding:gzip for .gz files
-    if (LittleFS.exists(HTML_FILE)) {
-        File f = LittleFS.open(HTML_FILE, "r");
+    if (adminOverride) {
+        File f = LittleFS.open(ADMIN_OVERRIDE_PATH, "r");
         if (f) {
+            // streamFile() adds Content-Encoding: gzip for .gz files
+            server.sendHeader("Cache-Control", "no-cache");
             size_t fileSize = f.size();
             server.streamFile(f, "text/html");
             f.close();
-            Serial.printf("[ADMIN] Served %s (%u bytes gzipped)\n", HTML_FILE, fileSize);
+            adminPageStats.requests++;
+            adminPageStats.firstByteUs = 0;
+            adminPageStats.totalUs = micros() - start;
+            Serial.printf("[ADMIN] Served %s (%u bytes gzipped)\n", ADMIN_OVERRIDE_PATH, fileSize);
             return;
         }
+        Serial.println(F("[ADMIN] Override unreadable, serving built-in page"));
+        adminOverride = false;
     }
 
-    // If we get here, admin.html.gz is missing - try to re-provision
-    Serial.println(F("[ADMIN] File missing, attempting re-provision..."));
-    provisionAdminHtml();
-
-    // Try again after provisioning
-    if (LittleFS.exists(HTML_FILE)) {
-        File f = LittleFS.open(HTML_FILE, "r");
-        if (f) {
-            size_t fileSize = f.size();
-            server.streamFile(f, "text/html");
-            f.close();
-            Serial.printf("[ADMIN] Served %s after re-provision (%u bytes)\n", HTML_FILE, fileSize);
-            return;
-        }
+    // Changes with the firmware version and with the page itself
+    char adminEtag[ETAG_MAX_LENGTH];
+    snprintf(adminEtag, sizeof(adminEtag), "\"admin-%s-%s\"", admin_html_version, admin_html_hash);
+    if (sendNotModified(TAGGED_ADMIN, adminEtag)) return;
+
+    server.sendHeader("Content-Encoding", "gzip");
+    server.setContentLength(admin_html_gz_len);
+    server.send(200, "text/html", "");
+    adminPageStats.firstByteUs = micros() - start;
+
+    uint8_t buf[ADMIN_CHUNK_SIZE];
+    size_t sent = 0;
+    while (sent < admin_html_gz_len && server.client().connected()) {
+        size_t n = admin_html_gz_len - sent;
+        if (n > sizeof(buf)) n = sizeof(buf);
+        memcpy_P(buf, admin_html_gz + sent, n);
+        server.sendContent((const char*)buf, n);
+        sent += n;
     }
 
-    // If still failing, show error page with reboot option
-    Serial.println(F("[ADMIN] Re-provision failed, showing error page"));
-    String html = F("<!DOCTYPE html><html><head><meta charset='UTF-8'>"
-        "<meta name='viewport' content='width=device-width,initial-scale=1'>"
-        "<title>Admin Error</title><style>"
-        "body{font-family:sans-serif;background:#1a1a2e;color:#eee;margin:0;padding:40px;text-align:center}"
-        ".card{background:#2a2a4e;border-radius:10px;padding:30px;max-width:400px;margin:50px auto}"
-        "h2{color:#ff6b35}p{color:#aaa;margin:20px 0}"
-        "button{background:#00d4ff;color:#1a1a2e;border:none;padding:15px 30px;border-radius:6px;cursor:pointer;margin:10px}"
-        "button:hover{background:#00a8cc}button.warn{background:#ff6b35}"
-        "</style></head><body><div class='card'>"
-        "<h2>Admin Page Error</h2>"
-        "<p>The admin interface could not be loaded. This may indicate a file system issue.</p>"
-        "<button onclick=\"location.href='/reboot'\">Reboot Device</button>"
-        "<button class='warn' onclick=\"location.href='/api/safemode'\">Enter Safe Mode</button>"
-        "</div></body></html>");
-    server.send(500, "text/html", html);
+    adminPageStats.requests++;
+    adminPageStats.totalUs = micros() - start;
+    Serial.printf("[ADMIN] Served built-in page (%u of %u bytes gzipped, first byte %u us, total %u us)\n",
+                  sent, admin_html_gz_len, adminPageStats.firstByteUs, adminPageStats.totalUs);
 }
 
 /**
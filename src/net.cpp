@@ -0,0 +1,859 @@
+/**
+ * EpicWeatherBox Firmware - Outbound HTTP Client Implementation
+ *
+ * Requests are stepped from the caller (netPoll/netRead) and never wait on
+ * the network except for the TLS handshake, so the weather engine can run
+ * them in time slices. Plain TCP connects are started with lwIP directly and
+ * polled; the established pcb is then handed to a WiFiClient. netGet() wraps
+ * the same steps for callers that can block.
+ */
+
+#include "net.h"
+#include "config.h"
+#include <WiFiClientSecure.h>
+#include <lwip/dns.h>
+#include <lwip/tcp.h>
+#include <include/ClientContext.h>
+#include <new>
+
+// =============================================================================
+// STATIC DATA
+// =============================================================================
+
+enum NetDnsState : uint8_t {
+    NET_DNS_NONE = 0,
+    NET_DNS_PENDING,    // Waiting on the lwIP callback
+    NET_DNS_OK,         // address is valid until resolvedAt + NET_DNS_TTL_MS
+    NET_DNS_FAILED
+};
+
+enum NetChunkState : uint8_t {
+    NET_CHUNK_SIZE = 0, // Reading the chunk-size line
+    NET_CHUNK_DATA,     // Reading chunkLeft bytes of data
+    NET_CHUNK_DATA_END, // Reading the CRLF after the data
+    NET_CHUNK_TRAILER   // Reading trailer lines after the last chunk
+};
+
+/**
+ * A host: its cached DNS answer and request stats
+ */
+struct NetHost {
+    char name[48];                  // Empty = entry free
+    uint8_t users;                  // Requests holding this entry
+    unsigned long lastUsed;
+
+    // DNS cache (written from the lwIP callback)
+    IPAddress address;
+    volatile uint8_t dnsState;
+    uint8_t dnsSequence;            // Ignores answers for abandoned lookups
+    unsigned long resolvedAt;
+
+    // Stats
+    uint32_t requests;
+    uint32_t reused;
+    uint32_t dnsHits;
+    uint32_t failures;
+    uint32_t blockingConnects;
+    uint32_t maxBlockingUs;
+    NetTimings last;
+};
+
+/**
+ * An open connection, in use by a request or kept alive for the next one
+ */
+struct NetConnection {
+    WiFiClient* client;             // Established connection
+    bool connecting;                // Plain TCP connect in flight (client still nullptr)
+    tcp_pcb* pcb;                   // Connecting pcb (cleared by the lwIP callbacks)
+    ClientContext* context;         // Connected, waiting for pollConnect() to wrap it
+    int8_t host;
+    uint16_t port;
+    bool secure;
+    bool busy;                      // Held by a request
+    unsigned long idleSince;
+};
+
+static NetHost hosts[NET_MAX_HOSTS];
+static NetConnection connections[NET_MAX_CONNECTIONS];
+static uint32_t blockingUs = 0;     // Time spent in TLS connects since netTakeBlockingUs()
+
+/**
+ * WiFiClient around a connection lwIP already established
+ */
+class NetClient : public WiFiClient {
+public:
+    explicit NetClient(ClientContext* context) : WiFiClient(context) {}
+};
+
+static const char* const NET_ERROR_MESSAGES[NET_ERR_COUNT] = {
+    "OK",
+    "WiFi not connected",
+    "DNS lookup failed",
+    "DNS lookup timeout",
+    "Connection failed",
+    "No free connection",
+    "Request send timeout",
+    "Response timeout",
+    "Connection closed early",
+    "Malformed response"
+};
+
+/**
+ * Get printable message for a NetError
+ */
+const char* netErrorToString(uint8_t error) {
+    return error < NET_ERR_COUNT ? NET_ERROR_MESSAGES[error] : "Unknown error";
+}
+
+// =============================================================================
+// HOSTS AND CONNECTIONS
+// =============================================================================
+
+/**
+ * lwIP DNS callback - runs outside loop(), so it only records the answer
+ */
+static void onDnsFound(const char* name, const ip_addr_t* addr, void* arg) {
+    uintptr_t tag = (uintptr_t)arg;
+    NetHost& host = hosts[(tag >> 8) % NET_MAX_HOSTS];
+    if ((uint8_t)tag != host.dnsSequence || host.dnsState != NET_DNS_PENDING) return;
+    if (addr) {
+        host.address = IPAddress(addr);
+        host.resolvedAt = millis();
+        host.dnsState = NET_DNS_OK;
+    } else {
+        host.dnsState = NET_DNS_FAILED;
+    }
+}
+
+/**
+ * lwIP connect callbacks for plain TCP - like onDnsFound they run outside
+ * loop(). The established pcb goes straight into a ClientContext so its
+ * receive and error handling is in place before pollConnect() picks it up.
+ */
+static err_t onTcpConnected(void* arg, tcp_pcb* pcb, err_t err) {
+    NetConnection& conn = connections[(uintptr_t)arg];
+    tcp_arg(pcb, nullptr);
+    tcp_err(pcb, nullptr);
+    conn.pcb = nullptr;
+
+    ClientContext* context = new (std::nothrow) ClientContext(pcb, nullptr, nullptr);
+    if (!context) {
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+    context->ref();  // Held until a NetClient takes its own reference
+    conn.context = context;
+    return ERR_OK;
+}
+
+static void onTcpError(void* arg, err_t err) {
+    connections[(uintptr_t)arg].pcb = nullptr;  // lwIP has already freed it
+}
+
+static bool isSlotFree(const NetConnection& conn) {
+    return !conn.client && !conn.connecting;
+}
+
+static void closeConnection(int8_t slot) {
+    NetConnection& conn = connections[slot];
+    if (conn.client) {
+        conn.client->stop();
+        delete conn.client;
+    }
+    if (conn.pcb) {
+        tcp_arg(conn.pcb, nullptr);
+        tcp_err(conn.pcb, nullptr);
+        tcp_abort(conn.pcb);
+    }
+    if (conn.context) {
+        conn.context->unref();
+    }
+    conn.client = nullptr;
+    conn.connecting = false;
+    conn.pcb = nullptr;
+    conn.context = nullptr;
+    conn.host = -1;
+    conn.busy = false;
+}
+
+/**
+ * Find or claim the host table entry for a name
+ * When the table is full, the least recently used host nobody holds is replaced.
+ */
+static int8_t acquireHost(const char* name) {
+    if (strlen(name) >= sizeof(hosts[0].name)) return -1;
+
+    int8_t empty = -1;
+    int8_t oldest = -1;
+    for (int8_t i = 0; i < NET_MAX_HOSTS; i++) {
+        NetHost& host = hosts[i];
+        if (host.name[0] == '\0') {
+            if (empty < 0) empty = i;
+        } else if (strcmp(host.name, name) == 0) {
+            host.users++;
+            return i;
+        } else if (host.users == 0 &&
+                   (oldest < 0 || (long)(host.lastUsed - hosts[oldest].lastUsed) < 0)) {
+            oldest = i;
+        }
+    }
+
+    int8_t index = empty >= 0 ? empty : oldest;
+    if (index < 0) return -1;
+
+    // Replacing a host - drop its kept-alive connections and pending lookup
+    for (int8_t s = 0; s < NET_MAX_CONNECTIONS; s++) {
+        if (!isSlotFree(connections[s]) && connections[s].host == index) {
+            closeConnection(s);
+        }
+    }
+
+    NetHost& host = hosts[index];
+    strcpy(host.name, name);
+    host.users = 1;
+    host.lastUsed = millis();
+    host.dnsSequence++;
+    host.dnsState = NET_DNS_NONE;
+    host.requests = 0;
+    host.reused = 0;
+    host.dnsHits = 0;
+    host.failures = 0;
+    host.blockingConnects = 0;
+    host.maxBlockingUs = 0;
+    host.last = {};
+    return index;
+}
+
+/**
+ * Find a kept-alive connection to reuse, closing ones the server has dropped
+ */
+static int8_t findIdleConnection(int8_t host, uint16_t port, bool secure) {
+    for (int8_t s = 0; s < NET_MAX_CONNECTIONS; s++) {
+        NetConnection& conn = connections[s];
+        if (!conn.client || conn.busy || conn.host != host ||
+            conn.port != port || conn.secure != secure) {
+            continue;
+        }
+        // Unread bytes on an idle connection mean it is out of step - don't reuse it
+        if (!conn.client->connected() || conn.client->available() > 0) {
+            closeConnection(s);
+            continue;
+        }
+        return s;
+    }
+    return -1;
+}
+
+/**
+ * Get a free connection slot, closing the longest-idle connection if needed
+ */
+static int8_t claimConnectionSlot() {
+    int8_t oldest = -1;
+    for (int8_t s = 0; s < NET_MAX_CONNECTIONS; s++) {
+        NetConnection& conn = connections[s];
+        if (isSlotFree(conn)) return s;
+        if (!conn.busy &&
+            (oldest < 0 || (long)(conn.idleSince - connections[oldest].idleSince) < 0)) {
+            oldest = s;
+        }
+    }
+    if (oldest >= 0) closeConnection(oldest);
+    return oldest;
+}
+
+/**
+ * Close kept-alive connections that went idle or were closed by the server
+ */
+void updateNet() {
+    unsigned long now = millis();
+    for (int8_t s = 0; s < NET_MAX_CONNECTIONS; s++) {
+        NetConnection& conn = connections[s];
+        if (!conn.client || conn.busy) continue;
+        if (now - conn.idleSince > NET_KEEPALIVE_IDLE_MS || !conn.client->connected()) {
+            closeConnection(s);
+        }
+    }
+}
+
+// =============================================================================
+// REQUEST STEPS
+// =============================================================================
+
+static void setPhase(NetRequest& req, uint8_t phase) {
+    req.phase = phase;
+    req.phaseStart = millis();
+    req.lastProgress = req.phaseStart;
+}
+
+static void failRequest(NetRequest& req, uint8_t error) {
+    if (req.slot >= 0) {
+        closeConnection(req.slot);
+        req.slot = -1;
+    }
+    req.error = error;
+    req.phase = NET_FAILED;
+}
+
+/**
+ * Fail a request whose connection closed - unless it went out on a
+ * kept-alive connection the server had already dropped, then send it again
+ * on a fresh one
+ */
+static bool retryOrFail(NetRequest& req, uint8_t error) {
+    if (!req.timings.reused || req.retried || req.statusSeen || req.lineLen > 0) {
+        failRequest(req, error);
+        return true;
+    }
+    Serial.printf("[NET] %s: kept-alive connection was closed, reconnecting\n", hosts[req.host].name);
+    closeConnection(req.slot);
+    req.slot = -1;
+    req.retried = true;
+    req.timings.reused = false;
+    req.sent = 0;
+    setPhase(req, NET_RESOLVE);
+    return true;
+}
+
+static bool pollResolve(NetRequest& req, unsigned long now) {
+    NetHost& host = hosts[req.host];
+
+    // A kept-alive connection or a TLS connect (which resolves by name so
+    // the server sees the right SNI) doesn't need an address from us
+    if (req.secure || findIdleConnection(req.host, req.port, req.secure) >= 0) {
+        setPhase(req, NET_CONNECT);
+        return true;
+    }
+
+    if (host.dnsState == NET_DNS_OK && now - host.resolvedAt < NET_DNS_TTL_MS) {
+        req.timings.dnsCached = true;
+        host.dnsHits++;
+        setPhase(req, NET_CONNECT);
+        return true;
+    }
+
+    if (host.dnsState != NET_DNS_PENDING) {
+        ip_addr_t addr;
+        host.dnsSequence++;
+        host.dnsState = NET_DNS_PENDING;
+        err_t err = dns_gethostbyname(host.name, &addr, onDnsFound,
+                                      (void*)(uintptr_t)((req.host << 8) | host.dnsSequence));
+        if (err == ERR_OK) {
+            // Answered from lwIP's own table
+            host.address = IPAddress(&addr);
+            host.resolvedAt = now;
+            host.dnsState = NET_DNS_OK;
+        } else if (err != ERR_INPROGRESS) {
+            host.dnsState = NET_DNS_FAILED;
+        }
+    }
+
+    if (host.dnsState == NET_DNS_PENDING) {
+        if (now - req.phaseStart > req.timeoutMs) {
+            host.dnsSequence++;  // Ignore a late answer
+            host.dnsState = NET_DNS_NONE;
+            failRequest(req, NET_ERR_DNS_TIMEOUT);
+            return true;
+        }
+        return false;
+    }
+    if (host.dnsState != NET_DNS_OK) {
+        host.dnsState = NET_DNS_NONE;
+        failRequest(req, NET_ERR_DNS);
+        return true;
+    }
+
+    req.timings.dnsMs = now - req.phaseStart;
+    setPhase(req, NET_CONNECT);
+    return true;
+}
+
+/**
+ * Wait for a plain TCP connect started by pollConnect()
+ */
+static bool pollTcpConnect(NetRequest& req, unsigned long now) {
+    NetConnection& conn = connections[req.slot];
+
+    if (conn.context) {
+        NetClient* client = new (std::nothrow) NetClient(conn.context);
+        if (!client) {
+            failRequest(req, NET_ERR_CONNECT);
+            return true;
+        }
+        conn.context->unref();  // The client holds its own reference now
+        conn.context = nullptr;
+        conn.connecting = false;
+        conn.client = client;
+        client->setNoDelay(true);
+        req.timings.connectMs = now - req.phaseStart;
+        setPhase(req, NET_SEND);
+        return true;
+    }
+
+    if (!conn.pcb || now - req.phaseStart > NET_CONNECT_TIMEOUT_MS) {
+        hosts[req.host].dnsState = NET_DNS_NONE;  // The cached address may be stale
+        failRequest(req, NET_ERR_CONNECT);
+        return true;
+    }
+    return false;
+}
+
+static bool pollConnect(NetRequest& req, unsigned long now) {
+    if (req.slot >= 0) return pollTcpConnect(req, now);
+
+    NetHost& host = hosts[req.host];
+
+    int8_t slot = findIdleConnection(req.host, req.port, req.secure);
+    if (slot >= 0) {
+        connections[slot].busy = true;
+        req.slot = slot;
+        req.timings.reused = true;
+        setPhase(req, NET_SEND);
+        return true;
+    }
+
+    // Got here through a kept-alive connection that has since closed
+    if (!req.secure && host.dnsState != NET_DNS_OK) {
+        setPhase(req, NET_RESOLVE);
+        return true;
+    }
+
+    slot = claimConnectionSlot();
+    if (slot < 0) {
+        failRequest(req, NET_ERR_BUSY);
+        return true;
+    }
+
+    NetConnection& conn = connections[slot];
+    conn.host = req.host;
+    conn.port = req.port;
+    conn.secure = req.secure;
+    conn.busy = true;
+
+    if (!req.secure) {
+        // Start the handshake and come back for it on later polls
+        tcp_pcb* pcb = tcp_new();
+        if (!pcb) {
+            failRequest(req, NET_ERR_CONNECT);
+            return true;
+        }
+        conn.connecting = true;
+        conn.pcb = pcb;
+        req.slot = slot;
+        tcp_arg(pcb, (void*)(uintptr_t)slot);
+        tcp_err(pcb, onTcpError);
+        if (tcp_connect(pcb, host.address, req.port, onTcpConnected) != ERR_OK) {
+            failRequest(req, NET_ERR_CONNECT);
+            return true;
+        }
+        setPhase(req, NET_CONNECT);  // Connect timeout and timing start here
+        return false;
+    }
+
+    BearSSL::WiFiClientSecure* tls = new (std::nothrow) BearSSL::WiFiClientSecure();
+    if (!tls) {
+        failRequest(req, NET_ERR_CONNECT);
+        return true;
+    }
+    tls->setInsecure();             // Skip certificate validation (OK for non-sensitive API calls)
+    tls->setBufferSizes(512, 512);  // Default is 16KB each
+    tls->setTimeout(req.timeoutMs);
+    conn.client = tls;
+    req.slot = slot;
+
+    // The one step that can't be split: BearSSL's connect() runs the TCP and
+    // TLS handshakes in place, bounded by the client timeout. The time is
+    // reported through netTakeBlockingUs() so callers can account for it.
+    uint32_t start = micros();
+    bool connected = conn.client->connect(host.name, req.port);
+    uint32_t blockedUs = micros() - start;
+    blockingUs += blockedUs;
+    host.blockingConnects++;
+    if (blockedUs > host.maxBlockingUs) host.maxBlockingUs = blockedUs;
+    req.timings.connectMs = blockedUs / 1000;
+    if (!connected) {
+        failRequest(req, NET_ERR_CONNECT);
+        return true;
+    }
+    setPhase(req, NET_SEND);
+    return true;
+}
+
+static bool pollSend(NetRequest& req, unsigned long now) {
+    WiFiClient& client = *connections[req.slot].client;
+    size_t remaining = req.request.length() - req.sent;
+    // BearSSL buffers the record itself, so TLS writes go out in one call
+    size_t room = req.secure ? remaining : (size_t)client.availableForWrite();
+    size_t n = room ? client.write((const uint8_t*)req.request.c_str() + req.sent, min(remaining, room)) : 0;
+    if (n == 0) {
+        if (!client.connected()) return retryOrFail(req, NET_ERR_CLOSED);
+        if (now - req.lastProgress > req.timeoutMs) {
+            failRequest(req, NET_ERR_SEND_TIMEOUT);
+            return true;
+        }
+        return false;
+    }
+    req.sent += n;
+    req.lastProgress = now;
+    if (req.sent >= req.request.length()) {
+        setPhase(req, NET_HEADERS);
+    }
+    return true;
+}
+
+/**
+ * Handle one complete response header line
+ */
+static void handleHeaderLine(NetRequest& req) {
+    uint8_t length = req.lineLen;
+    req.line[length] = '\0';
+    req.lineLen = 0;
+
+    if (!req.statusSeen) {
+        // Status line: "HTTP/1.1 200 OK" - HTTP/1.0 closes unless it says otherwise
+        req.statusSeen = true;
+        req.keepAlive = strncmp(req.line, "HTTP/1.1", 8) == 0;
+        const char* space = strchr(req.line, ' ');
+        req.status = space ? atoi(space + 1) : 0;
+        return;
+    }
+
+    if (length == 0) {
+        // Blank line - headers done
+        if (req.chunked) {
+            req.contentLength = -1;
+            req.chunkState = NET_CHUNK_SIZE;
+        } else if (req.status == 204 || req.status == 304) {
+            req.contentLength = 0;
+        } else if (req.contentLength < 0) {
+            req.keepAlive = false;  // Body ends when the server closes
+        }
+        setPhase(req, NET_BODY);
+        return;
+    }
+
+    if (strncasecmp(req.line, "Content-Length:", 15) == 0) {
+        req.contentLength = atol(req.line + 15);
+    } else if (strncasecmp(req.line, "Transfer-Encoding:", 18) == 0) {
+        req.chunked = strstr(req.line + 18, "chunked") != nullptr;
+    } else if (strncasecmp(req.line, "Connection:", 11) == 0) {
+        const char* value = req.line + 11;
+        while (*value == ' ') value++;
+        if (strncasecmp(value, "close", 5) == 0) {
+            req.keepAlive = false;
+        } else if (strncasecmp(value, "keep-alive", 10) == 0) {
+            req.keepAlive = true;
+        }
+    }
+}
+
+static bool pollHeaders(NetRequest& req, unsigned long now) {
+    WiFiClient& client = *connections[req.slot].client;
+    int available = client.available();
+    if (available <= 0) {
+        if (!client.connected()) return retryOrFail(req, NET_ERR_CLOSED);
+        if (now - req.lastProgress > req.timeoutMs) {
+            failRequest(req, NET_ERR_TIMEOUT);
+            return true;
+        }
+        return false;
+    }
+
+    if (!req.statusSeen && req.lineLen == 0) {
+        req.timings.ttfbMs = now - req.phaseStart;
+    }
+
+    // Consume up to one line per step
+    while (available-- > 0) {
+        char c = client.read();
+        if (c == '\r') continue;
+        if (c == '\n') {
+            req.lastProgress = now;
+            handleHeaderLine(req);
+            return true;
+        }
+        if (req.lineLen < sizeof(req.line) - 1) {
+            req.line[req.lineLen++] = c;
+        }
+    }
+    req.lastProgress = now;
+    return true;
+}
+
+/**
+ * Consume one byte of chunked framing
+ * @return false if the framing is malformed
+ */
+static bool readChunkFraming(NetRequest& req, char c) {
+    if (c == '\r') return true;
+
+    switch (req.chunkState) {
+        case NET_CHUNK_SIZE:
+            if (c != '\n') {
+                if (req.lineLen < sizeof(req.line) - 1) req.line[req.lineLen++] = c;
+                return true;
+            }
+            req.line[req.lineLen] = '\0';
+            {
+                char* end;
+                req.chunkLeft = strtoul(req.line, &end, 16);  // Stops at any ";extension"
+                if (end == req.line) return false;
+            }
+            req.lineLen = 0;
+            req.chunkState = req.chunkLeft ? NET_CHUNK_DATA : NET_CHUNK_TRAILER;
+            return true;
+
+        case NET_CHUNK_DATA_END:
+            if (c != '\n') return false;
+            req.chunkState = NET_CHUNK_SIZE;
+            return true;
+
+        case NET_CHUNK_TRAILER:
+            if (c != '\n') {
+                req.lineLen = 1;  // Only whether the line is empty matters
+                return true;
+            }
+            if (req.lineLen == 0) {
+                setPhase(req, NET_DONE);  // Blank line ends the trailer
+            }
+            req.lineLen = 0;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+NetRequest::~NetRequest() {
+    netEnd(*this);
+}
+
+/**
+ * Start a GET request
+ */
+void netBegin(NetRequest& req, const char* host, uint16_t port, const String& path,
+              bool secure, uint32_t timeoutMs) {
+    netEnd(req);  // Reusing the object for another request
+
+    req.error = NET_ERR_NONE;
+    req.status = 0;
+    req.contentLength = -1;
+    req.bodyRead = 0;
+    req.timings = {};
+    req.secure = secure;
+    req.port = port;
+    req.timeoutMs = timeoutMs;
+    req.sent = 0;
+    req.lineLen = 0;
+    req.statusSeen = false;
+    req.keepAlive = false;
+    req.chunked = false;
+    req.chunkState = NET_CHUNK_SIZE;
+    req.chunkLeft = 0;
+    req.retried = false;
+    req.started = millis();
+
+    req.request = "GET " + path + " HTTP/1.1\r\n";
+    req.request += "Host: ";
+    req.request += host;
+    req.request += "\r\n";
+    req.request += "User-Agent: EpicWeatherBox/" FIRMWARE_VERSION "\r\n";
+    req.request += "Connection: keep-alive\r\n\r\n";
+
+    req.host = acquireHost(host);
+    if (req.host < 0) {
+        failRequest(req, NET_ERR_BUSY);
+        return;
+    }
+    if (WiFi.status() != WL_CONNECTED) {
+        failRequest(req, NET_ERR_WIFI);
+        return;
+    }
+    setPhase(req, NET_RESOLVE);
+}
+
+/**
+ * Advance a request through DNS, connect, send and response headers
+ */
+bool netPoll(NetRequest& req) {
+    unsigned long now = millis();
+    switch (req.phase) {
+        case NET_RESOLVE: return pollResolve(req, now);
+        case NET_CONNECT: return pollConnect(req, now);
+        case NET_SEND:    return pollSend(req, now);
+        case NET_HEADERS: return pollHeaders(req, now);
+        default:          return false;
+    }
+}
+
+/**
+ * Read body bytes, decoding chunked transfer encoding
+ */
+int netRead(NetRequest& req, uint8_t* buffer, size_t length) {
+    if (req.phase != NET_BODY) return -1;
+
+    if (!req.chunked && req.contentLength >= 0 && req.bodyRead >= req.contentLength) {
+        setPhase(req, NET_DONE);
+        return -1;
+    }
+
+    WiFiClient& client = *connections[req.slot].client;
+    unsigned long now = millis();
+
+    while (true) {
+        int available = client.available();
+        if (available <= 0) {
+            if (!client.connected()) {
+                if (!req.chunked && req.contentLength < 0) {
+                    setPhase(req, NET_DONE);  // Server closed the connection - end of body
+                } else {
+                    failRequest(req, NET_ERR_CLOSED);
+                }
+                return -1;
+            }
+            if (now - req.lastProgress > req.timeoutMs) {
+                failRequest(req, NET_ERR_TIMEOUT);
+                return -1;
+            }
+            return 0;
+        }
+        req.lastProgress = now;
+
+        if (req.chunked && req.chunkState != NET_CHUNK_DATA) {
+            if (!readChunkFraming(req, client.read())) {
+                failRequest(req, NET_ERR_PROTOCOL);
+                return -1;
+            }
+            if (req.phase == NET_DONE) return -1;
+            continue;
+        }
+
+        size_t want = length;
+        if (req.chunked) {
+            want = min(want, (size_t)req.chunkLeft);
+        } else if (req.contentLength >= 0) {
+            want = min(want, (size_t)(req.contentLength - req.bodyRead));
+        }
+        int n = client.read(buffer, min(want, (size_t)available));
+        if (n <= 0) return 0;
+        req.bodyRead += n;
+        if (req.chunked) {
+            req.chunkLeft -= n;
+            if (req.chunkLeft == 0) req.chunkState = NET_CHUNK_DATA_END;
+        }
+        return n;
+    }
+}
+
+/**
+ * Finish a request, keeping the connection alive when possible
+ */
+void netEnd(NetRequest& req) {
+    if (req.host < 0) return;
+
+    NetHost& host = hosts[req.host];
+    unsigned long now = millis();
+
+    if (req.slot >= 0) {
+        NetConnection& conn = connections[req.slot];
+        if (req.phase == NET_DONE && req.keepAlive && !req.secure && conn.client->connected()) {
+            conn.busy = false;
+            conn.idleSince = now;
+        } else {
+            closeConnection(req.slot);
+        }
+        req.slot = -1;
+    }
+
+    // Requests abandoned before a response (or on a bad status) count too
+    if (req.phase >= NET_BODY) {
+        req.timings.totalMs = now - req.started;
+        host.requests++;
+        host.last = req.timings;
+        if (req.timings.reused) host.reused++;
+        if (req.phase == NET_FAILED) {
+            host.failures++;
+            Serial.printf("[NET] %s: %s after %u ms\n", host.name, netErrorToString(req.error),
+                          req.timings.totalMs);
+        } else {
+            Serial.printf("[NET] %s: HTTP %d, dns %u ms%s, connect %u ms%s, ttfb %u ms, total %u ms\n",
+                          host.name, req.status,
+                          req.timings.dnsMs, req.timings.dnsCached ? " (cached)" : "",
+                          req.timings.connectMs, req.timings.reused ? " (reused)" : "",
+                          req.timings.ttfbMs, req.timings.totalMs);
+        }
+    }
+
+    host.users--;
+    host.lastUsed = now;
+    req.host = -1;
+    req.request = String();
+}
+
+/**
+ * Blocking GET of a whole response body
+ */
+int netGet(const char* host, uint16_t port, const String& path, String& body,
+           bool secure, uint32_t timeoutMs) {
+    NetRequest req;
+    netBegin(req, host, port, path, secure, timeoutMs);
+    while (req.phase < NET_BODY) {
+        if (!netPoll(req)) yield();
+    }
+
+    body = String();
+    if (req.phase == NET_BODY) {
+        if (req.contentLength > 0) body.reserve(req.contentLength);
+        uint8_t buffer[128];
+        int n;
+        while ((n = netRead(req, buffer, sizeof(buffer))) >= 0) {
+            if (n == 0) {
+                yield();
+                continue;
+            }
+            body.concat((const char*)buffer, n);
+        }
+    }
+
+    int result = req.phase == NET_DONE ? req.status : -(int)req.error;
+    netEnd(req);
+    return result;
+}
+
+/**
+ * Number of hosts with request stats
+ */
+uint8_t getNetHostCount() {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < NET_MAX_HOSTS; i++) {
+        if (hosts[i].name[0]) count++;
+    }
+    return count;
+}
+
+/**
+ * Get request stats for a host
+ */
+NetHostStats getNetHostStats(uint8_t index) {
+    for (uint8_t i = 0; i < NET_MAX_HOSTS; i++) {
+        if (!hosts[i].name[0]) continue;
+        if (index-- == 0) {
+            const NetHost& host = hosts[i];
+            return {host.name, host.requests, host.reused, host.dnsHits, host.failures,
+                    host.blockingConnects, host.maxBlockingUs, host.last};
+        }
+    }
+    return {"", 0, 0, 0, 0, 0, 0, {}};
+}
+
+/**
+ * Microseconds spent blocked in TLS connects since the last call
+ */
+uint32_t netTakeBlockingUs() {
+    uint32_t us = blockingUs;
+    blockingUs = 0;
+    return us;
+}
@@ -0,0 +1,212 @@
+/**
+ * EpicWeatherBox Firmware - Outbound HTTP Client
+ *
+ * One HTTP/1.1 client shared by every outbound API call (weather, geocoding,
+ * YouTube). Keeps a keep-alive connection per host when the server allows it,
+ * caches DNS answers, and records DNS/connect/TTFB timings for each request.
+ */
+
+#ifndef NET_H
+#define NET_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+// =============================================================================
+// NETWORK CONFIGURATION
+// =============================================================================
+
+// Hosts tracked at once (DNS cache entries and per-host stats)
+#define NET_MAX_HOSTS 4
+
+// Open connections at once (in use or kept alive)
+#define NET_MAX_CONNECTIONS 3
+
+// Kept-alive connections idle longer than this are closed (milliseconds)
+#define NET_KEEPALIVE_IDLE_MS (30 * 1000)
+
+// How long a DNS answer is reused (milliseconds). lwIP doesn't hand the
+// record's own TTL to callers, so answers are kept for this long, and dropped
+// early if connecting to the cached address fails.
+#define NET_DNS_TTL_MS (10 * 60 * 1000)
+
+// Plain TCP connect timeout (milliseconds). The connect is polled, so this
+// bounds how long a request waits, not how long loop() is held up.
+#define NET_CONNECT_TIMEOUT_MS 2000
+
+// Default response timeout (milliseconds)
+#define NET_DEFAULT_TIMEOUT_MS 10000
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/**
+ * Request phases - netPoll() steps a request through these
+ */
+enum NetPhase : uint8_t {
+    NET_IDLE = 0,
+    NET_RESOLVE,        // Waiting on asynchronous DNS
+    NET_CONNECT,        // Opening (or reusing) the connection
+    NET_SEND,           // Writing the request as the socket has room
+    NET_HEADERS,        // Reading response headers
+    NET_BODY,           // Headers done - read the body with netRead()
+    NET_DONE,           // Body fully read
+    NET_FAILED          // See NetRequest::error
+};
+
+/**
+ * Request error codes - messages come from netErrorToString()
+ */
+enum NetError : uint8_t {
+    NET_ERR_NONE = 0,
+    NET_ERR_WIFI,           // WiFi not connected
+    NET_ERR_DNS,            // Lookup failed
+    NET_ERR_DNS_TIMEOUT,    // No DNS answer in time
+    NET_ERR_CONNECT,        // TCP/TLS connect failed
+    NET_ERR_BUSY,           // Every connection slot is in use
+    NET_ERR_SEND_TIMEOUT,   // Request couldn't be written
+    NET_ERR_TIMEOUT,        // No response in time
+    NET_ERR_CLOSED,         // Server closed before the response was complete
+    NET_ERR_PROTOCOL,       // Malformed response framing
+    NET_ERR_COUNT
+};
+
+/**
+ * Where the time of one request went
+ */
+struct NetTimings {
+    uint32_t dnsMs;         // Lookup time (0 when answered from the cache)
+    uint32_t connectMs;     // TCP (+TLS) connect time (0 when a connection was reused)
+    uint32_t ttfbMs;        // Request sent to first response byte
+    uint32_t totalMs;       // netBegin() to netEnd()
+    bool dnsCached;         // Address came from the DNS cache
+    bool reused;            // Sent on a kept-alive connection
+};
+
+/**
+ * One HTTP GET in flight
+ * Start with netBegin(), advance with netPoll() until phase reaches NET_BODY,
+ * read the body with netRead(), then release with netEnd().
+ */
+struct NetRequest {
+    // Result
+    uint8_t phase = NET_IDLE;
+    uint8_t error = NET_ERR_NONE;
+    int status = 0;             // HTTP status (0 until the status line arrives)
+    int32_t contentLength = -1; // -1 when the server sends no Content-Length
+    int32_t bodyRead = 0;       // Body bytes returned by netRead()
+    NetTimings timings = {};
+
+    // Connection
+    int8_t host = -1;           // Host table entry
+    int8_t slot = -1;           // Connection slot while one is held
+    bool secure = false;
+    uint16_t port = 0;
+    uint32_t timeoutMs = NET_DEFAULT_TIMEOUT_MS;
+
+    // Request and response framing
+    String request;
+    size_t sent = 0;
+    char line[96];              // Current header / chunk-size line
+    uint8_t lineLen = 0;
+    bool statusSeen = false;
+    bool keepAlive = false;     // Server lets the connection be reused
+    bool chunked = false;
+    uint8_t chunkState = 0;
+    uint32_t chunkLeft = 0;
+    bool retried = false;       // Already retried after a stale kept-alive connection
+
+    unsigned long started = 0;
+    unsigned long phaseStart = 0;
+    unsigned long lastProgress = 0;
+
+    ~NetRequest();
+};
+
+/**
+ * Per-host request counters and the timings of the latest request
+ */
+struct NetHostStats {
+    const char* host;
+    uint32_t requests;      // Requests completed or failed
+    uint32_t reused;        // Sent on a kept-alive connection
+    uint32_t dnsHits;       // Lookups answered from the DNS cache
+    uint32_t failures;      // Requests that ended in a NetError
+    uint32_t blockingConnects;  // TLS connects, which block in place
+    uint32_t maxBlockingUs;     // Longest of them
+    NetTimings last;        // Most recent request
+};
+
+// =============================================================================
+// FUNCTION DECLARATIONS
+// =============================================================================
+
+/**
+ * Start a GET request
+ * Never blocks; errors surface as phase NET_FAILED from netPoll().
+ *
+ * @param secure Use TLS (certificate not validated). TLS connections are
+ *               closed after each request to give BearSSL's buffers back,
+ *               and their handshake blocks netPoll() - see netTakeBlockingUs().
+ */
+void netBegin(NetRequest& req, const char* host, uint16_t port, const String& path,
+              bool secure = false, uint32_t timeoutMs = NET_DEFAULT_TIMEOUT_MS);
+
+/**
+ * Advance a request through DNS, connect, send and response headers
+ * @return true if more work can be done right away, false if waiting on I/O
+ */
+bool netPoll(NetRequest& req);
+
+/**
+ * Read body bytes (chunked transfer encoding is decoded)
+ * @return bytes read, 0 if none are available yet, -1 at the end of the
+ *         body (phase NET_DONE) or on error (phase NET_FAILED)
+ */
+int netRead(NetRequest& req, uint8_t* buffer, size_t length);
+
+/**
+ * Finish a request, keeping the connection for the next request to the same
+ * host if the body was fully read and the server allows it. Safe to call twice.
+ */
+void netEnd(NetRequest& req);
+
+/**
+ * Blocking GET of a whole response body
+ * For web handlers and other callers that can wait on the network.
+ *
+ * @return HTTP status, or -NetError if the request failed
+ */
+int netGet(const char* host, uint16_t port, const String& path, String& body,
+           bool secure = false, uint32_t timeoutMs = NET_DEFAULT_TIMEOUT_MS);
+
+/**
+ * Close kept-alive connections that went idle or were closed by the server
+ * Call in loop()
+ */
+void updateNet();
+
+/**
+ * Get printable message for a NetError
+ */
+const char* netErrorToString(uint8_t error);
+
+/**
+ * Number of hosts with request stats
+ */
+uint8_t getNetHostCount();
+
+/**
+ * Get request stats for a host (0 .. getNetHostCount() - 1)
+ */
+NetHostStats getNetHostStats(uint8_t index);
+
+/**
+ * Microseconds spent blocked in TLS connects since the last call
+ * The TLS handshake is the one request step that still runs in place;
+ * callers timing their own work take it out with this.
+ */
+uint32_t netTakeBlockingUs();
+
+#endif // NET_H
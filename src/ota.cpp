@@ -6,12 +6,17 @@
  */
 
 #include "ota.h"
+#include "live.h"
 #include <ESP8266mDNS.h>
+#include <Updater.h>
 
 // State tracking
 static bool otaInProgress = false;
 static ESP8266HTTPUpdateServer httpUpdateServer;
 
+// Bytes between OTA progress events on the live channel
+#define OTA_LIVE_PROGRESS_STEP (16 * 1024)
+
 // Store HTML in PROGMEM to save RAM
 static const char OTA_UPDATE_HTML[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
@@ -261,11 +266,13 @@ void initArduinoOTA(const char* hostname) {
             type = "filesystem";
         }
         Serial.println("\n[OTA] Starting " + type + " update...");
+        liveSendf("{\"type\":\"ota\",\"state\":\"start\",\"target\":\"%s\"}", type.c_str());
     });
 
     ArduinoOTA.onEnd([]() {
         otaInProgress = false;
         Serial.println("\n[OTA] Update complete! Rebooting...");
+        liveSendf("{\"type\":\"ota\",\"state\":\"end\"}");
     });
 
     ArduinoOTA.onProgress([](unsigned int progress, unsigned int total) {
@@ -279,6 +286,7 @@ void initArduinoOTA(const char* hostname) {
 
     ArduinoOTA.onError([](ota_error_t error) {
         otaInProgress = false;
+        liveSendf("{\"type\":\"ota\",\"state\":\"error\",\"error\":%u}", (unsigned)error);
         Serial.printf("[OTA] Error[%u]: ", error);
         switch (error) {
             case OTA_AUTH_ERROR:
@@ -327,6 +335,17 @@ void initWebOTA(ESP8266WebServer* server) {
     httpUpdateServer.setup(server, OTA_UPDATE_PATH);
     #endif
 
+    // Progress of both web and ArduinoOTA uploads to the live channel. For web
+    // uploads total is the space reserved, not the image size.
+    Update.onProgress([](size_t written, size_t total) {
+        static size_t lastSent = 0;
+        if (written < lastSent || written - lastSent >= OTA_LIVE_PROGRESS_STEP || written == total) {
+            lastSent = written;
+            liveSendf("{\"type\":\"ota\",\"state\":\"progress\",\"written\":%u,\"total\":%u}",
+                      (unsigned)written, (unsigned)total);
+        }
+    });
+
     Serial.printf("[OTA] Web update available at http://%s%s\n",
                   WiFi.localIP().toString().c_str(), OTA_UPDATE_PATH);
 }
@@ -110,6 +110,11 @@ static ThemeColors customThemeLight;
 static const ThemeColors* currentDark = &CLASSIC_DARK;
 static const ThemeColors* currentLight = &CLASSIC_LIGHT;
 
+// Resolved colors - rebuilt when the theme or mode changes (paletteDirty) or
+// day/night flips
+static ThemePalette palette;
+static bool paletteDirty = true;
+
 // Icon colors (constant, not theme-dependent currently)
 // Dark mode icons
 static const uint16_t ICON_CLOUD_DARK_MODE = 0xFFFF;       // White cloud
@@ -152,6 +157,7 @@ static void updateCachedTheme() {
             currentLight = &CLASSIC_LIGHT;
             break;
     }
+    paletteDirty = true;
 }
 
 // =============================================================================
@@ -193,6 +199,7 @@ int getThemeMode() {
 void setThemeMode(int mode) {
     if (mode >= THEME_MODE_AUTO && mode <= THEME_MODE_LIGHT) {
         themeMode = mode;
+        paletteDirty = true;
         saveThemeConfig();
     }
 }
@@ -210,84 +217,79 @@ bool shouldUseDarkTheme() {
 // COLOR GETTERS
 // =============================================================================
 
-// Helper to get current colors based on dark/light mode
-static const ThemeColors& getCurrentColors() {
-    if (shouldUseDarkTheme()) {
-        if (activeTheme == THEME_CUSTOM) {
-            return customThemeDark;
-        }
-        // For built-in themes, we need to copy from PROGMEM
-        static ThemeColors tempDark;
-        copyThemeColors(tempDark, *currentDark);
-        return tempDark;
+// Resolve the palette for the dark or light variant of the active theme
+static void resolvePalette(bool dark) {
+    const ThemeColors* colors = dark ? currentDark : currentLight;
+    if (activeTheme == THEME_CUSTOM) {
+        palette.colors = *colors;
     } else {
-        if (activeTheme == THEME_CUSTOM) {
-            return customThemeLight;
-        }
-        static ThemeColors tempLight;
-        copyThemeColors(tempLight, *currentLight);
-        return tempLight;
+        // Built-in themes live in PROGMEM
+        copyThemeColors(palette.colors, *colors);
+    }
+
+    palette.iconCloud = dark ? ICON_CLOUD_DARK_MODE : ICON_CLOUD_LIGHT_MODE;
+    palette.iconCloudDark = dark ? ICON_CLOUD_STORM_DARK : ICON_CLOUD_STORM_LIGHT;
+    palette.iconSnow = dark ? ICON_SNOW_DARK_MODE : ICON_SNOW_LIGHT_MODE;
+    palette.iconRain = dark ? ICON_RAIN_DARK_MODE : ICON_RAIN_LIGHT_MODE;
+    palette.dark = dark;
+    palette.generation++;
+    paletteDirty = false;
+}
+
+const ThemePalette& getThemePalette() {
+    bool dark = shouldUseDarkTheme();
+    if (paletteDirty || dark != palette.dark) {
+        resolvePalette(dark);
     }
+    return palette;
 }
 
 uint16_t getThemeBg() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.bg;
+    return getThemePalette().colors.bg;
 }
 
 uint16_t getThemeCard() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.card;
+    return getThemePalette().colors.card;
 }
 
 uint16_t getThemeText() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.text;
+    return getThemePalette().colors.text;
 }
 
 uint16_t getThemeCyan() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.cyan;
+    return getThemePalette().colors.cyan;
 }
 
 uint16_t getThemeCyanOnCard() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.cyanOnCard;
+    return getThemePalette().colors.cyanOnCard;
 }
 
 uint16_t getThemeOrange() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.orange;
+    return getThemePalette().colors.orange;
 }
 
 uint16_t getThemeOrangeOnCard() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.orangeOnCard;
+    return getThemePalette().colors.orangeOnCard;
 }
 
 uint16_t getThemeBlue() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.blue;
+    return getThemePalette().colors.blue;
 }
 
 uint16_t getThemeBlueOnCard() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.blueOnCard;
+    return getThemePalette().colors.blueOnCard;
 }
 
 uint16_t getThemeGray() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.gray;
+    return getThemePalette().colors.gray;
 }
 
 uint16_t getThemeGrayOnCard() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.grayOnCard;
+    return getThemePalette().colors.grayOnCard;
 }
 
 uint16_t getThemeTextOnCard() {
-    const ThemeColors& colors = getCurrentColors();
-    return colors.textOnCard;
+    return getThemePalette().colors.textOnCard;
 }
 
 // =============================================================================
@@ -295,19 +297,19 @@ uint16_t getThemeTextOnCard() {
 // =============================================================================
 
 uint16_t getIconCloud() {
-    return shouldUseDarkTheme() ? ICON_CLOUD_DARK_MODE : ICON_CLOUD_LIGHT_MODE;
+    return getThemePalette().iconCloud;
 }
 
 uint16_t getIconCloudDark() {
-    return shouldUseDarkTheme() ? ICON_CLOUD_STORM_DARK : ICON_CLOUD_STORM_LIGHT;
+    return getThemePalette().iconCloudDark;
 }
 
 uint16_t getIconSnow() {
-    return shouldUseDarkTheme() ? ICON_SNOW_DARK_MODE : ICON_SNOW_LIGHT_MODE;
+    return getThemePalette().iconSnow;
 }
 
 uint16_t getIconRain() {
-    return shouldUseDarkTheme() ? ICON_RAIN_DARK_MODE : ICON_RAIN_LIGHT_MODE;
+    return getThemePalette().iconRain;
 }
 
 // =============================================================================
@@ -405,6 +407,7 @@ const ThemeColors& getCustomThemeLight() {
 // =============================================================================
 
 bool saveThemeConfig() {
+    bumpContentGeneration(CONTENT_THEMES);
     JsonDocument doc;
 
     doc["activeTheme"] = activeTheme;
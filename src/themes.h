@@ -57,6 +57,21 @@ struct ThemeColors {
     uint16_t grayOnCard;    // Secondary text on cards
 };
 
+/**
+ * Active colors, resolved for the current theme, mode and day/night state
+ * Re-resolved only when one of those changes; generation goes up each time,
+ * so anything cached from these colors can tell cheaply if it's out of date.
+ */
+struct ThemePalette {
+    ThemeColors colors;
+    uint16_t iconCloud;
+    uint16_t iconCloudDark;
+    uint16_t iconSnow;
+    uint16_t iconRain;
+    bool dark;              // Dark variant is active
+    uint32_t generation;
+};
+
 /**
  * Complete theme definition with dark and light variants
  */
@@ -111,6 +126,12 @@ bool shouldUseDarkTheme();
 // COLOR GETTERS (use active theme and mode)
 // =============================================================================
 
+/**
+ * Get the resolved palette
+ * Draw code can hold the reference for a whole frame.
+ */
+const ThemePalette& getThemePalette();
+
 /**
  * Get current background color
  */
@@ -7,10 +7,16 @@
 
 #include "weather.h"
 #include "config.h"
+#include "net.h"
 #include <ESP8266WiFi.h>
-#include <ESP8266HTTPClient.h>
-#include <WiFiClientSecure.h>
 #include <LittleFS.h>
+#include <JsonListener.h>
+#include <JsonStreamingParser.h>
+#include <NTPClient.h>
+#include <new>
+
+// NTP client lives in main.cpp - used to stamp fetches with wall-clock time
+extern NTPClient timeClient;
 
 // =============================================================================
 // STATIC DATA
@@ -73,6 +79,10 @@ static CustomScreenConfig customScreens[MAX_CUSTOM_SCREENS] = {
     {"", "", ""}
 };
 static uint8_t customScreenCount = 0;
+static uint32_t customScreenGeneration = 0;  // Bumped whenever any screen's text changes
+
+// Content generations (see bumpContentGeneration)
+static uint32_t contentGenerations[CONTENT_TYPE_COUNT] = {0};
 
 // YouTube stats
 static YouTubeConfig youtubeConfig = {"", "", false};
@@ -90,8 +100,6 @@ static ImageScreenConfig imageScreens[MAX_IMAGE_SCREENS] = {
 static uint8_t imageScreenCount = 0;
 static ImageScreenConfig emptyImageScreen = {"", false};
 
-// Timing
-static unsigned long lastUpdateTime = 0;
 static bool initialized = false;
 
 // Config file path
@@ -274,189 +282,1489 @@ const char* conditionToIcon(WeatherCondition condition, bool isDay) {
 }
 
 /**
- * Get day name from day of week (0 = Sunday)
+ * Get short day name from day of week (0 = Sunday)
+ */
+const char* dayOfWeekToString(uint8_t dayOfWeek) {
+    static const char* const days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+    return dayOfWeek < 7 ? days[dayOfWeek] : "???";
+}
+
+// Shared messages for WeatherError codes - one copy instead of a buffer per location
+static const char* const WEATHER_ERROR_STRINGS[WEATHER_ERR_COUNT] = {
+    "",
+    "WiFi not connected",
+    "DNS lookup failed",
+    "DNS timeout",
+    "Connect failed",
+    "Send timeout",
+    "Response timeout",
+    "Connection closed",
+    "HTTP error",
+    "JSON error: incomplete response",
+    "FlatBuffers error: unreadable message"
+};
+
+/**
+ * Get message for a WeatherError code
+ */
+const char* weatherErrorToString(uint8_t error) {
+    return error < WEATHER_ERR_COUNT ? WEATHER_ERROR_STRINGS[error] : "Unknown error";
+}
+
+/**
+ * Convert a decimal string to fixed-point tenths
+ */
+static int16_t parseTenths(const char* v) {
+    return (int16_t)lroundf(atof(v) * 10.0f);
+}
+
+// =============================================================================
+// UNITS
+// =============================================================================
+//
+// Weather is fetched and stored in one canonical unit system (tenths of °C,
+// tenths of km/h) whatever the display setting. Everything shown to the user
+// goes through the conversions below, so toggling units needs no refetch.
+
+/**
+ * Divide rounding half away from zero
+ */
+static int32_t roundDiv(int32_t value, int32_t divisor) {
+    return value >= 0 ? (value + divisor / 2) / divisor : (value - divisor / 2) / divisor;
+}
+
+/**
+ * Convert a canonical temperature to whole degrees in the display unit
+ */
+int16_t toDisplayTemperature(int16_t tenthsC) {
+    if (useCelsius) {
+        return roundDiv(tenthsC, 10);
+    }
+    // F = C * 9/5 + 32, worked in fiftieths of a degree to stay in integers
+    return roundDiv((int32_t)tenthsC * 9 + 1600, 50);
+}
+
+/**
+ * Convert a canonical temperature to the display unit (for the API)
+ */
+float toDisplayTemperatureExact(int16_t tenthsC) {
+    return useCelsius ? tenthsC / 10.0f : tenthsC * 0.18f + 32.0f;
+}
+
+/**
+ * Convert a canonical wind speed to the display unit (km/h or mph)
+ */
+float toDisplayWindSpeed(uint16_t tenthsKmh) {
+    return useCelsius ? tenthsKmh / 10.0f : tenthsKmh * 0.0621371f;
+}
+
+/**
+ * Get wind speed unit label for the display unit
  */
-static void getDayName(int dayOfWeek, char* buffer) {
-    const char* days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-    strcpy(buffer, days[dayOfWeek % 7]);
+const char* windSpeedUnit() {
+    return useCelsius ? "km/h" : "mph";
+}
+
+/**
+ * Recompute the whole-degree display values of one location
+ * Called after a fetch, a snapshot restore and a unit change, so the draw
+ * code only formats integers.
+ */
+static void refreshDisplayValues(WeatherData& data) {
+    data.current.displayTemperature = toDisplayTemperature(data.current.temperatureTenths);
+    for (uint8_t i = 0; i < data.forecastDays && i < WEATHER_FORECAST_DAYS; i++) {
+        ForecastDay& day = data.forecast[i];
+        day.displayMax = toDisplayTemperature(day.tempMaxTenths);
+        day.displayMin = toDisplayTemperature(day.tempMinTenths);
+    }
 }
 
 // =============================================================================
 // API FETCH
 // =============================================================================
 
+// Diagnostics for the most recent fetch (see getWeatherFetchStats)
+static WeatherFetchStats fetchStats = {};
+static uint32_t fetchHeapLow = 0;
+static unsigned long fetchStartTime = 0;
+
+/**
+ * Start collecting fetch diagnostics
+ */
+static void beginFetchStats(uint8_t locationsInRequest, bool flatbuffers) {
+    fetchStats.bytes = 0;
+    fetchStats.parseUs = 0;
+    fetchStats.flatbuffers = flatbuffers;
+    fetchStats.locations = locationsInRequest;
+    fetchStats.httpStatus = 0;
+    fetchStats.heapBefore = ESP.getFreeHeap();
+    fetchHeapLow = fetchStats.heapBefore;
+    fetchStartTime = millis();
+}
+
+/**
+ * Sample free heap - called at every point where the fetch may hold memory
+ */
+static void noteFetchHeap() {
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < fetchHeapLow) {
+        fetchHeapLow = freeHeap;
+    }
+}
+
+/**
+ * Finish collecting fetch diagnostics and log them
+ */
+static void endFetchStats(const NetTimings& timings) {
+    noteFetchHeap();
+    fetchStats.durationMs = millis() - fetchStartTime;
+    fetchStats.dnsMs = timings.dnsMs;
+    fetchStats.connectMs = timings.connectMs;
+    fetchStats.ttfbMs = timings.ttfbMs;
+    fetchStats.dnsCached = timings.dnsCached;
+    fetchStats.reused = timings.reused;
+    fetchStats.peakHeapUsed = fetchStats.heapBefore - fetchHeapLow;
+    fetchStats.refreshRequests++;
+    fetchStats.refreshNetworkMs += fetchStats.durationMs;
+    Serial.printf("[WEATHER] Fetch: %d location(s), %u bytes in %u ms, peak heap used %u bytes\n",
+                  fetchStats.locations, fetchStats.bytes, fetchStats.durationMs,
+                  fetchStats.peakHeapUsed);
+    Serial.printf("[WEATHER] Parse (%s): %u us, %u us per location\n",
+                  fetchStats.flatbuffers ? "flatbuffers" : "json", fetchStats.parseUs,
+                  fetchStats.locations ? fetchStats.parseUs / fetchStats.locations : 0);
+}
+
+/**
+ * Number of forecast days the configured screens render
+ * Only the current-weather screen (today's high/low/rain) needs daily data
+ * when forecast screens are off or no location is in the carousel.
+ */
+static uint8_t profileForecastDays() {
+    if (!showForecast) return 1;
+    for (uint8_t i = 0; i < carouselCount; i++) {
+        if (carousel[i].type == CAROUSEL_LOCATION) return WEATHER_FORECAST_DAYS;
+    }
+    return 1;
+}
+
 /**
- * Build Open-Meteo API URL
+ * Build Open-Meteo API request path for one or more locations
+ * Multiple coordinates are sent as comma-separated lists; Open-Meteo then
+ * answers with an array holding one result per location, in request order.
  */
-static String buildApiUrl(float lat, float lon) {
-    String url = WEATHER_API_URL;
-    url += "?latitude=" + String(lat, 4);
-    url += "&longitude=" + String(lon, 4);
-    url += "&current_weather=true";
-    url += "&daily=temperature_2m_max,temperature_2m_min,precipitation_sum,precipitation_probability_max,weathercode,windspeed_10m_max,sunrise,sunset";
-    url += useCelsius ? "&temperature_unit=celsius" : "&temperature_unit=fahrenheit";
-    url += "&windspeed_unit=mph";
-    url += "&precipitation_unit=inch";
+static String buildApiPath(const float* lats, const float* lons, int count, bool flatbuffers,
+                           uint8_t forecastDays) {
+    String url = WEATHER_API_PATH;
+    url += "?latitude=";
+    for (int i = 0; i < count; i++) {
+        if (i > 0) url += ',';
+        url += String(lats[i], 4);
+    }
+    url += "&longitude=";
+    for (int i = 0; i < count; i++) {
+        if (i > 0) url += ',';
+        url += String(lons[i], 4);
+    }
+    // Lean profile: only the daily series the screens draw, times as unix seconds
+    if (flatbuffers) {
+        // Variables come back in request order - see FB_CURRENT_* / FB_DAILY_*
+        url += "&format=flatbuffers";
+        url += "&current=temperature_2m,weather_code,wind_speed_10m,wind_direction_10m,is_day";
+        url += "&daily=temperature_2m_max,temperature_2m_min,precipitation_probability_max,weather_code,sunrise,sunset";
+    } else {
+        url += "&current_weather=true";
+        url += "&daily=temperature_2m_max,temperature_2m_min,precipitation_probability_max,weathercode,sunrise,sunset";
+        url += "&timeformat=unixtime";
+    }
+    // Units are left at Open-Meteo's metric defaults (°C, km/h) - see UNITS
     url += "&timezone=auto";
-    url += "&forecast_days=" + String(WEATHER_FORECAST_DAYS);
+    url += "&forecast_days=" + String(forecastDays);
     return url;
 }
 
 /**
- * Fetch weather for a specific location
+ * Get local day of week (0 = Sunday) from a unix time
  */
-bool fetchWeather(float lat, float lon, WeatherData& data) {
-    if (WiFi.status() != WL_CONNECTED) {
-        strncpy(data.lastError, "WiFi not connected", sizeof(data.lastError));
-        data.errorCount++;
-        return false;
+static uint8_t localDayOfWeek(int64_t unixTime, int32_t utcOffset) {
+    int64_t days = (unixTime + utcOffset) / 86400;
+    if ((unixTime + utcOffset) < 0 && (unixTime + utcOffset) % 86400) days--;
+    return (uint8_t)(((days + 4) % 7 + 7) % 7);  // 1970-01-01 was a Thursday
+}
+
+/**
+ * Get local minutes since midnight from a unix time
+ */
+static uint16_t localMinutesOfDay(int64_t unixTime, int32_t utcOffset) {
+    int64_t secondsOfDay = (unixTime + utcOffset) % 86400;
+    if (secondsOfDay < 0) secondsOfDay += 86400;
+    return (uint16_t)(secondsOfDay / 60);
+}
+
+/**
+ * Open-Meteo response listener
+ *
+ * Receives tokens from JsonStreamingParser while the body is still arriving
+ * and writes each field straight into the target WeatherData, so neither the
+ * raw payload nor a JsonDocument is ever held in RAM.
+ *
+ * A single-location response is one object; a multi-location response is an
+ * array of such objects, demultiplexed into targets[] in order.
+ */
+class OpenMeteoListener : public JsonListener {
+public:
+    /**
+     * Prepare for a new response
+     */
+    void begin(WeatherData* const* targetList, uint8_t count) {
+        targets = targetList;
+        targetCount = count;
+        startDocument();
+    }
+
+    /**
+     * True once every requested location was received in full
+     */
+    bool isComplete() const { return finished && completed == targetCount; }
+
+    void whitespace(char c) override {}
+
+    void startDocument() override {
+        depth = 0;
+        slot = -1;
+        data = nullptr;
+        section = SECTION_ROOT;
+        series = SERIES_NONE;
+        finished = false;
+        inBatch = false;
+        completed = 0;
+        currentKey[0] = '\0';
+    }
+
+    void key(String name) override {
+        strncpy(currentKey, name.c_str(), sizeof(currentKey) - 1);
+        currentKey[sizeof(currentKey) - 1] = '\0';
+    }
+
+    void startObject() override {
+        depth++;
+        if (depth == 1) {
+            // Next location result
+            slot++;
+            data = (slot < targetCount) ? targets[slot] : nullptr;
+            sawCurrent = false;
+            firstDayTime = 0;
+            sunriseTime = 0;
+            sunsetTime = 0;
+        } else if (depth == 2) {
+            if (strcmp(currentKey, "current_weather") == 0) {
+                section = SECTION_CURRENT;
+                sawCurrent = true;
+            } else if (strcmp(currentKey, "daily") == 0) {
+                section = SECTION_DAILY;
+            } else {
+                section = SECTION_OTHER;
+            }
+        }
     }
 
-    String url = buildApiUrl(lat, lon);
-    Serial.printf("[WEATHER] Fetching: %s\n", url.c_str());
+    void endObject() override {
+        depth--;
+        if (depth == 1) {
+            section = SECTION_ROOT;
+        } else if (depth == 0) {
+            finishLocation();
+            if (!inBatch) finished = true;
+        }
+    }
 
-    // Use regular WiFiClient for HTTP (saves RAM vs BearSSL)
-    WiFiClient client;
+    void startArray() override {
+        if (depth == 0) {
+            inBatch = true;
+            return;
+        }
+        index = 0;
+        series = (section == SECTION_DAILY && depth == 2) ? seriesForKey(currentKey) : SERIES_NONE;
+    }
 
-    HTTPClient http;
-    http.setTimeout(10000);  // 10 second timeout
+    void endArray() override {
+        if (depth == 0) {
+            finished = true;
+            return;
+        }
+        if (series == SERIES_TEMP_MAX && data) {
+            data->forecastDays = min((int)index, WEATHER_FORECAST_DAYS);
+        }
+        series = SERIES_NONE;
+    }
+
+    void value(String v) override {
+        if (!data) return;
+        if (series != SERIES_NONE) {
+            dailyValue(v.c_str());
+            index++;
+        } else if (section == SECTION_CURRENT && depth == 2) {
+            currentValue(v.c_str());
+        } else if (section == SECTION_ROOT && depth == 1) {
+            rootValue(v.c_str());
+        }
+    }
 
-    if (!http.begin(client, url)) {
-        strncpy(data.lastError, "HTTP begin failed", sizeof(data.lastError));
-        data.errorCount++;
-        Serial.println(F("[WEATHER] HTTP begin failed"));
-        return false;
+    void endDocument() override {
+        finished = true;
+    }
+
+private:
+    enum Section : uint8_t { SECTION_ROOT, SECTION_CURRENT, SECTION_DAILY, SECTION_OTHER };
+    enum Series : uint8_t {
+        SERIES_NONE, SERIES_TIME, SERIES_TEMP_MAX, SERIES_TEMP_MIN,
+        SERIES_PRECIP_PROB, SERIES_WEATHER_CODE, SERIES_SUNRISE, SERIES_SUNSET
+    };
+
+    static Series seriesForKey(const char* k) {
+        if (strcmp(k, "time") == 0) return SERIES_TIME;
+        if (strcmp(k, "temperature_2m_max") == 0) return SERIES_TEMP_MAX;
+        if (strcmp(k, "temperature_2m_min") == 0) return SERIES_TEMP_MIN;
+        if (strcmp(k, "precipitation_probability_max") == 0) return SERIES_PRECIP_PROB;
+        if (strcmp(k, "weathercode") == 0) return SERIES_WEATHER_CODE;
+        if (strcmp(k, "sunrise") == 0) return SERIES_SUNRISE;
+        if (strcmp(k, "sunset") == 0) return SERIES_SUNSET;
+        return SERIES_NONE;
+    }
+
+    /**
+     * Close out one location result, filling defaults for missing fields
+     */
+    void finishLocation() {
+        if (!data) return;
+        // Times arrive as unix seconds; the UTC offset may come before or after
+        // them, so local values are worked out once the whole object is in
+        int32_t offset = data->utcOffsetSeconds;
+        for (uint8_t i = 0; i < data->forecastDays; i++) {
+            data->forecast[i].dayOfWeek = localDayOfWeek(firstDayTime + (int64_t)i * 86400, offset);
+        }
+        data->sunriseMinutes = sunriseTime ? localMinutesOfDay(sunriseTime, offset) : 6 * 60;   // Default 6:00 AM
+        data->sunsetMinutes = sunsetTime ? localMinutesOfDay(sunsetTime, offset) : 18 * 60;    // Default 6:00 PM
+        if (sawCurrent) completed++;
+        data = nullptr;
+    }
+
+    void rootValue(const char* v) {
+        if (strcmp(currentKey, "latitude") == 0) {
+            data->latitude = atof(v);
+        } else if (strcmp(currentKey, "longitude") == 0) {
+            data->longitude = atof(v);
+        } else if (strcmp(currentKey, "timezone_abbreviation") == 0) {
+            strncpy(data->timezone, v, sizeof(data->timezone) - 1);
+            data->timezone[sizeof(data->timezone) - 1] = '\0';
+        } else if (strcmp(currentKey, "utc_offset_seconds") == 0) {
+            data->utcOffsetSeconds = atoi(v);
+        }
     }
 
-    int httpCode = http.GET();
+    void currentValue(const char* v) {
+        CurrentWeather& current = data->current;
+        if (strcmp(currentKey, "temperature") == 0) {
+            current.temperatureTenths = parseTenths(v);
+        } else if (strcmp(currentKey, "windspeed") == 0) {
+            current.windSpeedTenths = (uint16_t)max(0, (int)parseTenths(v));
+        } else if (strcmp(currentKey, "winddirection") == 0) {
+            current.windDirection = (uint16_t)atoi(v);
+        } else if (strcmp(currentKey, "weathercode") == 0) {
+            current.weatherCode = (uint8_t)atoi(v);
+        } else if (strcmp(currentKey, "is_day") == 0) {
+            current.isDay = atoi(v) != 0;
+        }
+        current.timestamp = millis();
+    }
+
+    void dailyValue(const char* v) {
+        // Times and sunrise/sunset are unix seconds (timeformat=unixtime); only
+        // the first day's are needed - later days follow at 86400 s steps
+        if (series == SERIES_TIME || series == SERIES_SUNRISE || series == SERIES_SUNSET) {
+            if (index == 0) {
+                int32_t t = atol(v);
+                if (series == SERIES_TIME) firstDayTime = t;
+                else if (series == SERIES_SUNRISE) sunriseTime = t;
+                else sunsetTime = t;
+            }
+            return;
+        }
 
-    if (httpCode != HTTP_CODE_OK) {
-        snprintf(data.lastError, sizeof(data.lastError), "HTTP error: %d", httpCode);
-        data.errorCount++;
-        Serial.printf("[WEATHER] HTTP error: %d\n", httpCode);
-        http.end();
-        return false;
+        if (index >= WEATHER_FORECAST_DAYS) return;
+        ForecastDay& day = data->forecast[index];
+        bool isNull = strcmp(v, "null") == 0;
+
+        switch (series) {
+            case SERIES_TEMP_MAX:
+                day.tempMaxTenths = isNull ? 0 : parseTenths(v);
+                break;
+            case SERIES_TEMP_MIN:
+                day.tempMinTenths = isNull ? 0 : parseTenths(v);
+                break;
+            case SERIES_PRECIP_PROB:
+                day.precipitationProb = isNull ? 0 : (uint8_t)constrain(atoi(v), 0, 100);
+                break;
+            case SERIES_WEATHER_CODE:
+                day.weatherCode = isNull ? 0 : (uint8_t)atoi(v);
+                break;
+            default:
+                break;
+        }
     }
 
-    String payload = http.getString();
-    http.end();
+    WeatherData* const* targets = nullptr;
+    uint8_t targetCount = 0;
+    WeatherData* data = nullptr;  // Location currently being filled
+    int8_t slot = -1;             // Index of that location in targets[]
+    char currentKey[32];          // Most recent object key
+    uint8_t depth = 0;            // Object nesting depth (location object = 1)
+    Section section = SECTION_ROOT;
+    Series series = SERIES_NONE;
+    uint16_t index = 0;           // Element index within the current daily array
+    uint8_t completed = 0;        // Locations received in full
+    bool inBatch = false;         // Response is an array of locations
+    bool finished = false;
+    bool sawCurrent = false;
+    int32_t firstDayTime = 0;     // Unix time of the first daily entry
+    int32_t sunriseTime = 0;      // Today's sunrise (unix time, 0 = missing)
+    int32_t sunsetTime = 0;       // Today's sunset (unix time, 0 = missing)
+};
 
-    Serial.printf("[WEATHER] Response size: %d bytes\n", payload.length());
+/**
+ * Record a failed fetch against every location in the request
+ * A failed batch isn't counted as an error for each location - the
+ * per-location retry that follows records the real outcome.
+ */
+static void failFetch(WeatherData* const* targets, uint8_t count, uint8_t error) {
+    for (uint8_t i = 0; i < count; i++) {
+        targets[i]->lastError = error;
+        targets[i]->httpStatus = error == WEATHER_ERR_HTTP ? fetchStats.httpStatus : 0;
+        if (count == 1 && targets[i]->errorCount < 255) {
+            targets[i]->errorCount++;
+        }
+    }
+}
 
-    // Parse JSON response
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, payload);
+// =============================================================================
+// FLATBUFFERS RESPONSE
+// =============================================================================
+//
+// With format=flatbuffers Open-Meteo sends one size-prefixed FlatBuffers
+// message per location (schema: open-meteo/sdk weather_api.fbs). Fields are
+// read in place by vtable slot; every offset is bounds-checked against the
+// message so a schema change or corrupt body fails the parse instead of
+// reading stray memory. Times are unix seconds, so no ISO strings are parsed.
+
+// WeatherApiResponse table slots
+#define FB_RESPONSE_LATITUDE 0
+#define FB_RESPONSE_LONGITUDE 1
+#define FB_RESPONSE_UTC_OFFSET 6
+#define FB_RESPONSE_TZ_ABBREVIATION 8
+#define FB_RESPONSE_CURRENT 9
+#define FB_RESPONSE_DAILY 10
+
+// VariablesWithTime table slots
+#define FB_SERIES_TIME 0
+#define FB_SERIES_INTERVAL 2
+#define FB_SERIES_VARIABLES 3
+
+// VariableWithValues table slots
+#define FB_VARIABLE_VALUE 2
+#define FB_VARIABLE_VALUES 3
+#define FB_VARIABLE_VALUES_INT64 4
+
+// Position of each variable in the current= and daily= request lists
+enum { FB_CURRENT_TEMP, FB_CURRENT_CODE, FB_CURRENT_WIND, FB_CURRENT_WIND_DIR, FB_CURRENT_IS_DAY };
+enum {
+    FB_DAILY_TEMP_MAX, FB_DAILY_TEMP_MIN, FB_DAILY_PRECIP_PROB,
+    FB_DAILY_CODE, FB_DAILY_SUNRISE, FB_DAILY_SUNSET
+};
 
-    if (error) {
-        snprintf(data.lastError, sizeof(data.lastError), "JSON error: %s", error.c_str());
-        data.errorCount++;
-        Serial.printf("[WEATHER] JSON parse error: %s\n", error.c_str());
-        return false;
+/**
+ * Bounds-checked view of one FlatBuffers message
+ * Any failed check clears ok; reads after that return 0.
+ */
+struct FbReader {
+    const uint8_t* buf;
+    uint32_t size;
+    bool ok;
+
+    bool has(uint32_t pos, uint32_t bytes) {
+        if (pos > size || bytes > size - pos) ok = false;
+        return ok;
+    }
+
+    uint16_t u16(uint32_t pos) {
+        return has(pos, 2) ? (uint16_t)(buf[pos] | (buf[pos + 1] << 8)) : 0;
+    }
+
+    uint32_t u32(uint32_t pos) {
+        return has(pos, 4) ? ((uint32_t)buf[pos] | ((uint32_t)buf[pos + 1] << 8) |
+                              ((uint32_t)buf[pos + 2] << 16) | ((uint32_t)buf[pos + 3] << 24)) : 0;
+    }
+
+    int64_t i64(uint32_t pos) {
+        return has(pos, 8) ? (int64_t)((uint64_t)u32(pos) | ((uint64_t)u32(pos + 4) << 32)) : 0;
     }
 
-    // Store location info
-    data.latitude = doc["latitude"] | lat;
-    data.longitude = doc["longitude"] | lon;
-
-    const char* tz = doc["timezone"];
-    if (tz) {
-        strncpy(data.timezone, tz, sizeof(data.timezone) - 1);
-    }
-
-    // Get UTC offset for time display
-    data.utcOffsetSeconds = doc["utc_offset_seconds"] | 0;
-
-    // Parse current weather
-    JsonObject current = doc["current_weather"];
-    if (current) {
-        data.current.temperature = current["temperature"] | 0.0f;
-        data.current.windSpeed = current["windspeed"] | 0.0f;
-        data.current.windDirection = current["winddirection"] | 0.0f;
-        data.current.weatherCode = current["weathercode"] | 0;
-        data.current.isDay = current["is_day"] | 1;
-        data.current.condition = weatherCodeToCondition(data.current.weatherCode);
-        data.current.timestamp = millis();
-    }
-
-    // Parse daily forecast
-    JsonObject daily = doc["daily"];
-    if (daily) {
-        JsonArray tempMax = daily["temperature_2m_max"];
-        JsonArray tempMin = daily["temperature_2m_min"];
-        JsonArray precip = daily["precipitation_sum"];
-        JsonArray precipProb = daily["precipitation_probability_max"];
-        JsonArray codes = daily["weathercode"];
-        JsonArray wind = daily["windspeed_10m_max"];
-        JsonArray times = daily["time"];
-
-        data.forecastDays = min((int)tempMax.size(), WEATHER_FORECAST_DAYS);
-
-        for (int i = 0; i < data.forecastDays; i++) {
-            data.forecast[i].tempMax = tempMax[i] | 0.0f;
-            data.forecast[i].tempMin = tempMin[i] | 0.0f;
-            data.forecast[i].precipitationSum = precip[i] | 0.0f;
-            data.forecast[i].precipitationProb = precipProb[i] | 0.0f;
-            data.forecast[i].windSpeedMax = wind[i] | 0.0f;
-            data.forecast[i].weatherCode = codes[i] | 0;
-            data.forecast[i].condition = weatherCodeToCondition(data.forecast[i].weatherCode);
-
-            // Parse date to get day name
-            const char* dateStr = times[i];
-            if (dateStr && strlen(dateStr) >= 10) {
-                // Date format: YYYY-MM-DD
-                // Simple calculation for day of week
-                int year, month, day;
-                sscanf(dateStr, "%d-%d-%d", &year, &month, &day);
-
-                // Zeller's formula for day of week
-                if (month < 3) {
-                    month += 12;
-                    year--;
+    float f32(uint32_t pos) {
+        uint32_t bits = u32(pos);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Find a table field; returns its position or 0 if absent
+     */
+    uint32_t field(uint32_t table, uint8_t slot) {
+        if (!table) return 0;
+        uint32_t vtable = table - (int32_t)u32(table);
+        if (!ok) return 0;
+        uint16_t vtableSize = u16(vtable);
+        uint32_t entry = 4 + slot * 2;
+        if (!ok || entry + 2 > vtableSize) return 0;  // Field newer than the writer
+        uint16_t offset = u16(vtable + entry);
+        return offset ? table + offset : 0;
+    }
+
+    /**
+     * Follow an offset field (table, vector or string); returns target or 0
+     */
+    uint32_t ref(uint32_t table, uint8_t slot) {
+        uint32_t pos = field(table, slot);
+        if (!pos) return 0;
+        uint32_t target = pos + u32(pos);
+        return has(target, 4) ? target : 0;
+    }
+
+    /**
+     * Get vector length, checking the elements fit in the message
+     */
+    uint32_t vectorLength(uint32_t vector, uint8_t elementSize) {
+        if (!vector) return 0;
+        uint32_t length = u32(vector);
+        return has(vector + 4, length * elementSize) ? length : 0;
+    }
+
+    /**
+     * Get table element of a vector of tables
+     */
+    uint32_t vectorTable(uint32_t vector, uint32_t index) {
+        uint32_t pos = vector + 4 + index * 4;
+        uint32_t target = pos + u32(pos);
+        return has(target, 4) ? target : 0;
+    }
+
+    float scalarFloat(uint32_t table, uint8_t slot) {
+        uint32_t pos = field(table, slot);
+        return pos ? f32(pos) : 0.0f;
+    }
+};
+
+/**
+ * Get the VariableWithValues table at a request-order position
+ */
+static uint32_t fbVariable(FbReader& fb, uint32_t series, uint8_t position) {
+    uint32_t variables = fb.ref(series, FB_SERIES_VARIABLES);
+    if (position >= fb.vectorLength(variables, 4)) {
+        fb.ok = false;
+        return 0;
+    }
+    return fb.vectorTable(variables, position);
+}
+
+/**
+ * Get one of a daily variable's float values (0 if missing or NaN)
+ */
+static float fbDailyFloat(FbReader& fb, uint32_t variable, uint32_t day) {
+    uint32_t values = fb.ref(variable, FB_VARIABLE_VALUES);
+    if (day >= fb.vectorLength(values, 4)) return 0.0f;
+    float value = fb.f32(values + 4 + day * 4);
+    return isnan(value) ? 0.0f : value;
+}
+
+/**
+ * Decode one location message into WeatherData
+ * @return false if the message doesn't match the expected layout
+ */
+static bool decodeFlatBufferLocation(const uint8_t* buf, uint32_t size, WeatherData& data) {
+    FbReader fb = {buf, size, true};
+    uint32_t root = fb.u32(0);
+    if (!fb.has(root, 4)) return false;
+
+    data.latitude = fb.scalarFloat(root, FB_RESPONSE_LATITUDE);
+    data.longitude = fb.scalarFloat(root, FB_RESPONSE_LONGITUDE);
+    uint32_t offsetPos = fb.field(root, FB_RESPONSE_UTC_OFFSET);
+    int32_t utcOffset = offsetPos ? (int32_t)fb.u32(offsetPos) : 0;
+    data.utcOffsetSeconds = utcOffset;
+
+    uint32_t tz = fb.ref(root, FB_RESPONSE_TZ_ABBREVIATION);
+    uint32_t tzLength = fb.vectorLength(tz, 1);
+    if (tzLength >= sizeof(data.timezone)) tzLength = sizeof(data.timezone) - 1;
+    memcpy(data.timezone, buf + tz + 4, tzLength);
+    data.timezone[tzLength] = '\0';
+
+    // Current conditions (single values)
+    uint32_t current = fb.ref(root, FB_RESPONSE_CURRENT);
+    if (!current) return false;
+    CurrentWeather& now = data.current;
+    now.temperatureTenths = (int16_t)lroundf(fb.scalarFloat(fbVariable(fb, current, FB_CURRENT_TEMP), FB_VARIABLE_VALUE) * 10.0f);
+    now.weatherCode = (uint8_t)fb.scalarFloat(fbVariable(fb, current, FB_CURRENT_CODE), FB_VARIABLE_VALUE);
+    now.windSpeedTenths = (uint16_t)lroundf(max(0.0f, fb.scalarFloat(fbVariable(fb, current, FB_CURRENT_WIND), FB_VARIABLE_VALUE)) * 10.0f);
+    now.windDirection = (uint16_t)fb.scalarFloat(fbVariable(fb, current, FB_CURRENT_WIND_DIR), FB_VARIABLE_VALUE);
+    now.isDay = fb.scalarFloat(fbVariable(fb, current, FB_CURRENT_IS_DAY), FB_VARIABLE_VALUE) != 0.0f;
+    now.timestamp = millis();
+
+    // Daily series - day i starts at time + i * interval
+    uint32_t daily = fb.ref(root, FB_RESPONSE_DAILY);
+    if (!daily) return false;
+    uint32_t timePos = fb.field(daily, FB_SERIES_TIME);
+    uint32_t intervalPos = fb.field(daily, FB_SERIES_INTERVAL);
+    int64_t startTime = timePos ? fb.i64(timePos) : 0;
+    int32_t interval = intervalPos ? (int32_t)fb.u32(intervalPos) : 86400;
+
+    uint32_t tempMax = fbVariable(fb, daily, FB_DAILY_TEMP_MAX);
+    uint32_t tempMin = fbVariable(fb, daily, FB_DAILY_TEMP_MIN);
+    uint32_t precipProb = fbVariable(fb, daily, FB_DAILY_PRECIP_PROB);
+    uint32_t code = fbVariable(fb, daily, FB_DAILY_CODE);
+    if (!fb.ok) return false;
+
+    uint32_t days = fb.vectorLength(fb.ref(tempMax, FB_VARIABLE_VALUES), 4);
+    if (days > WEATHER_FORECAST_DAYS) days = WEATHER_FORECAST_DAYS;
+    for (uint32_t i = 0; i < days; i++) {
+        ForecastDay& day = data.forecast[i];
+        day.dayOfWeek = localDayOfWeek(startTime + (int64_t)i * interval, utcOffset);
+        day.tempMaxTenths = (int16_t)lroundf(fbDailyFloat(fb, tempMax, i) * 10.0f);
+        day.tempMinTenths = (int16_t)lroundf(fbDailyFloat(fb, tempMin, i) * 10.0f);
+        day.precipitationProb = (uint8_t)constrain((int)fbDailyFloat(fb, precipProb, i), 0, 100);
+        day.weatherCode = (uint8_t)fbDailyFloat(fb, code, i);
+    }
+    data.forecastDays = days;
+
+    // Sunrise/sunset arrive as int64 unix times; only today's are kept
+    uint32_t sunrise = fb.ref(fbVariable(fb, daily, FB_DAILY_SUNRISE), FB_VARIABLE_VALUES_INT64);
+    uint32_t sunset = fb.ref(fbVariable(fb, daily, FB_DAILY_SUNSET), FB_VARIABLE_VALUES_INT64);
+    data.sunriseMinutes = fb.vectorLength(sunrise, 8) ? localMinutesOfDay(fb.i64(sunrise + 4), utcOffset) : 6 * 60;
+    data.sunsetMinutes = fb.vectorLength(sunset, 8) ? localMinutesOfDay(fb.i64(sunset + 4), utcOffset) : 18 * 60;
+
+    return fb.ok;
+}
+
+// =============================================================================
+// WEATHER SNAPSHOT
+// =============================================================================
+//
+// The last good weather for every location is kept on flash so screens have
+// something to show right after a power cut. Records are raw WeatherData
+// structs; recordSize in the header rejects snapshots from a firmware with a
+// different layout.
+
+static const char* WEATHER_CACHE_FILE = "/weather_cache.bin";
+static const char* WEATHER_CACHE_TEMP_FILE = "/weather_cache.tmp";
+
+#define WEATHER_CACHE_MAGIC 0x43425745  // "EWBC"
+#define WEATHER_CACHE_VERSION 5
+
+/**
+ * Snapshot file header
+ */
+struct WeatherCacheHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;    // sizeof(WeatherData) when written
+    uint8_t count;          // Records that follow
+    uint8_t reserved[3];
+    uint32_t epoch;         // NTP time of the newest fetch in the snapshot
+    uint32_t crc;           // CRC32 of all records
+};
+
+static uint32_t cacheCrc = 0;               // CRC of the snapshot on flash
+static unsigned long cacheLastWrite = 0;    // millis() of the last write
+static bool cacheWritten = false;           // Written at least once this boot
+
+/**
+ * Update a CRC32 (IEEE) with more bytes
+ */
+static uint32_t crc32Update(uint32_t crc, const void* data, size_t length) {
+    const uint8_t* p = (const uint8_t*)data;
+    crc = ~crc;
+    while (length--) {
+        crc ^= *p++;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * Copy a location's weather into a snapshot record
+ * Runtime-only fields are cleared so they neither reach flash nor change the CRC.
+ */
+static void toCacheRecord(const WeatherData& data, WeatherData& record) {
+    memcpy(&record, &data, sizeof(record));  // Bytewise, so struct padding is copied too
+    record.valid = true;
+    record.stale = false;
+    record.lastUpdate = 0;
+    record.current.timestamp = 0;
+    record.errorCount = 0;
+    record.lastError = WEATHER_ERR_NONE;
+    record.httpStatus = 0;
+}
+
+/**
+ * Get current NTP time, or 0 if the clock hasn't been set yet
+ */
+static uint32_t currentEpoch() {
+    unsigned long epoch = timeClient.getEpochTime();
+    return epoch > 1600000000UL ? epoch : 0;  // Before 2020 = not synced
+}
+
+/**
+ * Check if a snapshot record belongs to a location
+ * Open-Meteo snaps coordinates to its model grid, so they never match exactly.
+ */
+static bool isRecordForLocation(const WeatherData& record, const WeatherLocation& loc) {
+    return strncmp(record.locationName, loc.name, sizeof(record.locationName)) == 0 &&
+           fabsf(record.latitude - loc.latitude) < 0.1f &&
+           fabsf(record.longitude - loc.longitude) < 0.1f;
+}
+
+/**
+ * Read record r of an open snapshot
+ */
+static bool readCacheRecord(File& file, uint8_t r, WeatherData& record) {
+    return file.seek(sizeof(WeatherCacheHeader) + r * sizeof(WeatherData)) &&
+           file.read((uint8_t*)&record, sizeof(record)) == sizeof(record);
+}
+
+/**
+ * Open the snapshot and check its header and CRC
+ * @return The open file, or a closed File if it is missing or unusable
+ */
+static File openWeatherSnapshot(WeatherCacheHeader& header) {
+    File file = LittleFS.open(WEATHER_CACHE_FILE, "r");
+    if (!file) {
+        return file;
+    }
+
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != WEATHER_CACHE_MAGIC ||
+        header.version != WEATHER_CACHE_VERSION ||
+        header.recordSize != sizeof(WeatherData) ||
+        header.count > MAX_WEATHER_LOCATIONS ||
+        file.size() != sizeof(header) + header.count * sizeof(WeatherData)) {
+        file.close();
+        Serial.println(F("[WEATHER] Snapshot missing or from another firmware, ignoring"));
+        return File();
+    }
+
+    WeatherData record;
+    uint32_t crc = 0;
+    for (uint8_t r = 0; r < header.count; r++) {
+        file.read((uint8_t*)&record, sizeof(record));
+        crc = crc32Update(crc, &record, sizeof(record));
+    }
+    if (crc != header.crc) {
+        file.close();
+        Serial.println(F("[WEATHER] Snapshot CRC mismatch, ignoring"));
+        return File();
+    }
+    return file;
+}
+
+/**
+ * Write every location's last good weather to the snapshot
+ * Locations with data in memory (fresh, or restored and not yet refreshed)
+ * are written from it. Locations without any - after a config change wiped
+ * them, say - keep the record already on flash, so a failed refresh never
+ * loses a location's weather; only records for removed locations are
+ * dropped. The new snapshot goes to a temporary file that replaces the old
+ * one once complete.
+ * Skipped when nothing changed since the last write, and rate limited to
+ * WEATHER_CACHE_WRITE_INTERVAL_MS to keep flash wear down.
+ */
+static void saveWeatherSnapshot() {
+    if (cacheWritten && (millis() - cacheLastWrite) < WEATHER_CACHE_WRITE_INTERVAL_MS) {
+        return;
+    }
+
+    WeatherCacheHeader previous;
+    File old = openWeatherSnapshot(previous);
+
+    WeatherCacheHeader header = {};
+    header.magic = WEATHER_CACHE_MAGIC;
+    header.version = WEATHER_CACHE_VERSION;
+    header.recordSize = sizeof(WeatherData);
+
+    // One record at a time keeps the stack small
+    WeatherData record;
+    int8_t carried[MAX_WEATHER_LOCATIONS];  // Record on flash kept for each location, -1 = none
+    uint32_t crc = 0;
+    for (int i = 0; i < locationCount; i++) {
+        carried[i] = -1;
+        if (weatherData[i].valid) {
+            toCacheRecord(weatherData[i], record);
+        } else {
+            for (uint8_t r = 0; old && r < previous.count; r++) {
+                if (readCacheRecord(old, r, record) && isRecordForLocation(record, locations[i])) {
+                    carried[i] = r;
+                    break;
                 }
-                int dow = (day + 13*(month+1)/5 + year + year/4 - year/100 + year/400) % 7;
-                // Convert from Zeller (0=Sat) to standard (0=Sun)
-                dow = (dow + 6) % 7;
-                getDayName(dow, data.forecast[i].dayName);
-            } else {
-                strcpy(data.forecast[i].dayName, "???");
             }
+            if (carried[i] < 0) continue;
+        }
+        crc = crc32Update(crc, &record, sizeof(record));
+        header.count++;
+        if (record.fetchEpoch > header.epoch) {
+            header.epoch = record.fetchEpoch;
+        }
+    }
+    header.crc = crc;
+
+    if (header.count == 0 || (cacheCrc != 0 && crc == cacheCrc)) {
+        if (header.count > 0) Serial.println(F("[WEATHER] Snapshot unchanged, skipping write"));
+        if (old) old.close();
+        return;
+    }
+
+    File file = LittleFS.open(WEATHER_CACHE_TEMP_FILE, "w");
+    if (!file) {
+        if (old) old.close();
+        Serial.println(F("[WEATHER] Failed to open snapshot for writing"));
+        return;
+    }
+
+    bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    for (int i = 0; ok && i < locationCount; i++) {
+        if (weatherData[i].valid) {
+            toCacheRecord(weatherData[i], record);
+        } else if (carried[i] < 0 || !readCacheRecord(old, carried[i], record)) {
+            continue;
+        }
+        ok = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+    }
+    file.close();
+    if (old) old.close();
+
+    if (!ok || !LittleFS.rename(WEATHER_CACHE_TEMP_FILE, WEATHER_CACHE_FILE)) {
+        // Don't leave a truncated snapshot behind
+        LittleFS.remove(WEATHER_CACHE_TEMP_FILE);
+        Serial.println(F("[WEATHER] Snapshot write failed"));
+        return;
+    }
+
+    cacheCrc = crc;
+    cacheLastWrite = millis();
+    cacheWritten = true;
+    Serial.printf("[WEATHER] Snapshot saved: %d location(s), %u bytes\n",
+                  header.count, sizeof(header) + header.count * sizeof(WeatherData));
+}
+
+/**
+ * Load the snapshot into matching locations, marked stale
+ * A record matches a location with the same name and nearby coordinates.
+ * @return Number of locations restored
+ */
+static int loadWeatherSnapshot() {
+    WeatherCacheHeader header;
+    File file = openWeatherSnapshot(header);
+    if (!file) {
+        return 0;
+    }
+
+    // Restore records into matching locations
+    WeatherData record;
+    int restored = 0;
+    file.seek(sizeof(header));
+    for (uint8_t r = 0; r < header.count; r++) {
+        file.read((uint8_t*)&record, sizeof(record));
+        record.locationName[sizeof(record.locationName) - 1] = '\0';
+
+        for (int i = 0; i < locationCount; i++) {
+            if (isRecordForLocation(record, locations[i])) {
+                weatherData[i] = record;
+                weatherData[i].stale = true;
+                refreshDisplayValues(weatherData[i]);
+                restored++;
+                break;
+            }
+        }
+    }
+    file.close();
+
+    cacheCrc = header.crc;
+    Serial.printf("[WEATHER] Restored %d location(s) from snapshot (epoch %u)\n",
+                  restored, header.epoch);
+    return restored;
+}
+
+/**
+ * Check if weather restored from the snapshot is available
+ */
+bool hasCachedWeather() {
+    for (int i = 0; i < locationCount; i++) {
+        if (weatherData[i].valid) return true;
+    }
+    return false;
+}
+
+// =============================================================================
+// FETCH ENGINE
+// =============================================================================
+//
+// A refresh runs as a state machine advanced from loop() by updateWeather().
+// Each call does at most WEATHER_SLICE_BUDGET_US of work and never waits on
+// the network: the request is stepped through the shared HTTP client (net.h),
+// which resolves DNS asynchronously, writes only when the socket has room and
+// reads only bytes that are already available. Results are parsed into a
+// staging copy and committed in one step, so screens never see a half-parsed
+// location.
+
+/**
+ * Work for one refresh - allocated when a refresh starts, freed when it ends
+ */
+struct FetchJob {
+    // Refresh plan
+    uint8_t slots[MAX_WEATHER_LOCATIONS];   // weatherData index of each enabled location
+    uint8_t slotCount;
+    bool fallback;          // Batch failed - fetching one location at a time
+    uint8_t nextSlot;       // Next slot to fetch in fallback mode
+    bool anyFailed;
+    uint8_t forecastDays;   // Query profile for this refresh
+    unsigned long refreshStart;
+
+    // Current request (covers slots first .. first+count-1)
+    uint8_t first;
+    uint8_t count;
+    WeatherData staging[MAX_WEATHER_LOCATIONS];
+    WeatherData* targets[MAX_WEATHER_LOCATIONS];
+    NetRequest http;
+    uint8_t rx[128];        // Body bytes waiting to be parsed
+    uint8_t rxLen;
+
+    // JSON body
+    JsonStreamingParser parser;
+    OpenMeteoListener listener;
+
+    // FlatBuffers body: [uint32 size][message] per location
+    bool flatbuffers;       // Current request asked for FlatBuffers
+    uint8_t* fbMessage = nullptr;  // WEATHER_FB_MAX_MESSAGE bytes, allocated on first use
+    uint8_t fbPrefix[4];
+    uint8_t fbPrefixLen;
+    uint32_t fbSize;        // Size of the message being collected
+    uint32_t fbFill;        // Bytes of it collected so far
+    uint8_t fbDecoded;      // Locations decoded
+
+    ~FetchJob() { delete[] fbMessage; }
+};
+
+static FetchJob* fetchJob = nullptr;
+static uint8_t fetchState = FETCH_IDLE;
+static bool refreshRequested = false;
+static WeatherEngineStats engineStats = {};
+static bool flatbuffersFailed = false;   // Use JSON for the rest of the session
+
+static const char* const FETCH_STATE_NAMES[FETCH_STATE_COUNT] = {
+    "idle", "resolve", "connect", "send", "headers", "body", "parse", "commit"
+};
+
+/**
+ * Get printable name for a fetch engine state
+ */
+const char* weatherFetchStateName(uint8_t state) {
+    return state < FETCH_STATE_COUNT ? FETCH_STATE_NAMES[state] : "?";
+}
+
+static void setFetchState(uint8_t state) {
+    fetchState = state;
+    engineStats.state = state;
+}
+
+/**
+ * Map an HTTP client error to the weather error shown for a location
+ */
+static uint8_t netToWeatherError(uint8_t error) {
+    switch (error) {
+        case NET_ERR_WIFI:         return WEATHER_ERR_WIFI;
+        case NET_ERR_DNS:          return WEATHER_ERR_DNS;
+        case NET_ERR_DNS_TIMEOUT:  return WEATHER_ERR_DNS_TIMEOUT;
+        case NET_ERR_SEND_TIMEOUT: return WEATHER_ERR_SEND_TIMEOUT;
+        case NET_ERR_TIMEOUT:      return WEATHER_ERR_TIMEOUT;
+        case NET_ERR_CLOSED:       return WEATHER_ERR_CLOSED;
+        case NET_ERR_PROTOCOL:     return WEATHER_ERR_JSON;
+        default:                   return WEATHER_ERR_CONNECT;
+    }
+}
+
+/**
+ * Fetch engine state matching the phase of the HTTP request in flight
+ */
+static uint8_t fetchStateForPhase(uint8_t phase) {
+    switch (phase) {
+        case NET_CONNECT: return FETCH_CONNECT;
+        case NET_SEND:    return FETCH_SEND;
+        case NET_HEADERS: return FETCH_HEADERS;
+        default:          return FETCH_RESOLVE;
+    }
+}
+
+/**
+ * Start the HTTP request for slots first .. first+count-1
+ */
+static void beginRequest(uint8_t first, uint8_t count) {
+    FetchJob& job = *fetchJob;
+    job.first = first;
+    job.count = count;
+
+    float lats[MAX_WEATHER_LOCATIONS];
+    float lons[MAX_WEATHER_LOCATIONS];
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t index = job.slots[first + i];
+        // Staging starts as a copy so fields the response doesn't carry survive
+        job.staging[i] = weatherData[index];
+        job.staging[i].latitude = locations[index].latitude;
+        job.staging[i].longitude = locations[index].longitude;
+        job.targets[i] = &job.staging[i];
+        lats[i] = locations[index].latitude;
+        lons[i] = locations[index].longitude;
+    }
+
+    // FlatBuffers needs a message buffer; without one the request goes out as JSON
+    job.flatbuffers = WEATHER_USE_FLATBUFFERS && !flatbuffersFailed;
+    if (job.flatbuffers && !job.fbMessage) {
+        job.fbMessage = new (std::nothrow) uint8_t[WEATHER_FB_MAX_MESSAGE];
+        job.flatbuffers = job.fbMessage != nullptr;
+    }
+
+    String path = buildApiPath(lats, lons, count, job.flatbuffers, job.forecastDays);
+    Serial.printf("[WEATHER] Fetching: http://%s%s\n", WEATHER_API_HOST, path.c_str());
+
+    job.rxLen = 0;
+    job.parser.reset();
+    job.parser.setListener(&job.listener);
+    job.listener.begin(job.targets, count);
+    job.fbPrefixLen = 0;
+    job.fbSize = 0;
+    job.fbFill = 0;
+    job.fbDecoded = 0;
+
+    beginFetchStats(count, job.flatbuffers);
+    netBegin(job.http, WEATHER_API_HOST, WEATHER_API_PORT, path, false, WEATHER_HTTP_TIMEOUT_MS);
+    setFetchState(FETCH_RESOLVE);
+}
+
+/**
+ * Delay before retrying a location that has failed errorCount times in a row
+ */
+static uint32_t retryDelay(uint8_t errorCount) {
+    if (errorCount == 0) return 0;
+
+    uint32_t delayMs = WEATHER_RETRY_BASE_MS;
+    for (uint8_t i = 1; i < errorCount && delayMs < WEATHER_RETRY_MAX_MS; i++) {
+        delayMs *= 2;
+    }
+    return min(delayMs, (uint32_t)WEATHER_RETRY_MAX_MS);
+}
+
+/**
+ * Set a location's next fetch delayMs from now, give or take the jitter
+ */
+static void scheduleLocation(WeatherLocation& loc, unsigned long now, uint32_t delayMs) {
+    long jitter = (long)(delayMs / 100 * WEATHER_UPDATE_JITTER_PERCENT);
+    loc.nextDue = now + delayMs + random(-jitter, jitter + 1);
+    if (loc.nextDue == 0) loc.nextDue = 1;  // 0 means due now
+}
+
+/**
+ * Check if a location's next fetch is due
+ */
+static bool isLocationDue(const WeatherLocation& loc, unsigned long now) {
+    return loc.nextDue == 0 || (long)(now - loc.nextDue) >= 0;
+}
+
+/**
+ * Schedule the next fetch of every location the refresh covered
+ * Successful locations fetched together are spread across the interval so
+ * they come due one at a time from then on; the k-th of n is brought forward
+ * by k/n of the interval, so none waits longer than the interval. Failed
+ * locations back off by their consecutive error count.
+ */
+static void scheduleRefreshed(const FetchJob& job) {
+    unsigned long now = millis();
+    uint32_t step = WEATHER_UPDATE_INTERVAL_MS / job.slotCount;
+    uint8_t spread = 0;
+
+    for (uint8_t k = 0; k < job.slotCount; k++) {
+        uint8_t slot = job.slots[k];
+        WeatherLocation& loc = locations[slot];
+        uint8_t errors = weatherData[slot].errorCount;
+
+        loc.forecastDays = job.forecastDays;
+        if (errors == 0) {
+            scheduleLocation(loc, now, WEATHER_UPDATE_INTERVAL_MS - spread++ * step);
+        } else {
+            scheduleLocation(loc, now, retryDelay(errors));
+            Serial.printf("[WEATHER] %s: %u error(s), retrying in %u s\n",
+                          loc.name, errors, (unsigned)((loc.nextDue - now) / 1000));
         }
+    }
+}
+
+/**
+ * Start the next request of the refresh, or finish the refresh
+ */
+static void nextRequestOrFinish() {
+    FetchJob& job = *fetchJob;
+
+    if (job.fallback && job.nextSlot < job.slotCount) {
+        uint8_t slot = job.nextSlot++;
+        Serial.printf("[WEATHER] Fetching location: %s\n", weatherData[job.slots[slot]].locationName);
+        beginRequest(slot, 1);
+        return;
+    }
 
-        // Parse sunrise/sunset for today (index 0) - format: "2024-01-01T07:23"
-        const char* sunriseStr = daily["sunrise"][0];
-        const char* sunsetStr = daily["sunset"][0];
-        if (sunriseStr && strlen(sunriseStr) >= 16) {  // Need at least "YYYY-MM-DDTHH:MM"
-            int hour = 0, minute = 0;
-            sscanf(sunriseStr + 11, "%d:%d", &hour, &minute);
-            data.sunriseMinutes = (uint16_t)(hour * 60 + minute);
+    fetchStats.refreshMs = millis() - job.refreshStart;
+    Serial.printf("[WEATHER] Refresh took %u ms (%u ms on the network, %d request(s)), max slice %u us\n",
+                  fetchStats.refreshMs, fetchStats.refreshNetworkMs, fetchStats.refreshRequests,
+                  engineStats.maxSliceUs);
+
+    engineStats.lastRefreshOk = !job.anyFailed;
+    scheduleRefreshed(job);
+    bumpContentGeneration(CONTENT_WEATHER);
+    delete fetchJob;
+    fetchJob = nullptr;
+    setFetchState(FETCH_IDLE);
+
+    saveWeatherSnapshot();
+}
+
+/**
+ * End the current request
+ * A failed batch falls back to fetching each location on its own.
+ */
+static void finishRequest(bool success, uint8_t error = WEATHER_ERR_NONE) {
+    FetchJob& job = *fetchJob;
+    netEnd(job.http);
+    endFetchStats(job.http.timings);
+    bumpContentGeneration(CONTENT_WEATHER);
+
+    // Server or firmware can't handle the binary format - repeat as JSON
+    if (!success && job.flatbuffers &&
+        (error == WEATHER_ERR_FORMAT || (error == WEATHER_ERR_HTTP && fetchStats.httpStatus == 400))) {
+        Serial.println(F("[WEATHER] FlatBuffers response unusable, using JSON for this session"));
+        flatbuffersFailed = true;
+        beginRequest(job.first, job.count);
+        return;
+    }
+
+    if (!success) {
+        if (error == WEATHER_ERR_HTTP) {
+            Serial.printf("[WEATHER] Fetch failed: HTTP error: %d\n", fetchStats.httpStatus);
         } else {
-            data.sunriseMinutes = 6 * 60;  // Default 6:00 AM
+            Serial.printf("[WEATHER] Fetch failed: %s\n", weatherErrorToString(error));
+        }
+        WeatherData* live[MAX_WEATHER_LOCATIONS];
+        for (uint8_t i = 0; i < job.count; i++) {
+            live[i] = &weatherData[job.slots[job.first + i]];
         }
-        if (sunsetStr && strlen(sunsetStr) >= 16) {
-            int hour = 0, minute = 0;
-            sscanf(sunsetStr + 11, "%d:%d", &hour, &minute);
-            data.sunsetMinutes = (uint16_t)(hour * 60 + minute);
+        failFetch(live, job.count, error);
+
+        if (job.count > 1 && !job.fallback) {
+            Serial.println(F("[WEATHER] Batched fetch failed, falling back to per-location fetches"));
+            job.fallback = true;
+            job.nextSlot = 0;
         } else {
-            data.sunsetMinutes = 18 * 60;  // Default 6:00 PM
+            job.anyFailed = true;
         }
-        Serial.printf("[WEATHER] Sunrise: %d:%02d, Sunset: %d:%02d\n",
+    }
+
+    nextRequestOrFinish();
+}
+
+/**
+ * Copy the parsed results into the live weather data
+ */
+static void commitRequest() {
+    FetchJob& job = *fetchJob;
+    unsigned long now = millis();
+
+    for (uint8_t i = 0; i < job.count; i++) {
+        WeatherData& data = weatherData[job.slots[job.first + i]];
+        data = job.staging[i];
+        data.valid = true;
+        data.stale = false;
+        data.fetchEpoch = currentEpoch();
+        data.lastUpdate = now;
+        data.errorCount = 0;
+        data.lastError = WEATHER_ERR_NONE;
+        data.httpStatus = 0;
+        refreshDisplayValues(data);
+
+        Serial.printf("[WEATHER] %s: %.1f°C, %s, sunrise %d:%02d, sunset %d:%02d\n",
+                      data.locationName, data.current.temperature(),
+                      conditionToString(data.current.condition()),
                       data.sunriseMinutes / 60, data.sunriseMinutes % 60,
                       data.sunsetMinutes / 60, data.sunsetMinutes % 60);
     }
 
-    // Success!
-    data.valid = true;
-    data.lastUpdate = millis();
-    data.errorCount = 0;
-    data.lastError[0] = '\0';
+    finishRequest(true);
+}
+
+/**
+ * Feed received body bytes to the FlatBuffers message collector
+ * Each complete message is decoded into the next location's staging data.
+ * @return false if a message is too large, unexpected or unreadable
+ */
+static bool parseFlatBufferChunk(FetchJob& job) {
+    uint8_t pos = 0;
+    while (pos < job.rxLen) {
+        if (job.fbPrefixLen < 4) {
+            // Collecting the little-endian size prefix
+            job.fbPrefix[job.fbPrefixLen++] = job.rx[pos++];
+            if (job.fbPrefixLen == 4) {
+                job.fbSize = (uint32_t)job.fbPrefix[0] | ((uint32_t)job.fbPrefix[1] << 8) |
+                             ((uint32_t)job.fbPrefix[2] << 16) | ((uint32_t)job.fbPrefix[3] << 24);
+                job.fbFill = 0;
+                if (job.fbSize < 8 || job.fbSize > WEATHER_FB_MAX_MESSAGE || job.fbDecoded >= job.count) {
+                    Serial.printf("[WEATHER] FlatBuffers message %u: bad size %u\n", job.fbDecoded, job.fbSize);
+                    return false;
+                }
+            }
+            continue;
+        }
+
+        uint32_t take = min((uint32_t)(job.rxLen - pos), job.fbSize - job.fbFill);
+        memcpy(job.fbMessage + job.fbFill, job.rx + pos, take);
+        job.fbFill += take;
+        pos += take;
+
+        if (job.fbFill == job.fbSize) {
+            if (!decodeFlatBufferLocation(job.fbMessage, job.fbSize, *job.targets[job.fbDecoded])) {
+                Serial.printf("[WEATHER] FlatBuffers message %u: unexpected layout\n", job.fbDecoded);
+                return false;
+            }
+            job.fbDecoded++;
+            job.fbPrefixLen = 0;
+        }
+    }
+    return true;
+}
+
+/**
+ * Advance the fetch engine by one step
+ * @return true if more work can be done right away, false if waiting on I/O
+ */
+static bool advanceFetch() {
+    FetchJob& job = *fetchJob;
+
+    switch (fetchState) {
+        case FETCH_RESOLVE:
+        case FETCH_CONNECT:
+        case FETCH_SEND:
+        case FETCH_HEADERS: {
+            bool more = netPoll(job.http);
+            switch (job.http.phase) {
+                case NET_FAILED:
+                    finishRequest(false, netToWeatherError(job.http.error));
+                    return true;
+                case NET_BODY:
+                    fetchStats.httpStatus = job.http.status;
+                    if (job.http.status != 200) {
+                        finishRequest(false, WEATHER_ERR_HTTP);
+                        return true;
+                    }
+                    setFetchState(FETCH_BODY);
+                    return true;
+                default: {
+                    uint8_t state = fetchStateForPhase(job.http.phase);
+                    if (state != fetchState) setFetchState(state);
+                    return more;
+                }
+            }
+        }
+
+        case FETCH_BODY: {
+            int n = netRead(job.http, job.rx, sizeof(job.rx));
+            if (n < 0) {
+                if (job.http.phase == NET_DONE) {
+                    setFetchState(FETCH_COMMIT);
+                } else {
+                    finishRequest(false, netToWeatherError(job.http.error));
+                }
+                return true;
+            }
+            if (n == 0) return false;
+            job.rxLen = n;
+            fetchStats.bytes += n;
+            noteFetchHeap();
+            setFetchState(FETCH_PARSE);
+            return true;
+        }
+
+        case FETCH_PARSE: {
+            uint32_t parseStart = micros();
+            if (job.flatbuffers) {
+                if (!parseFlatBufferChunk(job)) {
+                    finishRequest(false, WEATHER_ERR_FORMAT);
+                    return true;
+                }
+            } else {
+                for (uint8_t i = 0; i < job.rxLen; i++) {
+                    job.parser.parse((char)job.rx[i]);
+                }
+            }
+            fetchStats.parseUs += micros() - parseStart;
+            job.rxLen = 0;
+            noteFetchHeap();
+            setFetchState(FETCH_BODY);
+            return true;
+        }
+
+        case FETCH_COMMIT:
+            Serial.printf("[WEATHER] Response size: %u bytes\n", fetchStats.bytes);
+            if (job.flatbuffers) {
+                if (job.fbDecoded != job.count || job.fbPrefixLen != 0) {
+                    finishRequest(false, WEATHER_ERR_FORMAT);
+                    return true;
+                }
+            } else if (!job.listener.isComplete()) {
+                finishRequest(false, WEATHER_ERR_JSON);
+                return true;
+            }
+            commitRequest();
+            return true;
+
+        default:
+            return false;
+    }
+}
 
-    Serial.printf("[WEATHER] Success! Temp: %.1f°F, Condition: %s\n",
-                  data.current.temperature,
-                  conditionToString(data.current.condition));
+/**
+ * Run the fetch engine for one bounded slice
+ * A TLS connect blocks in place; its time is counted as blocking rather than
+ * as slice work, and the slice ends after it so loop() gets to run.
+ */
+static void stepFetch() {
+    uint32_t sliceStart = micros();
+    uint32_t sliceBlockedUs = 0;
+    netTakeBlockingUs();  // Drop time blocked outside the engine
+
+    while (fetchJob) {
+        uint8_t state = fetchState;
+        uint32_t stepStart = micros();
+        bool more = advanceFetch();
+        uint32_t blockedUs = netTakeBlockingUs();
+        uint32_t stepUs = micros() - stepStart - blockedUs;
+        sliceBlockedUs += blockedUs;
+        if (stepUs > engineStats.stateMaxUs[state]) {
+            engineStats.stateMaxUs[state] = stepUs;
+        }
+        if (!more || blockedUs > 0 || micros() - sliceStart >= WEATHER_SLICE_BUDGET_US) break;
+    }
 
+    uint32_t sliceUs = micros() - sliceStart - sliceBlockedUs;
+    engineStats.lastSliceUs = sliceUs;
+    engineStats.slices++;
+    if (sliceUs > engineStats.maxSliceUs) {
+        engineStats.maxSliceUs = sliceUs;
+    }
+    if (sliceBlockedUs > 0) {
+        engineStats.blockingSlices++;
+        engineStats.lastBlockingUs = sliceBlockedUs;
+        if (sliceBlockedUs > engineStats.maxBlockingUs) {
+            engineStats.maxBlockingUs = sliceBlockedUs;
+        }
+    }
+}
+
+/**
+ * Start a refresh of the enabled locations that are due (or all of them)
+ * Due locations go out in one batched request; if that fails, each location
+ * is retried on its own so one bad result can't blank the rest.
+ */
+static bool startRefresh(bool all) {
+    if (fetchJob) return true;
+
+    unsigned long now = millis();
+    uint8_t profileDays = profileForecastDays();
+    uint8_t slots[MAX_WEATHER_LOCATIONS];
+    uint8_t slotCount = 0;
+    for (int i = 0; i < locationCount; i++) {
+        WeatherLocation& loc = locations[i];
+        if (!loc.enabled) continue;
+        // Forecast screens just got enabled - the last lean fetch only covered today
+        bool upgrade = loc.forecastDays > 0 && loc.forecastDays < profileDays;
+        if (all || upgrade || isLocationDue(loc, now)) {
+            slots[slotCount++] = i;
+        }
+    }
+
+    if (slotCount == 0) {
+        return false;  // Nothing due
+    }
+
+    FetchJob* job = new (std::nothrow) FetchJob();
+    if (!job) {
+        Serial.println(F("[WEATHER] Not enough memory to start a refresh"));
+        return false;
+    }
+
+    job->slotCount = slotCount;
+    for (uint8_t k = 0; k < slotCount; k++) {
+        uint8_t i = slots[k];
+        strncpy(weatherData[i].locationName, locations[i].name, sizeof(weatherData[i].locationName));
+        job->slots[k] = i;
+    }
+
+    Serial.printf("[WEATHER] Updating weather for %d location(s)...\n", job->slotCount);
+
+    job->fallback = false;
+    job->nextSlot = 0;
+    job->anyFailed = false;
+    job->forecastDays = profileDays;
+    job->refreshStart = millis();
+    fetchStats.refreshRequests = 0;
+    fetchStats.refreshNetworkMs = 0;
+
+    fetchJob = job;
+    beginRequest(0, job->slotCount);
     return true;
 }
 
+/**
+ * Abandon the refresh in flight
+ * The job holds slot indices captured when it started; once the location
+ * list is edited those point at different (or removed) locations, so its
+ * results must never be committed or scheduled. Locations it covered stay
+ * due and go out in the next refresh.
+ */
+static void cancelRefresh() {
+    if (!fetchJob) return;
+
+    Serial.println(F("[WEATHER] Location list changed, cancelling refresh in flight"));
+    netEnd(fetchJob->http);
+    delete fetchJob;
+    fetchJob = nullptr;
+    setFetchState(FETCH_IDLE);
+    bumpContentGeneration(CONTENT_WEATHER);
+}
+
+/**
+ * Get fetch engine state and slice timing
+ */
+const WeatherEngineStats& getWeatherEngineStats() {
+    return engineStats;
+}
+
+/**
+ * Get diagnostics for the most recent weather fetch
+ */
+const WeatherFetchStats& getWeatherFetchStats() {
+    return fetchStats;
+}
+
 // =============================================================================
 // PUBLIC API
 // =============================================================================
@@ -482,49 +1790,68 @@ void initWeather() {
         strncpy(weatherData[i].locationName, locations[i].name, sizeof(weatherData[i].locationName));
     }
 
+    // Last known weather, shown as stale until the first fetch lands
+    loadWeatherSnapshot();
+
     initialized = true;
     Serial.printf("[WEATHER] Initialized with %d location(s)\n", locationCount);
+    Serial.printf("[WEATHER] WeatherData: %u bytes x %d = %u bytes (%d forecast days), free heap %u\n",
+                  sizeof(WeatherData), MAX_WEATHER_LOCATIONS, sizeof(weatherData),
+                  WEATHER_FORECAST_DAYS, ESP.getFreeHeap());
 }
 
 /**
- * Update weather if interval has elapsed
+ * Advance the fetch engine, starting a refresh when one is due
  */
 bool updateWeather() {
     if (!initialized) {
         initWeather();
     }
 
-    unsigned long now = millis();
-
-    // Check if update is needed
-    if (lastUpdateTime > 0 && (now - lastUpdateTime) < WEATHER_UPDATE_INTERVAL_MS) {
-        return false;  // Not time yet
+    if (!fetchJob) {
+        bool all = refreshRequested;
+        refreshRequested = false;
+        if (!startRefresh(all)) {
+            return false;  // No location due yet
+        }
     }
 
-    return forceWeatherUpdate();
+    stepFetch();
+    return fetchJob != nullptr;
 }
 
 /**
- * Force immediate weather update
+ * Ask for a refresh on the next updateWeather() call
  */
-bool forceWeatherUpdate() {
-    Serial.printf("[WEATHER] Updating weather for %d location(s)...\n", locationCount);
+void requestWeatherUpdate() {
+    refreshRequested = true;
+}
 
-    bool success = true;
+/**
+ * Check if a refresh is in progress
+ */
+bool isWeatherUpdating() {
+    return fetchJob != nullptr;
+}
 
-    // Update all enabled locations
-    for (int i = 0; i < locationCount; i++) {
-        if (locations[i].enabled) {
-            strncpy(weatherData[i].locationName, locations[i].name, sizeof(weatherData[i].locationName));
-            Serial.printf("[WEATHER] Fetching location %d: %s\n", i, locations[i].name);
-            if (!fetchWeather(locations[i].latitude, locations[i].longitude, weatherData[i])) {
-                success = false;
-            }
-        }
+/**
+ * Refresh all locations now, blocking until done
+ * Used at boot where nothing else needs loop() yet.
+ */
+bool forceWeatherUpdate() {
+    if (!initialized) {
+        initWeather();
     }
 
-    lastUpdateTime = millis();
-    return success;
+    refreshRequested = false;
+    if (!startRefresh(true)) {
+        return false;
+    }
+    while (fetchJob) {
+        stepFetch();
+        yield();
+    }
+    return engineStats.lastRefreshOk;
 }
 
 // =============================================================================
@@ -568,12 +1895,16 @@ bool addLocation(const char* name, float lat, float lon) {
         return false;
     }
 
+    cancelRefresh();
+
     int idx = locationCount;
     // Normalize name to ASCII for TFT display (e.g., "Cancún" -> "Cancun")
     normalizeToAscii(locations[idx].name, name, sizeof(locations[idx].name));
     locations[idx].latitude = lat;
     locations[idx].longitude = lon;
     locations[idx].enabled = true;
+    locations[idx].nextDue = 0;
+    locations[idx].forecastDays = 0;
 
     // Clear weather data for new location
     memset(&weatherData[idx], 0, sizeof(WeatherData));
@@ -595,6 +1926,8 @@ bool removeLocation(int index) {
         return false;
     }
 
+    cancelRefresh();
+
     Serial.printf("[WEATHER] Removing location %d: %s\n", index, locations[index].name);
 
     // Shift all locations after this one down
@@ -621,11 +1954,15 @@ bool updateLocation(int index, const char* name, float lat, float lon) {
         return false;
     }
 
+    cancelRefresh();
+
     // Normalize name to ASCII for TFT display (e.g., "Cancún" -> "Cancun")
     normalizeToAscii(locations[index].name, name, sizeof(locations[index].name));
     locations[index].latitude = lat;
     locations[index].longitude = lon;
     locations[index].enabled = true;
+    locations[index].nextDue = 0;
+    locations[index].forecastDays = 0;
 
     // Update weather data location name and invalidate cache
     normalizeToAscii(weatherData[index].locationName, name, sizeof(weatherData[index].locationName));
@@ -639,11 +1976,15 @@ bool updateLocation(int index, const char* name, float lat, float lon) {
  * Clear all locations and reset to default
  */
 void clearLocations() {
+    cancelRefresh();
+
     // Reset to single default location
     strcpy(locations[0].name, "Seattle");
     locations[0].latitude = 47.6062;
     locations[0].longitude = -122.3321;
     locations[0].enabled = true;
+    locations[0].nextDue = 0;
+    locations[0].forecastDays = 0;
 
     // Clear remaining slots
     for (int i = 1; i < MAX_WEATHER_LOCATIONS; i++) {
@@ -658,6 +1999,20 @@ void clearLocations() {
     Serial.println(F("[WEATHER] Locations cleared, reset to default"));
 }
 
+/**
+ * Check if a location slot already holds this name and coordinates
+ */
+bool isSameLocation(int index, const char* name, float lat, float lon) {
+    if (index < 0 || index >= locationCount || !name) {
+        return false;
+    }
+    char normalized[sizeof(locations[index].name)];
+    normalizeToAscii(normalized, name, sizeof(normalized));
+    return strcmp(normalized, locations[index].name) == 0 &&
+           fabsf(locations[index].latitude - lat) < 0.0001f &&
+           fabsf(locations[index].longitude - lon) < 0.0001f;
+}
+
 // =============================================================================
 // LEGACY API (BACKWARD COMPATIBILITY)
 // =============================================================================
@@ -724,19 +2079,46 @@ bool isSecondaryLocationEnabled() {
  * Get time until next update
  */
 unsigned long getNextUpdateIn() {
-    if (lastUpdateTime == 0) return 0;
+    unsigned long next = WEATHER_UPDATE_INTERVAL_MS;
+    for (int i = 0; i < locationCount; i++) {
+        if (locations[i].enabled) {
+            next = min(next, getLocationNextUpdateIn(i));
+        }
+    }
+    return next;
+}
+
+/**
+ * Get time until a location's next scheduled fetch
+ */
+unsigned long getLocationNextUpdateIn(int index) {
+    if (index < 0 || index >= locationCount) return 0;
 
-    unsigned long elapsed = millis() - lastUpdateTime;
-    if (elapsed >= WEATHER_UPDATE_INTERVAL_MS) return 0;
+    unsigned long now = millis();
+    const WeatherLocation& loc = locations[index];
+    if (isLocationDue(loc, now)) return 0;
+    return loc.nextDue - now;
+}
 
-    return WEATHER_UPDATE_INTERVAL_MS - elapsed;
+/**
+ * Get the retry delay a location is backing off by
+ */
+uint32_t getLocationRetryDelay(int index) {
+    if (index < 0 || index >= locationCount) return 0;
+    return retryDelay(weatherData[index].errorCount);
 }
 
 /**
  * Set temperature unit
  */
 void setUseCelsius(bool celsius) {
+    if (celsius == useCelsius) return;
     useCelsius = celsius;
+
+    // Stored data is unit-independent - only the display values change
+    for (int i = 0; i < MAX_WEATHER_LOCATIONS; i++) {
+        refreshDisplayValues(weatherData[i]);
+    }
 }
 
 /**
@@ -996,6 +2378,7 @@ int addCustomScreenConfig(const char* header, const char* body, const char* foot
         customScreens[idx].footer[sizeof(customScreens[idx].footer) - 1] = '\0';
     }
     customScreenCount++;
+    customScreenGeneration++;
     Serial.printf("[CUSTOM] Added screen %d\n", idx);
     return idx;
 }
@@ -1016,6 +2399,7 @@ bool updateCustomScreenConfig(uint8_t index, const char* header, const char* bod
         strncpy(customScreens[index].footer, footer, sizeof(customScreens[index].footer) - 1);
         customScreens[index].footer[sizeof(customScreens[index].footer) - 1] = '\0';
     }
+    customScreenGeneration++;
     Serial.printf("[CUSTOM] Updated screen %d\n", index);
     return true;
 }
@@ -1033,10 +2417,27 @@ bool removeCustomScreenConfig(uint8_t index) {
     customScreens[customScreenCount].header[0] = '\0';
     customScreens[customScreenCount].body[0] = '\0';
     customScreens[customScreenCount].footer[0] = '\0';
+    customScreenGeneration++;
     Serial.printf("[CUSTOM] Removed screen at index %d, now %d screens\n", index, customScreenCount);
     return true;
 }
 
+uint32_t getCustomScreenGeneration() {
+    return customScreenGeneration;
+}
+
+uint32_t getContentGeneration(uint8_t type) {
+    return type < CONTENT_TYPE_COUNT ? contentGenerations[type] : 0;
+}
+
+/**
+ * Mark a kind of content changed
+ * Called where changes are committed: a finished fetch, a config save, etc.
+ */
+void bumpContentGeneration(uint8_t type) {
+    if (type < CONTENT_TYPE_COUNT) contentGenerations[type]++;
+}
+
 /**
  * Check if currently in night mode based on time
  * Supports special values: -1 = sunset, -2 = sunrise (from weather data)
@@ -1100,6 +2501,7 @@ bool isNightModeActive(int currentMinutes) {
  * Save weather configuration to LittleFS
  */
 bool saveWeatherConfig() {
+    bumpContentGeneration(CONTENT_CONFIG);
     JsonDocument doc;
 
     // Save locations as array
@@ -1384,6 +2786,7 @@ bool loadWeatherConfig() {
             }
             customScreenCount++;
         }
+        customScreenGeneration++;
         Serial.printf("[WEATHER] Loaded %d custom screens\n", customScreenCount);
     }
 
@@ -1428,46 +2831,59 @@ bool loadWeatherConfig() {
 // =============================================================================
 
 /**
- * Convert weather data to JSON for API response
+ * Write weather data as members of the JSON object being written
  */
-void weatherToJson(const WeatherData& data, JsonDocument& doc) {
-    doc["location"] = data.locationName;
-    doc["latitude"] = data.latitude;
-    doc["longitude"] = data.longitude;
-    doc["timezone"] = data.timezone;
-    doc["valid"] = data.valid;
-    doc["lastUpdate"] = data.lastUpdate;
+void weatherToJson(const WeatherData& data, JsonStream& json) {
+    json.add("location", data.locationName);
+    json.add("latitude", data.latitude, 5);
+    json.add("longitude", data.longitude, 5);
+    json.add("timezone", data.timezone);
+    json.add("valid", data.valid);
+    json.add("lastUpdate", data.lastUpdate);
+    json.add("stale", data.stale);
+    json.add("fetchEpoch", data.fetchEpoch);
 
     if (!data.valid) {
-        doc["error"] = data.lastError;
+        if (data.lastError == WEATHER_ERR_HTTP) {
+            char error[24];
+            snprintf(error, sizeof(error), "HTTP error: %u", data.httpStatus);
+            json.add("error", error);
+            json.add("httpStatus", data.httpStatus);
+        } else {
+            json.add("error", weatherErrorToString(data.lastError));
+        }
         return;
     }
 
     // Current weather
-    JsonObject current = doc["current"].to<JsonObject>();
-    current["temperature"] = data.current.temperature;
-    current["windSpeed"] = data.current.windSpeed;
-    current["windDirection"] = data.current.windDirection;
-    current["weatherCode"] = data.current.weatherCode;
-    current["condition"] = conditionToString(data.current.condition);
-    current["conditionShort"] = conditionToShortString(data.current.condition);
-    current["icon"] = conditionToIcon(data.current.condition, data.current.isDay);
-    current["isDay"] = data.current.isDay;
+    json.beginObject("current");
+    WeatherCondition condition = data.current.condition();
+    json.add("temperature", toDisplayTemperatureExact(data.current.temperatureTenths));
+    json.add("windSpeed", toDisplayWindSpeed(data.current.windSpeedTenths));
+    json.add("windUnit", windSpeedUnit());
+    json.add("windDirection", data.current.windDirection);
+    json.add("weatherCode", data.current.weatherCode);
+    json.add("condition", conditionToString(condition));
+    json.add("conditionShort", conditionToShortString(condition));
+    json.add("icon", conditionToIcon(condition, data.current.isDay));
+    json.add("isDay", data.current.isDay);
+    json.endObject();
 
     // Forecast
-    JsonArray forecast = doc["forecast"].to<JsonArray>();
+    json.beginArray("forecast");
     for (int i = 0; i < data.forecastDays; i++) {
-        JsonObject day = forecast.add<JsonObject>();
-        day["day"] = data.forecast[i].dayName;
-        day["tempMax"] = data.forecast[i].tempMax;
-        day["tempMin"] = data.forecast[i].tempMin;
-        day["precipitation"] = data.forecast[i].precipitationSum;
-        day["precipProbability"] = data.forecast[i].precipitationProb;
-        day["windSpeedMax"] = data.forecast[i].windSpeedMax;
-        day["weatherCode"] = data.forecast[i].weatherCode;
-        day["condition"] = conditionToString(data.forecast[i].condition);
-        day["icon"] = conditionToIcon(data.forecast[i].condition, true);
+        const ForecastDay& fd = data.forecast[i];
+        json.beginObject();
+        json.add("day", fd.dayName());
+        json.add("tempMax", toDisplayTemperatureExact(fd.tempMaxTenths));
+        json.add("tempMin", toDisplayTemperatureExact(fd.tempMinTenths));
+        json.add("precipProbability", fd.precipitationProb);
+        json.add("weatherCode", fd.weatherCode);
+        json.add("condition", conditionToString(fd.condition()));
+        json.add("icon", conditionToIcon(fd.condition(), true));
+        json.endObject();
     }
+    json.endArray();
 }
 
 // =============================================================================
@@ -1498,46 +2914,33 @@ static bool fetchYouTubeStats() {
         return false;
     }
 
-    // Build YouTube API URL
-    String url = "https://www.googleapis.com/youtube/v3/channels";
-    url += "?part=statistics,snippet";
-    url += "&forHandle=" + String(youtubeConfig.channelHandle);
-    url += "&key=" + String(youtubeConfig.apiKey);
-
-    Serial.printf("[YOUTUBE] Fetching: %s\n", url.c_str());
+    // Build YouTube API path
+    String path = "/youtube/v3/channels";
+    path += "?part=statistics,snippet";
+    path += "&forHandle=" + String(youtubeConfig.channelHandle);
+    path += "&key=" + String(youtubeConfig.apiKey);
 
-    // Use WiFiClientSecure for HTTPS
-    WiFiClientSecure client;
-    client.setInsecure();  // Skip certificate validation (OK for non-sensitive API calls)
-    client.setBufferSizes(512, 512);  // Reduce buffer sizes to save memory (default is 16KB each!)
-
-    HTTPClient http;
-    http.setTimeout(20000);  // 20 second timeout (HTTPS on ESP8266 is slow)
-    http.setReuse(false);    // Don't keep connection open
+    Serial.printf("[YOUTUBE] Fetching: https://%s%s\n", YOUTUBE_API_HOST, path.c_str());
 
     // Give the system some time to free up memory
     yield();
 
-    if (!http.begin(client, url)) {
-        strncpy(youtubeData.lastError, "HTTP begin failed", sizeof(youtubeData.lastError));
-        Serial.println(F("[YOUTUBE] HTTP begin failed"));
+    // HTTPS on ESP8266 is slow - allow 20 seconds
+    String payload;
+    int httpCode = netGet(YOUTUBE_API_HOST, 443, path, payload, true, 20000);
+
+    if (httpCode < 0) {
+        strncpy(youtubeData.lastError, netErrorToString(-httpCode), sizeof(youtubeData.lastError));
+        Serial.printf("[YOUTUBE] Request failed: %s\n", netErrorToString(-httpCode));
         return false;
     }
 
-    Serial.printf("[YOUTUBE] Free heap during request: %u bytes\n", ESP.getFreeHeap());
-
-    int httpCode = http.GET();
-
-    if (httpCode != HTTP_CODE_OK) {
+    if (httpCode != 200) {
         snprintf(youtubeData.lastError, sizeof(youtubeData.lastError), "HTTP error: %d", httpCode);
         Serial.printf("[YOUTUBE] HTTP error: %d\n", httpCode);
-        http.end();
         return false;
     }
 
-    String payload = http.getString();
-    http.end();
-
     Serial.printf("[YOUTUBE] Response size: %d bytes\n", payload.length());
 
     // Parse JSON response
@@ -1661,6 +3064,7 @@ bool forceYouTubeUpdate() {
     Serial.println(F("[YOUTUBE] Updating stats..."));
     bool success = fetchYouTubeStats();
     youtubeLastUpdateTime = millis();
+    bumpContentGeneration(CONTENT_YOUTUBE);
     return success;
 }
 
@@ -1726,6 +3130,7 @@ bool isYouTubeConfigured() {
  * Save YouTube config to LittleFS
  */
 bool saveYouTubeConfig() {
+    bumpContentGeneration(CONTENT_YOUTUBE);
     JsonDocument doc;
 
     doc["apiKey"] = youtubeConfig.apiKey;
@@ -1868,6 +3273,11 @@ bool removeImageScreenConfig(uint8_t index) {
             LittleFS.remove(imageScreens[index].filename);
             Serial.printf("[IMAGE] Deleted file: %s\n", imageScreens[index].filename);
         }
+        char rawPath[sizeof(imageScreens[index].filename)];
+        getImageRawPath(imageScreens[index].filename, rawPath, sizeof(rawPath));
+        if (LittleFS.exists(rawPath)) {
+            LittleFS.remove(rawPath);
+        }
     }
 
     // Shift items down
@@ -1917,3 +3327,49 @@ bool validateImageFile(const char* filename) {
     }
     return isJpeg;
 }
+
+bool getJpegInfo(const char* filename, uint16_t* width, uint16_t* height, bool* progressive) {
+    File f = LittleFS.open(filename, "r");
+    if (!f) return false;
+
+    bool found = false;
+    if (f.read() == 0xFF && f.read() == 0xD8) {
+        // Walk the marker segments up to the first SOF
+        while (f.available()) {
+            if (f.read() != 0xFF) break;
+            int marker = f.read();
+            while (marker == 0xFF) marker = f.read();  // Fill bytes
+            if (marker < 0 || marker == 0xD9 || marker == 0xDA) break;  // EOI, SOS
+            if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) continue;  // No length
+
+            int hi = f.read();
+            int lo = f.read();
+            if (hi < 0 || lo < 0) break;
+            int length = (hi << 8) | lo;
+            if (length < 2) break;
+
+            // SOF0-SOF15, except DHT (C4), JPG (C8) and DAC (CC)
+            if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+                uint8_t sof[5];  // Precision, height, width
+                if (f.read(sof, sizeof(sof)) != sizeof(sof)) break;
+                *height = (sof[1] << 8) | sof[2];
+                *width = (sof[3] << 8) | sof[4];
+                *progressive = (marker == 0xC2 || marker == 0xC6 || marker == 0xCA || marker == 0xCE);
+                found = (*width > 0 && *height > 0);
+                break;
+            }
+            if (!f.seek(length - 2, SeekCur)) break;
+        }
+    }
+    f.close();
+    return found;
+}
+
+void getImageRawPath(const char* filename, char* path, size_t len) {
+    strncpy(path, filename, len - 1);
+    path[len - 1] = '\0';
+    char* ext = strrchr(path, '.');
+    size_t base = ext ? (size_t)(ext - path) : strlen(path);
+    if (base + 5 > len) base = len - 5;
+    strcpy(path + base, ".565");
+}
@@ -10,6 +10,7 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include "json_stream.h"
 
 // =============================================================================
 // WEATHER CONFIGURATION
@@ -17,13 +18,41 @@
 
 // Open-Meteo API endpoint (free, no API key needed!)
 // Using HTTP instead of HTTPS for ESP8266 compatibility (saves ~20KB RAM)
-#define WEATHER_API_URL "http://api.open-meteo.com/v1/forecast"
+#define WEATHER_API_HOST "api.open-meteo.com"
+#define WEATHER_API_PORT 80
+#define WEATHER_API_PATH "/v1/forecast"
 
 // Update interval (milliseconds) - 20 minutes default
 #define WEATHER_UPDATE_INTERVAL_MS (20 * 60 * 1000)
 
-// Maximum forecast days supported
-#define WEATHER_FORECAST_DAYS 7
+// Each location is refreshed on its own schedule. Locations fetched together
+// are spread across the interval, and every delay is nudged by up to
+// +/- WEATHER_UPDATE_JITTER_PERCENT so devices don't hit the API in lockstep.
+#define WEATHER_UPDATE_JITTER_PERCENT 5
+
+// Retry delay after a failed fetch, doubling per consecutive error (milliseconds)
+#define WEATHER_RETRY_BASE_MS (30 * 1000)
+#define WEATHER_RETRY_MAX_MS WEATHER_UPDATE_INTERVAL_MS
+
+// Forecast days fetched and kept per location (Open-Meteo allows up to 16)
+#define WEATHER_FORECAST_DAYS 16
+
+// HTTP timeout for weather requests (milliseconds)
+#define WEATHER_HTTP_TIMEOUT_MS 10000
+
+// Most work the fetch engine may do per updateWeather() call (microseconds)
+#define WEATHER_SLICE_BUDGET_US 3000
+
+// Ask Open-Meteo for FlatBuffers (1) instead of JSON (0). Binary messages are
+// read by offset with no text parsing; JSON is used for the rest of the session
+// if a FlatBuffers response can't be read.
+#define WEATHER_USE_FLATBUFFERS 1
+
+// Largest single-location FlatBuffers message accepted (bytes)
+#define WEATHER_FB_MAX_MESSAGE 2048
+
+// Minimum time between weather snapshot writes to flash (milliseconds)
+#define WEATHER_CACHE_WRITE_INTERVAL_MS (60 * 60 * 1000)
 
 // Maximum number of locations supported
 #define MAX_WEATHER_LOCATIONS 5
@@ -162,37 +191,79 @@ enum WeatherCondition {
     WEATHER_UNKNOWN
 };
 
+/**
+ * Convert WMO weather code to simplified condition
+ */
+WeatherCondition weatherCodeToCondition(int code);
+
+/**
+ * Get short day name ("Sun".."Sat") for a day of week (0 = Sunday)
+ */
+const char* dayOfWeekToString(uint8_t dayOfWeek);
+
+/**
+ * Get message for a WeatherError code
+ */
+const char* weatherErrorToString(uint8_t error);
+
 // =============================================================================
 // DATA STRUCTURES
 // =============================================================================
 
+/**
+ * Fetch error codes - messages come from weatherErrorToString()
+ */
+enum WeatherError : uint8_t {
+    WEATHER_ERR_NONE = 0,
+    WEATHER_ERR_WIFI,           // WiFi not connected
+    WEATHER_ERR_DNS,            // Lookup failed
+    WEATHER_ERR_DNS_TIMEOUT,    // No DNS answer in time
+    WEATHER_ERR_CONNECT,        // TCP connect failed
+    WEATHER_ERR_SEND_TIMEOUT,   // Request couldn't be written
+    WEATHER_ERR_TIMEOUT,        // No response in time
+    WEATHER_ERR_CLOSED,         // Server closed before the body
+    WEATHER_ERR_HTTP,           // Non-200 status (see WeatherFetchStats::httpStatus)
+    WEATHER_ERR_JSON,           // Response incomplete or malformed
+    WEATHER_ERR_FORMAT,         // FlatBuffers message unreadable or too large
+    WEATHER_ERR_COUNT
+};
+
 /**
  * Current weather conditions
+ * Values are packed fixed-point in canonical metric units (°C, km/h);
+ * convert with toDisplayTemperature() / toDisplayWindSpeed() for display.
  */
 struct CurrentWeather {
-    float temperature;          // Current temperature
-    float apparentTemperature;  // "Feels like" temperature
-    float windSpeed;            // Wind speed
-    float windDirection;        // Wind direction in degrees
-    float precipitation;        // Precipitation amount
-    int weatherCode;            // WMO weather code
-    WeatherCondition condition; // Simplified condition category
+    int16_t temperatureTenths;  // Current temperature, tenths of °C
+    int16_t displayTemperature; // Whole degrees in the display unit (see refreshDisplayValues)
+    uint16_t windSpeedTenths;   // Wind speed, tenths of km/h
+    uint16_t windDirection;     // Wind direction in degrees
+    uint8_t weatherCode;        // WMO weather code (0-99)
     bool isDay;                 // Day/night indicator
-    unsigned long timestamp;    // When this data was fetched
+    uint32_t timestamp;         // When this data was fetched (millis)
+
+    float temperature() const { return temperatureTenths / 10.0f; }   // °C
+    float windSpeed() const { return windSpeedTenths / 10.0f; }       // km/h
+    WeatherCondition condition() const { return weatherCodeToCondition(weatherCode); }
 };
 
 /**
  * Single day forecast
+ * Values are packed fixed-point in canonical metric units (°C).
  */
 struct ForecastDay {
-    float tempMax;              // Maximum temperature
-    float tempMin;              // Minimum temperature
-    float precipitationSum;     // Total precipitation
-    float precipitationProb;    // Precipitation probability (%)
-    float windSpeedMax;         // Maximum wind speed
-    int weatherCode;            // WMO weather code
-    WeatherCondition condition; // Simplified condition category
-    char dayName[4];            // Short day name (Mon, Tue, etc.)
+    int16_t tempMaxTenths;      // Maximum temperature, tenths of °C
+    int16_t tempMinTenths;      // Minimum temperature, tenths of °C
+    int16_t displayMax;         // Whole degrees in the display unit
+    int16_t displayMin;         // Whole degrees in the display unit
+    uint8_t precipitationProb;  // Precipitation probability (%)
+    uint8_t weatherCode;        // WMO weather code (0-99)
+    uint8_t dayOfWeek;          // 0 = Sunday .. 6 = Saturday
+
+    float tempMax() const { return tempMaxTenths / 10.0f; }   // °C
+    float tempMin() const { return tempMinTenths / 10.0f; }   // °C
+    WeatherCondition condition() const { return weatherCodeToCondition(weatherCode); }
+    const char* dayName() const { return dayOfWeekToString(dayOfWeek); }
 };
 
 /**
@@ -203,25 +274,84 @@ struct WeatherData {
     char locationName[32];      // City/location name
     float latitude;
     float longitude;
-    char timezone[32];          // Timezone string
-    int utcOffsetSeconds;       // UTC offset in seconds (for NTP)
+    char timezone[8];           // Timezone abbreviation (EST, CEST, GMT+2...)
+    int32_t utcOffsetSeconds;   // UTC offset in seconds (for NTP)
 
     // Current conditions
     CurrentWeather current;
 
-    // 7-day forecast
+    // Daily forecast
     ForecastDay forecast[WEATHER_FORECAST_DAYS];
-    int forecastDays;           // Number of valid forecast days
+    uint8_t forecastDays;       // Number of valid forecast days
+
+    // Status
+    bool valid;                 // Is this data valid?
+    bool stale;                 // Restored from flash snapshot, not yet refreshed
+    uint8_t errorCount;         // Consecutive error count
+    uint8_t lastError;          // Last WeatherError (WEATHER_ERR_NONE if ok)
+    uint16_t httpStatus;        // Status behind a WEATHER_ERR_HTTP lastError, else 0
 
     // Sunrise/sunset times (minutes since midnight for precise night mode)
     uint16_t sunriseMinutes;    // Minutes since midnight (0-1439)
     uint16_t sunsetMinutes;     // Minutes since midnight (0-1439)
 
-    // Status
-    bool valid;                 // Is this data valid?
-    unsigned long lastUpdate;   // Last successful update time
-    int errorCount;             // Consecutive error count
-    char lastError[64];         // Last error message
+    uint32_t fetchEpoch;        // NTP time of the fetch (0 = clock not set)
+    uint32_t lastUpdate;        // Last successful update time (millis)
+};
+
+/**
+ * Diagnostics for the most recent weather fetch
+ */
+struct WeatherFetchStats {
+    // Most recent HTTP request
+    uint32_t bytes;             // Response body bytes received
+    uint32_t durationMs;        // Request start to parse complete
+    uint32_t heapBefore;        // Free heap when the fetch started
+    uint32_t peakHeapUsed;      // Largest drop in free heap during the fetch
+    uint8_t locations;          // Locations covered by the request
+    uint16_t httpStatus;        // Status of the most recent response (0 = none)
+    bool flatbuffers;           // true = FlatBuffers response, false = JSON
+    uint32_t parseUs;           // Time spent decoding the body (excludes network)
+    uint32_t dnsMs;             // DNS lookup (0 = cached or connection reused)
+    uint32_t connectMs;         // TCP connect (0 = kept-alive connection reused)
+    uint32_t ttfbMs;            // Request sent to first response byte
+    bool dnsCached;             // Address came from the DNS cache
+    bool reused;                // Sent on a kept-alive connection
+
+    // Most recent full refresh (all locations)
+    uint32_t refreshMs;         // Wall time for the whole refresh
+    uint32_t refreshNetworkMs;  // Time spent inside HTTP requests (radio busy)
+    uint8_t refreshRequests;    // HTTP round trips used
+};
+
+/**
+ * Fetch engine states - a refresh steps through these from loop()
+ */
+enum WeatherFetchState {
+    FETCH_IDLE = 0,
+    FETCH_RESOLVE,      // Waiting on asynchronous DNS
+    FETCH_CONNECT,      // Opening the TCP connection
+    FETCH_SEND,         // Writing the request as the socket has room
+    FETCH_HEADERS,      // Reading response headers
+    FETCH_BODY,         // Reading the next chunk of body
+    FETCH_PARSE,        // Feeding that chunk to the streaming parser
+    FETCH_COMMIT,       // Publishing parsed results
+    FETCH_STATE_COUNT
+};
+
+/**
+ * Fetch engine timing - how long the engine held up loop()
+ */
+struct WeatherEngineStats {
+    uint8_t state;                          // Current WeatherFetchState
+    bool lastRefreshOk;                     // Every location of the last refresh updated
+    uint32_t slices;                        // updateWeather() calls that did engine work
+    uint32_t lastSliceUs;                   // Duration of the most recent slice
+    uint32_t maxSliceUs;                    // Longest slice since boot
+    uint32_t stateMaxUs[FETCH_STATE_COUNT]; // Longest single step in each state
+    uint32_t blockingSlices;                // Slices that waited on a TLS connect
+    uint32_t lastBlockingUs;                // Time the latest of them waited (not in slice timing)
+    uint32_t maxBlockingUs;                 // Longest such wait since boot
 };
 
 /**
@@ -232,6 +362,10 @@ struct WeatherLocation {
     float latitude;
     float longitude;
     bool enabled;               // Is this location active?
+
+    // Refresh schedule (runtime only, not saved)
+    unsigned long nextDue;      // millis() when the next fetch is due (0 = now)
+    uint8_t forecastDays;       // Forecast days asked for by the last fetch
 };
 
 // =============================================================================
@@ -245,26 +379,49 @@ struct WeatherLocation {
 void initWeather();
 
 /**
- * Update weather data if needed (checks interval)
- * Call in loop() - handles timing internally
- * Returns true if an update was performed
+ * Advance the weather fetch engine; starts a refresh when one is due
+ * Call in loop() - does at most WEATHER_SLICE_BUDGET_US of work per call
+ * Returns true while a refresh is in progress
  */
 bool updateWeather();
 
 /**
- * Force immediate weather update for all locations
- * Returns true if update was successful
+ * Ask for a refresh of all locations on the next updateWeather() call
+ * Returns immediately - use when loop() must keep running (web handlers)
+ */
+void requestWeatherUpdate();
+
+/**
+ * Refresh all locations now, blocking until done
+ * Returns true if every location updated
  */
 bool forceWeatherUpdate();
 
 /**
- * Fetch weather for a specific location
- * @param lat Latitude
- * @param lon Longitude
- * @param data Output weather data structure
- * @return true on success
+ * Check if a refresh is in progress
+ */
+bool isWeatherUpdating();
+
+/**
+ * Check if any location has weather restored from the flash snapshot
+ * Valid right after initWeather(), before the first fetch
  */
-bool fetchWeather(float lat, float lon, WeatherData& data);
+bool hasCachedWeather();
+
+/**
+ * Get diagnostics (size, duration, peak heap) for the most recent fetch
+ */
+const WeatherFetchStats& getWeatherFetchStats();
+
+/**
+ * Get fetch engine state and per-slice timing
+ */
+const WeatherEngineStats& getWeatherEngineStats();
+
+/**
+ * Get printable name for a WeatherFetchState
+ */
+const char* weatherFetchStateName(uint8_t state);
 
 // =============================================================================
 // MULTI-LOCATION API (NEW)
@@ -353,6 +510,16 @@ bool isSecondaryLocationEnabled();
  */
 unsigned long getNextUpdateIn();
 
+/**
+ * Get time until a location's next scheduled fetch (milliseconds)
+ */
+unsigned long getLocationNextUpdateIn(int index);
+
+/**
+ * Get the retry delay a location is backing off by (milliseconds, 0 = healthy)
+ */
+uint32_t getLocationRetryDelay(int index);
+
 /**
  * Set temperature unit (true = Celsius, false = Fahrenheit)
  */
@@ -364,9 +531,30 @@ void setUseCelsius(bool celsius);
 bool getUseCelsius();
 
 /**
- * Convert WMO weather code to simplified condition
+ * Convert a canonical temperature (tenths of °C) to whole display degrees
  */
-WeatherCondition weatherCodeToCondition(int code);
+int16_t toDisplayTemperature(int16_t tenthsC);
+
+/**
+ * Convert a canonical temperature (tenths of °C) to the display unit
+ */
+float toDisplayTemperatureExact(int16_t tenthsC);
+
+/**
+ * Convert a canonical wind speed (tenths of km/h) to the display unit
+ */
+float toDisplayWindSpeed(uint16_t tenthsKmh);
+
+/**
+ * Get wind speed unit label ("km/h" or "mph") for the display unit
+ */
+const char* windSpeedUnit();
+
+/**
+ * Check if a location slot already holds this name and coordinates
+ * Lets callers skip re-adding (and refetching) unchanged locations.
+ */
+bool isSameLocation(int index, const char* name, float lat, float lon);
 
 /**
  * Get human-readable condition string
@@ -394,9 +582,10 @@ bool saveWeatherConfig();
 bool loadWeatherConfig();
 
 /**
- * Get weather data as JSON for API response
+ * Write weather data for an API response
+ * Writes members into the JSON object currently open on json.
  */
-void weatherToJson(const WeatherData& data, JsonDocument& doc);
+void weatherToJson(const WeatherData& data, JsonStream& json);
 
 // =============================================================================
 // DISPLAY SETTINGS
@@ -588,6 +777,13 @@ bool updateCustomScreenConfig(uint8_t index, const char* header, const char* bod
  */
 bool removeCustomScreenConfig(uint8_t index);
 
+/**
+ * Change counter for the custom screens
+ * Bumped by add, update, remove and config load, so cached layouts can tell
+ * when the text under them changed.
+ */
+uint32_t getCustomScreenGeneration();
+
 // =============================================================================
 // YOUTUBE STATS
 // =============================================================================
@@ -676,7 +872,7 @@ int addImageScreenConfig(const char* filename, const char* header = "");
 bool updateImageScreenHeader(uint8_t index, const char* header);
 
 /**
- * Remove image screen by index (also deletes file)
+ * Remove image screen by index (also deletes the file and its decoded copy)
  */
 bool removeImageScreenConfig(uint8_t index);
 
@@ -685,4 +881,43 @@ bool removeImageScreenConfig(uint8_t index);
  */
 bool validateImageFile(const char* filename);
 
+/**
+ * Read a JPEG's pixel size from its SOF (start of frame) marker
+ * @param progressive Set if the frame is progressive (the decoder can't show it)
+ * @return false if the file isn't a JPEG or has no SOF before the image data
+ */
+bool getJpegInfo(const char* filename, uint16_t* width, uint16_t* height, bool* progressive);
+
+/**
+ * Path of the decoded RGB565 copy kept next to an uploaded image
+ * e.g., "/images/image_0.jpg" -> "/images/image_0.565"
+ */
+void getImageRawPath(const char* filename, char* path, size_t len);
+
+// =============================================================================
+// CONTENT GENERATIONS
+// =============================================================================
+
+/**
+ * Content the web API tags with ETags
+ */
+enum ContentType : uint8_t {
+    CONTENT_WEATHER = 0,    // Fetched weather and fetch outcomes
+    CONTENT_CONFIG,         // Settings, locations, carousel, screens and images
+    CONTENT_THEMES,         // Theme selection, mode and custom colors
+    CONTENT_YOUTUBE,        // YouTube settings and stats
+    CONTENT_TYPE_COUNT
+};
+
+/**
+ * Generation of a kind of content - changes whenever the content does
+ * Restarts from 0 on every boot.
+ */
+uint32_t getContentGeneration(uint8_t type);
+
+/**
+ * Mark a kind of content changed
+ */
+void bumpContentGeneration(uint8_t type);
+
 #endif // WEATHER_H